@@ -667,12 +667,32 @@ ifneq ($(strip $(CUSTOM_MATRIX)), yes)
     endif
 endif
 
+MATRIX_WAKEUP_ENABLE ?= no
+ifeq ($(strip $(MATRIX_WAKEUP_ENABLE)), yes)
+    ifeq ($(strip $(SPLIT_KEYBOARD)), yes)
+        $(call CATASTROPHIC_ERROR,Invalid MATRIX_WAKEUP_ENABLE,MATRIX_WAKEUP_ENABLE is not supported on split keyboards)
+    endif
+    OPT_DEFS += -DMATRIX_WAKEUP_ENABLE
+    SRC += $(PLATFORM_PATH)/$(PLATFORM_KEY)/gpio_wakeup.c
+endif
+
 # Debounce Modules. Set DEBOUNCE_TYPE=custom if including one manually.
 DEBOUNCE_TYPE ?= sym_defer_g
 ifneq ($(strip $(DEBOUNCE_TYPE)), custom)
     QUANTUM_SRC += $(QUANTUM_DIR)/debounce/$(strip $(DEBOUNCE_TYPE)).c
 endif
 
+DEBOUNCE_PER_KEY_TYPES := sym_defer_pk sym_eager_pk asym_eager_defer_pk
+
+DEBOUNCE_PER_KEY_ENABLE ?= no
+ifeq ($(strip $(DEBOUNCE_PER_KEY_ENABLE)), yes)
+    ifeq ($(filter $(strip $(DEBOUNCE_TYPE)),$(DEBOUNCE_PER_KEY_TYPES)),)
+        $(call CATASTROPHIC_ERROR,Invalid DEBOUNCE_TYPE,DEBOUNCE_PER_KEY_ENABLE requires DEBOUNCE_TYPE to be one of $(DEBOUNCE_PER_KEY_TYPES))
+    endif
+    OPT_DEFS += -DDEBOUNCE_PER_KEY_ENABLE
+    QUANTUM_SRC += $(QUANTUM_DIR)/debounce_per_key.c
+endif
+
 
 VALID_SERIAL_DRIVER_TYPES := bitbang usart vendor
 
@@ -945,6 +965,12 @@ ifeq ($(strip $(DIP_SWITCH_ENABLE)), yes)
     endif
 endif
 
+ifeq ($(strip $(LEADER_ENABLE)), yes)
+    ifeq ($(strip $(LEADER_SEQUENCES_ENABLE)), yes)
+        OPT_DEFS += -DLEADER_SEQUENCES_ENABLE
+    endif
+endif
+
 ifeq ($(strip $(BATTERY_ENABLE)), yes)
     BATTERY_DRIVER_REQUIRED := yes
 endif
@@ -1030,3 +1056,15 @@ ifeq ($(strip $(UART_DRIVER_REQUIRED)), yes)
         QUANTUM_LIB_SRC += uart.c
     endif
 endif
+
+ifeq ($(strip $(SCAN_STATS_ENABLE)), yes)
+    HISTOGRAM_REQUIRED := yes
+endif
+
+ifeq ($(strip $(LATENCY_TRACE_ENABLE)), yes)
+    HISTOGRAM_REQUIRED := yes
+endif
+
+ifeq ($(strip $(HISTOGRAM_REQUIRED)), yes)
+    QUANTUM_SRC += $(QUANTUM_DIR)/histogram.c
+endif
@@ -37,22 +37,27 @@ GENERIC_FEATURES = \
     GRAVE_ESC \
     HAPTIC \
     KEYCODE_STRING \
+    KEY_EVENT_QUEUE \
     KEY_LOCK \
     KEY_OVERRIDE \
+    LATENCY_TRACE \
     LAYER_LOCK \
     LEADER \
     MAGIC \
     MOUSEKEY \
     MUSIC \
     OS_DETECTION \
+    PROFILER \
     PROGRAMMABLE_BUTTON \
     REPEAT_KEY \
+    SCAN_STATS \
     SECURE \
     SEND_STRING \
     SEQUENCER \
     SPACE_CADET \
     SWAP_HANDS \
     TAP_DANCE \
+    TAPPING_STATS \
     TRI_LAYER \
     VIA \
     VIRTSER \
@@ -13,7 +13,7 @@
 # limitations under the License.
 """Python program to make autocorrect_data.h.
 This program reads from a prepared dictionary file and generates a C source file
-"autocorrect_data.h" with a serialized trie embedded as an array. Run this
+"autocorrect_data.h" with a serialized word graph embedded as an array. Run this
 program and pass it as the first argument like:
 $ qmk generate-autocorrect-data autocorrect_dict.txt
 Each line of the dict file defines one typo and its correction with the syntax
@@ -178,19 +178,7 @@ def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any])
     # Traverse trie in depth first order.
     def traverse(trie_node):
         if 'LEAF' in trie_node:  # Handle a leaf trie node.
-            typo, correction = trie_node['LEAF']
-            word_boundary_ending = typo[-1] == ':'
-            typo = typo.strip(':')
-            i = 0  # Make the autocorrection data for this entry and serialize it.
-            while i < min(len(typo), len(correction)) and typo[i] == correction[i]:
-                i += 1
-            backspaces = len(typo) - i - 1 + word_boundary_ending
-            assert 0 <= backspaces <= 63
-            correction = correction[i:]
-            bs_count = [backspaces + 128]
-            data = bs_count + list(bytes(correction, 'ascii')) + [0]
-
-            entry = {'data': data, 'links': [], 'byte_offset': 0}
+            entry = {'data': leaf_data(*trie_node['LEAF']), 'links': [], 'byte_offset': 0}
             table.append(entry)
         elif len(trie_node) == 1:  # Handle trie node with a single child.
             c, trie_node = next(iter(trie_node.items()))
@@ -232,6 +220,141 @@ def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any])
     return [b for e in table for b in serialize(e)]  # Serialize final table.
 
 
+def leaf_data(typo: str, correction: str) -> List[int]:
+    """Makes the data of a leaf, the backspaces to type and the correction."""
+    word_boundary_ending = typo[-1] == ':'
+    typo = typo.strip(':')
+    i = 0
+    while i < min(len(typo), len(correction)) and typo[i] == correction[i]:
+        i += 1
+    backspaces = len(typo) - i - 1 + word_boundary_ending
+    assert 0 <= backspaces <= 63
+    return [backspaces + 128] + list(bytes(correction[i:], 'ascii')) + [0]
+
+
+def make_dawg(trie: Dict[str, Any]) -> Dict[str, Any]:
+    """Makes a directed acyclic word graph from the trie, by merging its identical subtries.
+  Args:
+    trie: Dict of dicts, from make_trie().
+  Returns:
+    The root node. Leaf nodes have 'data', the other nodes have 'children', a
+    list of (keycode, node) sorted by keycode.
+  """
+    nodes = {}
+
+    def merge(trie_node):
+        if 'LEAF' in trie_node:
+            if len(trie_node) > 1:
+                cli.log.error('{fg_red}Error:{fg_reset} Typo "{fg_cyan}%s{fg_reset}" is the end of another typo.', trie_node['LEAF'][0])
+                maybe_exit(1)
+            key = ('LEAF', tuple(leaf_data(*trie_node['LEAF'])))
+            return nodes.setdefault(key, {'data': list(key[1]), 'children': []})
+        children = sorted((TYPO_CHARS[c], merge(child)) for c, child in trie_node.items())
+        key = tuple((keycode, id(child)) for keycode, child in children)
+        return nodes.setdefault(key, {'children': children})
+
+    return merge(trie)
+
+
+def serialize_dawg(root: Dict[str, Any]) -> List[int]:
+    """Serializes the word graph in a form readable by the C code.
+  Nodes are laid out after all the nodes that link to them, so every link is a
+  forward offset, stored in as few bytes as the node needs. A node with a single
+  child is followed by that child when possible, which then needs no link at all.
+  The links of a node with multiple children all have the same width, so that the
+  C code can step through them without decoding each one.
+  Args:
+    root: The root node, from make_dawg().
+  Returns:
+    List of ints in the range 0-255.
+  """
+    parents = {}
+
+    def count_parents(node):
+        for _, child in node['children']:
+            if id(child) not in parents:
+                parents[id(child)] = 0
+                count_parents(child)
+            parents[id(child)] += 1
+
+    count_parents(root)
+
+    # Topological order, continuing with a child of the last node whenever it is ready.
+    order = []
+    ready = [root]
+    while ready:
+        node = ready.pop()
+        while node is not None:
+            order.append(node)
+            next_node = None
+            for _, child in reversed(node['children']):
+                parents[id(child)] -= 1
+                if parents[id(child)] == 0:
+                    if next_node is not None:
+                        ready.append(next_node)
+                    next_node = child
+            node = next_node
+
+    # single children laid out right after their parent
+    follows = {id(node) for node, next_node in zip(order, order[1:]) if len(node['children']) == 1 and node['children'][0][1] is next_node}
+
+    def offset_width(offset):
+        assert 0 < offset < 1 << 24
+        return 1 if offset < 1 << 8 else 2 if offset < 1 << 16 else 3
+
+    def little_endian(offset, width):
+        return [(offset >> (8 * i)) & 255 for i in range(width)]
+
+    # Link widths depend on the node positions and the other way around, grow them until they fit.
+    widths = {id(node): 1 for node in order}
+    while True:
+        positions = {}
+        position = 0
+        for node in order:
+            positions[id(node)] = position
+            if 'data' in node:
+                position += len(node['data'])
+            elif id(node) in follows:
+                position += 1
+            elif len(node['children']) == 1:
+                position += 2 + widths[id(node)]
+            else:
+                position += 1 + len(node['children']) * (1 + widths[id(node)])
+
+        grown = False
+        for node in order:
+            if id(node) in follows:
+                continue
+            # a single child is linked from its jump byte, after the keycode
+            base = positions[id(node)] + (1 if len(node['children']) == 1 else 0)
+            for _, child in node['children']:
+                width = offset_width(positions[id(child)] - base)
+                if width > widths[id(node)]:
+                    widths[id(node)] = width
+                    grown = True
+        if not grown:
+            break
+
+    data = []
+    for node in order:
+        assert len(data) == positions[id(node)]
+        if 'data' in node:  # Leaf: backspaces | 128, then the correction.
+            data += node['data']
+        elif len(node['children']) == 1:  # Chain: the keycode, then a jump to the child unless it follows.
+            keycode, child = node['children'][0]
+            data.append(keycode)
+            if id(node) not in follows:
+                width = widths[id(node)]
+                data += [width] + little_endian(positions[id(child)] - positions[id(node)] - 1, width)
+        else:  # Branch: the child count | 64, then the keycode and link of each child.
+            width = widths[id(node)]
+            data.append(64 | len(node['children']))
+            for keycode, child in node['children']:
+                data += [width << 6 | keycode] + little_endian(positions[id(child)] - positions[id(node)], width)
+
+    return data
+
+
 def encode_link(link: Dict[str, Any]) -> List[int]:
     """Encodes a node link as two bytes."""
     byte_offset = link['byte_offset']
@@ -254,11 +377,15 @@ def to_hex(b: int) -> str:
 @cli.argument('-km', '--keymap', completer=keymap_completer, help='The keymap to build a firmware for. Ignored when a configurator export is supplied.')
 @cli.argument('-o', '--output', arg_only=True, type=normpath, help='File to write to')
 @cli.argument('-q', '--quiet', arg_only=True, action='store_true', help="Quiet mode, only output error messages")
+@cli.argument('-f', '--format', arg_only=True, choices=['dawg', 'trie'], default='dawg', help='The data format, the compact word graph (default) or the trie of older versions')
 @cli.subcommand('Generate the autocorrection data file from a dictionary file.')
 def generate_autocorrect_data(cli):
     autocorrections = parse_file(cli.args.filename)
     trie = make_trie(autocorrections)
-    data = serialize_trie(autocorrections, trie)
+    if cli.args.format == 'dawg':
+        data = serialize_dawg(make_dawg(trie))
+    else:
+        data = serialize_trie(autocorrections, trie)
 
     current_keyboard = cli.args.keyboard or cli.config.user.keyboard or cli.config.generate_autocorrect_data.keyboard
     current_keymap = cli.args.keymap or cli.config.user.keymap or cli.config.generate_autocorrect_data.keymap
@@ -282,6 +409,8 @@ def generate_autocorrect_data(cli):
     autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MIN_LENGTH {len(min_typo)} // "{min_typo}"')
     autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MAX_LENGTH {len(max_typo)} // "{max_typo}"')
     autocorrect_data_h_lines.append(f'#define DICTIONARY_SIZE {len(data)}')
+    if cli.args.format == 'dawg':
+        autocorrect_data_h_lines.append('#define AUTOCORRECT_DATA_DAWG')
     autocorrect_data_h_lines.append('')
     autocorrect_data_h_lines.append('static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {')
     autocorrect_data_h_lines.append(textwrap.fill('    %s' % (', '.join(map(to_hex, data))), width=100, subsequent_indent='    '))
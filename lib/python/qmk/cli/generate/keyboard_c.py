@@ -132,6 +132,49 @@ def _gen_joystick_axes(info_data):
     return lines
 
 
+def _gen_debounce_per_key(info_data):
+    """Convert info.json content to debounce_per_key_defaults
+    """
+    cols = info_data['matrix_size']['cols']
+    rows = info_data['matrix_size']['rows']
+
+    # Class 0 is DEBOUNCE, so that a keymap can still change it, every time set on a key gets its own class
+    times = ['DEBOUNCE']
+    classes = [[0] * cols for _ in range(rows)]
+
+    # Mirror layout macros squashed on top of each other
+    for layout_name, layout_data in info_data['layouts'].items():
+        for key_data in layout_data['layout']:
+            if 'debounce' not in key_data:
+                continue
+            row, col = key_data['matrix']
+            if row >= rows or col >= cols:
+                cli.log.error(f'Skipping debounce_per_key_defaults due to {layout_name} containing invalid matrix values')
+                return []
+            if key_data['debounce'] not in times:
+                times.append(key_data['debounce'])
+            classes[row][col] = times.index(key_data['debounce'])
+
+    if len(times) > 16:
+        cli.log.error(f'Skipping debounce_per_key_defaults, {len(times)} distinct debounce times is more than the 16 supported')
+        return []
+
+    lines = []
+    lines.append('#ifdef DEBOUNCE_PER_KEY_ENABLE')
+    lines.append('__attribute__((weak)) const debounce_per_key_table_t debounce_per_key_defaults PROGMEM = {')
+    lines.append(f'    .times = {{ {", ".join(str(time) for time in times)} }},')
+    lines.append('    .classes = {')
+    for row in classes:
+        packed = [row[col] | ((row[col + 1] if col + 1 < cols else 0) << 4) for col in range(0, cols, 2)]
+        lines.append(f'        {{ {", ".join(f"0x{byte:02X}" for byte in packed)} }},')
+    lines.append('    },')
+    lines.append('};')
+    lines.append('#endif')
+    lines.append('')
+
+    return lines
+
+
 @dataclasses.dataclass
 class LayoutKey:
     """Geometric info for one key in a layout."""
@@ -267,6 +310,7 @@ def generate_keyboard_c(cli):
 
     keyboard_c_lines.extend(_gen_led_configs(kb_info_json))
     keyboard_c_lines.extend(_gen_matrix_mask(kb_info_json))
+    keyboard_c_lines.extend(_gen_debounce_per_key(kb_info_json))
     keyboard_c_lines.extend(_gen_joystick_axes(kb_info_json))
     keyboard_c_lines.extend(_gen_chordal_hold_layout(kb_info_json))
 
@@ -0,0 +1,17 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gpio_wakeup.h"
+
+// Pin change interrupts are grouped per port on AVR, so the matrix keeps being polled.
+bool gpio_wakeup_enable_pin(pin_t pin) {
+    return false;
+}
+
+void gpio_wakeup_disable_pin(pin_t pin) {}
+
+bool gpio_wakeup_pending(void) {
+    return true;
+}
+
+void gpio_wakeup_clear(void) {}
@@ -0,0 +1,53 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gpio_wakeup.h"
+
+#if PAL_USE_CALLBACKS != TRUE
+#    error "MATRIX_WAKEUP_ENABLE requires PAL_USE_CALLBACKS set to TRUE in halconf.h"
+#endif
+
+static volatile bool wakeup_pending = false;
+
+// On STM32 and alike, the ports share one edge interrupt per pad number, so
+// only one of the pins with the same pad number can be armed at a time
+static uint32_t armed_pads = 0;
+static pin_t    armed_pins[32];
+
+static void gpio_wakeup_callback(void *arg) {
+    wakeup_pending = true;
+}
+
+bool gpio_wakeup_enable_pin(pin_t pin) {
+    uint32_t pad = PAL_PAD(pin);
+
+    if (armed_pads & (1UL << pad)) {
+        return false;
+    }
+    armed_pads |= 1UL << pad;
+    armed_pins[pad] = pin;
+
+    palEnableLineEvent(pin, PAL_EVENT_MODE_BOTH_EDGES);
+    palSetLineCallback(pin, gpio_wakeup_callback, NULL);
+    return true;
+}
+
+void gpio_wakeup_disable_pin(pin_t pin) {
+    uint32_t pad = PAL_PAD(pin);
+
+    // leave alone the pin of another port which has the same pad number
+    if (!(armed_pads & (1UL << pad)) || armed_pins[pad] != pin) {
+        return;
+    }
+    armed_pads &= ~(1UL << pad);
+
+    palDisableLineEvent(pin);
+}
+
+bool gpio_wakeup_pending(void) {
+    return wakeup_pending;
+}
+
+void gpio_wakeup_clear(void) {
+    wakeup_pending = false;
+}
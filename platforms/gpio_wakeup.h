@@ -0,0 +1,29 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <gpio.h> // through the include path, so that the platform gpio.h is found as well
+
+/** \brief Enable an edge interrupt on an input pin
+ *
+ * \return false if the platform can't wake up from this pin
+ */
+bool gpio_wakeup_enable_pin(pin_t pin);
+
+/** \brief Disable the edge interrupt on an input pin
+ */
+void gpio_wakeup_disable_pin(pin_t pin);
+
+/** \brief Whether any enabled pin has seen an edge since the last gpio_wakeup_clear
+ */
+bool gpio_wakeup_pending(void);
+
+/** \brief Forget any edges seen so far
+ */
+void gpio_wakeup_clear(void);
+
+#if __has_include("_gpio_wakeup.h")
+#    include "_gpio_wakeup.h" /* Include the platforms gpio_wakeup.h */
+#endif
@@ -0,0 +1,24 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** \brief Simulate an edge on an input pin, as if the line changed level
+ */
+void gpio_wakeup_simulate_edge(pin_t pin);
+
+/** \brief Whether the edge interrupt of a pin is currently enabled
+ */
+bool gpio_wakeup_is_pin_enabled(pin_t pin);
+
+/** \brief Make the edge interrupt of a pin fail to enable, as if it was shared with an armed pin
+ */
+void gpio_wakeup_set_pin_unsupported(pin_t pin, bool unsupported);
+
+#ifdef __cplusplus
+}
+#endif
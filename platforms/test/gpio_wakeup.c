@@ -0,0 +1,42 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gpio_wakeup.h"
+
+static bool wakeup_enabled[(pin_t)~0 + 1]     = {false};
+static bool wakeup_unsupported[(pin_t)~0 + 1] = {false};
+static bool wakeup_pending                    = false;
+
+bool gpio_wakeup_enable_pin(pin_t pin) {
+    if (wakeup_unsupported[pin]) {
+        return false;
+    }
+    wakeup_enabled[pin] = true;
+    return true;
+}
+
+void gpio_wakeup_disable_pin(pin_t pin) {
+    wakeup_enabled[pin] = false;
+}
+
+bool gpio_wakeup_pending(void) {
+    return wakeup_pending;
+}
+
+void gpio_wakeup_clear(void) {
+    wakeup_pending = false;
+}
+
+void gpio_wakeup_simulate_edge(pin_t pin) {
+    if (wakeup_enabled[pin]) {
+        wakeup_pending = true;
+    }
+}
+
+bool gpio_wakeup_is_pin_enabled(pin_t pin) {
+    return wakeup_enabled[pin];
+}
+
+void gpio_wakeup_set_pin_unsupported(pin_t pin, bool unsupported) {
+    wakeup_unsupported[pin] = unsupported;
+}
@@ -60,6 +60,10 @@ uint32_t timer_read32(void) {
     return current_time;
 }
 
+uint32_t timer_read_us(void) {
+    return current_time * 1000;
+}
+
 void set_time(uint32_t t) {
     current_time   = t;
     access_counter = 0;
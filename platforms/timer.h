@@ -43,6 +43,9 @@ uint16_t timer_read(void);
 uint32_t timer_read32(void);
 uint16_t timer_elapsed(uint16_t last);
 uint32_t timer_elapsed32(uint32_t last);
+// Free-running microsecond timestamp, at the resolution of the platform timer. Only
+// meaningful for measuring short intervals with TIMER_DIFF_32().
+uint32_t timer_read_us(void);
 
 // Utility functions to check if a future time has expired & autmatically handle time wrapping if checked / reset frequently (half of max value)
 #define timer_expired(current, future) ((uint16_t)(current - future) < UINT16_MAX / 2)
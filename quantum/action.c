@@ -36,6 +36,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    include "backlight.h"
 #endif
 
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
+
 #ifdef POINTING_DEVICE_ENABLE
 #    include "pointing_device.h"
 #endif
@@ -77,6 +81,9 @@ __attribute__((weak)) bool get_retro_tapping(uint16_t keycode, keyrecord_t *reco
  */
 void action_exec(keyevent_t event) {
     if (IS_EVENT(event)) {
+#ifdef LATENCY_TRACE_ENABLE
+        latency_trace_event(&event);
+#endif
         ac_dprintf("\n---- action_exec: start -----\n");
         ac_dprintf("EVENT: ");
         debug_event(event);
@@ -278,9 +285,14 @@ void process_record_tap_hint(keyrecord_t *record) {
  * FIXME: Needs documentation.
  */
 void process_record(keyrecord_t *record) {
+    PROFILER_SCOPE("process_record");
+
     if (IS_NOEVENT(record->event)) {
         return;
     }
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_process(&record->event);
+#endif
 #ifdef FLOW_TAP_TERM
     flow_tap_update_last_event(record);
 #endif // FLOW_TAP_TERM
@@ -1,7 +1,9 @@
 #include <limits.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "keyboard.h"
+#include "matrix.h"
 #include "action.h"
 #include "encoder.h"
 #include "util.h"
@@ -57,10 +59,14 @@ static void default_layer_state_set(layer_state_t state) {
 
 /** \brief Default Layer Print
  *
- * Print out the hex value of the 32-bit default layer state, as well as the value of the highest bit.
+ * Print out the hex value of the default layer state, as well as the value of the highest bit.
  */
 void default_layer_debug(void) {
+#ifdef LAYER_STATE_64BIT
+    ac_dprintf("%08lX%08lX(%u)", (unsigned long)(default_layer_state >> 32), (unsigned long)(default_layer_state & 0xFFFFFFFF), get_highest_layer(default_layer_state));
+#else
     ac_dprintf("%08hX(%u)", default_layer_state, get_highest_layer(default_layer_state));
+#endif
 }
 
 /** \brief Default Layer Set
@@ -228,21 +234,154 @@ void layer_xor(layer_state_t state) {
 
 /** \brief Layer debug printing
  *
- * Print out the hex value of the 32-bit layer state, as well as the value of the highest bit.
+ * Print out the hex value of the layer state, as well as the value of the highest bit.
  */
 void layer_debug(void) {
+#    ifdef LAYER_STATE_64BIT
+    ac_dprintf("%08lX%08lX(%u)", (unsigned long)(layer_state >> 32), (unsigned long)(layer_state & 0xFFFFFFFF), get_highest_layer(layer_state));
+#    else
     ac_dprintf("%08hX(%u)", layer_state, get_highest_layer(layer_state));
+#    endif
+}
+#endif
+
+/** \brief Default layer state changed at module level
+ *
+ * Runs module code once per loop when the default layer state changed
+ */
+__attribute__((weak)) void default_layer_state_changed_modules(layer_state_t old_state, layer_state_t new_state) {}
+
+/** \brief Default layer state changed at user level
+ *
+ * Runs user code once per loop when the default layer state changed
+ */
+__attribute__((weak)) void default_layer_state_changed_user(layer_state_t old_state, layer_state_t new_state) {}
+
+/** \brief Default layer state changed at keyboard level
+ *
+ * Runs keyboard code once per loop when the default layer state changed
+ */
+__attribute__((weak)) void default_layer_state_changed_kb(layer_state_t old_state, layer_state_t new_state) {
+    default_layer_state_changed_user(old_state, new_state);
+}
+
+#ifndef NO_ACTION_LAYER
+/** \brief Layer state changed at module level
+ *
+ * Runs module code once per loop when the layer state changed
+ */
+__attribute__((weak)) void layer_state_changed_modules(layer_state_t old_state, layer_state_t new_state) {}
+
+/** \brief Layer state changed at user level
+ *
+ * Runs user code once per loop when the layer state changed
+ */
+__attribute__((weak)) void layer_state_changed_user(layer_state_t old_state, layer_state_t new_state) {}
+
+/** \brief Layer state changed at keyboard level
+ *
+ * Runs keyboard code once per loop when the layer state changed
+ */
+__attribute__((weak)) void layer_state_changed_kb(layer_state_t old_state, layer_state_t new_state) {
+    layer_state_changed_user(old_state, new_state);
 }
 #endif
 
+/** \brief Layer state notify task
+ *
+ * Delivers the net change of the default and keymap layer states since the
+ * previous call, so the layer changes of a whole loop, like a layer tapped on
+ * and off, cost the subscribers at most one call each. Changes that end where
+ * they started aren't delivered.
+ */
+void layer_state_notify_task(void) {
+    static layer_state_t notified_default_layer_state = 0;
+
+    if (default_layer_state != notified_default_layer_state) {
+        layer_state_t old_state      = notified_default_layer_state;
+        notified_default_layer_state = default_layer_state;
+        default_layer_state_changed_modules(old_state, default_layer_state);
+        default_layer_state_changed_kb(old_state, default_layer_state);
+    }
+
+#ifndef NO_ACTION_LAYER
+    static layer_state_t notified_layer_state = 0;
+
+    if (layer_state != notified_layer_state) {
+        layer_state_t old_state = notified_layer_state;
+        notified_layer_state    = layer_state;
+        layer_state_changed_modules(old_state, layer_state);
+        layer_state_changed_kb(old_state, layer_state);
+    }
+#endif
+}
+
 #if !defined(NO_ACTION_LAYER) && !defined(STRICT_LAYER_RELEASE)
+#    if defined(SOURCE_LAYERS_CACHE_PACKED) && MAX_LAYER_BITS <= 4
+/** \brief source layer cache
+ *
+ * Two keys per byte, one per nibble.
+ */
+
+uint8_t source_layers_cache[((MATRIX_ROWS * MATRIX_COLS) + 1) / 2] = {0};
+#        ifdef ENCODER_MAP_ENABLE
+uint8_t encoder_source_layers_cache[(NUM_ENCODERS + 1) / 2] = {0};
+#        endif // ENCODER_MAP_ENABLE
+
+/** \brief update source layers cache impl
+ *
+ * Updates the supplied cache when changing layers
+ */
+void update_source_layers_cache_impl(uint8_t layer, uint16_t entry_number, uint8_t cache[]) {
+    const uint8_t shift = (entry_number & 1) * 4;
+    cache[entry_number / 2] = (cache[entry_number / 2] & ~(0x0F << shift)) | (layer << shift);
+}
+
+/** \brief read source layers cache
+ *
+ * reads the cached keys stored when the layer was changed
+ */
+uint8_t read_source_layers_cache_impl(uint16_t entry_number, uint8_t cache[]) {
+    return (cache[entry_number / 2] >> ((entry_number & 1) * 4)) & 0x0F;
+}
+
+#    elif defined(SOURCE_LAYERS_CACHE_PACKED)
 /** \brief source layer cache
+ *
+ * One byte per key.
+ */
+
+uint8_t source_layers_cache[MATRIX_ROWS * MATRIX_COLS] = {0};
+#        ifdef ENCODER_MAP_ENABLE
+uint8_t encoder_source_layers_cache[NUM_ENCODERS] = {0};
+#        endif // ENCODER_MAP_ENABLE
+
+/** \brief update source layers cache impl
+ *
+ * Updates the supplied cache when changing layers
+ */
+void update_source_layers_cache_impl(uint8_t layer, uint16_t entry_number, uint8_t cache[]) {
+    cache[entry_number] = layer;
+}
+
+/** \brief read source layers cache
+ *
+ * reads the cached keys stored when the layer was changed
+ */
+uint8_t read_source_layers_cache_impl(uint16_t entry_number, uint8_t cache[]) {
+    return cache[entry_number];
+}
+
+#    else
+/** \brief source layer cache
+ *
+ * One bit per key in each of the MAX_LAYER_BITS planes.
  */
 
 uint8_t source_layers_cache[((MATRIX_ROWS * MATRIX_COLS) + (CHAR_BIT)-1) / (CHAR_BIT)][MAX_LAYER_BITS] = {{0}};
-#    ifdef ENCODER_MAP_ENABLE
+#        ifdef ENCODER_MAP_ENABLE
 uint8_t encoder_source_layers_cache[(NUM_ENCODERS + (CHAR_BIT)-1) / (CHAR_BIT)][MAX_LAYER_BITS] = {{0}};
-#    endif // ENCODER_MAP_ENABLE
+#        endif // ENCODER_MAP_ENABLE
 
 /** \brief update source layers cache impl
  *
@@ -271,6 +410,7 @@ uint8_t read_source_layers_cache_impl(uint16_t entry_number, uint8_t cache[][MAX
 
     return layer;
 }
+#    endif
 
 /** \brief update encoder source layers cache
  *
@@ -335,27 +475,89 @@ action_t store_or_get_action(bool pressed, keypos_t key) {
 #endif
 }
 
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_LOOKUP_CACHE)
+/* Resolved layer of each key for the layers in layer_cache_state, filled in as
+ * keys are looked up. When the active layers change, however layer_state or
+ * default_layer_state were written, only the keys the change can affect are
+ * resolved again.
+ */
+static uint8_t       layer_cache[MATRIX_ROWS][MATRIX_COLS];
+static matrix_row_t  layer_cache_valid[MATRIX_ROWS];
+static layer_state_t layer_cache_state;
+
+/** \brief Layer lookup cache invalidate
+ *
+ * Forgets the resolved layers, for when the keymap itself changes.
+ */
+void layer_cache_invalidate(void) {
+    memset(layer_cache_valid, 0, sizeof(layer_cache_valid));
+}
+
+/** \brief Layer lookup cache update
+ *
+ * Forgets the keys resolved to a layer that was turned off, or to a layer below
+ * one that was turned on. The other keys still resolve to the same layer: the
+ * layers turned off above theirs were transparent for them.
+ */
+static void layer_cache_update(layer_state_t layers) {
+    layer_state_t removed = layer_cache_state & ~layers;
+    layer_state_t added   = layers & ~layer_cache_state;
+    uint8_t       covered = added ? get_highest_layer(added) : 0; // keys on a layer below this one may now resolve to an added layer
+
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        matrix_row_t valid = layer_cache_valid[row];
+        for (uint8_t col = 0; valid; col++, valid >>= 1) {
+            uint8_t layer = layer_cache[row][col];
+            if ((valid & 1) && (layer < covered || (removed & ((layer_state_t)1 << layer)))) {
+                layer_cache_valid[row] &= ~((matrix_row_t)1 << col);
+            }
+        }
+    }
+    layer_cache_state = layers;
+}
+#endif
+
+#ifndef NO_ACTION_LAYER
+/** \brief Resolve layer
+ *
+ * Finds the topmost active layer where the key isn't transparent.
+ */
+static uint8_t resolve_layer(layer_state_t layers, keypos_t key) {
+    /* check top layer first, visiting only the active ones */
+    while (layers) {
+        uint8_t i = get_highest_layer(layers);
+        layers &= ~((layer_state_t)1 << i);
+        if (i < MAX_LAYER && action_for_key(i, key).code != ACTION_TRANSPARENT) {
+            return i;
+        }
+    }
+    /* fall back to layer 0 */
+    return 0;
+}
+#endif
+
 /** \brief Layer switch get layer
  *
  * Gets the layer based on key info
  */
 uint8_t layer_switch_get_layer(keypos_t key) {
 #ifndef NO_ACTION_LAYER
-    action_t action;
-    action.code = ACTION_TRANSPARENT;
-
     layer_state_t layers = layer_state | default_layer_state;
-    /* check top layer first */
-    for (int8_t i = MAX_LAYER - 1; i >= 0; i--) {
-        if (layers & ((layer_state_t)1 << i)) {
-            action = action_for_key(i, key);
-            if (action.code != ACTION_TRANSPARENT) {
-                return i;
-            }
+#    ifdef LAYER_LOOKUP_CACHE
+    if (key.row < MATRIX_ROWS && key.col < MATRIX_COLS) {
+        const matrix_row_t col_bit = (matrix_row_t)1 << key.col;
+
+        if (layers != layer_cache_state) {
+            layer_cache_update(layers);
+        }
+        if (!(layer_cache_valid[key.row] & col_bit)) {
+            layer_cache[key.row][key.col] = resolve_layer(layers, key);
+            layer_cache_valid[key.row] |= col_bit;
         }
+        return layer_cache[key.row][key.col];
     }
-    /* fall back to layer 0 */
-    return 0;
+#    endif
+    return resolve_layer(layers, key);
 #else
     return get_highest_layer(default_layer_state);
 #endif
@@ -35,14 +35,20 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #        ifndef LAYER_STATE_16BIT
 #            define LAYER_STATE_16BIT
 #        endif
-#    else
+#    elif DYNAMIC_KEYMAP_LAYER_COUNT <= 32
 #        ifndef LAYER_STATE_32BIT
 #            define LAYER_STATE_32BIT
 #        endif
+#    elif DYNAMIC_KEYMAP_LAYER_COUNT <= 64
+#        ifndef LAYER_STATE_64BIT
+#            define LAYER_STATE_64BIT
+#        endif
+#    else
+#        error DYNAMIC_KEYMAP_LAYER_COUNT must not exceed 64
 #    endif
 #endif
 
-#if !defined(LAYER_STATE_8BIT) && !defined(LAYER_STATE_16BIT) && !defined(LAYER_STATE_32BIT)
+#if !defined(LAYER_STATE_8BIT) && !defined(LAYER_STATE_16BIT) && !defined(LAYER_STATE_32BIT) && !defined(LAYER_STATE_64BIT)
 #    define LAYER_STATE_16BIT
 #endif
 
@@ -67,6 +73,13 @@ typedef uint32_t layer_state_t;
 #        define MAX_LAYER 32
 #    endif
 #    define get_highest_layer(state) biton32(state)
+#elif defined(LAYER_STATE_64BIT)
+typedef uint64_t layer_state_t;
+#    define MAX_LAYER_BITS 6
+#    ifndef MAX_LAYER
+#        define MAX_LAYER 64
+#    endif
+#    define get_highest_layer(state) biton64(state)
 #else
 #    error Layer Mask size not specified.  HOW?!
 #endif
@@ -82,6 +95,13 @@ __attribute__((weak)) layer_state_t default_layer_state_set_modules(layer_state_
 __attribute__((weak)) layer_state_t default_layer_state_set_kb(layer_state_t state);
 __attribute__((weak)) layer_state_t default_layer_state_set_user(layer_state_t state);
 
+void default_layer_state_changed_modules(layer_state_t old_state, layer_state_t new_state);
+void default_layer_state_changed_kb(layer_state_t old_state, layer_state_t new_state);
+void default_layer_state_changed_user(layer_state_t old_state, layer_state_t new_state);
+
+/** \brief Calls the *_changed_* hooks with the layer state changes since the previous call, once per loop. */
+void layer_state_notify_task(void);
+
 #ifndef NO_ACTION_LAYER
 /* bitwise operation */
 void default_layer_or(layer_state_t state);
@@ -116,6 +136,9 @@ void          layer_xor(layer_state_t state);
 layer_state_t layer_state_set_user(layer_state_t state);
 layer_state_t layer_state_set_kb(layer_state_t state);
 layer_state_t layer_state_set_modules(layer_state_t state);
+void          layer_state_changed_modules(layer_state_t old_state, layer_state_t new_state);
+void          layer_state_changed_kb(layer_state_t old_state, layer_state_t new_state);
+void          layer_state_changed_user(layer_state_t old_state, layer_state_t new_state);
 
 /**
  * @brief Applies the tri layer to global layer state. Not be used in layer_state_set_(kb|user) functions.
@@ -169,5 +192,12 @@ action_t store_or_get_action(bool pressed, keypos_t key);
 /* return the topmost non-transparent layer currently associated with key */
 uint8_t layer_switch_get_layer(keypos_t key);
 
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_LOOKUP_CACHE)
+/* forget the layers resolved by layer_switch_get_layer(), needed when the keymap changes */
+void layer_cache_invalidate(void);
+#else
+#    define layer_cache_invalidate()
+#endif
+
 /* return action depending on current layer status */
 action_t layer_switch_get_action(keypos_t key);
@@ -0,0 +1,36 @@
+SOURCE_LAYERS_CACHE_DEFS := -DMATRIX_ROWS=16 -DMATRIX_COLS=16 -DNO_DEBUG -DNO_PRINT
+
+SOURCE_LAYERS_CACHE_SRC := \
+    $(QUANTUM_PATH)/action_layer/tests/source_layers_cache_tests.cpp \
+    $(QUANTUM_PATH)/action_layer.c \
+    $(QUANTUM_PATH)/bitwise.c
+
+source_layers_cache_4_DEFS := $(SOURCE_LAYERS_CACHE_DEFS) -DLAYER_STATE_8BIT -DMAX_LAYER=4
+source_layers_cache_4_SRC := $(SOURCE_LAYERS_CACHE_SRC)
+
+source_layers_cache_8_DEFS := $(SOURCE_LAYERS_CACHE_DEFS) -DLAYER_STATE_8BIT -DMAX_LAYER=8
+source_layers_cache_8_SRC := $(SOURCE_LAYERS_CACHE_SRC)
+
+source_layers_cache_16_DEFS := $(SOURCE_LAYERS_CACHE_DEFS) -DLAYER_STATE_16BIT -DMAX_LAYER=16
+source_layers_cache_16_SRC := $(SOURCE_LAYERS_CACHE_SRC)
+
+source_layers_cache_32_DEFS := $(SOURCE_LAYERS_CACHE_DEFS) -DLAYER_STATE_32BIT -DMAX_LAYER=32
+source_layers_cache_32_SRC := $(SOURCE_LAYERS_CACHE_SRC)
+
+source_layers_cache_64_DEFS := $(SOURCE_LAYERS_CACHE_DEFS) -DLAYER_STATE_64BIT -DMAX_LAYER=64
+source_layers_cache_64_SRC := $(SOURCE_LAYERS_CACHE_SRC)
+
+source_layers_cache_packed_4_DEFS := $(SOURCE_LAYERS_CACHE_DEFS) -DLAYER_STATE_8BIT -DMAX_LAYER=4 -DSOURCE_LAYERS_CACHE_PACKED
+source_layers_cache_packed_4_SRC := $(SOURCE_LAYERS_CACHE_SRC)
+
+source_layers_cache_packed_8_DEFS := $(SOURCE_LAYERS_CACHE_DEFS) -DLAYER_STATE_8BIT -DMAX_LAYER=8 -DSOURCE_LAYERS_CACHE_PACKED
+source_layers_cache_packed_8_SRC := $(SOURCE_LAYERS_CACHE_SRC)
+
+source_layers_cache_packed_16_DEFS := $(SOURCE_LAYERS_CACHE_DEFS) -DLAYER_STATE_16BIT -DMAX_LAYER=16 -DSOURCE_LAYERS_CACHE_PACKED
+source_layers_cache_packed_16_SRC := $(SOURCE_LAYERS_CACHE_SRC)
+
+source_layers_cache_packed_32_DEFS := $(SOURCE_LAYERS_CACHE_DEFS) -DLAYER_STATE_32BIT -DMAX_LAYER=32 -DSOURCE_LAYERS_CACHE_PACKED
+source_layers_cache_packed_32_SRC := $(SOURCE_LAYERS_CACHE_SRC)
+
+source_layers_cache_packed_64_DEFS := $(SOURCE_LAYERS_CACHE_DEFS) -DLAYER_STATE_64BIT -DMAX_LAYER=64 -DSOURCE_LAYERS_CACHE_PACKED
+source_layers_cache_packed_64_SRC := $(SOURCE_LAYERS_CACHE_SRC)
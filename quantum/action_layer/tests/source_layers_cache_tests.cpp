@@ -0,0 +1,104 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <climits>
+#include <cstdio>
+#include <string>
+
+extern "C" {
+#include "action_layer.h"
+
+bool disable_action_cache = false;
+
+action_t action_for_key(uint8_t layer, keypos_t key) {
+    action_t action;
+    action.code = ACTION_TRANSPARENT;
+    return action;
+}
+}
+
+#define KEY_COUNT (MATRIX_ROWS * MATRIX_COLS)
+
+static keypos_t key_at(uint16_t index) {
+    keypos_t key;
+    key.row = index / MATRIX_COLS;
+    key.col = index % MATRIX_COLS;
+    return key;
+}
+
+// RAM used by the cache of the matrix, see action_layer.c
+static size_t cache_size(void) {
+#if defined(SOURCE_LAYERS_CACHE_PACKED) && MAX_LAYER_BITS <= 4
+    return (KEY_COUNT + 1) / 2;
+#elif defined(SOURCE_LAYERS_CACHE_PACKED)
+    return KEY_COUNT;
+#else
+    return (KEY_COUNT + CHAR_BIT - 1) / CHAR_BIT * MAX_LAYER_BITS;
+#endif
+}
+
+TEST(SourceLayersCache, StoresEveryLayer) {
+    for (uint16_t i = 0; i < KEY_COUNT; i++) {
+        update_source_layers_cache(key_at(i), i % MAX_LAYER);
+    }
+    for (uint16_t i = 0; i < KEY_COUNT; i++) {
+        EXPECT_EQ(read_source_layers_cache(key_at(i)), i % MAX_LAYER) << "key " << i;
+    }
+}
+
+TEST(SourceLayersCache, NeighboursAreKept) {
+    for (uint16_t i = 0; i < KEY_COUNT; i++) {
+        update_source_layers_cache(key_at(i), 0);
+    }
+    update_source_layers_cache(key_at(1), MAX_LAYER - 1);
+    update_source_layers_cache(key_at(2), MAX_LAYER / 2);
+
+    EXPECT_EQ(read_source_layers_cache(key_at(0)), 0);
+    EXPECT_EQ(read_source_layers_cache(key_at(1)), MAX_LAYER - 1);
+    EXPECT_EQ(read_source_layers_cache(key_at(2)), MAX_LAYER / 2);
+    EXPECT_EQ(read_source_layers_cache(key_at(3)), 0);
+
+    update_source_layers_cache(key_at(1), 0);
+    EXPECT_EQ(read_source_layers_cache(key_at(1)), 0);
+    EXPECT_EQ(read_source_layers_cache(key_at(2)), MAX_LAYER / 2);
+}
+
+TEST(SourceLayersCache, OutOfMatrixKeysAreIgnored) {
+    update_source_layers_cache(key_at(KEY_COUNT), MAX_LAYER - 1);
+    EXPECT_EQ(read_source_layers_cache(key_at(KEY_COUNT)), 0);
+}
+
+/* A press writes the cache and the matching release reads it back. */
+TEST(SourceLayersCache, Benchmark) {
+    const uint32_t rounds = 2000;
+    uint32_t       rng    = 0x12345678;
+    uint32_t       sum    = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t round = 0; round < rounds; round++) {
+        for (uint16_t i = 0; i < KEY_COUNT; i++) {
+            rng ^= rng << 13;
+            rng ^= rng >> 17;
+            rng ^= rng << 5;
+            update_source_layers_cache(key_at(i), rng % MAX_LAYER);
+        }
+        for (uint16_t i = 0; i < KEY_COUNT; i++) {
+            sum += read_source_layers_cache(key_at(i));
+        }
+    }
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+    double ns_per_lookup = elapsed.count() / ((double)rounds * KEY_COUNT);
+    RecordProperty("ns_per_update_and_read", std::to_string(ns_per_lookup));
+    RecordProperty("ram_bytes", std::to_string(cache_size()));
+    printf("%u layers, %s: %.2f ns per update and read, %u bytes for %u keys (checksum %u)\n", MAX_LAYER,
+#ifdef SOURCE_LAYERS_CACHE_PACKED
+           "packed",
+#else
+           "bit planes",
+#endif
+           ns_per_lookup, (unsigned)cache_size(), KEY_COUNT, (unsigned)sum);
+}
@@ -0,0 +1,11 @@
+TEST_LIST += \
+	source_layers_cache_4 \
+	source_layers_cache_8 \
+	source_layers_cache_16 \
+	source_layers_cache_32 \
+	source_layers_cache_64 \
+	source_layers_cache_packed_4 \
+	source_layers_cache_packed_8 \
+	source_layers_cache_packed_16 \
+	source_layers_cache_packed_32 \
+	source_layers_cache_packed_64
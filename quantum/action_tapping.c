@@ -5,10 +5,15 @@
 #include "action_layer.h"
 #include "action_tapping.h"
 #include "action_util.h"
+#include "compiler_support.h"
 #include "keycode.h"
 #include "quantum_keycodes.h"
 #include "timer.h"
 
+#ifdef TAPPING_STATS_ENABLE
+#    include "tapping_stats.h"
+#endif
+
 #ifndef NO_ACTION_TAPPING
 
 #    if defined(IGNORE_MOD_TAP_INTERRUPT_PER_KEY)
@@ -31,6 +36,12 @@ uint16_t g_tapping_term = TAPPING_TERM;
 
 #    ifdef TAPPING_TERM_PER_KEY
 __attribute__((weak)) uint16_t get_tapping_term(uint16_t keycode, keyrecord_t *record) {
+#        if defined(TAPPING_STATS_ENABLE) && defined(TAPPING_STATS_AUTO_TUNE)
+    uint16_t term = tapping_stats_get_term(keycode, record);
+    if (term != 0) {
+        return term;
+    }
+#        endif
 #        ifdef DYNAMIC_TAPPING_TERM_ENABLE
     return g_tapping_term;
 #        else
@@ -114,11 +125,33 @@ static keyrecord_t tapping_key                         = {};
 static keyrecord_t waiting_buffer[WAITING_BUFFER_SIZE] = {};
 static uint8_t     waiting_buffer_head                 = 0;
 static uint8_t     waiting_buffer_tail                 = 0;
+// Bit i is set when waiting_buffer[i] is a queued press, or a queued release
+static uint8_t waiting_buffer_presses  = 0;
+static uint8_t waiting_buffer_releases = 0;
+
+STATIC_ASSERT(WAITING_BUFFER_SIZE <= 8, "The waiting buffer masks only have 8 bits");
+
+/** Returns the index following `i` in the waiting buffer. */
+static inline uint8_t waiting_buffer_next(uint8_t i) {
+    return (i + 1) % WAITING_BUFFER_SIZE;
+}
+
+static inline bool waiting_buffer_is_empty(void) {
+    return waiting_buffer_tail == waiting_buffer_head;
+}
+
+/** Removes the oldest event from the waiting buffer. */
+static inline void waiting_buffer_pop(void) {
+    waiting_buffer_presses &= ~(1 << waiting_buffer_tail);
+    waiting_buffer_releases &= ~(1 << waiting_buffer_tail);
+    waiting_buffer_tail = waiting_buffer_next(waiting_buffer_tail);
+}
 
 static bool process_tapping(keyrecord_t *record);
 static bool waiting_buffer_enq(keyrecord_t record);
 static void waiting_buffer_clear(void);
-static bool waiting_buffer_typed(keyevent_t event);
+static uint8_t waiting_buffer_find(keypos_t key, bool pressed);
+static bool    waiting_buffer_typed(keyevent_t event);
 static bool waiting_buffer_has_anykey_pressed(void);
 static void waiting_buffer_scan_tap(void);
 static void debug_tapping_key(void);
@@ -129,6 +162,11 @@ static void debug_waiting_buffer(void);
  * FIXME: Needs doc
  */
 void action_tapping_process(keyrecord_t record) {
+#    ifdef TAPPING_STATS_ENABLE
+    if (IS_EVENT(record.event)) {
+        tapping_stats_event(&record);
+    }
+#    endif
     if (process_tapping(&record)) {
         if (IS_EVENT(record.event)) {
             ac_dprintf("processed: ");
@@ -146,10 +184,10 @@ void action_tapping_process(keyrecord_t record) {
     }
 
     // process waiting_buffer
-    if (IS_EVENT(record.event) && waiting_buffer_head != waiting_buffer_tail) {
+    if (IS_EVENT(record.event) && !waiting_buffer_is_empty()) {
         ac_dprintf("---- action_exec: process waiting_buffer -----\n");
     }
-    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
+    for (; !waiting_buffer_is_empty(); waiting_buffer_pop()) {
         if (process_tapping(&waiting_buffer[waiting_buffer_tail])) {
             ac_dprintf("processed: waiting_buffer[%u] =", waiting_buffer_tail);
             debug_record(waiting_buffer[waiting_buffer_tail]);
@@ -293,7 +331,7 @@ bool process_tapping(keyrecord_t *keyp) {
                     // Now that tapping_key has settled as tapped, check whether
                     // Flow Tap applies to following yet-unsettled keys.
                     uint16_t prev_time = tapping_key.event.time;
-                    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
+                    for (; !waiting_buffer_is_empty(); waiting_buffer_pop()) {
                         keyrecord_t *record = &waiting_buffer[waiting_buffer_tail];
                         if (!record->event.pressed) {
                             break;
@@ -353,7 +391,7 @@ bool process_tapping(keyrecord_t *keyp) {
                     uint8_t first_tap = waiting_buffer_find_chordal_hold_tap();
                     ac_dprintf("first_tap = %u\n", first_tap);
                     if (first_tap < WAITING_BUFFER_SIZE) {
-                        for (; waiting_buffer_tail != first_tap; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
+                        for (; waiting_buffer_tail != first_tap; waiting_buffer_pop()) {
                             ac_dprintf("Processing [%u]\n", waiting_buffer_tail);
                             process_record(&waiting_buffer[waiting_buffer_tail]);
                         }
@@ -450,10 +488,9 @@ bool process_tapping(keyrecord_t *keyp) {
                             process_record(&tapping_key);
 
 #    if defined(CHORDAL_HOLD)
-                            if (waiting_buffer_tail != waiting_buffer_head && is_tap_record(&waiting_buffer[waiting_buffer_tail])) {
+                            if (!waiting_buffer_is_empty() && is_tap_record(&waiting_buffer[waiting_buffer_tail])) {
                                 tapping_key = waiting_buffer[waiting_buffer_tail];
-                                // Pop tail from the queue.
-                                waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE;
+                                waiting_buffer_pop();
                                 debug_waiting_buffer();
                             } else
 #    endif // CHORDAL_HOLD
@@ -629,13 +666,18 @@ bool waiting_buffer_enq(keyrecord_t record) {
         return true;
     }
 
-    if ((waiting_buffer_head + 1) % WAITING_BUFFER_SIZE == waiting_buffer_tail) {
+    if (waiting_buffer_next(waiting_buffer_head) == waiting_buffer_tail) {
         ac_dprintf("waiting_buffer_enq: Over flow.\n");
         return false;
     }
 
     waiting_buffer[waiting_buffer_head] = record;
-    waiting_buffer_head                 = (waiting_buffer_head + 1) % WAITING_BUFFER_SIZE;
+    if (record.event.pressed) {
+        waiting_buffer_presses |= 1 << waiting_buffer_head;
+    } else {
+        waiting_buffer_releases |= 1 << waiting_buffer_head;
+    }
+    waiting_buffer_head = waiting_buffer_next(waiting_buffer_head);
 
     ac_dprintf("waiting_buffer_enq: ");
     debug_waiting_buffer();
@@ -647,8 +689,30 @@ bool waiting_buffer_enq(keyrecord_t record) {
  * FIXME: Needs docs
  */
 void waiting_buffer_clear(void) {
-    waiting_buffer_head = 0;
-    waiting_buffer_tail = 0;
+    waiting_buffer_head     = 0;
+    waiting_buffer_tail     = 0;
+    waiting_buffer_presses  = 0;
+    waiting_buffer_releases = 0;
+}
+
+/** \brief Finds the oldest press or release of `key` in the waiting buffer
+ *
+ * Only the queued events in the same direction are compared.
+ *
+ * \return Index of the event, or WAITING_BUFFER_SIZE if there is none.
+ */
+uint8_t waiting_buffer_find(keypos_t key, bool pressed) {
+    uint8_t candidates = pressed ? waiting_buffer_presses : waiting_buffer_releases;
+
+    for (uint8_t i = waiting_buffer_tail; candidates != 0; i = waiting_buffer_next(i)) {
+        if (candidates & (1 << i)) {
+            if (KEYEQ(key, waiting_buffer[i].event.key)) {
+                return i;
+            }
+            candidates &= ~(1 << i);
+        }
+    }
+    return WAITING_BUFFER_SIZE;
 }
 
 /** \brief Waiting buffer typed
@@ -656,12 +720,7 @@ void waiting_buffer_clear(void) {
  * FIXME: Needs docs
  */
 bool waiting_buffer_typed(keyevent_t event) {
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
-        if (KEYEQ(event.key, waiting_buffer[i].event.key) && event.pressed != waiting_buffer[i].event.pressed) {
-            return true;
-        }
-    }
-    return false;
+    return waiting_buffer_find(event.key, !event.pressed) != WAITING_BUFFER_SIZE;
 }
 
 /** \brief Waiting buffer has anykey pressed
@@ -669,10 +728,7 @@ bool waiting_buffer_typed(keyevent_t event) {
  * FIXME: Needs docs
  */
 __attribute__((unused)) bool waiting_buffer_has_anykey_pressed(void) {
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
-        if (waiting_buffer[i].event.pressed) return true;
-    }
-    return false;
+    return waiting_buffer_presses != 0;
 }
 
 /** \brief Scan buffer for tapping
@@ -683,17 +739,18 @@ void waiting_buffer_scan_tap(void) {
     // early return if:
     // - tapping already is settled
     // - invalid state: tapping_key released && tap.count == 0
-    if ((tapping_key.tap.count > 0) || !tapping_key.event.pressed) {
+    // - no release is queued
+    if ((tapping_key.tap.count > 0) || !tapping_key.event.pressed || waiting_buffer_releases == 0) {
         return;
     }
 
 #    if (defined(AUTO_SHIFT_ENABLE) && defined(RETRO_SHIFT))
     TAP_DEFINE_KEYCODE;
 #    endif
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
+    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = waiting_buffer_next(i)) {
         keyrecord_t *candidate = &waiting_buffer[i];
         // clang-format off
-        if (IS_EVENT(candidate->event) && KEYEQ(candidate->event.key, tapping_key.event.key) && !candidate->event.pressed && (
+        if ((waiting_buffer_releases & (1 << i)) && KEYEQ(candidate->event.key, tapping_key.event.key) && (
             WITHIN_TAPPING_TERM(waiting_buffer[i].event) || MAYBE_RETRO_SHIFTING(waiting_buffer[i].event, &tapping_key)
         )) {
             // clang-format on
@@ -774,7 +831,7 @@ static uint8_t waiting_buffer_find_chordal_hold_tap(void) {
     keyrecord_t *prev         = &tapping_key;
     uint16_t     prev_keycode = get_record_keycode(&tapping_key, false);
     uint8_t      first_tap    = WAITING_BUFFER_SIZE;
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
+    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = waiting_buffer_next(i)) {
         keyrecord_t *  cur         = &waiting_buffer[i];
         const uint16_t cur_keycode = get_record_keycode(cur, false);
         if (!cur->event.pressed || !is_mt_or_lt(prev_keycode)) {
@@ -789,7 +846,7 @@ static uint8_t waiting_buffer_find_chordal_hold_tap(void) {
 }
 
 static void waiting_buffer_chordal_hold_taps_until(keypos_t key) {
-    while (waiting_buffer_tail != waiting_buffer_head) {
+    while (!waiting_buffer_is_empty()) {
         keyrecord_t *record = &waiting_buffer[waiting_buffer_tail];
         ac_dprintf("waiting_buffer_chordal_hold_taps_until: processing [%u]\n", waiting_buffer_tail);
         if (record->event.pressed && is_tap_record(record)) {
@@ -797,7 +854,7 @@ static void waiting_buffer_chordal_hold_taps_until(keypos_t key) {
             registered_taps_add(record->event.key);
         }
         process_record(record);
-        waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE;
+        waiting_buffer_pop();
 
         if (KEYEQ(key, record->event.key) && record->event.pressed) {
             break;
@@ -806,7 +863,7 @@ static void waiting_buffer_chordal_hold_taps_until(keypos_t key) {
 }
 
 static void waiting_buffer_process_regular(void) {
-    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
+    for (; !waiting_buffer_is_empty(); waiting_buffer_pop()) {
         if (is_tap_record(&waiting_buffer[waiting_buffer_tail])) {
             break; // Stop once a tap-hold key event is reached.
         }
@@ -821,7 +878,7 @@ static void waiting_buffer_process_regular(void) {
 void flow_tap_update_last_event(keyrecord_t *record) {
     const uint16_t keycode = get_record_keycode(record, false);
     // Don't update while a tap-hold key is unsettled.
-    if (record->tap.count == 0 && (waiting_buffer_tail != waiting_buffer_head || (tapping_key.event.pressed && tapping_key.tap.count == 0))) {
+    if (record->tap.count == 0 && (!waiting_buffer_is_empty() || (tapping_key.event.pressed && tapping_key.tap.count == 0))) {
         return;
     }
     // Ignore releases of modifiers and held layer switches.
@@ -921,7 +978,7 @@ static void debug_tapping_key(void) {
 /** \brief Logs waiting buffer if ACTION_DEBUG is enabled. */
 static void debug_waiting_buffer(void) {
     ac_dprintf("{");
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
+    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = waiting_buffer_next(i)) {
         ac_dprintf(" [%u]=", i);
         debug_record(waiting_buffer[i]);
     }
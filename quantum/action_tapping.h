@@ -34,6 +34,11 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #define WAITING_BUFFER_SIZE 8
 
+/* derived tapping terms are returned by get_tapping_term() */
+#if defined(TAPPING_STATS_ENABLE) && defined(TAPPING_STATS_AUTO_TUNE) && !defined(TAPPING_TERM_PER_KEY)
+#    define TAPPING_TERM_PER_KEY
+#endif
+
 #ifndef NO_ACTION_TAPPING
 uint16_t get_record_keycode(keyrecord_t *record, bool update_layer_cache);
 uint16_t get_event_keycode(keyevent_t event, bool update_layer_cache);
@@ -15,6 +15,7 @@ You should have received a copy of the GNU General Public License
 along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <limits.h>
 #include "util.h"
 
 // bit population - return number of on-bit
@@ -43,6 +44,10 @@ uint8_t bitpop32(uint32_t bits) {
     return c;
 }
 
+uint8_t bitpop64(uint64_t bits) {
+    return bitpop32(bits >> 32) + bitpop32(bits & 0xffffffff);
+}
+
 // most significant on-bit - return highest location of on-bit
 // NOTE: return 0 when bit0 is on or all bits are off
 __attribute__((noinline)) uint8_t biton(uint8_t bits) {
@@ -84,6 +89,10 @@ uint8_t biton16(uint16_t bits) {
 }
 
 uint8_t biton32(uint32_t bits) {
+#if defined(__GNUC__) && !defined(__AVR__)
+    // a single instruction on most 32-bit cores, AVR has none and gets a slow libgcc call
+    return bits ? (sizeof(unsigned long) * CHAR_BIT - 1) - __builtin_clzl(bits) : 0;
+#else
     uint8_t n = 0;
     if (bits >> 16) {
         bits >>= 16;
@@ -106,6 +115,18 @@ uint8_t biton32(uint32_t bits) {
         n += 1;
     }
     return n;
+#endif
+}
+
+uint8_t biton64(uint64_t bits) {
+#if defined(__GNUC__) && !defined(__AVR__)
+    return bits ? (sizeof(unsigned long long) * CHAR_BIT - 1) - __builtin_clzll(bits) : 0;
+#else
+    if (bits >> 32) {
+        return 32 + biton32(bits >> 32);
+    }
+    return biton32(bits);
+#endif
 }
 
 __attribute__((noinline)) uint8_t bitrev(uint8_t bits) {
@@ -124,3 +145,8 @@ uint32_t bitrev32(uint32_t bits) {
     bits = (uint32_t)bitrev16(bits & 0x0000ffff) << 16 | bitrev16((bits & 0xffff0000) >> 16);
     return bits;
 }
+
+uint64_t bitrev64(uint64_t bits) {
+    bits = (uint64_t)bitrev32(bits & 0xffffffff) << 32 | bitrev32(bits >> 32);
+    return bits;
+}
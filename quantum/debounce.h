@@ -4,6 +4,14 @@
 #include <stdbool.h>
 #include "matrix.h"
 
+#ifdef DEBOUNCE_STATIC_ALLOCATION
+// Debounce state is sized for MATRIX_ROWS_PER_HAND at build time instead of being
+// allocated by debounce_init(), so the num_rows passed in must be that value.
+#    define DEBOUNCE_NUM_ROWS(num_rows) ((uint8_t)(MATRIX_ROWS_PER_HAND))
+#else
+#    define DEBOUNCE_NUM_ROWS(num_rows) (num_rows)
+#endif
+
 /**
  * @brief Debounce raw matrix events according to the choosen debounce algorithm.
  *
@@ -0,0 +1,318 @@
+/*
+ * Copyright 2017 Alex Ong <the.onga@gmail.com>
+ * Copyright 2020 Andrei Purdea <andrei@purdea.ro>
+ * Copyright 2021 Simon Arlott
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+Adaptive asymetric per-key algorithm, based on asym_eager_defer_pk. After pressing
+a key, it immediately changes state, with no further inputs accepted until the
+key's debounce window has elapsed. After releasing a key, that state is pushed
+after no changes occur for the key's debounce window.
+
+The window starts at DEBOUNCE milliseconds. Each key keeps a chatter level, raised
+when a bounce is seen in the last DEBOUNCE_ADAPTIVE_MARGIN milliseconds of its
+window (the window was almost too short), or when the key is pressed again within
+DEBOUNCE_ADAPTIVE_GUARD milliseconds of a release (the window was too short).
+Every level lengthens the window of that key by DEBOUNCE_ADAPTIVE_STEP
+milliseconds, up to DEBOUNCE_ADAPTIVE_MAX. Levels decay by one every
+DEBOUNCE_ADAPTIVE_DECAY milliseconds, so keys that stop chattering get their low
+latency back.
+*/
+
+#include "debounce.h"
+#include "timer.h"
+#include <stdlib.h>
+
+#if defined(PROTOCOL_CHIBIOS) && !defined(DEBOUNCE_STATIC_ALLOCATION)
+#    if CH_CFG_USE_MEMCORE == FALSE
+#        error ChibiOS is configured without a memory allocator. Your keyboard may have set `#define CH_CFG_USE_MEMCORE FALSE`, which is incompatible with this debounce algorithm.
+#    endif
+#endif
+
+#ifndef DEBOUNCE
+#    define DEBOUNCE 5
+#endif
+
+// Maximum debounce: 127ms
+#if DEBOUNCE > 127
+#    undef DEBOUNCE
+#    define DEBOUNCE 127
+#endif
+
+#ifndef DEBOUNCE_ADAPTIVE_STEP
+#    define DEBOUNCE_ADAPTIVE_STEP 5
+#endif
+
+#ifndef DEBOUNCE_ADAPTIVE_MAX
+#    define DEBOUNCE_ADAPTIVE_MAX 50
+#endif
+
+#if DEBOUNCE_ADAPTIVE_MAX > 127
+#    undef DEBOUNCE_ADAPTIVE_MAX
+#    define DEBOUNCE_ADAPTIVE_MAX 127
+#endif
+
+#ifndef DEBOUNCE_ADAPTIVE_MARGIN
+#    define DEBOUNCE_ADAPTIVE_MARGIN 2
+#endif
+
+#ifndef DEBOUNCE_ADAPTIVE_GUARD
+#    define DEBOUNCE_ADAPTIVE_GUARD 20
+#endif
+
+#if DEBOUNCE_ADAPTIVE_GUARD > 127
+#    undef DEBOUNCE_ADAPTIVE_GUARD
+#    define DEBOUNCE_ADAPTIVE_GUARD 127
+#endif
+
+#ifndef DEBOUNCE_ADAPTIVE_DECAY
+#    define DEBOUNCE_ADAPTIVE_DECAY 10000
+#endif
+
+#if DEBOUNCE_ADAPTIVE_STEP < 1
+#    error DEBOUNCE_ADAPTIVE_STEP must be at least 1
+#endif
+
+#if DEBOUNCE_ADAPTIVE_GUARD < 1
+#    error DEBOUNCE_ADAPTIVE_GUARD must be at least 1
+#endif
+
+#if DEBOUNCE_ADAPTIVE_MAX <= DEBOUNCE
+#    define DEBOUNCE_ADAPTIVE_LEVELS 0
+#elif (DEBOUNCE_ADAPTIVE_MAX - DEBOUNCE + DEBOUNCE_ADAPTIVE_STEP - 1) / DEBOUNCE_ADAPTIVE_STEP > 63
+#    define DEBOUNCE_ADAPTIVE_LEVELS 63
+#else
+#    define DEBOUNCE_ADAPTIVE_LEVELS ((DEBOUNCE_ADAPTIVE_MAX - DEBOUNCE + DEBOUNCE_ADAPTIVE_STEP - 1) / DEBOUNCE_ADAPTIVE_STEP)
+#endif
+
+#define ROW_SHIFTER ((matrix_row_t)1)
+
+typedef struct {
+    bool    pressed : 1;
+    uint8_t time : 7;
+    bool    guard : 1;   // time counts down the guard period after a release
+    bool    bounced : 1; // chatter was already seen in this window
+    uint8_t level : 6;
+} debounce_counter_t;
+
+#if DEBOUNCE > 0
+#    ifdef DEBOUNCE_STATIC_ALLOCATION
+static debounce_counter_t debounce_counters[MATRIX_ROWS_PER_HAND * MATRIX_COLS];
+#    else
+static debounce_counter_t *debounce_counters;
+#    endif
+static fast_timer_t        last_time;
+static fast_timer_t        last_decay;
+static bool                counters_need_update;
+static bool                matrix_need_update;
+static bool                levels_need_decay;
+static bool                cooked_changed;
+
+#    define DEBOUNCE_ELAPSED 0
+
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time);
+static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows);
+static void decay_chatter_levels(uint8_t num_rows);
+
+// we use num_rows rather than MATRIX_ROWS to support split keyboards
+void debounce_init(uint8_t num_rows) {
+#    ifndef DEBOUNCE_STATIC_ALLOCATION
+    debounce_counters = malloc(num_rows * MATRIX_COLS * sizeof(debounce_counter_t));
+#    endif
+    num_rows = DEBOUNCE_NUM_ROWS(num_rows);
+    int i    = 0;
+    for (uint8_t r = 0; r < num_rows; r++) {
+        for (uint8_t c = 0; c < MATRIX_COLS; c++) {
+            debounce_counters[i].time    = DEBOUNCE_ELAPSED;
+            debounce_counters[i].guard   = false;
+            debounce_counters[i].bounced = false;
+            debounce_counters[i++].level = 0;
+        }
+    }
+    counters_need_update = false;
+    matrix_need_update   = false;
+    levels_need_decay    = false;
+}
+
+void debounce_free(void) {
+#    ifndef DEBOUNCE_STATIC_ALLOCATION
+    free(debounce_counters);
+    debounce_counters = NULL;
+#    endif
+}
+
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+    bool updated_last = false;
+    cooked_changed    = false;
+    num_rows          = DEBOUNCE_NUM_ROWS(num_rows);
+
+    if (counters_need_update) {
+        fast_timer_t now          = timer_read_fast();
+        fast_timer_t elapsed_time = TIMER_DIFF_FAST(now, last_time);
+
+        last_time    = now;
+        updated_last = true;
+        if (elapsed_time > UINT8_MAX) {
+            elapsed_time = UINT8_MAX;
+        }
+
+        if (elapsed_time > 0) {
+            update_debounce_counters_and_transfer_if_expired(raw, cooked, num_rows, elapsed_time);
+        }
+    }
+
+    if (changed || matrix_need_update) {
+        if (!updated_last) {
+            last_time    = timer_read_fast();
+            updated_last = true;
+        }
+
+        transfer_matrix_values(raw, cooked, num_rows);
+    }
+
+    // levels only decay while the timer is being read anyway
+    if (levels_need_decay && updated_last && TIMER_DIFF_FAST(last_time, last_decay) >= DEBOUNCE_ADAPTIVE_DECAY) {
+        decay_chatter_levels(num_rows);
+    }
+
+    return cooked_changed;
+}
+
+static uint8_t debounce_window(const debounce_counter_t *counter) {
+    uint16_t window = DEBOUNCE + counter->level * DEBOUNCE_ADAPTIVE_STEP;
+    return window > DEBOUNCE_ADAPTIVE_MAX ? DEBOUNCE_ADAPTIVE_MAX : window;
+}
+
+static void add_chatter(debounce_counter_t *counter) {
+    if (counter->bounced) {
+        return;
+    }
+    counter->bounced = true;
+    if (counter->level < DEBOUNCE_ADAPTIVE_LEVELS) {
+        counter->level++;
+    }
+    if (!levels_need_decay) {
+        levels_need_decay = true;
+        last_decay        = last_time;
+    }
+}
+
+static void decay_chatter_levels(uint8_t num_rows) {
+    debounce_counter_t *debounce_pointer = debounce_counters;
+
+    levels_need_decay = false;
+    last_decay        = last_time;
+
+    for (uint8_t row = 0; row < num_rows; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (debounce_pointer->level > 0) {
+                debounce_pointer->level--;
+                levels_need_decay |= debounce_pointer->level > 0;
+            }
+            debounce_pointer++;
+        }
+    }
+}
+
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time) {
+    debounce_counter_t *debounce_pointer = debounce_counters;
+
+    counters_need_update = false;
+    matrix_need_update   = false;
+
+    for (uint8_t row = 0; row < num_rows; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            matrix_row_t col_mask = (ROW_SHIFTER << col);
+
+            if (debounce_pointer->time != DEBOUNCE_ELAPSED) {
+                if (debounce_pointer->time <= elapsed_time) {
+                    debounce_pointer->time = DEBOUNCE_ELAPSED;
+
+                    if (debounce_pointer->guard) {
+                        debounce_pointer->guard = false;
+                    } else if (debounce_pointer->pressed) {
+                        // key-down: eager
+                        matrix_need_update = true;
+                    } else {
+                        // key-up: defer, then guard against a chattering press
+                        matrix_row_t cooked_next = (cooked[row] & ~col_mask) | (raw[row] & col_mask);
+                        cooked_changed |= cooked_next ^ cooked[row];
+                        cooked[row] = cooked_next;
+
+                        debounce_pointer->guard   = true;
+                        debounce_pointer->bounced = false;
+                        debounce_pointer->time    = DEBOUNCE_ADAPTIVE_GUARD;
+                        counters_need_update      = true;
+                    }
+                } else {
+                    debounce_pointer->time -= elapsed_time;
+                    counters_need_update = true;
+                }
+            }
+            debounce_pointer++;
+        }
+    }
+}
+
+static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
+    debounce_counter_t *debounce_pointer = debounce_counters;
+
+    matrix_need_update = false;
+
+    for (uint8_t row = 0; row < num_rows; row++) {
+        matrix_row_t delta = raw[row] ^ cooked[row];
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            matrix_row_t col_mask = (ROW_SHIFTER << col);
+
+            if (delta & col_mask) {
+                if (debounce_pointer->time == DEBOUNCE_ELAPSED || debounce_pointer->guard) {
+                    if (debounce_pointer->guard) {
+                        // pressed again too soon after the release
+                        add_chatter(debounce_pointer);
+                        debounce_pointer->guard = false;
+                    }
+                    debounce_pointer->pressed = (raw[row] & col_mask);
+                    debounce_pointer->bounced = false;
+                    debounce_pointer->time    = debounce_window(debounce_pointer);
+                    counters_need_update      = true;
+
+                    if (debounce_pointer->pressed) {
+                        // key-down: eager
+                        cooked[row] ^= col_mask;
+                        cooked_changed = true;
+                    }
+                } else if (debounce_pointer->pressed && debounce_pointer->time <= DEBOUNCE_ADAPTIVE_MARGIN) {
+                    // key-down: a bounce at the end of the window is chatter
+                    add_chatter(debounce_pointer);
+                }
+            } else if (debounce_pointer->time != DEBOUNCE_ELAPSED && !debounce_pointer->guard) {
+                if (!debounce_pointer->pressed) {
+                    // key-up: defer, a bounce that almost got through is chatter
+                    if (debounce_pointer->time <= DEBOUNCE_ADAPTIVE_MARGIN) {
+                        add_chatter(debounce_pointer);
+                    }
+                    debounce_pointer->time = DEBOUNCE_ELAPSED;
+                }
+            }
+            debounce_pointer++;
+        }
+    }
+}
+
+#else
+#    include "none.c"
+#endif
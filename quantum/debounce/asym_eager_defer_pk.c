@@ -27,7 +27,7 @@ releasing a key, that state is pushed after no changes occur for DEBOUNCE millis
 #include "timer.h"
 #include <stdlib.h>
 
-#ifdef PROTOCOL_CHIBIOS
+#if defined(PROTOCOL_CHIBIOS) && !defined(DEBOUNCE_STATIC_ALLOCATION)
 #    if CH_CFG_USE_MEMCORE == FALSE
 #        error ChibiOS is configured without a memory allocator. Your keyboard may have set `#define CH_CFG_USE_MEMCORE FALSE`, which is incompatible with this debounce algorithm.
 #    endif
@@ -43,6 +43,17 @@ releasing a key, that state is pushed after no changes occur for DEBOUNCE millis
 #    define DEBOUNCE 127
 #endif
 
+#ifdef DEBOUNCE_PER_KEY_ENABLE
+#    include "debounce_per_key.h"
+static inline uint8_t debounce_time(uint8_t row, uint8_t col) {
+    uint8_t time = debounce_per_key_get_hand_time(row, col);
+    return time > 127 ? 127 : time;
+}
+#    define DEBOUNCE_TIME(row, col) debounce_time(row, col)
+#else
+#    define DEBOUNCE_TIME(row, col) DEBOUNCE
+#endif
+
 #define ROW_SHIFTER ((matrix_row_t)1)
 
 typedef struct {
@@ -51,7 +62,11 @@ typedef struct {
 } debounce_counter_t;
 
 #if DEBOUNCE > 0
+#    ifdef DEBOUNCE_STATIC_ALLOCATION
+static debounce_counter_t debounce_counters[MATRIX_ROWS_PER_HAND * MATRIX_COLS];
+#    else
 static debounce_counter_t *debounce_counters;
+#    endif
 static fast_timer_t        last_time;
 static bool                counters_need_update;
 static bool                matrix_need_update;
@@ -64,8 +79,11 @@ static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], ui
 
 // we use num_rows rather than MATRIX_ROWS to support split keyboards
 void debounce_init(uint8_t num_rows) {
+#    ifndef DEBOUNCE_STATIC_ALLOCATION
     debounce_counters = malloc(num_rows * MATRIX_COLS * sizeof(debounce_counter_t));
-    int i             = 0;
+#    endif
+    num_rows = DEBOUNCE_NUM_ROWS(num_rows);
+    int i    = 0;
     for (uint8_t r = 0; r < num_rows; r++) {
         for (uint8_t c = 0; c < MATRIX_COLS; c++) {
             debounce_counters[i++].time = DEBOUNCE_ELAPSED;
@@ -74,13 +92,16 @@ void debounce_init(uint8_t num_rows) {
 }
 
 void debounce_free(void) {
+#    ifndef DEBOUNCE_STATIC_ALLOCATION
     free(debounce_counters);
     debounce_counters = NULL;
+#    endif
 }
 
 bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
     bool updated_last = false;
     cooked_changed    = false;
+    num_rows          = DEBOUNCE_NUM_ROWS(num_rows);
 
     if (counters_need_update) {
         fast_timer_t now          = timer_read_fast();
@@ -154,7 +175,7 @@ static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], ui
             if (delta & col_mask) {
                 if (debounce_pointer->time == DEBOUNCE_ELAPSED) {
                     debounce_pointer->pressed = (raw[row] & col_mask);
-                    debounce_pointer->time    = DEBOUNCE;
+                    debounce_pointer->time    = DEBOUNCE_TIME(row, col);
                     counters_need_update      = true;
 
                     if (debounce_pointer->pressed) {
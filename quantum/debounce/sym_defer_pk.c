@@ -23,7 +23,7 @@ When no state changes have occured for DEBOUNCE milliseconds, we push the state.
 #include "timer.h"
 #include <stdlib.h>
 
-#ifdef PROTOCOL_CHIBIOS
+#if defined(PROTOCOL_CHIBIOS) && !defined(DEBOUNCE_STATIC_ALLOCATION)
 #    if CH_CFG_USE_MEMCORE == FALSE
 #        error ChibiOS is configured without a memory allocator. Your keyboard may have set `#define CH_CFG_USE_MEMCORE FALSE`, which is incompatible with this debounce algorithm.
 #    endif
@@ -39,12 +39,23 @@ When no state changes have occured for DEBOUNCE milliseconds, we push the state.
 #    define DEBOUNCE UINT8_MAX
 #endif
 
+#ifdef DEBOUNCE_PER_KEY_ENABLE
+#    include "debounce_per_key.h"
+#    define DEBOUNCE_TIME(row, col) debounce_per_key_get_hand_time(row, col)
+#else
+#    define DEBOUNCE_TIME(row, col) DEBOUNCE
+#endif
+
 #define ROW_SHIFTER ((matrix_row_t)1)
 
 typedef uint8_t debounce_counter_t;
 
 #if DEBOUNCE > 0
+#    ifdef DEBOUNCE_STATIC_ALLOCATION
+static debounce_counter_t debounce_counters[MATRIX_ROWS_PER_HAND * MATRIX_COLS];
+#    else
 static debounce_counter_t *debounce_counters;
+#    endif
 static fast_timer_t        last_time;
 static bool                counters_need_update;
 static bool                cooked_changed;
@@ -56,8 +67,11 @@ static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], u
 
 // we use num_rows rather than MATRIX_ROWS to support split keyboards
 void debounce_init(uint8_t num_rows) {
+#    ifndef DEBOUNCE_STATIC_ALLOCATION
     debounce_counters = (debounce_counter_t *)malloc(num_rows * MATRIX_COLS * sizeof(debounce_counter_t));
-    int i             = 0;
+#    endif
+    num_rows = DEBOUNCE_NUM_ROWS(num_rows);
+    int i    = 0;
     for (uint8_t r = 0; r < num_rows; r++) {
         for (uint8_t c = 0; c < MATRIX_COLS; c++) {
             debounce_counters[i++] = DEBOUNCE_ELAPSED;
@@ -66,13 +80,16 @@ void debounce_init(uint8_t num_rows) {
 }
 
 void debounce_free(void) {
+#    ifndef DEBOUNCE_STATIC_ALLOCATION
     free(debounce_counters);
     debounce_counters = NULL;
+#    endif
 }
 
 bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
     bool updated_last = false;
     cooked_changed    = false;
+    num_rows          = DEBOUNCE_NUM_ROWS(num_rows);
 
     if (counters_need_update) {
         fast_timer_t now          = timer_read_fast();
@@ -128,7 +145,7 @@ static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], u
         for (uint8_t col = 0; col < MATRIX_COLS; col++) {
             if (delta & (ROW_SHIFTER << col)) {
                 if (*debounce_pointer == DEBOUNCE_ELAPSED) {
-                    *debounce_pointer    = DEBOUNCE;
+                    *debounce_pointer    = DEBOUNCE_TIME(row, col);
                     counters_need_update = true;
                 }
             } else {
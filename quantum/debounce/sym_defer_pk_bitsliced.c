@@ -0,0 +1,203 @@
+/*
+Copyright 2017 Alex Ong<the.onga@gmail.com>
+Copyright 2020 Andrei Purdea<andrei@purdea.ro>
+Copyright 2021 Simon Arlott
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Basic symmetric per-key algorithm, with the same behaviour as sym_defer_pk.
+When no state changes have occured for DEBOUNCE milliseconds, we push the state.
+
+The counters are stored bit-sliced: bit n of the counters of all the keys in a row
+is kept in one matrix_row_t, so a whole row is counted down and expired with a
+handful of word-wide operations instead of a loop over its columns.
+*/
+
+#include "debounce.h"
+#include "timer.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(PROTOCOL_CHIBIOS) && !defined(DEBOUNCE_STATIC_ALLOCATION)
+#    if CH_CFG_USE_MEMCORE == FALSE
+#        error ChibiOS is configured without a memory allocator. Your keyboard may have set `#define CH_CFG_USE_MEMCORE FALSE`, which is incompatible with this debounce algorithm.
+#    endif
+#endif
+
+#ifndef DEBOUNCE
+#    define DEBOUNCE 5
+#endif
+
+// Maximum debounce: 255ms
+#if DEBOUNCE > UINT8_MAX
+#    undef DEBOUNCE
+#    define DEBOUNCE UINT8_MAX
+#endif
+
+// Number of bit planes needed to hold DEBOUNCE
+#if DEBOUNCE < 2
+#    define DEBOUNCE_BITS 1
+#elif DEBOUNCE < 4
+#    define DEBOUNCE_BITS 2
+#elif DEBOUNCE < 8
+#    define DEBOUNCE_BITS 3
+#elif DEBOUNCE < 16
+#    define DEBOUNCE_BITS 4
+#elif DEBOUNCE < 32
+#    define DEBOUNCE_BITS 5
+#elif DEBOUNCE < 64
+#    define DEBOUNCE_BITS 6
+#elif DEBOUNCE < 128
+#    define DEBOUNCE_BITS 7
+#else
+#    define DEBOUNCE_BITS 8
+#endif
+
+// All the columns of a row when bit n of a value is set, none otherwise
+#define BIT_PLANE_MASK(value, n) (((value) >> (n)) & 1 ? (matrix_row_t)~(matrix_row_t)0 : (matrix_row_t)0)
+
+typedef struct {
+    matrix_row_t bits[DEBOUNCE_BITS];
+} debounce_counters_t;
+
+#if DEBOUNCE > 0
+#    ifdef DEBOUNCE_STATIC_ALLOCATION
+static debounce_counters_t debounce_counters[MATRIX_ROWS_PER_HAND];
+#    else
+static debounce_counters_t *debounce_counters;
+#    endif
+static fast_timer_t         last_time;
+static bool                 counters_need_update;
+static bool                 cooked_changed;
+
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time);
+static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows);
+
+// we use num_rows rather than MATRIX_ROWS to support split keyboards
+void debounce_init(uint8_t num_rows) {
+#    ifdef DEBOUNCE_STATIC_ALLOCATION
+    memset(debounce_counters, 0, sizeof(debounce_counters));
+#    else
+    debounce_counters = (debounce_counters_t *)calloc(num_rows, sizeof(debounce_counters_t));
+#    endif
+}
+
+void debounce_free(void) {
+#    ifndef DEBOUNCE_STATIC_ALLOCATION
+    free(debounce_counters);
+    debounce_counters = NULL;
+#    endif
+}
+
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+    bool updated_last = false;
+    cooked_changed    = false;
+    num_rows          = DEBOUNCE_NUM_ROWS(num_rows);
+
+    if (counters_need_update) {
+        fast_timer_t now          = timer_read_fast();
+        fast_timer_t elapsed_time = TIMER_DIFF_FAST(now, last_time);
+
+        last_time    = now;
+        updated_last = true;
+        if (elapsed_time > UINT8_MAX) {
+            elapsed_time = UINT8_MAX;
+        }
+
+        if (elapsed_time > 0) {
+            update_debounce_counters_and_transfer_if_expired(raw, cooked, num_rows, elapsed_time);
+        }
+    }
+
+    if (changed) {
+        if (!updated_last) {
+            last_time = timer_read_fast();
+        }
+
+        start_debounce_counters(raw, cooked, num_rows);
+    }
+
+    return cooked_changed;
+}
+
+// keys of a row with a counter that isn't elapsed
+static inline matrix_row_t counters_running(const matrix_row_t bits[]) {
+    matrix_row_t running = 0;
+    for (uint8_t n = 0; n < DEBOUNCE_BITS; n++) {
+        running |= bits[n];
+    }
+    return running;
+}
+
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time) {
+    counters_need_update = false;
+    for (uint8_t row = 0; row < num_rows; row++) {
+        matrix_row_t *bits   = debounce_counters[row].bits;
+        matrix_row_t  active = counters_running(bits);
+
+        if (!active) {
+            continue;
+        }
+
+        matrix_row_t expired = active;
+        if (elapsed_time < DEBOUNCE) {
+            // subtract elapsed_time from every counter of the row at once,
+            // a counter has expired if it went below zero or reached it
+            matrix_row_t borrow    = 0;
+            matrix_row_t remaining = 0;
+            for (uint8_t n = 0; n < DEBOUNCE_BITS; n++) {
+                matrix_row_t counter_bit = bits[n];
+                matrix_row_t elapsed_bit = BIT_PLANE_MASK(elapsed_time, n);
+                matrix_row_t difference  = counter_bit ^ elapsed_bit;
+
+                bits[n] = difference ^ borrow;
+                borrow  = (~counter_bit & elapsed_bit) | (~difference & borrow);
+                remaining |= bits[n];
+            }
+            expired = active & (borrow | ~remaining);
+        }
+
+        for (uint8_t n = 0; n < DEBOUNCE_BITS; n++) {
+            bits[n] &= active & ~expired;
+        }
+        if (active & ~expired) {
+            counters_need_update = true;
+        }
+
+        if (expired) {
+            matrix_row_t cooked_next = (cooked[row] & ~expired) | (raw[row] & expired);
+            cooked_changed |= cooked[row] ^ cooked_next;
+            cooked[row] = cooked_next;
+        }
+    }
+}
+
+static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
+    for (uint8_t row = 0; row < num_rows; row++) {
+        matrix_row_t *bits  = debounce_counters[row].bits;
+        matrix_row_t  delta = raw[row] ^ cooked[row];
+
+        // keys that changed start counting, keys that changed back stop
+        matrix_row_t start = delta & ~counters_running(bits);
+        for (uint8_t n = 0; n < DEBOUNCE_BITS; n++) {
+            bits[n] = (bits[n] & delta) | (start & BIT_PLANE_MASK(DEBOUNCE, n));
+        }
+        if (start) {
+            counters_need_update = true;
+        }
+    }
+}
+
+#else
+#    include "none.c"
+#endif
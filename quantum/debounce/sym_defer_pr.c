@@ -20,29 +20,44 @@ DEBOUNCE milliseconds have elapsed since the last change.
 #include "debounce.h"
 #include "timer.h"
 #include <stdlib.h>
+#include <string.h>
 
 #ifndef DEBOUNCE
 #    define DEBOUNCE 5
 #endif
 
 static uint16_t last_time;
+#ifdef DEBOUNCE_STATIC_ALLOCATION
+// [row] milliseconds until key's state is considered debounced.
+static uint8_t countdowns[MATRIX_ROWS_PER_HAND];
+// [row]
+static matrix_row_t last_raw[MATRIX_ROWS_PER_HAND];
+#else
 // [row] milliseconds until key's state is considered debounced.
 static uint8_t* countdowns;
 // [row]
 static matrix_row_t* last_raw;
+#endif
 
 void debounce_init(uint8_t num_rows) {
+#ifdef DEBOUNCE_STATIC_ALLOCATION
+    memset(countdowns, 0, sizeof(countdowns));
+    memset(last_raw, 0, sizeof(last_raw));
+#else
     countdowns = (uint8_t*)calloc(num_rows, sizeof(uint8_t));
     last_raw   = (matrix_row_t*)calloc(num_rows, sizeof(matrix_row_t));
+#endif
 
     last_time = timer_read();
 }
 
 void debounce_free(void) {
+#ifndef DEBOUNCE_STATIC_ALLOCATION
     free(countdowns);
     countdowns = NULL;
     free(last_raw);
     last_raw = NULL;
+#endif
 }
 
 bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
@@ -52,6 +67,7 @@ bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool
     uint8_t elapsed        = (elapsed16 > 255) ? 255 : elapsed16;
     bool    cooked_changed = false;
 
+    num_rows           = DEBOUNCE_NUM_ROWS(num_rows);
     uint8_t* countdown = countdowns;
 
     for (uint8_t row = 0; row < num_rows; ++row, ++countdown) {
@@ -23,7 +23,7 @@ No further inputs are accepted until DEBOUNCE milliseconds have occurred.
 #include "timer.h"
 #include <stdlib.h>
 
-#ifdef PROTOCOL_CHIBIOS
+#if defined(PROTOCOL_CHIBIOS) && !defined(DEBOUNCE_STATIC_ALLOCATION)
 #    if CH_CFG_USE_MEMCORE == FALSE
 #        error ChibiOS is configured without a memory allocator. Your keyboard may have set `#define CH_CFG_USE_MEMCORE FALSE`, which is incompatible with this debounce algorithm.
 #    endif
@@ -39,12 +39,23 @@ No further inputs are accepted until DEBOUNCE milliseconds have occurred.
 #    define DEBOUNCE UINT8_MAX
 #endif
 
+#ifdef DEBOUNCE_PER_KEY_ENABLE
+#    include "debounce_per_key.h"
+#    define DEBOUNCE_TIME(row, col) debounce_per_key_get_hand_time(row, col)
+#else
+#    define DEBOUNCE_TIME(row, col) DEBOUNCE
+#endif
+
 #define ROW_SHIFTER ((matrix_row_t)1)
 
 typedef uint8_t debounce_counter_t;
 
 #if DEBOUNCE > 0
+#    ifdef DEBOUNCE_STATIC_ALLOCATION
+static debounce_counter_t debounce_counters[MATRIX_ROWS_PER_HAND * MATRIX_COLS];
+#    else
 static debounce_counter_t *debounce_counters;
+#    endif
 static fast_timer_t        last_time;
 static bool                counters_need_update;
 static bool                matrix_need_update;
@@ -57,8 +68,11 @@ static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], ui
 
 // we use num_rows rather than MATRIX_ROWS to support split keyboards
 void debounce_init(uint8_t num_rows) {
+#    ifndef DEBOUNCE_STATIC_ALLOCATION
     debounce_counters = (debounce_counter_t *)malloc(num_rows * MATRIX_COLS * sizeof(debounce_counter_t));
-    int i             = 0;
+#    endif
+    num_rows = DEBOUNCE_NUM_ROWS(num_rows);
+    int i    = 0;
     for (uint8_t r = 0; r < num_rows; r++) {
         for (uint8_t c = 0; c < MATRIX_COLS; c++) {
             debounce_counters[i++] = DEBOUNCE_ELAPSED;
@@ -67,13 +81,16 @@ void debounce_init(uint8_t num_rows) {
 }
 
 void debounce_free(void) {
+#    ifndef DEBOUNCE_STATIC_ALLOCATION
     free(debounce_counters);
     debounce_counters = NULL;
+#    endif
 }
 
 bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
     bool updated_last = false;
     cooked_changed    = false;
+    num_rows          = DEBOUNCE_NUM_ROWS(num_rows);
 
     if (counters_need_update) {
         fast_timer_t now          = timer_read_fast();
@@ -133,7 +150,7 @@ static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], ui
             matrix_row_t col_mask = (ROW_SHIFTER << col);
             if (delta & col_mask) {
                 if (*debounce_pointer == DEBOUNCE_ELAPSED) {
-                    *debounce_pointer    = DEBOUNCE;
+                    *debounce_pointer    = DEBOUNCE_TIME(row, col);
                     counters_need_update = true;
                     existing_row ^= col_mask; // flip the bit.
                     cooked_changed = true;
@@ -23,7 +23,7 @@ No further inputs are accepted until DEBOUNCE milliseconds have occurred.
 #include "timer.h"
 #include <stdlib.h>
 
-#ifdef PROTOCOL_CHIBIOS
+#if defined(PROTOCOL_CHIBIOS) && !defined(DEBOUNCE_STATIC_ALLOCATION)
 #    if CH_CFG_USE_MEMCORE == FALSE
 #        error ChibiOS is configured without a memory allocator. Your keyboard may have set `#define CH_CFG_USE_MEMCORE FALSE`, which is incompatible with this debounce algorithm.
 #    endif
@@ -44,7 +44,11 @@ typedef uint8_t debounce_counter_t;
 #if DEBOUNCE > 0
 static bool matrix_need_update;
 
+#    ifdef DEBOUNCE_STATIC_ALLOCATION
+static debounce_counter_t debounce_counters[MATRIX_ROWS_PER_HAND];
+#    else
 static debounce_counter_t *debounce_counters;
+#    endif
 static fast_timer_t        last_time;
 static bool                counters_need_update;
 static bool                cooked_changed;
@@ -56,20 +60,26 @@ static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], ui
 
 // we use num_rows rather than MATRIX_ROWS to support split keyboards
 void debounce_init(uint8_t num_rows) {
+#    ifndef DEBOUNCE_STATIC_ALLOCATION
     debounce_counters = (debounce_counter_t *)malloc(num_rows * sizeof(debounce_counter_t));
+#    endif
+    num_rows = DEBOUNCE_NUM_ROWS(num_rows);
     for (uint8_t r = 0; r < num_rows; r++) {
         debounce_counters[r] = DEBOUNCE_ELAPSED;
     }
 }
 
 void debounce_free(void) {
+#    ifndef DEBOUNCE_STATIC_ALLOCATION
     free(debounce_counters);
     debounce_counters = NULL;
+#    endif
 }
 
 bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
     bool updated_last = false;
     cooked_changed    = false;
+    num_rows          = DEBOUNCE_NUM_ROWS(num_rows);
 
     if (counters_need_update) {
         fast_timer_t now          = timer_read_fast();
@@ -0,0 +1,163 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include "debounce_test_common.h"
+
+static void expectTrace(const std::vector<DebounceTraceEvent> &actual, const std::vector<DebounceTraceEvent> &expected) {
+    ASSERT_EQ(actual.size(), expected.size()) << "Wrong number of debounced changes";
+    for (size_t i = 0; i < expected.size(); i++) {
+        EXPECT_EQ(actual[i].time_, expected[i].time_) << "Change " << i;
+        EXPECT_EQ(actual[i].event_.row_, expected[i].event_.row_) << "Change " << i;
+        EXPECT_EQ(actual[i].event_.col_, expected[i].event_.col_) << "Change " << i;
+        EXPECT_EQ(actual[i].event_.direction_, expected[i].event_.direction_) << "Change " << i;
+    }
+}
+
+TEST_F(DebounceTest, HealthyKeyLowLatency) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}}, {{0, 1, DOWN}}},
+        /* Early bounces are absorbed without raising the window */
+        {1, {{0, 1, UP}}, {}},
+        {2, {{0, 1, DOWN}}, {}},
+
+        {50, {{0, 1, UP}}, {}},
+        {51, {{0, 1, DOWN}}, {}},
+        {52, {{0, 1, UP}}, {}},
+        {57, {}, {{0, 1, UP}}},
+
+        {100, {{0, 1, DOWN}}, {{0, 1, DOWN}}},
+        {150, {{0, 1, UP}}, {}},
+        {155, {}, {{0, 1, UP}}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, LateBounceRaisesWindow) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}}, {{0, 1, DOWN}}},
+        /* Bounce in the last 2ms of the window */
+        {4, {{0, 1, UP}}, {}},
+        {6, {{0, 1, DOWN}}, {}},
+
+        /* Release is now deferred by 10ms */
+        {50, {{0, 1, UP}}, {}},
+        {60, {}, {{0, 1, UP}}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, DoubleTypeRaisesWindow) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}}, {{0, 1, DOWN}}},
+        {20, {{0, 1, UP}}, {}},
+        {25, {}, {{0, 1, UP}}},
+        /* Pressed again 2ms after the release, that can't be prevented */
+        {27, {{0, 1, DOWN}}, {{0, 1, DOWN}}},
+        {28, {{0, 1, UP}}, {}},
+
+        {37, {}, {}}, /* 10ms window ends */
+        {47, {}, {{0, 1, UP}}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, HealthyTrace) {
+    /* Two keys typed on healthy switches, bouncing for 2ms on each change */
+    auto changes = runTrace({
+        {0, 0, 1, DOWN},
+        {1, 0, 1, UP},
+        {2, 0, 1, DOWN},
+        {40, 1, 2, DOWN},
+        {80, 0, 1, UP},
+        {81, 0, 1, DOWN},
+        {82, 0, 1, UP},
+        {95, 1, 2, UP},
+        {96, 1, 2, DOWN},
+        {97, 1, 2, UP},
+        {130, 0, 1, DOWN},
+        {131, 0, 1, UP},
+        {132, 0, 1, DOWN},
+        {170, 0, 1, UP},
+    });
+    expectTrace(changes, {
+                             {0, 0, 1, DOWN},
+                             {40, 1, 2, DOWN},
+                             {87, 0, 1, UP},
+                             {102, 1, 2, UP},
+                             {130, 0, 1, DOWN},
+                             {175, 0, 1, UP},
+                         });
+}
+
+TEST_F(DebounceTest, WornSwitchTrace) {
+    /* Key held for 300ms on a worn switch that opens for 7ms at a time */
+    auto changes = runTrace({
+        {0, 2, 3, DOWN},
+        {60, 2, 3, UP},
+        {67, 2, 3, DOWN},
+        {120, 2, 3, UP},
+        {127, 2, 3, DOWN},
+        {180, 2, 3, UP},
+        {187, 2, 3, DOWN},
+        {240, 2, 3, UP},
+        {247, 2, 3, DOWN},
+        {300, 2, 3, UP},
+    });
+    /* Only the first opening gets through, it raises the window to 10ms */
+    expectTrace(changes, {
+                             {0, 2, 3, DOWN},
+                             {65, 2, 3, UP},
+                             {67, 2, 3, DOWN},
+                             {310, 2, 3, UP},
+                         });
+}
+
+TEST_F(DebounceTest, ChatteringSwitchTrace) {
+    /* Key held for 300ms on a switch that opens for 12ms at a time */
+    auto changes = runTrace({
+        {0, 3, 9, DOWN},
+        {50, 3, 9, UP},
+        {62, 3, 9, DOWN},
+        {100, 3, 9, UP},
+        {112, 3, 9, DOWN},
+        {150, 3, 9, UP},
+        {162, 3, 9, DOWN},
+        {200, 3, 9, UP},
+        {212, 3, 9, DOWN},
+        {300, 3, 9, UP},
+    });
+    /* The window goes up to 10ms then 15ms, after which the openings are absorbed */
+    expectTrace(changes, {
+                             {0, 3, 9, DOWN},
+                             {55, 3, 9, UP},
+                             {62, 3, 9, DOWN},
+                             {110, 3, 9, UP},
+                             {112, 3, 9, DOWN},
+                             {315, 3, 9, UP},
+                         });
+}
+
+TEST_F(DebounceTest, ChatterLevelDecays) {
+    auto changes = runTrace({
+        {0, 2, 3, DOWN},
+        {60, 2, 3, UP},
+        {67, 2, 3, DOWN},
+        {300, 2, 3, UP},
+        /* More than 10s later */
+        {11000, 2, 3, DOWN},
+        {11050, 2, 3, UP},
+    });
+    expectTrace(changes, {
+                             {0, 2, 3, DOWN},
+                             {65, 2, 3, UP},
+                             {67, 2, 3, DOWN},
+                             {310, 2, 3, UP},
+                             {11000, 2, 3, DOWN},
+                             {11055, 2, 3, UP},
+                         });
+}
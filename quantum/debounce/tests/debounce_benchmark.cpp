@@ -0,0 +1,68 @@
+/* Copyright 2026 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+extern "C" {
+#include "debounce.h"
+#include "timer.h"
+
+void advance_time(uint32_t ms);
+}
+
+/* Keys are pressed and chatter in bursts, so that most scans see counters running. */
+TEST(DebounceBenchmark, LargeMatrixThroughput) {
+    const uint32_t scans = 200000;
+    matrix_row_t   raw[MATRIX_ROWS];
+    matrix_row_t   cooked[MATRIX_ROWS];
+    uint32_t       rng = 0x12345678;
+
+    memset(raw, 0, sizeof(raw));
+    memset(cooked, 0, sizeof(cooked));
+    debounce_init(MATRIX_ROWS);
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t scan = 0; scan < scans; scan++) {
+        bool changed = false;
+        if (scan % 8 == 0) {
+            rng ^= rng << 13;
+            rng ^= rng >> 17;
+            rng ^= rng << 5;
+            raw[rng % MATRIX_ROWS] ^= (matrix_row_t)1 << ((rng >> 8) % MATRIX_COLS);
+            changed = true;
+        }
+        debounce(raw, cooked, MATRIX_ROWS, changed);
+        advance_time(1);
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    /* Everything settles once the input stops changing. */
+    for (uint32_t scan = 0; scan < 300; scan++) {
+        debounce(raw, cooked, MATRIX_ROWS, false);
+        advance_time(1);
+    }
+    EXPECT_EQ(0, memcmp(raw, cooked, sizeof(raw)));
+
+    debounce_free();
+
+    double keys_per_second = (double)scans * MATRIX_ROWS * MATRIX_COLS / elapsed.count();
+    RecordProperty("scans_per_second", std::to_string(scans / elapsed.count()));
+    printf("%ux%u matrix: %.0f scans/s, %.0f keys/s\n", MATRIX_ROWS, MATRIX_COLS, scans / elapsed.count(), keys_per_second);
+}
@@ -125,6 +125,50 @@ void DebounceTest::runEventsInternal() {
     debounce_free();
 }
 
+std::vector<DebounceTraceEvent> DebounceTest::runTrace(const std::vector<DebounceTraceEvent> &trace) {
+    std::vector<DebounceTraceEvent> changes;
+    auto                            next = trace.begin();
+    fast_timer_t                    end  = trace.empty() ? 0 : trace.back().time_ + 1000;
+
+    if (!std::is_sorted(trace.begin(), trace.end(), [](const DebounceTraceEvent &a, const DebounceTraceEvent &b) { return a.time_ < b.time_; })) {
+        ADD_FAILURE() << "Trace is not in time order";
+        return changes;
+    }
+
+    extra_iterations_  = 0;
+    auto_advance_time_ = true;
+
+    debounce_init(MATRIX_ROWS);
+    set_time(time_offset_);
+    std::fill(std::begin(input_matrix_), std::end(input_matrix_), 0);
+    std::fill(std::begin(output_matrix_), std::end(output_matrix_), 0);
+
+    for (fast_timer_t time = 0; time <= end; time++) {
+        bool changed = false;
+
+        for (; next != trace.end() && next->time_ == time; next++) {
+            matrixUpdate(input_matrix_, "input", next->event_);
+            changed = true;
+        }
+
+        runDebounce(changed);
+
+        for (int row = 0; row < MATRIX_ROWS; row++) {
+            for (int col = 0; col < MATRIX_COLS; col++) {
+                if ((cooked_matrix_[row] ^ output_matrix_[row]) & (1U << col)) {
+                    changes.emplace_back(time, row, col, (cooked_matrix_[row] & (1U << col)) ? DOWN : UP);
+                }
+            }
+        }
+        std::copy(std::begin(cooked_matrix_), std::end(cooked_matrix_), std::begin(output_matrix_));
+
+        advance_time(1);
+    }
+
+    debounce_free();
+    return changes;
+}
+
 void DebounceTest::runDebounce(bool changed) {
     std::copy(std::begin(input_matrix_), std::end(input_matrix_), std::begin(raw_matrix_));
     std::copy(std::begin(output_matrix_), std::end(output_matrix_), std::begin(cooked_matrix_));
@@ -218,4 +262,6 @@ void DebounceTest::matrixUpdate(matrix_row_t matrix[], const std::string &name,
 
 DebounceTestEvent::DebounceTestEvent(fast_timer_t time, std::initializer_list<MatrixTestEvent> inputs, std::initializer_list<MatrixTestEvent> outputs) : time_(time), inputs_(inputs), outputs_(outputs) {}
 
+DebounceTraceEvent::DebounceTraceEvent(fast_timer_t time, int row, int col, Direction direction) : time_(time), event_(row, col, direction) {}
+
 MatrixTestEvent::MatrixTestEvent(int row, int col, Direction direction) : row_(row), col_(col), direction_(direction) {}
@@ -19,6 +19,7 @@
 #include <initializer_list>
 #include <list>
 #include <string>
+#include <vector>
 
 extern "C" {
 #include "matrix.h"
@@ -49,11 +50,22 @@ class DebounceTestEvent {
     const std::list<MatrixTestEvent> outputs_;
 };
 
+class DebounceTraceEvent {
+   public:
+    DebounceTraceEvent(fast_timer_t time, int row, int col, Direction direction);
+
+    const fast_timer_t    time_;
+    const MatrixTestEvent event_;
+};
+
 class DebounceTest : public ::testing::Test {
    protected:
     void addEvents(std::initializer_list<DebounceTestEvent> events);
     void runEvents();
 
+    /* Replay a recorded input trace at a 1kHz scan rate, returning the debounced changes */
+    std::vector<DebounceTraceEvent> runTrace(const std::vector<DebounceTraceEvent> &trace);
+
     fast_timer_t time_offset_      = 7777;
     bool         time_jumps_       = false;
     fast_timer_t async_time_jumps_ = 0;
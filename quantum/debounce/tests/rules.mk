@@ -14,6 +14,8 @@
 # along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 DEBOUNCE_COMMON_DEFS := -DMATRIX_ROWS=4 -DMATRIX_COLS=10 -DDEBOUNCE=5
+DEBOUNCE_STATIC_DEFS := $(DEBOUNCE_COMMON_DEFS) -DDEBOUNCE_STATIC_ALLOCATION
+DEBOUNCE_BENCHMARK_DEFS := -DMATRIX_ROWS=32 -DMATRIX_COLS=32 -DDEBOUNCE=5
 
 DEBOUNCE_COMMON_SRC := $(QUANTUM_PATH)/debounce/tests/debounce_test_common.cpp \
 	$(PLATFORM_PATH)/timer.c \
@@ -34,6 +36,12 @@ debounce_sym_defer_pk_SRC := $(DEBOUNCE_COMMON_SRC) \
 	$(QUANTUM_PATH)/debounce/sym_defer_pk.c \
 	$(QUANTUM_PATH)/debounce/tests/sym_defer_pk_tests.cpp
 
+# same behaviour as sym_defer_pk, so the same tests
+debounce_sym_defer_pk_bitsliced_DEFS := $(DEBOUNCE_COMMON_DEFS)
+debounce_sym_defer_pk_bitsliced_SRC := $(DEBOUNCE_COMMON_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_defer_pk_bitsliced.c \
+	$(QUANTUM_PATH)/debounce/tests/sym_defer_pk_tests.cpp
+
 debounce_sym_defer_pr_DEFS := $(DEBOUNCE_COMMON_DEFS)
 debounce_sym_defer_pr_SRC := $(DEBOUNCE_COMMON_SRC) \
 	$(QUANTUM_PATH)/debounce/sym_defer_pr.c \
@@ -53,3 +61,71 @@ debounce_asym_eager_defer_pk_DEFS := $(DEBOUNCE_COMMON_DEFS)
 debounce_asym_eager_defer_pk_SRC := $(DEBOUNCE_COMMON_SRC) \
 	$(QUANTUM_PATH)/debounce/asym_eager_defer_pk.c \
 	$(QUANTUM_PATH)/debounce/tests/asym_eager_defer_pk_tests.cpp
+
+debounce_sym_defer_pk_per_key_DEFS := $(DEBOUNCE_COMMON_DEFS) -DDEBOUNCE_PER_KEY_ENABLE
+debounce_sym_defer_pk_per_key_SRC := $(DEBOUNCE_COMMON_SRC) \
+	$(QUANTUM_PATH)/debounce_per_key.c \
+	$(QUANTUM_PATH)/debounce/sym_defer_pk.c \
+	$(QUANTUM_PATH)/debounce/tests/sym_defer_pk_per_key_tests.cpp
+
+# a keymap overriding the DEBOUNCE of keyboard.json
+debounce_sym_defer_pk_per_key_debounce_DEFS := -DMATRIX_ROWS=4 -DMATRIX_COLS=10 -DDEBOUNCE=10 -DDEBOUNCE_PER_KEY_ENABLE
+debounce_sym_defer_pk_per_key_debounce_SRC := $(DEBOUNCE_COMMON_SRC) \
+	$(QUANTUM_PATH)/debounce_per_key.c \
+	$(QUANTUM_PATH)/debounce/sym_defer_pk.c \
+	$(QUANTUM_PATH)/debounce/tests/sym_defer_pk_per_key_debounce_tests.cpp
+
+debounce_asym_adaptive_pk_DEFS := $(DEBOUNCE_COMMON_DEFS)
+debounce_asym_adaptive_pk_SRC := $(DEBOUNCE_COMMON_SRC) \
+	$(QUANTUM_PATH)/debounce/asym_adaptive_pk.c \
+	$(QUANTUM_PATH)/debounce/tests/asym_adaptive_pk_tests.cpp
+
+debounce_sym_defer_pk_static_DEFS := $(DEBOUNCE_STATIC_DEFS)
+debounce_sym_defer_pk_static_SRC := $(DEBOUNCE_COMMON_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_defer_pk.c \
+	$(QUANTUM_PATH)/debounce/tests/sym_defer_pk_tests.cpp
+
+debounce_sym_defer_pk_bitsliced_static_DEFS := $(DEBOUNCE_STATIC_DEFS)
+debounce_sym_defer_pk_bitsliced_static_SRC := $(DEBOUNCE_COMMON_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_defer_pk_bitsliced.c \
+	$(QUANTUM_PATH)/debounce/tests/sym_defer_pk_tests.cpp
+
+debounce_sym_defer_pr_static_DEFS := $(DEBOUNCE_STATIC_DEFS)
+debounce_sym_defer_pr_static_SRC := $(DEBOUNCE_COMMON_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_defer_pr.c \
+	$(QUANTUM_PATH)/debounce/tests/sym_defer_pr_tests.cpp
+
+debounce_sym_eager_pk_static_DEFS := $(DEBOUNCE_STATIC_DEFS)
+debounce_sym_eager_pk_static_SRC := $(DEBOUNCE_COMMON_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_eager_pk.c \
+	$(QUANTUM_PATH)/debounce/tests/sym_eager_pk_tests.cpp
+
+debounce_sym_eager_pr_static_DEFS := $(DEBOUNCE_STATIC_DEFS)
+debounce_sym_eager_pr_static_SRC := $(DEBOUNCE_COMMON_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_eager_pr.c \
+	$(QUANTUM_PATH)/debounce/tests/sym_eager_pr_tests.cpp
+
+debounce_asym_eager_defer_pk_static_DEFS := $(DEBOUNCE_STATIC_DEFS)
+debounce_asym_eager_defer_pk_static_SRC := $(DEBOUNCE_COMMON_SRC) \
+	$(QUANTUM_PATH)/debounce/asym_eager_defer_pk.c \
+	$(QUANTUM_PATH)/debounce/tests/asym_eager_defer_pk_tests.cpp
+
+debounce_asym_adaptive_pk_static_DEFS := $(DEBOUNCE_STATIC_DEFS)
+debounce_asym_adaptive_pk_static_SRC := $(DEBOUNCE_COMMON_SRC) \
+	$(QUANTUM_PATH)/debounce/asym_adaptive_pk.c \
+	$(QUANTUM_PATH)/debounce/tests/asym_adaptive_pk_tests.cpp
+
+debounce_benchmark_sym_defer_pk_DEFS := $(DEBOUNCE_BENCHMARK_DEFS)
+debounce_benchmark_sym_defer_pk_SRC := $(DEBOUNCE_COMMON_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_defer_pk.c \
+	$(QUANTUM_PATH)/debounce/tests/debounce_benchmark.cpp
+
+debounce_benchmark_sym_defer_pk_bitsliced_DEFS := $(DEBOUNCE_BENCHMARK_DEFS)
+debounce_benchmark_sym_defer_pk_bitsliced_SRC := $(DEBOUNCE_COMMON_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_defer_pk_bitsliced.c \
+	$(QUANTUM_PATH)/debounce/tests/debounce_benchmark.cpp
+
+debounce_benchmark_sym_defer_pk_static_DEFS := $(DEBOUNCE_BENCHMARK_DEFS) -DDEBOUNCE_STATIC_ALLOCATION
+debounce_benchmark_sym_defer_pk_static_SRC := $(DEBOUNCE_COMMON_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_defer_pk.c \
+	$(QUANTUM_PATH)/debounce/tests/debounce_benchmark.cpp
@@ -0,0 +1,42 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include "debounce_test_common.h"
+
+extern "C" {
+#include "debounce_per_key.h"
+}
+
+/* Built with DEBOUNCE overriding the 5ms of keyboard.json, key (0, 1) sets 5ms on its own */
+static_assert(DEBOUNCE == 10, "the keymap is expected to override DEBOUNCE");
+
+const debounce_per_key_table_t debounce_per_key_defaults = {
+    {DEBOUNCE, 5},
+    {
+        {0x10, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00},
+    },
+};
+
+TEST_F(DebounceTest, PerKeyOverriddenDefault) {
+    debounce_per_key_init();
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}, {0, 2, DOWN}}, {}},
+
+        {5, {}, {{0, 1, DOWN}}},
+        {10, {}, {{0, 2, DOWN}}},
+    });
+    runEvents();
+}
+
+TEST(DebouncePerKey, OverriddenDefaultTime) {
+    debounce_per_key_init();
+    EXPECT_EQ(debounce_per_key_get_time(0, 1), 5);
+    EXPECT_EQ(debounce_per_key_get_time(0, 2), 10);
+    EXPECT_EQ(debounce_per_key_get_time(3, 9), 10);
+}
@@ -0,0 +1,116 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include "debounce_test_common.h"
+
+extern "C" {
+#include "debounce_per_key.h"
+}
+
+/* 4x10 matrix: key (0, 1) debounces for 20ms, key (2, 3) for 12ms, all the others for DEBOUNCE */
+const debounce_per_key_table_t debounce_per_key_defaults = {
+    {DEBOUNCE, 20, 12},
+    {
+        {0x10, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x20, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00},
+    },
+};
+
+TEST_F(DebounceTest, PerKeyDefaultTimes) {
+    debounce_per_key_init();
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}, {0, 2, DOWN}, {2, 3, DOWN}}, {}},
+
+        {5, {}, {{0, 2, DOWN}}},
+        {12, {}, {{2, 3, DOWN}}},
+        {20, {}, {{0, 1, DOWN}}},
+
+        {25, {{0, 1, UP}, {0, 2, UP}, {2, 3, UP}}, {}},
+
+        {30, {}, {{0, 2, UP}}},
+        {37, {}, {{2, 3, UP}}},
+        {45, {}, {{0, 1, UP}}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, PerKeyLongTimeChatter) {
+    debounce_per_key_init();
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}}, {}},
+        /* Bounces that a 5ms debounce would let through */
+        {6, {{0, 1, UP}}, {}},
+        {12, {{0, 1, DOWN}}, {}},
+        {18, {{0, 1, UP}}, {}},
+        {24, {{0, 1, DOWN}}, {}},
+
+        {44, {}, {{0, 1, DOWN}}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, PerKeySetTime) {
+    debounce_per_key_init();
+    EXPECT_TRUE(debounce_per_key_set_time(1, 0, 30));
+    EXPECT_TRUE(debounce_per_key_set_time(0, 1, 5));
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}, {1, 0, DOWN}}, {}},
+
+        {5, {}, {{0, 1, DOWN}}},
+        {30, {}, {{1, 0, DOWN}}},
+    });
+    runEvents();
+}
+
+TEST(DebouncePerKey, GetTime) {
+    debounce_per_key_init();
+    EXPECT_EQ(debounce_per_key_get_time(0, 0), 5);
+    EXPECT_EQ(debounce_per_key_get_time(0, 1), 20);
+    EXPECT_EQ(debounce_per_key_get_time(2, 3), 12);
+    EXPECT_EQ(debounce_per_key_get_time(3, 9), 5);
+}
+
+TEST(DebouncePerKey, SetTimeSharesClasses) {
+    debounce_per_key_init();
+    EXPECT_TRUE(debounce_per_key_set_time(3, 9, 20));
+    EXPECT_EQ(debounce_per_key_get_time(3, 9), 20);
+    EXPECT_EQ(debounce_per_key_table.times[1], 20);
+    EXPECT_EQ(debounce_per_key_table.classes[3][4], 0x10);
+
+    /* Key (2, 3) is alone in its class, the class time changes in place */
+    EXPECT_TRUE(debounce_per_key_set_time(2, 3, 15));
+    EXPECT_EQ(debounce_per_key_get_time(2, 3), 15);
+    EXPECT_EQ(debounce_per_key_table.times[2], 15);
+
+    /* Back to the default time frees the class */
+    EXPECT_TRUE(debounce_per_key_set_time(2, 3, 5));
+    EXPECT_EQ(debounce_per_key_table.times[2], 0);
+    EXPECT_EQ(debounce_per_key_table.classes[2][1], 0x00);
+
+    EXPECT_TRUE(debounce_per_key_set_time(2, 3, 0));
+    EXPECT_EQ(debounce_per_key_get_time(2, 3), 1);
+}
+
+TEST(DebouncePerKey, SetTimeOutOfClasses) {
+    debounce_per_key_init();
+    /* Classes 0 to 2 are in use, fill the other 13 */
+    for (uint8_t i = 0; i < DEBOUNCE_PER_KEY_CLASSES - 3; i++) {
+        EXPECT_TRUE(debounce_per_key_set_time(1 + i / MATRIX_COLS, i % MATRIX_COLS, 100 + i));
+    }
+    EXPECT_FALSE(debounce_per_key_set_time(3, 0, 50));
+    EXPECT_EQ(debounce_per_key_get_time(3, 0), 5);
+
+    /* Existing times can still be used */
+    EXPECT_TRUE(debounce_per_key_set_time(3, 0, 20));
+    EXPECT_EQ(debounce_per_key_get_time(3, 0), 20);
+
+    EXPECT_FALSE(debounce_per_key_set_time(MATRIX_ROWS, 0, 20));
+    EXPECT_FALSE(debounce_per_key_set_time(0, MATRIX_COLS, 20));
+}
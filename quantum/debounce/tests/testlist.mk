@@ -2,7 +2,21 @@ TEST_LIST += \
 	debounce_none \
 	debounce_sym_defer_g \
 	debounce_sym_defer_pk \
+	debounce_sym_defer_pk_bitsliced \
 	debounce_sym_defer_pr \
 	debounce_sym_eager_pk \
 	debounce_sym_eager_pr \
-	debounce_asym_eager_defer_pk
+	debounce_asym_eager_defer_pk \
+	debounce_asym_adaptive_pk \
+	debounce_sym_defer_pk_per_key \
+	debounce_sym_defer_pk_per_key_debounce \
+	debounce_sym_defer_pk_static \
+	debounce_sym_defer_pk_bitsliced_static \
+	debounce_sym_defer_pr_static \
+	debounce_sym_eager_pk_static \
+	debounce_sym_eager_pr_static \
+	debounce_asym_eager_defer_pk_static \
+	debounce_asym_adaptive_pk_static \
+	debounce_benchmark_sym_defer_pk \
+	debounce_benchmark_sym_defer_pk_bitsliced \
+	debounce_benchmark_sym_defer_pk_static
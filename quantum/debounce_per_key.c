@@ -0,0 +1,93 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "debounce_per_key.h"
+#include "progmem.h"
+
+#ifdef SPLIT_KEYBOARD
+#    include "split_util.h"
+#endif
+
+debounce_per_key_table_t debounce_per_key_table;
+
+void debounce_per_key_init(void) {
+    memcpy_P(&debounce_per_key_table, &debounce_per_key_defaults, sizeof(debounce_per_key_table));
+}
+
+uint8_t debounce_per_key_get_hand_time(uint8_t row, uint8_t col) {
+#ifdef SPLIT_KEYBOARD
+    if (!isLeftHand) {
+        row += MATRIX_ROWS_PER_HAND;
+    }
+#endif
+    return debounce_per_key_get_time(row, col);
+}
+
+static uint8_t get_class(uint8_t row, uint8_t col) {
+    uint8_t classes = debounce_per_key_table.classes[row][col / 2];
+    return (col & 1) ? classes >> 4 : classes & 0x0F;
+}
+
+static void set_class(uint8_t row, uint8_t col, uint8_t class) {
+    uint8_t *classes = &debounce_per_key_table.classes[row][col / 2];
+    if (col & 1) {
+        *classes = (*classes & 0x0F) | (class << 4);
+    } else {
+        *classes = (*classes & 0xF0) | class;
+    }
+}
+
+static uint16_t count_class_keys(uint8_t class) {
+    uint16_t count = 0;
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (get_class(row, col) == class) {
+                count++;
+            }
+        }
+    }
+    return count;
+}
+
+bool debounce_per_key_set_time(uint8_t row, uint8_t col, uint8_t time) {
+    if (row >= MATRIX_ROWS || col >= MATRIX_COLS) {
+        return false;
+    }
+    if (time == 0) {
+        time = 1;
+    }
+
+    uint8_t *times     = debounce_per_key_table.times;
+    uint8_t  old_class = get_class(row, col);
+    uint8_t  new_class = 0;
+
+    // share the class of the keys that already have this time
+    while (new_class < DEBOUNCE_PER_KEY_CLASSES && times[new_class] != time) {
+        new_class++;
+    }
+
+    if (new_class == DEBOUNCE_PER_KEY_CLASSES) {
+        if (old_class != 0 && count_class_keys(old_class) == 1) {
+            // the key is alone in its class, change the class time
+            times[old_class] = time;
+            return true;
+        }
+
+        // otherwise take a free class
+        new_class = 1;
+        while (new_class < DEBOUNCE_PER_KEY_CLASSES && times[new_class] != 0) {
+            new_class++;
+        }
+        if (new_class == DEBOUNCE_PER_KEY_CLASSES) {
+            return false;
+        }
+        times[new_class] = time;
+    }
+
+    set_class(row, col, new_class);
+    if (old_class != 0 && old_class != new_class && count_class_keys(old_class) == 0) {
+        times[old_class] = 0;
+    }
+    return true;
+}
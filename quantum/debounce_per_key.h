@@ -0,0 +1,60 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "matrix.h"
+
+/* Per-key debounce times.
+ *
+ * Each key refers to one of DEBOUNCE_PER_KEY_CLASSES debounce times through a
+ * 4-bit class, two keys to a byte. Class 0 holds the default time, DEBOUNCE,
+ * and is used by every key that doesn't have a time of its own, unused classes
+ * hold 0.
+ */
+#ifndef DEBOUNCE
+#    define DEBOUNCE 5
+#endif
+
+// the times are stored in a byte, class 0 included
+#if DEBOUNCE > UINT8_MAX
+#    error "DEBOUNCE must not exceed 255 with DEBOUNCE_PER_KEY_ENABLE"
+#endif
+
+#define DEBOUNCE_PER_KEY_CLASSES 16
+#define DEBOUNCE_PER_KEY_ROW_BYTES ((MATRIX_COLS + 1) / 2)
+#define DEBOUNCE_PER_KEY_TABLE_SIZE (DEBOUNCE_PER_KEY_CLASSES + MATRIX_ROWS * DEBOUNCE_PER_KEY_ROW_BYTES)
+
+typedef struct {
+    uint8_t times[DEBOUNCE_PER_KEY_CLASSES];
+    uint8_t classes[MATRIX_ROWS][DEBOUNCE_PER_KEY_ROW_BYTES];
+} debounce_per_key_table_t;
+
+/** \brief Default table, generated from the `debounce` values of the keys in keyboard.json */
+extern const debounce_per_key_table_t debounce_per_key_defaults;
+
+/** \brief Table in use, loaded from the defaults and changed at runtime */
+extern debounce_per_key_table_t debounce_per_key_table;
+
+/** \brief Loads the default table. */
+void debounce_per_key_init(void);
+
+/** \brief Gets the debounce time of a key, in milliseconds. */
+static inline uint8_t debounce_per_key_get_time(uint8_t row, uint8_t col) {
+    uint8_t classes = debounce_per_key_table.classes[row][col / 2];
+    return debounce_per_key_table.times[(col & 1) ? classes >> 4 : classes & 0x0F];
+}
+
+/** \brief Gets the debounce time of a key, with the row relative to this half of a split keyboard. */
+uint8_t debounce_per_key_get_hand_time(uint8_t row, uint8_t col);
+
+/**
+ * \brief Sets the debounce time of a key, in milliseconds.
+ *
+ * A time of 0 is raised to 1ms.
+ *
+ * \return false if the key is out of range or every class is already in use by other times.
+ */
+bool debounce_per_key_set_time(uint8_t row, uint8_t col, uint8_t time);
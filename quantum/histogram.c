@@ -0,0 +1,112 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "histogram.h"
+
+// Bucket 0 and 1 hold 0 and 1, then each power of two is split in two
+// halves: [2^n, 1.5 * 2^n) and [1.5 * 2^n, 2^(n+1)).
+static uint8_t bucket_index(uint16_t value) {
+    if (value < 2) {
+        return value;
+    }
+    uint8_t octave = 1;
+    while (value >> (octave + 1)) {
+        octave++;
+    }
+    return octave * 2 + ((value >> (octave - 1)) & 1);
+}
+
+static uint32_t bucket_lower_bound(uint8_t index) {
+    if (index < 2) {
+        return index;
+    }
+    return (uint32_t)(2 + (index & 1)) << (index / 2 - 1);
+}
+
+static uint16_t bucket_upper_bound(uint8_t index) {
+    return bucket_lower_bound(index + 1) - 1;
+}
+
+// Keeps the shape of the histogram when a bucket is about to overflow.
+static void halve(histogram_t *histogram) {
+    histogram->count = 0;
+    for (uint8_t i = 0; i < HISTOGRAM_BUCKETS; i++) {
+        histogram->buckets[i] >>= 1;
+        histogram->count += histogram->buckets[i];
+    }
+    histogram->total >>= 1;
+}
+
+static uint16_t percentile(const histogram_t *histogram, uint8_t percent) {
+    uint32_t target = (histogram->count * percent + 99) / 100; // count is at most HISTOGRAM_BUCKETS * UINT16_MAX
+    uint32_t seen   = 0;
+    uint8_t  i      = 0;
+
+    for (; i < HISTOGRAM_BUCKETS - 1; i++) {
+        seen += histogram->buckets[i];
+        if (seen >= target) {
+            break;
+        }
+    }
+
+    uint16_t value = bucket_upper_bound(i);
+    if (value > histogram->max) {
+        return histogram->max;
+    }
+    if (value < histogram->min) {
+        return histogram->min;
+    }
+    return value;
+}
+
+void histogram_record(histogram_t *histogram, uint32_t value) {
+    uint16_t sample = value > UINT16_MAX ? UINT16_MAX : value;
+    uint8_t  bucket = bucket_index(sample);
+
+    if (histogram->count == 0 || sample < histogram->min) {
+        histogram->min = sample;
+    }
+    if (sample > histogram->max) {
+        histogram->max = sample;
+    }
+    if (histogram->buckets[bucket] == UINT16_MAX || histogram->total > UINT32_MAX - sample) {
+        halve(histogram);
+    }
+    histogram->buckets[bucket]++;
+    histogram->count++;
+    histogram->total += sample;
+}
+
+void histogram_reset(histogram_t *histogram) {
+    memset(histogram, 0, sizeof(histogram_t));
+}
+
+void histogram_get(const histogram_t *histogram, histogram_summary_t *summary) {
+    memset(summary, 0, sizeof(histogram_summary_t));
+    if (histogram->count == 0) {
+        return;
+    }
+    summary->count = histogram->count;
+    summary->min   = histogram->min;
+    summary->p50   = percentile(histogram, 50);
+    summary->p99   = percentile(histogram, 99);
+    summary->max   = histogram->max;
+    summary->avg   = histogram->total / histogram->count;
+}
+
+static uint8_t *pack16(uint8_t *data, uint16_t value) {
+    *data++ = value >> 8;
+    *data++ = value & 0xFF;
+    return data;
+}
+
+void histogram_summary_pack(const histogram_summary_t *summary, uint8_t *data) {
+    data = pack16(data, summary->count >> 16);
+    data = pack16(data, summary->count & 0xFFFF);
+    data = pack16(data, summary->min);
+    data = pack16(data, summary->p50);
+    data = pack16(data, summary->p99);
+    data = pack16(data, summary->max);
+    pack16(data, summary->avg);
+}
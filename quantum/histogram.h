@@ -0,0 +1,44 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+/* Histogram of 16-bit durations, with two buckets per power of two.
+ *
+ * Percentiles are estimated from the buckets, rounded up to the end of their
+ * bucket. When a bucket is about to overflow, all of them are halved so the
+ * shape of the distribution is kept.
+ */
+
+#define HISTOGRAM_BUCKETS 32
+
+typedef struct {
+    uint32_t count;
+    uint32_t total;
+    uint16_t min;
+    uint16_t max;
+    uint16_t buckets[HISTOGRAM_BUCKETS];
+} histogram_t;
+
+typedef struct {
+    uint32_t count;
+    uint16_t min;
+    uint16_t p50;
+    uint16_t p99;
+    uint16_t max;
+    uint16_t avg;
+} histogram_summary_t;
+
+/** \brief Adds a sample, saturated to UINT16_MAX. */
+void histogram_record(histogram_t *histogram, uint32_t value);
+
+/** \brief Removes every sample. */
+void histogram_reset(histogram_t *histogram);
+
+/** \brief Gets the statistics of the samples, all zero if there are none. */
+void histogram_get(const histogram_t *histogram, histogram_summary_t *summary);
+
+/** \brief Packs a summary big-endian: count (4 bytes), then min, p50, p99, max and avg (2 bytes each). */
+void histogram_summary_pack(const histogram_summary_t *summary, uint8_t *data);
@@ -0,0 +1,86 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "key_event_queue.h"
+#include "compiler_support.h"
+
+#ifdef KEY_EVENT_QUEUE_SCAN_THREAD
+#    if !defined(PROTOCOL_CHIBIOS)
+#        error "KEY_EVENT_QUEUE_SCAN_THREAD requires ChibiOS"
+#    endif
+#    ifdef SPLIT_KEYBOARD
+#        error "KEY_EVENT_QUEUE_SCAN_THREAD is not supported on split keyboards, their matrix scan talks to the other half"
+#    endif
+#    if defined(PROFILER_ENABLE) || defined(DEBUG_MATRIX_SCAN_RATE) || defined(LATENCY_TRACE_ENABLE)
+#        error "KEY_EVENT_QUEUE_SCAN_THREAD can't be used with PROFILER_ENABLE, DEBUG_MATRIX_SCAN_RATE_ENABLE or LATENCY_TRACE_ENABLE, their state is not shared safely with the scan thread"
+#    endif
+#    include <ch.h>
+#endif
+
+// the indices run freely and wrap together with the buffer
+STATIC_ASSERT((KEY_EVENT_QUEUE_SIZE & (KEY_EVENT_QUEUE_SIZE - 1)) == 0, "KEY_EVENT_QUEUE_SIZE must be a power of two");
+STATIC_ASSERT(KEY_EVENT_QUEUE_SIZE <= 128, "KEY_EVENT_QUEUE_SIZE must not exceed 128");
+
+static keyevent_t events[KEY_EVENT_QUEUE_SIZE];
+static uint8_t    head = 0; // written by the producer
+static uint8_t    tail = 0; // written by the consumer
+
+bool key_event_queue_push(keyevent_t event) {
+    uint8_t current = head;
+    // the consumer publishes the tail after it read the event
+    if ((uint8_t)(current - __atomic_load_n(&tail, __ATOMIC_ACQUIRE)) == KEY_EVENT_QUEUE_SIZE) {
+        return false;
+    }
+    events[current % KEY_EVENT_QUEUE_SIZE] = event;
+    // the event has to be complete before the consumer can see it
+    __atomic_store_n(&head, (uint8_t)(current + 1), __ATOMIC_RELEASE);
+    return true;
+}
+
+bool key_event_queue_pop(keyevent_t *event) {
+    uint8_t current = tail;
+    if (__atomic_load_n(&head, __ATOMIC_ACQUIRE) == current) {
+        return false;
+    }
+    *event = events[current % KEY_EVENT_QUEUE_SIZE];
+    __atomic_store_n(&tail, (uint8_t)(current + 1), __ATOMIC_RELEASE);
+    return true;
+}
+
+uint8_t key_event_queue_count(void) {
+    return (uint8_t)(__atomic_load_n(&head, __ATOMIC_ACQUIRE) - __atomic_load_n(&tail, __ATOMIC_ACQUIRE));
+}
+
+void key_event_queue_clear(void) {
+    __atomic_store_n(&tail, __atomic_load_n(&head, __ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
+}
+
+#ifdef KEY_EVENT_QUEUE_SCAN_THREAD
+static THD_WORKING_AREA(scan_thread_wa, KEY_EVENT_QUEUE_SCAN_THREAD_STACK);
+
+// held by the scan thread while it scans, and by the main thread while the scan is paused
+static MUTEX_DECL(scan_mutex);
+
+static THD_FUNCTION(scan_thread, arg) {
+    (void)arg;
+    chRegSetThreadName("matrix_scan");
+    while (true) {
+        chMtxLock(&scan_mutex);
+        keyboard_scan_task();
+        chMtxUnlock(&scan_mutex);
+        chThdSleepMicroseconds(KEY_EVENT_QUEUE_SCAN_INTERVAL);
+    }
+}
+
+void key_event_queue_scan_thread_start(void) {
+    chThdCreateStatic(scan_thread_wa, sizeof(scan_thread_wa), KEY_EVENT_QUEUE_SCAN_THREAD_PRIO, scan_thread, NULL);
+}
+
+void key_event_queue_scan_thread_pause(void) {
+    chMtxLock(&scan_mutex);
+}
+
+void key_event_queue_scan_thread_resume(void) {
+    chMtxUnlock(&scan_mutex);
+}
+#endif
@@ -0,0 +1,65 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "keyboard.h"
+
+/* Key event queue between the matrix scan and the action processing.
+ *
+ * The scan pushes the key events it finds, stamped with the time of the scan,
+ * and the action stage pops them in the same order. There is exactly one
+ * producer and one consumer, which lets the queue work without locks: the
+ * producer only writes the head and the consumer only writes the tail.
+ *
+ * When the queue is full, the scan leaves the remaining changes of the matrix
+ * unconsumed and picks them up again on a later scan, so no event is lost.
+ *
+ * With KEY_EVENT_QUEUE_SCAN_THREAD on ChibiOS, the matrix is scanned by its own
+ * thread and the main loop only drains the queue.
+ */
+
+#ifndef KEY_EVENT_QUEUE_SIZE
+#    define KEY_EVENT_QUEUE_SIZE 16
+#endif
+
+#ifndef KEY_EVENT_QUEUE_SCAN_INTERVAL
+#    define KEY_EVENT_QUEUE_SCAN_INTERVAL 1000 // microseconds between the scans of the scan thread
+#endif
+
+#ifndef KEY_EVENT_QUEUE_SCAN_THREAD_STACK
+#    define KEY_EVENT_QUEUE_SCAN_THREAD_STACK 512
+#endif
+
+#ifndef KEY_EVENT_QUEUE_SCAN_THREAD_PRIO
+#    define KEY_EVENT_QUEUE_SCAN_THREAD_PRIO (NORMALPRIO + 1)
+#endif
+
+/** \brief Adds an event at the head of the queue, producer only. Returns false if the queue is full. */
+bool key_event_queue_push(keyevent_t event);
+
+/** \brief Removes the event at the tail of the queue, consumer only. Returns false if the queue is empty. */
+bool key_event_queue_pop(keyevent_t *event);
+
+/** \brief Gets the number of queued events. */
+uint8_t key_event_queue_count(void);
+
+/** \brief Drops every queued event, consumer only. */
+void key_event_queue_clear(void);
+
+#ifdef KEY_EVENT_QUEUE_SCAN_THREAD
+/** \brief Scans the matrix into the queue, called by the scan thread. Implemented in keyboard.c. */
+bool keyboard_scan_task(void);
+
+/** \brief Starts the scan thread. */
+void key_event_queue_scan_thread_start(void);
+
+/** \brief Waits for the current scan to finish and stops the scan thread, so the main
+ * thread can scan the matrix itself, e.g. for suspend_wakeup_condition(). Not from an ISR. */
+void key_event_queue_scan_thread_pause(void);
+
+/** \brief Lets the scan thread scan again after key_event_queue_scan_thread_pause(). */
+void key_event_queue_scan_thread_resume(void);
+#endif
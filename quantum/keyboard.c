@@ -32,6 +32,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "sendchar.h"
 #include "eeconfig.h"
 #include "action_layer.h"
+#include "profiler.h"
 #ifdef BOOTMAGIC_ENABLE
 #    include "bootmagic.h"
 #endif
@@ -104,6 +105,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef VIA_ENABLE
 #    include "via.h"
 #endif
+#ifdef DEBOUNCE_PER_KEY_ENABLE
+#    include "debounce_per_key.h"
+#endif
 #ifdef DIP_SWITCH_ENABLE
 #    include "dip_switch.h"
 #endif
@@ -149,6 +153,24 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef CONNECTION_ENABLE
 #    include "connection.h"
 #endif
+#ifdef SCAN_STATS_ENABLE
+#    include "scan_stats.h"
+#else
+#    define scan_stats_start()
+#    define scan_stats_lap(section)
+#    define scan_stats_end()
+#endif
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
+#ifdef TAPPING_STATS_ENABLE
+#    include "tapping_stats.h"
+#endif
+#ifdef KEY_EVENT_QUEUE_ENABLE
+#    include "key_event_queue.h"
+#elif defined(KEY_EVENT_QUEUE_SCAN_THREAD)
+#    error "KEY_EVENT_QUEUE_SCAN_THREAD requires KEY_EVENT_QUEUE_ENABLE = yes"
+#endif
 
 static uint32_t last_input_modification_time = 0;
 uint32_t        last_input_activity_time(void) {
@@ -351,6 +373,28 @@ __attribute__((weak)) bool matrix_can_read(void) {
     return true;
 }
 
+/** \brief matrix_wakeup_arm
+ *
+ * Prepares the matrix to detect the next key press without being scanned, for example by
+ * driving every output line and enabling edge interrupts on the input lines. A key change
+ * still being debounced, or one that raised its edge before the interrupts were enabled,
+ * raises no further edge, so the matrix must not be armed while either is pending.
+ *
+ * @return false if the matrix can't be woken up this way right now and has to keep being polled
+ */
+__attribute__((weak)) bool matrix_wakeup_arm(void) {
+    return false;
+}
+
+/** \brief matrix_wakeup_triggered
+ *
+ * Whether an input edge was seen since matrix_wakeup_arm. Once it returns true the matrix
+ * has to be ready to be scanned again.
+ */
+__attribute__((weak)) bool matrix_wakeup_triggered(void) {
+    return true;
+}
+
 /** \brief keyboard_setup
  *
  * FIXME: needs doc
@@ -457,6 +501,9 @@ void quantum_init(void) {
 void keyboard_init(void) {
     timer_init();
     sync_timer_init();
+#ifdef DEBOUNCE_PER_KEY_ENABLE
+    debounce_per_key_init();
+#endif
 #ifdef VIA_ENABLE
     via_init();
 #endif
@@ -545,6 +592,9 @@ void keyboard_init(void) {
 #if defined(DEBUG_MATRIX_SCAN_RATE) && defined(CONSOLE_ENABLE)
     debug_enable = true;
 #endif
+#ifdef KEY_EVENT_QUEUE_SCAN_THREAD
+    key_event_queue_scan_thread_start();
+#endif
 
     keyboard_post_init_quantum(); /* Always keep this last */
 }
@@ -576,73 +626,234 @@ static inline void generate_tick_event(void) {
     }
 }
 
+#ifdef KEY_EVENT_QUEUE_ENABLE
+// the ticks have to follow the queued events, key_event_queue_task() generates them
+#    define generate_scan_tick_event()
+#else
+#    define generate_scan_tick_event() generate_tick_event()
+#endif
+
+#ifdef MATRIX_WAKEUP_ENABLE
+#    ifndef MATRIX_WAKEUP_IDLE_TIME
+#        define MATRIX_WAKEUP_IDLE_TIME 500
+#    endif
+
+static bool     matrix_wakeup_armed  = false;
+static bool     matrix_has_keys_down = false;
+static uint32_t matrix_wakeup_time   = 0;
+
+/**
+ * @brief Stops polling the matrix once no key has been down for
+ * MATRIX_WAKEUP_IDLE_TIME and resumes on the first input edge. If the matrix
+ * can't be armed, it keeps being polled until the next idle time.
+ *
+ * @return true The matrix should be scanned
+ * @return false The matrix is waiting for a wakeup
+ */
+static bool matrix_wakeup_task(void) {
+    if (matrix_wakeup_armed) {
+        if (!matrix_wakeup_triggered()) {
+            return false;
+        }
+        matrix_wakeup_armed = false;
+        matrix_wakeup_time  = timer_read32();
+        return true;
+    }
+
+    // keep polling for a while after waking up, so debouncing can settle
+    if (matrix_has_keys_down || last_matrix_activity_elapsed() < MATRIX_WAKEUP_IDLE_TIME || timer_elapsed32(matrix_wakeup_time) < MATRIX_WAKEUP_IDLE_TIME) {
+        return true;
+    }
+
+    matrix_wakeup_armed = matrix_wakeup_arm();
+    if (!matrix_wakeup_armed) {
+        matrix_wakeup_time = timer_read32();
+    }
+    return !matrix_wakeup_armed;
+}
+#endif
+
+/** \brief matrix_get_changed_rows
+ *
+ * Fallback for matrix implementations which do not track changed rows, every row gets compared.
+ */
+__attribute__((weak)) void matrix_get_changed_rows(uint32_t changed_rows[MATRIX_ROW_BITMAP_WORDS]) {
+    for (uint8_t i = 0; i < MATRIX_ROW_BITMAP_WORDS; i++) {
+        changed_rows[i] = UINT32_MAX;
+    }
+    if (MATRIX_ROWS % 32) {
+        changed_rows[MATRIX_ROW_BITMAP_WORDS - 1] = GENMASK32((MATRIX_ROWS % 32) - 1, 0);
+    }
+}
+
 /**
  * @brief This task scans the keyboards matrix and processes any key presses
  * that occur.
  *
+ * Only the rows flagged by matrix_get_changed_rows are compared against the
+ * previous state, and only the changed columns of those rows are visited.
+ *
  * @return true Matrix did change
  * @return false Matrix didn't change
  */
 static bool matrix_task(void) {
+    PROFILER_SCOPE("matrix_task");
+
     if (!matrix_can_read()) {
-        generate_tick_event();
+        generate_scan_tick_event();
+        return false;
+    }
+
+#ifdef MATRIX_WAKEUP_ENABLE
+    if (!matrix_wakeup_task()) {
+#    ifndef KEY_EVENT_QUEUE_SCAN_THREAD
+        // matrix_scan() isn't called while armed, keep the periodic work of the keyboard and keymap going
+        matrix_scan_kb();
+#    endif
+        generate_scan_tick_event();
         return false;
     }
+#endif
 
     static matrix_row_t matrix_previous[MATRIX_ROWS];
+#if defined(MATRIX_HAS_GHOST) || defined(KEY_EVENT_QUEUE_ENABLE)
+    // ghosted rows, and changes that did not fit in the key event queue, are not
+    // consumed, so they have to be checked again on the next scan
+    static uint32_t unconsumed_rows[MATRIX_ROW_BITMAP_WORDS];
+#endif
 
     matrix_scan();
-    bool matrix_changed = false;
-    for (uint8_t row = 0; row < MATRIX_ROWS && !matrix_changed; row++) {
-        matrix_changed |= matrix_previous[row] ^ matrix_get_row(row);
-    }
+
+    uint32_t changed_rows[MATRIX_ROW_BITMAP_WORDS];
+    matrix_get_changed_rows(changed_rows);
 
     matrix_scan_perf_task();
 
-    // Short-circuit the complete matrix processing if it is not necessary
-    if (!matrix_changed) {
-        generate_tick_event();
-        return matrix_changed;
-    }
+    bool matrix_changed   = false;
+    bool process_keypress = false;
 
-    if (debug_config.matrix) {
-        matrix_print();
-    }
+    for (uint8_t word = 0; word < MATRIX_ROW_BITMAP_WORDS; word++) {
+        uint32_t rows = changed_rows[word];
+#if defined(MATRIX_HAS_GHOST) || defined(KEY_EVENT_QUEUE_ENABLE)
+        rows |= unconsumed_rows[word];
+        unconsumed_rows[word] = 0;
+#endif
 
-    const bool process_keypress = should_process_keypress();
+        while (rows) {
+            const uint8_t row = word * 32 + __builtin_ctzl(rows);
+            rows &= rows - 1;
 
-    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
-        const matrix_row_t current_row = matrix_get_row(row);
-        const matrix_row_t row_changes = current_row ^ matrix_previous[row];
+            const matrix_row_t current_row = matrix_get_row(row);
+            const matrix_row_t row_changes = current_row ^ matrix_previous[row];
 
-        if (!row_changes || has_ghost_in_row(row, current_row)) {
-            continue;
-        }
+            if (!row_changes) {
+                continue;
+            }
+
+            if (!matrix_changed) {
+                matrix_changed = true;
+
+#ifndef KEY_EVENT_QUEUE_SCAN_THREAD
+                if (debug_config.matrix) {
+                    matrix_print();
+                }
+#endif
+
+                process_keypress = should_process_keypress();
+            }
+
+            if (has_ghost_in_row(row, current_row)) {
+#ifdef MATRIX_HAS_GHOST
+                unconsumed_rows[word] |= BIT32(row % 32);
+#endif
+                continue;
+            }
 
-        matrix_row_t col_mask = 1;
-        for (uint8_t col = 0; col < MATRIX_COLS; col++, col_mask <<= 1) {
-            if (row_changes & col_mask) {
-                const bool key_pressed = current_row & col_mask;
+            matrix_row_t col_changes = row_changes;
+            matrix_row_t deferred    = 0;
+            while (col_changes) {
+                const uint8_t col = __builtin_ctzl(col_changes);
+                if (col >= MATRIX_COLS) {
+                    break;
+                }
+                col_changes &= col_changes - 1;
+
+                const bool key_pressed = current_row & (MATRIX_ROW_SHIFTER << col);
 
                 if (process_keypress) {
+#ifdef KEY_EVENT_QUEUE_ENABLE
+                    if (!key_event_queue_push(MAKE_KEYEVENT(row, col, key_pressed))) {
+                        // the queue is full, this key and the rest of the row wait for a later scan
+                        deferred = col_changes | (MATRIX_ROW_SHIFTER << col);
+                        unconsumed_rows[word] |= BIT32(row % 32);
+                        break;
+                    }
+                    // key_event_queue_task() calls switch_events() when the event is popped
+                    continue;
+#else
                     action_exec(MAKE_KEYEVENT(row, col, key_pressed));
+#endif
                 }
 
                 switch_events(row, col, key_pressed);
             }
+
+            matrix_previous[row] = current_row ^ deferred;
         }
+    }
+
+    // Short-circuit the complete matrix processing if it is not necessary
+    if (!matrix_changed) {
+        generate_scan_tick_event();
+        return matrix_changed;
+    }
 
-        matrix_previous[row] = current_row;
+#ifdef MATRIX_WAKEUP_ENABLE
+    matrix_has_keys_down = false;
+    for (uint8_t row = 0; row < MATRIX_ROWS && !matrix_has_keys_down; row++) {
+        matrix_has_keys_down = matrix_previous[row];
     }
+#endif
 
     return matrix_changed;
 }
 
+#ifdef KEY_EVENT_QUEUE_ENABLE
+/** \brief Hands the queued key events over to the action processing and the switch events
+ *
+ * Generates a tick event instead when there are none.
+ *
+ * \return true if there were any events
+ */
+static bool key_event_queue_task(void) {
+    keyevent_t event;
+
+    if (!key_event_queue_pop(&event)) {
+        generate_tick_event();
+        return false;
+    }
+    do {
+        action_exec(event);
+        switch_events(event.key.row, event.key.col, event.pressed);
+    } while (key_event_queue_pop(&event));
+    return true;
+}
+#endif
+
+#ifdef KEY_EVENT_QUEUE_SCAN_THREAD
+// Only scans, debounces and queues the key events, everything else runs in the main loop
+bool keyboard_scan_task(void) {
+    return matrix_task();
+}
+#endif
+
 /** \brief Tasks previously located in matrix_scan_quantum
  *
  * TODO: rationalise against keyboard_task and current split role
  */
 void quantum_task(void) {
+    PROFILER_SCOPE("quantum_task");
+
 #ifdef SPLIT_KEYBOARD
     // some tasks should only run on master
     if (!is_keyboard_master()) return;
@@ -699,44 +910,248 @@ void quantum_task(void) {
 #ifdef LAYER_LOCK_ENABLE
     layer_lock_task();
 #endif
+
+#ifdef TAPPING_STATS_ENABLE
+    tapping_stats_task();
+#endif
+}
+
+/* Periods of the tasks run by keyboard_task(), in milliseconds. A period of 0
+ * runs the task on every iteration, as fast as the matrix is scanned.
+ */
+#ifndef RGBLIGHT_TASK_PERIOD
+#    define RGBLIGHT_TASK_PERIOD 0
+#endif
+#ifndef LED_MATRIX_TASK_PERIOD
+#    define LED_MATRIX_TASK_PERIOD 0
+#endif
+#ifndef RGB_MATRIX_TASK_PERIOD
+#    define RGB_MATRIX_TASK_PERIOD 0
+#endif
+#ifndef BACKLIGHT_TASK_PERIOD
+#    define BACKLIGHT_TASK_PERIOD 0
+#endif
+#ifndef OLED_TASK_PERIOD
+#    define OLED_TASK_PERIOD 0
+#endif
+#ifndef ST7565_TASK_PERIOD
+#    define ST7565_TASK_PERIOD 0
+#endif
+#ifndef MOUSEKEY_TASK_PERIOD
+#    define MOUSEKEY_TASK_PERIOD 0
+#endif
+#ifndef PS2_MOUSE_TASK_PERIOD
+#    define PS2_MOUSE_TASK_PERIOD 0
+#endif
+#ifndef MIDI_TASK_PERIOD
+#    define MIDI_TASK_PERIOD 0
+#endif
+#ifndef JOYSTICK_TASK_PERIOD
+#    define JOYSTICK_TASK_PERIOD 0
+#endif
+#ifndef BATTERY_TASK_PERIOD
+#    define BATTERY_TASK_PERIOD 0
+#endif
+#ifndef BLUETOOTH_TASK_PERIOD
+#    define BLUETOOTH_TASK_PERIOD 0
+#endif
+#ifndef HAPTIC_TASK_PERIOD
+#    define HAPTIC_TASK_PERIOD 0
+#endif
+#ifndef LED_TASK_PERIOD
+#    define LED_TASK_PERIOD 0
+#endif
+#ifndef OS_DETECTION_TASK_PERIOD
+#    define OS_DETECTION_TASK_PERIOD 0
+#endif
+
+#if defined(BACKLIGHT_ENABLE) && (defined(BACKLIGHT_PIN) || defined(BACKLIGHT_PINS))
+#    define BACKLIGHT_TASK_ENABLE
+#endif
+
+typedef enum {
+#ifdef RGBLIGHT_ENABLE
+    TASK_RGBLIGHT,
+#endif
+#ifdef LED_MATRIX_ENABLE
+    TASK_LED_MATRIX,
+#endif
+#ifdef RGB_MATRIX_ENABLE
+    TASK_RGB_MATRIX,
+#endif
+#ifdef BACKLIGHT_TASK_ENABLE
+    TASK_BACKLIGHT,
+#endif
+#ifdef OLED_ENABLE
+    TASK_OLED,
+#endif
+#ifdef ST7565_ENABLE
+    TASK_ST7565,
+#endif
+#ifdef MOUSEKEY_ENABLE
+    TASK_MOUSEKEY,
+#endif
+#ifdef PS2_MOUSE_ENABLE
+    TASK_PS2_MOUSE,
+#endif
+#ifdef MIDI_ENABLE
+    TASK_MIDI,
+#endif
+#ifdef JOYSTICK_ENABLE
+    TASK_JOYSTICK,
+#endif
+#ifdef BATTERY_ENABLE
+    TASK_BATTERY,
+#endif
+#ifdef BLUETOOTH_ENABLE
+    TASK_BLUETOOTH,
+#endif
+#ifdef HAPTIC_ENABLE
+    TASK_HAPTIC,
+#endif
+    TASK_LED,
+#ifdef OS_DETECTION_ENABLE
+    TASK_OS_DETECTION,
+#endif
+    TASK_COUNT,
+} keyboard_task_id_t;
+
+static const uint16_t task_periods[TASK_COUNT] = {
+#ifdef RGBLIGHT_ENABLE
+    [TASK_RGBLIGHT] = RGBLIGHT_TASK_PERIOD,
+#endif
+#ifdef LED_MATRIX_ENABLE
+    [TASK_LED_MATRIX] = LED_MATRIX_TASK_PERIOD,
+#endif
+#ifdef RGB_MATRIX_ENABLE
+    [TASK_RGB_MATRIX] = RGB_MATRIX_TASK_PERIOD,
+#endif
+#ifdef BACKLIGHT_TASK_ENABLE
+    [TASK_BACKLIGHT] = BACKLIGHT_TASK_PERIOD,
+#endif
+#ifdef OLED_ENABLE
+    [TASK_OLED] = OLED_TASK_PERIOD,
+#endif
+#ifdef ST7565_ENABLE
+    [TASK_ST7565] = ST7565_TASK_PERIOD,
+#endif
+#ifdef MOUSEKEY_ENABLE
+    [TASK_MOUSEKEY] = MOUSEKEY_TASK_PERIOD,
+#endif
+#ifdef PS2_MOUSE_ENABLE
+    [TASK_PS2_MOUSE] = PS2_MOUSE_TASK_PERIOD,
+#endif
+#ifdef MIDI_ENABLE
+    [TASK_MIDI] = MIDI_TASK_PERIOD,
+#endif
+#ifdef JOYSTICK_ENABLE
+    [TASK_JOYSTICK] = JOYSTICK_TASK_PERIOD,
+#endif
+#ifdef BATTERY_ENABLE
+    [TASK_BATTERY] = BATTERY_TASK_PERIOD,
+#endif
+#ifdef BLUETOOTH_ENABLE
+    [TASK_BLUETOOTH] = BLUETOOTH_TASK_PERIOD,
+#endif
+#ifdef HAPTIC_ENABLE
+    [TASK_HAPTIC] = HAPTIC_TASK_PERIOD,
+#endif
+    [TASK_LED] = LED_TASK_PERIOD,
+#ifdef OS_DETECTION_ENABLE
+    [TASK_OS_DETECTION] = OS_DETECTION_TASK_PERIOD,
+#endif
+};
+
+static uint16_t task_last_run[TASK_COUNT];
+static uint8_t  periodic_task_last = TASK_COUNT - 1; // the periodic task run last
+static uint8_t  periodic_task_due  = TASK_COUNT;     // the periodic task to run in this iteration, TASK_COUNT for none
+
+/** \brief Picks the periodic task to run in this iteration.
+ *
+ * Tasks with a period only run once it has elapsed, and at most one of them
+ * per keyboard_task() iteration so they don't all delay the same scan. The
+ * due tasks take turns, starting after the one run last, so that a task with
+ * a period shorter than an iteration can't keep the others from running.
+ */
+static uint8_t periodic_task_select(void) {
+    uint16_t now = timer_read();
+    for (uint8_t i = 1; i <= TASK_COUNT; i++) {
+        uint8_t task = (periodic_task_last + i) % TASK_COUNT;
+        if (task_periods[task] != 0 && TIMER_DIFF_16(now, task_last_run[task]) >= task_periods[task]) {
+            return task;
+        }
+    }
+    return TASK_COUNT;
+}
+
+/** \brief Checks whether a task is due, and if so marks it as run. */
+static bool task_is_due(keyboard_task_id_t task) {
+    if (task_periods[task] == 0) {
+        return true;
+    }
+    if (task != periodic_task_due) {
+        return false;
+    }
+    task_last_run[task] = timer_read();
+    periodic_task_last  = task;
+    return true;
 }
 
 /** \brief Main task that is repeatedly called as fast as possible. */
 void keyboard_task(void) {
+    PROFILER_SCOPE("keyboard_task");
+
     __attribute__((unused)) bool activity_has_occurred = false;
+    scan_stats_start();
+#if defined(KEY_EVENT_QUEUE_SCAN_THREAD)
+    // the scan thread fills the queue, the scan hooks run here instead of in matrix_scan()
+    matrix_scan_kb();
+    if (key_event_queue_task()) {
+#elif defined(KEY_EVENT_QUEUE_ENABLE)
+    bool matrix_changed = matrix_task();
+    key_event_queue_task();
+    if (matrix_changed) {
+#else
     if (matrix_task()) {
+#endif
         last_matrix_activity_trigger();
         activity_has_occurred = true;
     }
+    // no periodic task runs in an iteration where the matrix changed, so that the key events get reported first
+    periodic_task_due = activity_has_occurred ? TASK_COUNT : periodic_task_select();
+    scan_stats_lap(SCAN_STATS_MATRIX);
 
     quantum_task();
+    layer_state_notify_task();
+    scan_stats_lap(SCAN_STATS_QUANTUM);
 
 #if defined(SPLIT_WATCHDOG_ENABLE)
     split_watchdog_task();
+    scan_stats_lap(SCAN_STATS_OTHER);
 #endif
 
 #if defined(RGBLIGHT_ENABLE)
-    rgblight_task();
+    if (task_is_due(TASK_RGBLIGHT)) rgblight_task();
 #endif
 
 #ifdef LED_MATRIX_ENABLE
-    led_matrix_task();
+    if (task_is_due(TASK_LED_MATRIX)) led_matrix_task();
 #endif
 #ifdef RGB_MATRIX_ENABLE
-    rgb_matrix_task();
+    if (task_is_due(TASK_RGB_MATRIX)) rgb_matrix_task();
 #endif
 
-#if defined(BACKLIGHT_ENABLE)
-#    if defined(BACKLIGHT_PIN) || defined(BACKLIGHT_PINS)
-    backlight_task();
-#    endif
+#ifdef BACKLIGHT_TASK_ENABLE
+    if (task_is_due(TASK_BACKLIGHT)) backlight_task();
 #endif
+    scan_stats_lap(SCAN_STATS_LIGHTING);
 
 #ifdef ENCODER_ENABLE
     if (encoder_task()) {
         last_encoder_activity_trigger();
         activity_has_occurred = true;
     }
+    scan_stats_lap(SCAN_STATS_OTHER);
 #endif
 
 #ifdef POINTING_DEVICE_ENABLE
@@ -744,10 +1159,11 @@ void keyboard_task(void) {
         last_pointing_device_activity_trigger();
         activity_has_occurred = true;
     }
+    scan_stats_lap(SCAN_STATS_POINTING);
 #endif
 
 #ifdef OLED_ENABLE
-    oled_task();
+    if (task_is_due(TASK_OLED)) oled_task();
 #    if OLED_TIMEOUT > 0
     // Wake up oled if user is using those fabulous keys or spinning those encoders!
     if (activity_has_occurred) oled_on();
@@ -755,45 +1171,51 @@ void keyboard_task(void) {
 #endif
 
 #ifdef ST7565_ENABLE
-    st7565_task();
+    if (task_is_due(TASK_ST7565)) st7565_task();
 #    if ST7565_TIMEOUT > 0
     // Wake up display if user is using those fabulous keys or spinning those encoders!
     if (activity_has_occurred) st7565_on();
 #    endif
 #endif
+    scan_stats_lap(SCAN_STATS_DISPLAY);
 
 #ifdef MOUSEKEY_ENABLE
     // mousekey repeat & acceleration
-    mousekey_task();
+    if (task_is_due(TASK_MOUSEKEY)) mousekey_task();
 #endif
 
 #ifdef PS2_MOUSE_ENABLE
-    ps2_mouse_task();
+    if (task_is_due(TASK_PS2_MOUSE)) ps2_mouse_task();
 #endif
 
 #ifdef MIDI_ENABLE
-    midi_task();
+    if (task_is_due(TASK_MIDI)) midi_task();
 #endif
 
 #ifdef JOYSTICK_ENABLE
-    joystick_task();
+    if (task_is_due(TASK_JOYSTICK)) joystick_task();
 #endif
 
 #ifdef BATTERY_ENABLE
-    battery_task();
+    if (task_is_due(TASK_BATTERY)) battery_task();
 #endif
 
 #ifdef BLUETOOTH_ENABLE
-    bluetooth_task();
+    if (task_is_due(TASK_BLUETOOTH)) bluetooth_task();
 #endif
 
 #ifdef HAPTIC_ENABLE
-    haptic_task();
+    if (task_is_due(TASK_HAPTIC)) haptic_task();
 #endif
 
-    led_task();
+    if (task_is_due(TASK_LED)) led_task();
 
 #ifdef OS_DETECTION_ENABLE
-    os_detection_task();
+    if (task_is_due(TASK_OS_DETECTION)) os_detection_task();
+#endif
+
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_task();
 #endif
+    scan_stats_end();
 }
@@ -34,12 +34,24 @@ typedef struct {
 
 typedef enum keyevent_type_t { TICK_EVENT = 0, KEY_EVENT = 1, ENCODER_CW_EVENT = 2, ENCODER_CCW_EVENT = 3, COMBO_EVENT = 4, DIP_SWITCH_ON_EVENT = 5, DIP_SWITCH_OFF_EVENT = 6 } keyevent_type_t;
 
+#ifdef LATENCY_TRACE_ENABLE
+/* key event timestamps in microseconds, see latency_trace.h */
+typedef struct {
+    uint32_t edge;
+    uint32_t event;
+    bool     valid;
+} keyevent_trace_t;
+#endif
+
 /* key event */
 typedef struct {
     keypos_t        key;
     uint16_t        time;
     keyevent_type_t type;
     bool            pressed;
+#ifdef LATENCY_TRACE_ENABLE
+    keyevent_trace_t trace;
+#endif
 } keyevent_t;
 
 /* equivalent test of keypos_t */
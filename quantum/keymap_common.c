@@ -24,6 +24,8 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "debug.h"
 #include "keycode_config.h"
 #include "quantum_keycodes.h"
+#include "compiler_support.h"
+#include "progmem.h"
 
 #ifdef ENCODER_MAP_ENABLE
 #    include "encoder.h"
@@ -52,149 +54,391 @@ action_t action_for_key(uint8_t layer, keypos_t key) {
     return action_for_keycode(keycode);
 };
 
-action_t action_for_keycode(uint16_t keycode) {
-    // keycode remapping
-    keycode = keycode_config(keycode);
-
-    action_t action = {};
-    uint8_t  action_layer, mod;
-
-    (void)action_layer;
-    (void)mod;
+static uint16_t decode_key(uint16_t keycode) {
+    return ACTION_KEY(keycode);
+}
 
-    switch (keycode) {
-        case BASIC_KEYCODE_RANGE:
-        case MODIFIER_KEYCODE_RANGE:
-            action.code = ACTION_KEY(keycode);
-            break;
 #ifdef EXTRAKEY_ENABLE
-        case SYSTEM_KEYCODE_RANGE:
-            action.code = ACTION_USAGE_SYSTEM(KEYCODE2SYSTEM(keycode));
-            break;
-        case CONSUMER_KEYCODE_RANGE:
-            action.code = ACTION_USAGE_CONSUMER(KEYCODE2CONSUMER(keycode));
-            break;
+static uint16_t decode_system(uint16_t keycode) {
+    return ACTION_USAGE_SYSTEM(KEYCODE2SYSTEM(keycode));
+}
+
+static uint16_t decode_consumer(uint16_t keycode) {
+    return ACTION_USAGE_CONSUMER(KEYCODE2CONSUMER(keycode));
+}
 #endif
-        case MOUSE_KEYCODE_RANGE:
-            action.code = ACTION_MOUSEKEY(keycode);
-            break;
-        case KC_TRANSPARENT:
-            action.code = ACTION_TRANSPARENT;
-            break;
-        case QK_MODS ... QK_MODS_MAX:;
-        // Has a modifier
-        // Split it up
+
+static uint16_t decode_mousekey(uint16_t keycode) {
+    return ACTION_MOUSEKEY(keycode);
+}
+
+static uint16_t decode_transparent(uint16_t keycode) {
+    return ACTION_TRANSPARENT;
+}
+
+static uint16_t decode_mods(uint16_t keycode) {
+    // Has a modifier
+    // Split it up
 #ifdef LEGACY_MAGIC_HANDLING
-            action.code = ACTION_MODS_KEY(QK_MODS_GET_MODS(keycode), QK_MODS_GET_BASIC_KEYCODE(keycode)); // adds modifier to key
-#else                                                                                                     // LEGACY_MAGIC_HANDLING
-            action.code = ACTION_MODS_KEY(mod_config(QK_MODS_GET_MODS(keycode)), keycode_config(QK_MODS_GET_BASIC_KEYCODE(keycode))); // adds modifier to key
-#endif                                                                                                    // LEGACY_MAGIC_HANDLING
-            break;
-        case QK_LAYER_TAP ... QK_LAYER_TAP_MAX:
+    return ACTION_MODS_KEY(QK_MODS_GET_MODS(keycode), QK_MODS_GET_BASIC_KEYCODE(keycode)); // adds modifier to key
+#else                                                                                     // LEGACY_MAGIC_HANDLING
+    return ACTION_MODS_KEY(mod_config(QK_MODS_GET_MODS(keycode)), keycode_config(QK_MODS_GET_BASIC_KEYCODE(keycode))); // adds modifier to key
+#endif                                                                                    // LEGACY_MAGIC_HANDLING
+}
+
+static uint16_t decode_layer_tap(uint16_t keycode) {
 #if !defined(NO_ACTION_LAYER) && !defined(NO_ACTION_TAPPING)
 #    ifdef LEGACY_MAGIC_HANDLING
-            action.code = ACTION_LAYER_TAP_KEY(QK_LAYER_TAP_GET_LAYER(keycode), QK_LAYER_TAP_GET_TAP_KEYCODE(keycode));
+    return ACTION_LAYER_TAP_KEY(QK_LAYER_TAP_GET_LAYER(keycode), QK_LAYER_TAP_GET_TAP_KEYCODE(keycode));
 #    else  // LEGACY_MAGIC_HANDLING
-            action.code = ACTION_LAYER_TAP_KEY(QK_LAYER_TAP_GET_LAYER(keycode), keycode_config(QK_LAYER_TAP_GET_TAP_KEYCODE(keycode)));
+    return ACTION_LAYER_TAP_KEY(QK_LAYER_TAP_GET_LAYER(keycode), keycode_config(QK_LAYER_TAP_GET_TAP_KEYCODE(keycode)));
 #    endif // LEGACY_MAGIC_HANDLING
 #else
-            // pass through keycode_config again, since it previously missed it
-            // and then only send as ACTION_KEY to bypass most of action.c handling
-            action.code = ACTION_KEY(keycode_config(QK_LAYER_TAP_GET_TAP_KEYCODE(keycode)));
+    // pass through keycode_config again, since it previously missed it
+    // and then only send as ACTION_KEY to bypass most of action.c handling
+    return ACTION_KEY(keycode_config(QK_LAYER_TAP_GET_TAP_KEYCODE(keycode)));
 #endif
-            break;
+}
+
 #ifndef NO_ACTION_LAYER
-        case QK_TO ... QK_TO_MAX:;
-            // Layer set "GOTO"
-            action_layer = QK_TO_GET_LAYER(keycode);
-            action.code  = ACTION_LAYER_GOTO(action_layer);
-            break;
-        case QK_MOMENTARY ... QK_MOMENTARY_MAX:;
-            // Momentary action_layer
-            action_layer = QK_MOMENTARY_GET_LAYER(keycode);
-            action.code  = ACTION_LAYER_MOMENTARY(action_layer);
-            break;
-        case QK_DEF_LAYER ... QK_DEF_LAYER_MAX:;
-            // Set default action_layer
-            action_layer = QK_DEF_LAYER_GET_LAYER(keycode);
-            action.code  = ACTION_DEFAULT_LAYER_SET(action_layer);
-            break;
-        case QK_TOGGLE_LAYER ... QK_TOGGLE_LAYER_MAX:;
-            // Set toggle
-            action_layer = QK_TOGGLE_LAYER_GET_LAYER(keycode);
-            action.code  = ACTION_LAYER_TOGGLE(action_layer);
-            break;
+static uint16_t decode_to(uint16_t keycode) {
+    // Layer set "GOTO"
+    return ACTION_LAYER_GOTO(QK_TO_GET_LAYER(keycode));
+}
+
+static uint16_t decode_momentary(uint16_t keycode) {
+    // Momentary action_layer
+    return ACTION_LAYER_MOMENTARY(QK_MOMENTARY_GET_LAYER(keycode));
+}
+
+static uint16_t decode_def_layer(uint16_t keycode) {
+    // Set default action_layer
+    return ACTION_DEFAULT_LAYER_SET(QK_DEF_LAYER_GET_LAYER(keycode));
+}
+
+static uint16_t decode_toggle_layer(uint16_t keycode) {
+    // Set toggle
+    return ACTION_LAYER_TOGGLE(QK_TOGGLE_LAYER_GET_LAYER(keycode));
+}
 #endif
+
 #ifndef NO_ACTION_ONESHOT
-        case QK_ONE_SHOT_LAYER ... QK_ONE_SHOT_LAYER_MAX:;
-            // OSL(action_layer) - One-shot action_layer
-            action_layer = QK_ONE_SHOT_LAYER_GET_LAYER(keycode);
-            action.code  = ACTION_LAYER_ONESHOT(action_layer);
-            break;
+static uint16_t decode_one_shot_layer(uint16_t keycode) {
+    // OSL(action_layer) - One-shot action_layer
+    return ACTION_LAYER_ONESHOT(QK_ONE_SHOT_LAYER_GET_LAYER(keycode));
+}
 #endif // NO_ACTION_ONESHOT
-        case QK_ONE_SHOT_MOD ... QK_ONE_SHOT_MOD_MAX:;
-            // OSM(mod) - One-shot mod
-            mod = mod_config(QK_ONE_SHOT_MOD_GET_MODS(keycode));
+
+static uint16_t decode_one_shot_mod(uint16_t keycode) {
+    // OSM(mod) - One-shot mod
+    uint8_t mod = mod_config(QK_ONE_SHOT_MOD_GET_MODS(keycode));
 #if defined(NO_ACTION_TAPPING) || defined(NO_ACTION_ONESHOT)
-            action.code = ACTION_MODS(mod);
+    return ACTION_MODS(mod);
 #else  // defined(NO_ACTION_TAPPING) || defined(NO_ACTION_ONESHOT)
-            action.code = ACTION_MODS_ONESHOT(mod);
+    return ACTION_MODS_ONESHOT(mod);
 #endif // defined(NO_ACTION_TAPPING) || defined(NO_ACTION_ONESHOT)
-            break;
+}
+
 #ifndef NO_ACTION_LAYER
-        case QK_LAYER_TAP_TOGGLE ... QK_LAYER_TAP_TOGGLE_MAX:
+static uint16_t decode_layer_tap_toggle(uint16_t keycode) {
 #    ifndef NO_ACTION_TAPPING
-            action.code = ACTION_LAYER_TAP_TOGGLE(QK_LAYER_TAP_TOGGLE_GET_LAYER(keycode));
+    return ACTION_LAYER_TAP_TOGGLE(QK_LAYER_TAP_TOGGLE_GET_LAYER(keycode));
 #    else // NO_ACTION_TAPPING
 #        ifdef NO_ACTION_TAPPING_TAP_TOGGLE_MO
-            action.code = ACTION_LAYER_MOMENTARY(QK_LAYER_TAP_TOGGLE_GET_LAYER(keycode));
+    return ACTION_LAYER_MOMENTARY(QK_LAYER_TAP_TOGGLE_GET_LAYER(keycode));
 #        else  // NO_ACTION_TAPPING_TAP_TOGGLE_MO
-            action.code = ACTION_LAYER_TOGGLE(QK_LAYER_TAP_TOGGLE_GET_LAYER(keycode));
+    return ACTION_LAYER_TOGGLE(QK_LAYER_TAP_TOGGLE_GET_LAYER(keycode));
 #        endif // NO_ACTION_TAPPING_TAP_TOGGLE_MO
 #    endif     // NO_ACTION_TAPPING
-            break;
-        case QK_LAYER_MOD ... QK_LAYER_MOD_MAX:
-            mod          = mod_config(QK_LAYER_MOD_GET_MODS(keycode));
-            action_layer = QK_LAYER_MOD_GET_LAYER(keycode);
-            action.code  = ACTION_LAYER_MODS(action_layer, (mod & 0x10) ? (mod & 0xF) << 4 : mod);
-            break;
+}
+
+static uint16_t decode_layer_mod(uint16_t keycode) {
+    uint8_t mod = mod_config(QK_LAYER_MOD_GET_MODS(keycode));
+    return ACTION_LAYER_MODS(QK_LAYER_MOD_GET_LAYER(keycode), (mod & 0x10) ? (mod & 0xF) << 4 : mod);
+}
 #endif // NO_ACTION_LAYER
-        case QK_MOD_TAP ... QK_MOD_TAP_MAX:
+
+static uint16_t decode_mod_tap(uint16_t keycode) {
 #ifndef NO_ACTION_TAPPING
-            mod = mod_config(QK_MOD_TAP_GET_MODS(keycode));
+    uint8_t mod = mod_config(QK_MOD_TAP_GET_MODS(keycode));
 #    ifdef LEGACY_MAGIC_HANDLING
-            action.code = ACTION_MODS_TAP_KEY(mod, QK_MOD_TAP_GET_TAP_KEYCODE(keycode));
+    return ACTION_MODS_TAP_KEY(mod, QK_MOD_TAP_GET_TAP_KEYCODE(keycode));
 #    else  // LEGACY_MAGIC_HANDLING
-            action.code = ACTION_MODS_TAP_KEY(mod, keycode_config(QK_MOD_TAP_GET_TAP_KEYCODE(keycode)));
+    return ACTION_MODS_TAP_KEY(mod, keycode_config(QK_MOD_TAP_GET_TAP_KEYCODE(keycode)));
 #    endif // LEGACY_MAGIC_HANDLING
 #else      // NO_ACTION_TAPPING
 #    ifdef NO_ACTION_TAPPING_MODTAP_MODS
-            // pass through mod_config again, since it previously missed it
-            // and then only send as ACTION_KEY to bypass most of action.c handling
-            action.code = ACTION_MODS(mod_config(QK_MOD_TAP_GET_MODS(keycode)));
+    // pass through mod_config again, since it previously missed it
+    // and then only send as ACTION_KEY to bypass most of action.c handling
+    return ACTION_MODS(mod_config(QK_MOD_TAP_GET_MODS(keycode)));
 #    else  // NO_ACTION_TAPPING_MODTAP_MODS
-           // pass through keycode_config again, since it previously missed it
-           // and then only send as ACTION_KEY to bypass most of action.c handling
-            action.code = ACTION_KEY(keycode_config(QK_MOD_TAP_GET_TAP_KEYCODE(keycode)));
+    // pass through keycode_config again, since it previously missed it
+    // and then only send as ACTION_KEY to bypass most of action.c handling
+    return ACTION_KEY(keycode_config(QK_MOD_TAP_GET_TAP_KEYCODE(keycode)));
 #    endif // NO_ACTION_TAPPING_MODTAP_MODS
 #endif     // NO_ACTION_TAPPING
-            break;
+}
+
 #ifdef SWAP_HANDS_ENABLE
-        case QK_SWAP_HANDS ... QK_SWAP_HANDS_MAX:
+static uint16_t decode_swap_hands(uint16_t keycode) {
 #    ifdef LEGACY_MAGIC_HANDLING
-            action.code = ACTION(ACT_SWAP_HANDS, QK_SWAP_HANDS_GET_TAP_KEYCODE(keycode));
+    return ACTION(ACT_SWAP_HANDS, QK_SWAP_HANDS_GET_TAP_KEYCODE(keycode));
 #    else  // LEGACY_MAGIC_HANDLING
-            action.code = ACTION(ACT_SWAP_HANDS, keycode_config(QK_SWAP_HANDS_GET_TAP_KEYCODE(keycode)));
+    return ACTION(ACT_SWAP_HANDS, keycode_config(QK_SWAP_HANDS_GET_TAP_KEYCODE(keycode)));
 #    endif // LEGACY_MAGIC_HANDLING
-            break;
+}
 #endif
 
+/* With KEYCODE_ACTION_TABLE, keycodes are decoded through a table instead of
+ * a switch over their ranges. It takes the same time for every keycode, which
+ * can help where the switch compiles to a chain of compares, at the cost of
+ * about 500 bytes of flash. Compilers that turn the switch into a jump table,
+ * like on the test host, are faster with the switch.
+ */
+#ifdef KEYCODE_ACTION_TABLE
+static uint16_t decode_none(uint16_t keycode) {
+    return ACTION_NO;
+}
+
+typedef uint16_t (*keycode_decoder_t)(uint16_t keycode);
+
+typedef enum {
+    DECODE_NONE, // must be zero, see below
+    DECODE_KEY,
+#    ifdef EXTRAKEY_ENABLE
+    DECODE_SYSTEM,
+    DECODE_CONSUMER,
+#    endif
+    DECODE_MOUSEKEY,
+    DECODE_TRANSPARENT,
+    DECODE_MODS,
+    DECODE_LAYER_TAP,
+#    ifndef NO_ACTION_LAYER
+    DECODE_TO,
+    DECODE_MOMENTARY,
+    DECODE_DEF_LAYER,
+    DECODE_TOGGLE_LAYER,
+#    endif
+#    ifndef NO_ACTION_ONESHOT
+    DECODE_ONE_SHOT_LAYER,
+#    endif
+    DECODE_ONE_SHOT_MOD,
+#    ifndef NO_ACTION_LAYER
+    DECODE_LAYER_TAP_TOGGLE,
+    DECODE_LAYER_MOD,
+#    endif
+    DECODE_MOD_TAP,
+#    ifdef SWAP_HANDS_ENABLE
+    DECODE_SWAP_HANDS,
+#    endif
+    KEYCODE_DECODERS,
+} keycode_decoder_id_t;
+
+static const keycode_decoder_t keycode_decoders[KEYCODE_DECODERS] PROGMEM = {
+    [DECODE_NONE]        = decode_none,
+    [DECODE_KEY]         = decode_key,
+#    ifdef EXTRAKEY_ENABLE
+    [DECODE_SYSTEM]      = decode_system,
+    [DECODE_CONSUMER]    = decode_consumer,
+#    endif
+    [DECODE_MOUSEKEY]    = decode_mousekey,
+    [DECODE_TRANSPARENT] = decode_transparent,
+    [DECODE_MODS]        = decode_mods,
+    [DECODE_LAYER_TAP]   = decode_layer_tap,
+#    ifndef NO_ACTION_LAYER
+    [DECODE_TO]           = decode_to,
+    [DECODE_MOMENTARY]    = decode_momentary,
+    [DECODE_DEF_LAYER]    = decode_def_layer,
+    [DECODE_TOGGLE_LAYER] = decode_toggle_layer,
+#    endif
+#    ifndef NO_ACTION_ONESHOT
+    [DECODE_ONE_SHOT_LAYER] = decode_one_shot_layer,
+#    endif
+    [DECODE_ONE_SHOT_MOD] = decode_one_shot_mod,
+#    ifndef NO_ACTION_LAYER
+    [DECODE_LAYER_TAP_TOGGLE] = decode_layer_tap_toggle,
+    [DECODE_LAYER_MOD]        = decode_layer_mod,
+#    endif
+    [DECODE_MOD_TAP] = decode_mod_tap,
+#    ifdef SWAP_HANDS_ENABLE
+    [DECODE_SWAP_HANDS] = decode_swap_hands,
+#    endif
+};
+
+/* Keycodes are decoded in two lookups instead of a switch over their ranges.
+ *
+ * The high byte of the keycode selects a page, which gives a block of the
+ * decoder table and how many high bits of the low byte index it. Pages holding
+ * a single range use 0 bits and point to the entry of that decoder in the first
+ * block, so that the unlisted pages, all zero, decode to nothing. The pages that
+ * are split in several ranges have a block of their own: one entry per keycode
+ * for the basic keycodes, and one per 32 keycodes for the layer keycodes.
+ */
+#    define LAYER_BLOCK KEYCODE_DECODERS
+#    define BASIC_BLOCK (LAYER_BLOCK + 8)
+#    define KEYCODE_PAGE(kc) ((kc) >> 8)
+#    define KEYCODE_PAGES (KEYCODE_PAGE(QK_SWAP_HANDS_MAX) + 1)
+
+typedef struct {
+    uint8_t block;
+    uint8_t bits;
+} keycode_page_t;
+
+STATIC_ASSERT(BASIC_BLOCK <= UINT8_MAX, "Too many keycode decoders");
+STATIC_ASSERT(KEYCODE_PAGE(QK_TO) == KEYCODE_PAGE(QK_LAYER_TAP_TOGGLE_MAX), "Layer keycodes must share a page");
+STATIC_ASSERT((QK_LAYER_MOD | QK_LAYER_TAP | QK_MODS | QK_MOD_TAP | QK_SWAP_HANDS) % 256 == 0, "Single range keycode pages must be aligned");
+STATIC_ASSERT((QK_TO | QK_MOMENTARY | QK_DEF_LAYER | QK_TOGGLE_LAYER | QK_ONE_SHOT_LAYER | QK_ONE_SHOT_MOD | QK_LAYER_TAP_TOGGLE) % 32 == 0, "Layer keycode ranges must be aligned");
+
+#    define PAGE_RANGE(first, last) [KEYCODE_PAGE(first) ... KEYCODE_PAGE(last)]
+#    define SINGLE_RANGE_PAGE(decoder) {.block = (decoder), .bits = 0}
+#    define LAYER_RANGE(first, last) [LAYER_BLOCK + ((first)&0xFF) / 32 ... LAYER_BLOCK + ((last)&0xFF) / 32]
+#    define BASIC_RANGE(first, last) [BASIC_BLOCK + (first) ... BASIC_BLOCK + (last)]
+
+static const keycode_page_t keycode_pages[KEYCODE_PAGES] PROGMEM = {
+    [KEYCODE_PAGE(QK_BASIC)]                   = {.block = BASIC_BLOCK, .bits = 8},
+    PAGE_RANGE(QK_MODS, QK_MODS_MAX)           = SINGLE_RANGE_PAGE(DECODE_MODS),
+    PAGE_RANGE(QK_MOD_TAP, QK_MOD_TAP_MAX)     = SINGLE_RANGE_PAGE(DECODE_MOD_TAP),
+    PAGE_RANGE(QK_LAYER_TAP, QK_LAYER_TAP_MAX) = SINGLE_RANGE_PAGE(DECODE_LAYER_TAP),
+#    ifndef NO_ACTION_LAYER
+    PAGE_RANGE(QK_LAYER_MOD, QK_LAYER_MOD_MAX) = SINGLE_RANGE_PAGE(DECODE_LAYER_MOD),
+#    endif
+    [KEYCODE_PAGE(QK_TO)]                      = {.block = LAYER_BLOCK, .bits = 3},
+#    ifdef SWAP_HANDS_ENABLE
+    PAGE_RANGE(QK_SWAP_HANDS, QK_SWAP_HANDS_MAX) = SINGLE_RANGE_PAGE(DECODE_SWAP_HANDS),
+#    endif
+};
+
+static const uint8_t keycode_decoder_ids[BASIC_BLOCK + 256] PROGMEM = {
+    // single range pages
+    [DECODE_MODS]      = DECODE_MODS,
+    [DECODE_MOD_TAP]   = DECODE_MOD_TAP,
+    [DECODE_LAYER_TAP] = DECODE_LAYER_TAP,
+#    ifndef NO_ACTION_LAYER
+    [DECODE_LAYER_MOD] = DECODE_LAYER_MOD,
+#    endif
+#    ifdef SWAP_HANDS_ENABLE
+    [DECODE_SWAP_HANDS] = DECODE_SWAP_HANDS,
+#    endif
+    // layer keycodes
+#    ifndef NO_ACTION_LAYER
+    LAYER_RANGE(QK_TO, QK_TO_MAX)                             = DECODE_TO,
+    LAYER_RANGE(QK_MOMENTARY, QK_MOMENTARY_MAX)               = DECODE_MOMENTARY,
+    LAYER_RANGE(QK_DEF_LAYER, QK_DEF_LAYER_MAX)               = DECODE_DEF_LAYER,
+    LAYER_RANGE(QK_TOGGLE_LAYER, QK_TOGGLE_LAYER_MAX)         = DECODE_TOGGLE_LAYER,
+    LAYER_RANGE(QK_LAYER_TAP_TOGGLE, QK_LAYER_TAP_TOGGLE_MAX) = DECODE_LAYER_TAP_TOGGLE,
+#    endif
+#    ifndef NO_ACTION_ONESHOT
+    LAYER_RANGE(QK_ONE_SHOT_LAYER, QK_ONE_SHOT_LAYER_MAX) = DECODE_ONE_SHOT_LAYER,
+#    endif
+    LAYER_RANGE(QK_ONE_SHOT_MOD, QK_ONE_SHOT_MOD_MAX) = DECODE_ONE_SHOT_MOD,
+    // basic keycodes
+    [BASIC_BLOCK + KC_TRANSPARENT]          = DECODE_TRANSPARENT,
+    BASIC_RANGE(KC_A, KC_EXSEL)             = DECODE_KEY,
+    BASIC_RANGE(KC_LEFT_CTRL, KC_RIGHT_GUI) = DECODE_KEY,
+#    ifdef EXTRAKEY_ENABLE
+    BASIC_RANGE(KC_SYSTEM_POWER, KC_SYSTEM_WAKE) = DECODE_SYSTEM,
+    BASIC_RANGE(KC_AUDIO_MUTE, KC_LAUNCHPAD)     = DECODE_CONSUMER,
+#    endif
+    BASIC_RANGE(QK_MOUSE_CURSOR_UP, QK_MOUSE_ACCELERATION_2) = DECODE_MOUSEKEY,
+};
+
+action_t action_for_keycode(uint16_t keycode) {
+    // keycode remapping
+    keycode = keycode_config(keycode);
+
+    action_t action = {};
+    uint8_t  page   = KEYCODE_PAGE(keycode);
+
+    if (page >= KEYCODE_PAGES) {
+        action.code = ACTION_NO;
+        return action;
+    }
+
+    uint8_t block = pgm_read_byte(&keycode_pages[page].block);
+    uint8_t bits  = pgm_read_byte(&keycode_pages[page].bits);
+    uint8_t id    = pgm_read_byte(&keycode_decoder_ids[block + ((keycode & 0xFF) >> (8 - bits))]);
+
+    keycode_decoder_t decoder = (keycode_decoder_t)pgm_read_ptr(&keycode_decoders[id]);
+    action.code               = decoder(keycode);
+    return action;
+}
+#else
+action_t action_for_keycode(uint16_t keycode) {
+    // keycode remapping
+    keycode = keycode_config(keycode);
+
+    action_t action = {};
+
+    switch (keycode) {
+        case BASIC_KEYCODE_RANGE:
+        case MODIFIER_KEYCODE_RANGE:
+            action.code = decode_key(keycode);
+            break;
+#    ifdef EXTRAKEY_ENABLE
+        case SYSTEM_KEYCODE_RANGE:
+            action.code = decode_system(keycode);
+            break;
+        case CONSUMER_KEYCODE_RANGE:
+            action.code = decode_consumer(keycode);
+            break;
+#    endif
+        case MOUSE_KEYCODE_RANGE:
+            action.code = decode_mousekey(keycode);
+            break;
+        case KC_TRANSPARENT:
+            action.code = decode_transparent(keycode);
+            break;
+        case QK_MODS ... QK_MODS_MAX:
+            action.code = decode_mods(keycode);
+            break;
+        case QK_LAYER_TAP ... QK_LAYER_TAP_MAX:
+            action.code = decode_layer_tap(keycode);
+            break;
+#    ifndef NO_ACTION_LAYER
+        case QK_TO ... QK_TO_MAX:
+            action.code = decode_to(keycode);
+            break;
+        case QK_MOMENTARY ... QK_MOMENTARY_MAX:
+            action.code = decode_momentary(keycode);
+            break;
+        case QK_DEF_LAYER ... QK_DEF_LAYER_MAX:
+            action.code = decode_def_layer(keycode);
+            break;
+        case QK_TOGGLE_LAYER ... QK_TOGGLE_LAYER_MAX:
+            action.code = decode_toggle_layer(keycode);
+            break;
+#    endif
+#    ifndef NO_ACTION_ONESHOT
+        case QK_ONE_SHOT_LAYER ... QK_ONE_SHOT_LAYER_MAX:
+            action.code = decode_one_shot_layer(keycode);
+            break;
+#    endif
+        case QK_ONE_SHOT_MOD ... QK_ONE_SHOT_MOD_MAX:
+            action.code = decode_one_shot_mod(keycode);
+            break;
+#    ifndef NO_ACTION_LAYER
+        case QK_LAYER_TAP_TOGGLE ... QK_LAYER_TAP_TOGGLE_MAX:
+            action.code = decode_layer_tap_toggle(keycode);
+            break;
+        case QK_LAYER_MOD ... QK_LAYER_MOD_MAX:
+            action.code = decode_layer_mod(keycode);
+            break;
+#    endif
+        case QK_MOD_TAP ... QK_MOD_TAP_MAX:
+            action.code = decode_mod_tap(keycode);
+            break;
+#    ifdef SWAP_HANDS_ENABLE
+        case QK_SWAP_HANDS ... QK_SWAP_HANDS_MAX:
+            action.code = decode_swap_hands(keycode);
+            break;
+#    endif
         default:
             action.code = ACTION_NO;
             break;
     }
     return action;
 }
+#endif
 
 // translates key to keycode
 __attribute__((weak)) uint16_t keymap_key_to_keycode(uint8_t layer, keypos_t key) {
@@ -0,0 +1,121 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "latency_trace.h"
+#include "timer.h"
+#include "debug.h"
+
+typedef struct {
+    uint32_t edge;
+    uint32_t event;
+    uint32_t process;
+} pending_event_t;
+
+static histogram_t     stats[LATENCY_TRACE_STAGES];
+static pending_event_t pending[LATENCY_TRACE_PENDING];
+static uint8_t         pending_count;
+static uint32_t        edge_time;
+static bool            edge_valid;
+static bool            edge_settled;
+static bool            edge_used;
+#ifdef CONSOLE_ENABLE
+static uint32_t interval_start;
+#endif
+
+__attribute__((unused)) static const char *const stage_names[LATENCY_TRACE_STAGES] = {
+    [LATENCY_TRACE_DEBOUNCE]   = "debounce",
+    [LATENCY_TRACE_BUFFERING]  = "buffering",
+    [LATENCY_TRACE_PROCESSING] = "processing",
+    [LATENCY_TRACE_TOTAL]      = "total",
+};
+
+static void record(latency_trace_stage_t stage, uint32_t from, uint32_t to) {
+    histogram_record(&stats[stage], TIMER_DIFF_32(to, from) / LATENCY_TRACE_RESOLUTION_US);
+}
+
+void latency_trace_matrix_scan(bool changed, bool settled) {
+    if (changed && !edge_valid) {
+        edge_time  = timer_read_us();
+        edge_valid = true;
+    }
+    edge_settled = settled;
+}
+
+void latency_trace_event(keyevent_t *event) {
+    uint32_t now = timer_read_us();
+
+    event->trace = (keyevent_trace_t){
+        .edge  = edge_valid ? edge_time : now,
+        .event = now,
+        .valid = true,
+    };
+    edge_used = true;
+}
+
+void latency_trace_process(keyevent_t *event) {
+    if (!event->trace.valid) {
+        return;
+    }
+    // the same record can be processed again, it only counts once
+    event->trace.valid = false;
+
+    if (pending_count == LATENCY_TRACE_PENDING) {
+        return;
+    }
+    pending[pending_count++] = (pending_event_t){
+        .edge    = event->trace.edge,
+        .event   = event->trace.event,
+        .process = timer_read_us(),
+    };
+}
+
+void latency_trace_report(void) {
+    uint32_t now = timer_read_us();
+
+    for (uint8_t i = 0; i < pending_count; i++) {
+        record(LATENCY_TRACE_DEBOUNCE, pending[i].edge, pending[i].event);
+        record(LATENCY_TRACE_BUFFERING, pending[i].event, pending[i].process);
+        record(LATENCY_TRACE_PROCESSING, pending[i].process, now);
+        record(LATENCY_TRACE_TOTAL, pending[i].edge, now);
+    }
+    pending_count = 0;
+}
+
+void latency_trace_task(void) {
+    pending_count = 0;
+    if (edge_settled || edge_used) {
+        edge_valid = false;
+    }
+    edge_used = false;
+
+#ifdef CONSOLE_ENABLE
+    uint32_t now = timer_read_us();
+    if (TIMER_DIFF_32(now, interval_start) >= (uint32_t)LATENCY_TRACE_INTERVAL * 1000) {
+        interval_start = now;
+        latency_trace_print();
+        latency_trace_reset();
+    }
+#endif
+}
+
+void latency_trace_reset(void) {
+    memset(stats, 0, sizeof(stats));
+}
+
+void latency_trace_get(latency_trace_stage_t stage, latency_trace_summary_t *summary) {
+    histogram_get(&stats[stage], summary);
+}
+
+void latency_trace_print(void) {
+    latency_trace_summary_t summary;
+
+    for (uint8_t i = 0; i < LATENCY_TRACE_STAGES; i++) {
+        latency_trace_get(i, &summary);
+        if (summary.count == 0) {
+            continue;
+        }
+        // in hundredths of milliseconds
+        dprintf("latency %s: n=%lu min=%u.%02u p50=%u.%02u p99=%u.%02u max=%u.%02u avg=%u.%02u ms\n", stage_names[i], (unsigned long)summary.count, summary.min / 100, summary.min % 100, summary.p50 / 100, summary.p50 % 100, summary.p99 / 100, summary.p99 % 100, summary.max / 100, summary.max % 100, summary.avg / 100, summary.avg % 100);
+    }
+}
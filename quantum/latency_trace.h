@@ -0,0 +1,82 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "keyboard.h"
+#include "histogram.h"
+
+/* Key event latency tracing.
+ *
+ * Each key event carries timestamps from the matrix to the report it ends up
+ * in, which splits its latency into stages:
+ *
+ *   matrix edge -> key event -> process_record() -> keyboard report
+ *    (debounce)    (buffering)     (processing)
+ *
+ * The matrix edge is the first raw change seen by the matrix since it was last
+ * settled, so it is shared by the keys that change within the debounce time of
+ * each other. Keyboards without the default matrix.c, and the keys of the other
+ * half of a split keyboard, have no debounce stage. Buffering is the time spent
+ * in the tapping, combo or other buffers, and processing goes from the start of
+ * process_record() until the report is sent. Events that don't send a report in
+ * the same keyboard_task() iteration, like layer keys, aren't counted.
+ *
+ * Latencies are in tens of microseconds, so they saturate at 655 ms.
+ */
+
+#ifndef LATENCY_TRACE_INTERVAL
+#    define LATENCY_TRACE_INTERVAL 10000
+#endif
+
+#ifndef LATENCY_TRACE_PENDING
+#    define LATENCY_TRACE_PENDING 8
+#endif
+
+#define LATENCY_TRACE_RESOLUTION_US 10
+
+typedef enum {
+    LATENCY_TRACE_DEBOUNCE,   // matrix edge to key event
+    LATENCY_TRACE_BUFFERING,  // key event to process_record()
+    LATENCY_TRACE_PROCESSING, // process_record() to report
+    LATENCY_TRACE_TOTAL,      // matrix edge to report
+    LATENCY_TRACE_STAGES,
+} latency_trace_stage_t;
+
+typedef histogram_summary_t latency_trace_summary_t;
+
+/**
+ * \brief Marks a scan of the matrix.
+ *
+ * \param changed Whether the raw matrix changed.
+ * \param settled Whether the raw matrix matches the debounced one.
+ */
+void latency_trace_matrix_scan(bool changed, bool settled);
+
+/** \brief Stamps a new key event with its matrix edge and current time. */
+void latency_trace_event(keyevent_t *event);
+
+/** \brief Marks the start of the processing of an event. */
+void latency_trace_process(keyevent_t *event);
+
+/** \brief Completes the processed events when a report is sent. */
+void latency_trace_report(void);
+
+/**
+ * \brief Ends a keyboard_task() iteration, dropping the events that didn't send a report.
+ *
+ * With the console enabled, the statistics are printed and reset every
+ * LATENCY_TRACE_INTERVAL milliseconds.
+ */
+void latency_trace_task(void);
+
+/** \brief Clears the statistics of every stage. */
+void latency_trace_reset(void);
+
+/** \brief Gets the statistics of a stage, all zero if it has no samples. */
+void latency_trace_get(latency_trace_stage_t stage, latency_trace_summary_t *summary);
+
+/** \brief Prints the statistics of every stage to the console. */
+void latency_trace_print(void);
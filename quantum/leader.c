@@ -2,20 +2,29 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "leader.h"
+#include "compiler_support.h"
 #include "timer.h"
 #include "util.h"
 
 #include <string.h>
 
+#ifdef LEADER_SEQUENCES_ENABLE
+#    include "keymap_introspection.h"
+#    include "progmem.h"
+#    include "quantum.h"
+#endif
+
 #ifndef LEADER_TIMEOUT
 #    define LEADER_TIMEOUT 300
 #endif
 
+STATIC_ASSERT(LEADER_SEQUENCE_LENGTH >= 5, "LEADER_SEQUENCE_LENGTH must be at least 5");
+
 // Leader key stuff
-bool     leading              = false;
-uint16_t leader_time          = 0;
-uint16_t leader_sequence[5]   = {0, 0, 0, 0, 0};
-uint8_t  leader_sequence_size = 0;
+bool     leading                                 = false;
+uint16_t leader_time                             = 0;
+uint16_t leader_sequence[LEADER_SEQUENCE_LENGTH] = {0};
+uint8_t  leader_sequence_size                    = 0;
 
 __attribute__((weak)) void leader_start_user(void) {}
 
@@ -25,6 +34,58 @@ __attribute__((weak)) bool leader_add_user(uint16_t keycode) {
     return false;
 }
 
+#ifdef LEADER_SEQUENCES_ENABLE
+#    define LEADER_SEQUENCE_NONE UINT16_MAX
+
+__attribute__((weak)) void leader_sequence_matched_user(uint16_t index) {}
+
+/**
+ * Gets the first sequence of the table that is the sequence buffer, and counts
+ * the sequences that start with it. A sequence is dropped at its first key that
+ * differs, so a key costs about a read per sequence.
+ */
+static uint16_t leader_sequences_find(uint16_t *candidates) {
+    uint16_t match = LEADER_SEQUENCE_NONE;
+
+    *candidates = 0;
+    for (uint16_t index = 0; index < leader_sequence_count(); index++) {
+        const leader_sequence_t *sequence = leader_sequence_get(index);
+        uint8_t                  i        = 0;
+        while (i < leader_sequence_size && pgm_read_word(&sequence->keys[i]) == leader_sequence[i]) {
+            i++;
+        }
+        if (i < leader_sequence_size) {
+            continue;
+        }
+        (*candidates)++;
+        if (match == LEADER_SEQUENCE_NONE && (leader_sequence_size == LEADER_SEQUENCE_LENGTH || pgm_read_word(&sequence->keys[leader_sequence_size]) == KC_NO)) {
+            match = index;
+        }
+    }
+    return match;
+}
+
+static void leader_sequences_end(void) {
+    uint16_t candidates;
+    uint16_t index = leader_sequences_find(&candidates);
+    if (index == LEADER_SEQUENCE_NONE) {
+        return;
+    }
+
+    leader_sequence_matched_user(index);
+    uint16_t keycode = pgm_read_word(&leader_sequence_get(index)->keycode);
+    if (keycode != KC_NO) {
+        tap_code16(keycode);
+    }
+}
+
+/* Whether the sequence buffer is a sequence, and the start of no other one. */
+static bool leader_sequences_unambiguous(void) {
+    uint16_t candidates;
+    return leader_sequences_find(&candidates) != LEADER_SEQUENCE_NONE && candidates == 1;
+}
+#endif
+
 void leader_start(void) {
     if (leading) {
         return;
@@ -38,6 +99,9 @@ void leader_start(void) {
 
 void leader_end(void) {
     leading = false;
+#ifdef LEADER_SEQUENCES_ENABLE
+    leader_sequences_end();
+#endif
     leader_end_user();
 }
 
@@ -65,7 +129,11 @@ bool leader_sequence_add(uint16_t keycode) {
     leader_sequence[leader_sequence_size] = keycode;
     leader_sequence_size++;
 
-    if (leader_add_user(keycode)) {
+    if (leader_add_user(keycode)
+#ifdef LEADER_SEQUENCES_ENABLE
+        || leader_sequences_unambiguous()
+#endif
+    ) {
         leader_end();
     }
     return true;
@@ -84,7 +152,7 @@ void leader_reset_timer(void) {
 }
 
 bool leader_sequence_is(uint16_t kc1, uint16_t kc2, uint16_t kc3, uint16_t kc4, uint16_t kc5) {
-    return leader_sequence[0] == kc1 && leader_sequence[1] == kc2 && leader_sequence[2] == kc3 && leader_sequence[3] == kc4 && leader_sequence[4] == kc5;
+    return leader_sequence_size <= 5 && leader_sequence[0] == kc1 && leader_sequence[1] == kc2 && leader_sequence[2] == kc3 && leader_sequence[3] == kc4 && leader_sequence[4] == kc5;
 }
 
 bool leader_sequence_one_key(uint16_t kc) {
@@ -1,6 +1,8 @@
 // Copyright 2023 QMK
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#pragma once
+
 #include <stdbool.h>
 #include <stdint.h>
 
@@ -11,6 +13,23 @@
  * \{
  */
 
+#ifndef LEADER_SEQUENCE_LENGTH
+#    define LEADER_SEQUENCE_LENGTH 5
+#endif
+
+/**
+ * \brief A sequence of the `leader_sequences` table, with `LEADER_SEQUENCES_ENABLE`.
+ */
+typedef struct leader_sequence_t {
+    uint16_t keys[LEADER_SEQUENCE_LENGTH]; // followed by KC_NO if shorter
+    uint16_t keycode;                      // tapped when the sequence matches, or KC_NO
+} leader_sequence_t;
+
+#define LEADER_SEQUENCE(kc, ...) \
+    { .keys = {__VA_ARGS__}, .keycode = (kc) }
+#define LEADER_SEQUENCE_ACTION(...) \
+    { .keys = {__VA_ARGS__}, .keycode = KC_NO }
+
 /**
  * \brief User callback, invoked when the leader sequence begins.
  */
@@ -30,6 +49,15 @@ void leader_end_user(void);
  */
 bool leader_add_user(uint16_t keycode);
 
+/**
+ * \brief User callback, invoked when a sequence of the `leader_sequences` table matches.
+ *
+ * It is invoked before the keycode of the sequence, if any, is tapped.
+ *
+ * \param index The index of the sequence in the table.
+ */
+void leader_sequence_matched_user(uint16_t index);
+
 /**
  * Begin the leader sequence, resetting the buffer and timer.
  */
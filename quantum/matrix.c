@@ -26,6 +26,12 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    include "split_common/split_util.h"
 #    include "split_common/transactions.h"
 #endif
+#ifdef MATRIX_WAKEUP_ENABLE
+#    include "gpio_wakeup.h"
+#endif
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
 
 #ifdef DIRECT_PINS_RIGHT
 #    define SPLIT_MUTABLE
@@ -266,6 +272,95 @@ __attribute__((weak)) void matrix_read_rows_on_col(matrix_row_t current_matrix[]
 #    error DIODE_DIRECTION is not defined!
 #endif
 
+#if defined(MATRIX_WAKEUP_ENABLE) && (defined(DIRECT_PINS) || (defined(MATRIX_ROW_PINS) && defined(MATRIX_COL_PINS)))
+static void matrix_wakeup_disarm(void) {
+#    if defined(DIRECT_PINS)
+    for (uint8_t row = 0; row < MATRIX_ROWS_PER_HAND; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (direct_pins[row][col] != NO_PIN) {
+                gpio_wakeup_disable_pin(direct_pins[row][col]);
+            }
+        }
+    }
+#    elif (DIODE_DIRECTION == COL2ROW)
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        if (col_pins[col] != NO_PIN) {
+            gpio_wakeup_disable_pin(col_pins[col]);
+        }
+    }
+    unselect_rows();
+    matrix_io_delay();
+#    elif (DIODE_DIRECTION == ROW2COL)
+    for (uint8_t row = 0; row < MATRIX_ROWS_PER_HAND; row++) {
+        if (row_pins[row] != NO_PIN) {
+            gpio_wakeup_disable_pin(row_pins[row]);
+        }
+    }
+    unselect_cols();
+    matrix_io_delay();
+#    endif
+}
+
+// Drive every output line, so that any key press pulls its input line and raises an edge
+bool matrix_wakeup_arm(void) {
+    bool armed = true;
+
+    // a change still being debounced raises no more edges
+    if (memcmp(raw_matrix, matrix, sizeof(matrix_row_t) * MATRIX_ROWS_PER_HAND) != 0) {
+        return false;
+    }
+
+    // an edge between the last scan and enabling its interrupt is missed, so each input is read again once enabled
+    gpio_wakeup_clear();
+#    if defined(DIRECT_PINS)
+    for (uint8_t row = 0; row < MATRIX_ROWS_PER_HAND; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (direct_pins[row][col] != NO_PIN) {
+                armed &= gpio_wakeup_enable_pin(direct_pins[row][col]);
+                armed &= readMatrixPin(direct_pins[row][col]);
+            }
+        }
+    }
+#    elif (DIODE_DIRECTION == COL2ROW)
+    for (uint8_t row = 0; row < MATRIX_ROWS_PER_HAND; row++) {
+        select_row(row);
+    }
+    matrix_output_select_delay();
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        if (col_pins[col] != NO_PIN) {
+            armed &= gpio_wakeup_enable_pin(col_pins[col]);
+            armed &= readMatrixPin(col_pins[col]);
+        }
+    }
+#    elif (DIODE_DIRECTION == ROW2COL)
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        select_col(col);
+    }
+    matrix_output_select_delay();
+    for (uint8_t row = 0; row < MATRIX_ROWS_PER_HAND; row++) {
+        if (row_pins[row] != NO_PIN) {
+            armed &= gpio_wakeup_enable_pin(row_pins[row]);
+            armed &= readMatrixPin(row_pins[row]);
+        }
+    }
+#    endif
+
+    if (!armed) {
+        matrix_wakeup_disarm();
+    }
+    return armed;
+}
+
+bool matrix_wakeup_triggered(void) {
+    if (!gpio_wakeup_pending()) {
+        return false;
+    }
+
+    matrix_wakeup_disarm();
+    return true;
+}
+#endif
+
 void matrix_init(void) {
 #ifdef SPLIT_KEYBOARD
     // Set pinout for right half if pinout for that half is defined
@@ -335,11 +430,25 @@ uint8_t matrix_scan(void) {
     bool changed = memcmp(raw_matrix, curr_matrix, sizeof(curr_matrix)) != 0;
     if (changed) memcpy(raw_matrix, curr_matrix, sizeof(curr_matrix));
 
+#ifdef LATENCY_TRACE_ENABLE
+    bool raw_changed = changed;
+#endif
+
 #ifdef SPLIT_KEYBOARD
-    changed = debounce(raw_matrix, matrix + thisHand, MATRIX_ROWS_PER_HAND, changed) | matrix_post_scan();
+    changed = matrix_post_debounce(debounce(raw_matrix, matrix + thisHand, MATRIX_ROWS_PER_HAND, changed));
 #else
-    changed = debounce(raw_matrix, matrix, MATRIX_ROWS_PER_HAND, changed);
-    matrix_scan_kb();
+    changed = matrix_post_debounce(debounce(raw_matrix, matrix, MATRIX_ROWS_PER_HAND, changed));
+#    ifndef KEY_EVENT_QUEUE_SCAN_THREAD
+    matrix_scan_kb(); // keyboard_task() calls it from the main loop instead
+#    endif
+#endif
+
+#ifdef LATENCY_TRACE_ENABLE
+#    ifdef SPLIT_KEYBOARD
+    latency_trace_matrix_scan(raw_changed, memcmp(raw_matrix, matrix + thisHand, sizeof(matrix_row_t) * MATRIX_ROWS_PER_HAND) == 0);
+#    else
+    latency_trace_matrix_scan(raw_changed, memcmp(raw_matrix, matrix, sizeof(matrix_row_t) * MATRIX_ROWS_PER_HAND) == 0);
+#    endif
 #endif
     return (uint8_t)changed;
 }
@@ -43,6 +43,9 @@ typedef uint32_t matrix_row_t;
 
 #define MATRIX_ROW_SHIFTER ((matrix_row_t)1)
 
+/* number of 32-bit words needed to store one bit per matrix row */
+#define MATRIX_ROW_BITMAP_WORDS ((MATRIX_ROWS + 31) / 32)
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -59,10 +62,20 @@ void matrix_init(void);
 uint8_t matrix_scan(void);
 /* whether matrix scanning operations should be executed */
 bool matrix_can_read(void);
+/* stop polling and wait for a key press to wake the matrix up, false if unsupported */
+bool matrix_wakeup_arm(void);
+/* whether a key press woke the matrix up, scanning is restored when it did */
+bool matrix_wakeup_triggered(void);
 /* whether a switch is on */
 bool matrix_is_on(uint8_t row, uint8_t col);
 /* matrix state on row */
 matrix_row_t matrix_get_row(uint8_t row);
+/* rows which may have changed since the last call, one bit per row */
+void matrix_get_changed_rows(uint32_t changed_rows[MATRIX_ROW_BITMAP_WORDS]);
+/* flag a range of rows as changed for matrix_get_changed_rows */
+void matrix_set_rows_changed(uint8_t first_row, uint8_t num_rows);
+/* flag the rows changed by debounce (and on splits, the other half), returns whether anything changed */
+bool matrix_post_debounce(bool changed);
 /* print matrix for debug */
 void matrix_print(void);
 /* delay between changing matrix pin state and reading values */
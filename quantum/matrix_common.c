@@ -3,11 +3,12 @@
 #include "wait.h"
 #include "print.h"
 #include "debug.h"
+#include "bits.h"
+#include <string.h>
 
 #ifdef SPLIT_KEYBOARD
 #    include "split_common/split_util.h"
 #    include "split_common/transactions.h"
-#    include <string.h>
 #endif
 
 #ifndef MATRIX_IO_DELAY
@@ -23,6 +24,11 @@ matrix_row_t matrix[MATRIX_ROWS];
 uint8_t thisHand, thatHand;
 #endif
 
+/* rows whose debounced state changed since the last matrix_get_changed_rows call */
+static uint32_t changed_rows[MATRIX_ROW_BITMAP_WORDS];
+// matrix_scan overrides which never flag rows get every row reported as changed
+static bool changed_rows_tracked = false;
+
 #ifdef MATRIX_MASKED
 extern const matrix_row_t matrix_mask[];
 #endif
@@ -65,6 +71,22 @@ inline matrix_row_t matrix_get_row(uint8_t row) {
 #endif
 }
 
+void matrix_set_rows_changed(uint8_t first_row, uint8_t num_rows) {
+    changed_rows_tracked = true;
+    for (uint8_t row = first_row; row < first_row + num_rows; row++) {
+        changed_rows[row / 32] |= BIT32(row % 32);
+    }
+}
+
+void matrix_get_changed_rows(uint32_t rows[MATRIX_ROW_BITMAP_WORDS]) {
+    if (!changed_rows_tracked) {
+        matrix_set_rows_changed(0, MATRIX_ROWS);
+        changed_rows_tracked = false;
+    }
+    memcpy(rows, changed_rows, sizeof(changed_rows));
+    memset(changed_rows, 0, sizeof(changed_rows));
+}
+
 #if (MATRIX_COLS <= 8)
 #    define print_matrix_header() print("\nr/c 01234567\n")
 #    define print_matrix_row(row) print_bin_reverse8(matrix_get_row(row))
@@ -118,6 +140,23 @@ bool matrix_post_scan(void) {
 }
 #endif
 
+bool matrix_post_debounce(bool changed) {
+    changed_rows_tracked = true;
+#ifdef SPLIT_KEYBOARD
+    bool that_hand_changed = matrix_post_scan();
+
+    if (changed) matrix_set_rows_changed(thisHand, MATRIX_ROWS_PER_HAND);
+    // the slave receives the other half without being told whether it changed
+    if (that_hand_changed || !is_keyboard_master()) matrix_set_rows_changed(thatHand, MATRIX_ROWS_PER_HAND);
+
+    return changed || that_hand_changed;
+#else
+    if (changed) matrix_set_rows_changed(0, MATRIX_ROWS);
+
+    return changed;
+#endif
+}
+
 /* `matrix_io_delay ()` exists for backwards compatibility. From now on, use matrix_output_unselect_delay(). */
 __attribute__((weak)) void matrix_io_delay(void) {
     wait_us(MATRIX_IO_DELAY);
@@ -165,10 +204,12 @@ __attribute__((weak)) uint8_t matrix_scan(void) {
     bool changed = matrix_scan_custom(raw_matrix);
 
 #ifdef SPLIT_KEYBOARD
-    changed = debounce(raw_matrix, matrix + thisHand, MATRIX_ROWS_PER_HAND, changed) | matrix_post_scan();
+    changed = matrix_post_debounce(debounce(raw_matrix, matrix + thisHand, MATRIX_ROWS_PER_HAND, changed));
 #else
-    changed = debounce(raw_matrix, matrix, MATRIX_ROWS_PER_HAND, changed);
-    matrix_scan_kb();
+    changed = matrix_post_debounce(debounce(raw_matrix, matrix, MATRIX_ROWS_PER_HAND, changed));
+#    ifndef KEY_EVENT_QUEUE_SCAN_THREAD
+    matrix_scan_kb(); // keyboard_task() calls it from the main loop instead
+#    endif
 #endif
 
     return changed;
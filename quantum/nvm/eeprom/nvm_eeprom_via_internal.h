@@ -19,4 +19,24 @@
 // custom config
 #define VIA_EEPROM_CUSTOM_CONFIG_ADDR (VIA_EEPROM_LAYOUT_OPTIONS_ADDR + VIA_EEPROM_LAYOUT_OPTIONS_SIZE)
 
-#define VIA_EEPROM_CONFIG_END (VIA_EEPROM_CUSTOM_CONFIG_ADDR + VIA_EEPROM_CUSTOM_CONFIG_SIZE)
+// Per-key debounce times follow the custom config
+#define VIA_EEPROM_DEBOUNCE_PER_KEY_ADDR (VIA_EEPROM_CUSTOM_CONFIG_ADDR + VIA_EEPROM_CUSTOM_CONFIG_SIZE)
+
+#ifdef DEBOUNCE_PER_KEY_ENABLE
+#    include "debounce_per_key.h"
+#    define VIA_EEPROM_DEBOUNCE_PER_KEY_SIZE (DEBOUNCE_PER_KEY_TABLE_SIZE)
+#else
+#    define VIA_EEPROM_DEBOUNCE_PER_KEY_SIZE 0
+#endif
+
+// Derived tapping terms follow the per-key debounce times
+#define VIA_EEPROM_TAPPING_STATS_ADDR (VIA_EEPROM_DEBOUNCE_PER_KEY_ADDR + VIA_EEPROM_DEBOUNCE_PER_KEY_SIZE)
+
+#ifdef TAPPING_STATS_ENABLE
+#    include "tapping_stats.h"
+#    define VIA_EEPROM_TAPPING_STATS_SIZE (sizeof(tapping_stats_table_t))
+#else
+#    define VIA_EEPROM_TAPPING_STATS_SIZE 0
+#endif
+
+#define VIA_EEPROM_CONFIG_END (VIA_EEPROM_TAPPING_STATS_ADDR + VIA_EEPROM_TAPPING_STATS_SIZE)
@@ -75,3 +75,43 @@ uint32_t nvm_via_update_custom_config(const void *buf, uint32_t offset, uint32_t
     return 0;
 #endif
 }
+
+uint32_t nvm_via_read_debounce_per_key(void *buf, uint32_t length) {
+#if VIA_EEPROM_DEBOUNCE_PER_KEY_SIZE > 0
+    length = MIN(VIA_EEPROM_DEBOUNCE_PER_KEY_SIZE, length);
+    eeprom_read_block(buf, (void *)(uintptr_t)(VIA_EEPROM_DEBOUNCE_PER_KEY_ADDR), length);
+    return length;
+#else
+    return 0;
+#endif
+}
+
+uint32_t nvm_via_update_debounce_per_key(const void *buf, uint32_t length) {
+#if VIA_EEPROM_DEBOUNCE_PER_KEY_SIZE > 0
+    length = MIN(VIA_EEPROM_DEBOUNCE_PER_KEY_SIZE, length);
+    eeprom_update_block(buf, (void *)(uintptr_t)(VIA_EEPROM_DEBOUNCE_PER_KEY_ADDR), length);
+    return length;
+#else
+    return 0;
+#endif
+}
+
+uint32_t nvm_via_read_tapping_stats(void *buf, uint32_t length) {
+#if defined(TAPPING_STATS_ENABLE)
+    length = MIN(VIA_EEPROM_TAPPING_STATS_SIZE, length);
+    eeprom_read_block(buf, (void *)(uintptr_t)(VIA_EEPROM_TAPPING_STATS_ADDR), length);
+    return length;
+#else
+    return 0;
+#endif
+}
+
+uint32_t nvm_via_update_tapping_stats(const void *buf, uint32_t length) {
+#if defined(TAPPING_STATS_ENABLE)
+    length = MIN(VIA_EEPROM_TAPPING_STATS_SIZE, length);
+    eeprom_update_block(buf, (void *)(uintptr_t)(VIA_EEPROM_TAPPING_STATS_ADDR), length);
+    return length;
+#else
+    return 0;
+#endif
+}
@@ -15,3 +15,9 @@ void     nvm_via_update_layout_options(uint32_t val);
 
 uint32_t nvm_via_read_custom_config(void *buf, uint32_t offset, uint32_t length);
 uint32_t nvm_via_update_custom_config(const void *buf, uint32_t offset, uint32_t length);
+
+uint32_t nvm_via_read_debounce_per_key(void *buf, uint32_t length);
+uint32_t nvm_via_update_debounce_per_key(const void *buf, uint32_t length);
+
+uint32_t nvm_via_read_tapping_stats(void *buf, uint32_t length);
+uint32_t nvm_via_update_tapping_stats(const void *buf, uint32_t length);
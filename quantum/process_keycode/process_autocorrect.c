@@ -189,6 +189,104 @@ __attribute__((weak)) bool apply_autocorrect(uint8_t backspaces, const char *str
     return true;
 }
 
+#if DICTIONARY_SIZE > 65535
+typedef uint32_t autocorrect_offset_t;
+#else
+typedef uint16_t autocorrect_offset_t;
+#endif
+
+#ifdef AUTOCORRECT_DATA_DAWG
+/**
+ * @brief reads a link of the word graph
+ *
+ * @param index index of the link in `autocorrect_data`
+ * @param width size of the link in bytes, little endian
+ * @return the offset of the linked node
+ */
+static inline autocorrect_offset_t read_offset(autocorrect_offset_t index, uint8_t width) {
+    autocorrect_offset_t offset = 0;
+    for (uint8_t shift = 0; width > 0; --width, shift += 8) {
+        offset |= (autocorrect_offset_t)pgm_read_byte(autocorrect_data + index++) << shift;
+    }
+    return offset;
+}
+#endif
+
+/**
+ * @brief corrects the typo at the end of the buffer
+ *
+ * @param keycode Keycode appended last to the buffer
+ * @param record keyrecord_t structure
+ * @param state index of the leaf node of the typo in `autocorrect_data`
+ * @return true Continue processing keycodes, and send to host
+ * @return false Stop processing keycodes, and don't send to host
+ */
+static bool correct_typo(uint16_t keycode, keyrecord_t *record, autocorrect_offset_t state) {
+    const uint8_t code       = pgm_read_byte(autocorrect_data + state);
+    const uint8_t backspaces = (code & 63) + !record->event.pressed;
+    const char *  changes    = (const char *)(autocorrect_data + state + 1);
+
+    /* Gather info about the typo'd word
+     *
+     * Since buffer may contain several words, delimited by spaces, we
+     * iterate from the end to find the start and length of the typo
+     */
+    char typo[AUTOCORRECT_MAX_LENGTH + 1] = {0}; // extra char for null terminator
+
+    uint8_t typo_len   = 0;
+    uint8_t typo_start = 0;
+    bool    space_last = typo_buffer[typo_buffer_size - 1] == KC_SPC;
+    for (uint8_t i = typo_buffer_size; i > 0; --i) {
+        // stop counting after finding space (unless it is the last thing)
+        if (typo_buffer[i - 1] == KC_SPC && i != typo_buffer_size) {
+            typo_start = i;
+            break;
+        }
+
+        ++typo_len;
+    }
+
+    // when detecting 'typo:', reduce the length of the string by one
+    if (space_last) {
+        --typo_len;
+    }
+
+    // convert buffer of keycodes into a string
+    for (uint8_t i = 0; i < typo_len; ++i) {
+        typo[i] = typo_buffer[typo_start + i] - KC_A + 'a';
+    }
+
+    /* Gather the corrected word
+     *
+     * A) Correction of 'typo:' -- Code takes into account
+     * an extra backspace to delete the space (which we dont copy)
+     * for this reason the offset is correct to "skip" the null terminator
+     *
+     * B) When correcting 'typo' -- Need extra offset for terminator
+     */
+    char correct[AUTOCORRECT_MAX_LENGTH + 10] = {0}; // let's hope this is big enough
+
+    uint8_t offset = space_last ? backspaces : backspaces + 1;
+    strcpy(correct, typo);
+    strcpy_P(correct + typo_len - offset, changes);
+
+    if (apply_autocorrect(backspaces, changes, typo, correct)) {
+        for (uint8_t i = 0; i < backspaces; ++i) {
+            tap_code(KC_BSPC);
+        }
+        send_string_P(changes);
+    }
+
+    if (keycode == KC_SPC) {
+        typo_buffer[0]   = KC_SPC;
+        typo_buffer_size = 1;
+        return true;
+    } else {
+        typo_buffer_size = 0;
+        return false;
+    }
+}
+
 /**
  * @brief Process handler for autocorrect feature
  *
@@ -279,6 +377,54 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
         return true;
     }
 
+#ifdef AUTOCORRECT_DATA_DAWG
+    // Check for typo in buffer using a word graph stored in `autocorrect_data`.
+    autocorrect_offset_t state = 0;
+    int8_t               i     = typo_buffer_size - 1;
+    for (;;) {
+        // Stop if `state` becomes an invalid index. This should not normally
+        // happen, it is a safeguard in case of a bug, data corruption, etc.
+        if (state >= DICTIONARY_SIZE) {
+            return true;
+        }
+
+        uint8_t code = pgm_read_byte(autocorrect_data + state);
+
+        if (code & 128) { // A typo was found! Apply autocorrect.
+            return correct_typo(keycode, record, state);
+        }
+        if (code < 4) { // Jump to the child of a node with a single child.
+            autocorrect_offset_t const offset = read_offset(state + 1, code);
+            if (!offset) {
+                return true;
+            }
+            state += offset;
+            continue;
+        }
+        if (i < 0) {
+            return true;
+        }
+
+        uint8_t const key_i = typo_buffer[i--];
+
+        if (code & 64) { // Check for match in node with multiple children, sorted by keycode.
+            autocorrect_offset_t entry = state + 1;
+            uint8_t const        width = pgm_read_byte(autocorrect_data + entry) >> 6;
+            for (code &= 63; code > 0 && (pgm_read_byte(autocorrect_data + entry) & 63) < key_i; --code) {
+                entry += 1 + width;
+            }
+            if (!code || (pgm_read_byte(autocorrect_data + entry) & 63) != key_i) {
+                return true;
+            }
+            // Follow link to child node.
+            state += read_offset(entry + 1, width);
+        } else if (code != key_i) { // Check for match in node with single child.
+            return true;
+        } else {
+            ++state;
+        }
+    }
+#else
     // Check for typo in buffer using a trie stored in `autocorrect_data`.
     uint16_t state = 0;
     uint8_t  code  = pgm_read_byte(autocorrect_data + state);
@@ -308,69 +454,9 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
         code = pgm_read_byte(autocorrect_data + state);
 
         if (code & 128) { // A typo was found! Apply autocorrect.
-            const uint8_t backspaces = (code & 63) + !record->event.pressed;
-            const char *  changes    = (const char *)(autocorrect_data + state + 1);
-
-            /* Gather info about the typo'd word
-             *
-             * Since buffer may contain several words, delimited by spaces, we
-             * iterate from the end to find the start and length of the typo
-             */
-            char typo[AUTOCORRECT_MAX_LENGTH + 1] = {0}; // extra char for null terminator
-
-            uint8_t typo_len   = 0;
-            uint8_t typo_start = 0;
-            bool    space_last = typo_buffer[typo_buffer_size - 1] == KC_SPC;
-            for (uint8_t i = typo_buffer_size; i > 0; --i) {
-                // stop counting after finding space (unless it is the last thing)
-                if (typo_buffer[i - 1] == KC_SPC && i != typo_buffer_size) {
-                    typo_start = i;
-                    break;
-                }
-
-                ++typo_len;
-            }
-
-            // when detecting 'typo:', reduce the length of the string by one
-            if (space_last) {
-                --typo_len;
-            }
-
-            // convert buffer of keycodes into a string
-            for (uint8_t i = 0; i < typo_len; ++i) {
-                typo[i] = typo_buffer[typo_start + i] - KC_A + 'a';
-            }
-
-            /* Gather the corrected word
-             *
-             * A) Correction of 'typo:' -- Code takes into account
-             * an extra backspace to delete the space (which we dont copy)
-             * for this reason the offset is correct to "skip" the null terminator
-             *
-             * B) When correcting 'typo' -- Need extra offset for terminator
-             */
-            char correct[AUTOCORRECT_MAX_LENGTH + 10] = {0}; // let's hope this is big enough
-
-            uint8_t offset = space_last ? backspaces : backspaces + 1;
-            strcpy(correct, typo);
-            strcpy_P(correct + typo_len - offset, changes);
-
-            if (apply_autocorrect(backspaces, changes, typo, correct)) {
-                for (uint8_t i = 0; i < backspaces; ++i) {
-                    tap_code(KC_BSPC);
-                }
-                send_string_P(changes);
-            }
-
-            if (keycode == KC_SPC) {
-                typo_buffer[0]   = KC_SPC;
-                typo_buffer_size = 1;
-                return true;
-            } else {
-                typo_buffer_size = 0;
-                return false;
-            }
+            return correct_typo(keycode, record, state);
         }
     }
     return true;
+#endif
 }
@@ -16,6 +16,7 @@
 
 #include "process_combo.h"
 #include <stddef.h>
+#include <stdlib.h>
 #include "process_auto_shift.h"
 #include "caps_word.h"
 #include "timer.h"
@@ -95,11 +96,38 @@ static queued_record_t key_buffer[COMBO_KEY_BUFFER_LENGTH];
 
 typedef struct {
     uint16_t combo_index;
+    uint8_t  key_count;
+    uint32_t key_bits; // see combo_key_bit()
 } queued_combo_t;
 static uint8_t        combo_buffer_write = 0;
 static uint8_t        combo_buffer_read  = 0;
 static queued_combo_t combo_buffer[COMBO_BUFFER_LENGTH];
 
+// some combo has a state to clear, see clear_combos()
+static bool combos_dirty = false;
+
+#ifdef COMBO_LOOKUP_SIZE
+/* Index of the combos by their keys, one entry per key of every combo, sorted
+ * by keycode and then by combo. An event only goes through the combos of its
+ * keycode, in the same order as without the index. */
+typedef struct {
+    uint16_t keycode;
+    uint16_t combo_index;
+    uint8_t  key_index; // of the keycode in the keys of the combo
+    uint8_t  key_count; // of the combo
+} combo_lookup_entry_t;
+static combo_lookup_entry_t combo_lookup[COMBO_LOOKUP_SIZE];
+static uint16_t             combo_lookup_size  = 0;
+static uint16_t             combo_lookup_count = 0;     // the index was built for this combo_count()
+static bool                 combo_lookup_built = false; // combo_lookup_count is set
+static bool                 combo_lookup_valid = false; // the keys of the combos fit
+
+// keycodes of the combos that may have a state to clear, see clear_combos()
+static uint16_t combo_touched[COMBO_KEY_BUFFER_LENGTH];
+static uint8_t  combo_touched_count    = 0;
+static bool     combo_touched_overflow = false;
+#endif
+
 #define INCREMENT_MOD(i) i = (i + 1) % COMBO_BUFFER_LENGTH
 
 #ifndef EXTRA_SHORT_COMBOS
@@ -199,13 +227,131 @@ static inline uint16_t _get_combo_term(uint16_t combo_index, combo_t *combo) {
     return COMBO_TERM;
 }
 
+#ifdef COMBO_LOOKUP_SIZE
+/* Orders the entries by keycode, and then by combo. */
+static int combo_lookup_compare(const void *a, const void *b) {
+    const combo_lookup_entry_t *x = a, *y = b;
+    if (x->keycode != y->keycode) {
+        return x->keycode < y->keycode ? -1 : 1;
+    }
+    return x->combo_index < y->combo_index ? -1 : x->combo_index > y->combo_index;
+}
+
+/* Matches an entry against a keycode, for bsearch(). */
+static int combo_lookup_compare_keycode(const void *key, const void *entry) {
+    uint16_t keycode = *(const uint16_t *)key, other = ((const combo_lookup_entry_t *)entry)->keycode;
+    return keycode < other ? -1 : keycode > other;
+}
+
+/* Builds the index, it stays invalid if the keys of the combos don't fit. */
+static void combo_lookup_build(void) {
+    uint16_t count     = combo_count();
+    combo_lookup_count = count;
+    combo_lookup_built = true;
+    combo_lookup_size  = 0;
+    combo_lookup_valid = false;
+
+    for (uint16_t idx = 0; idx < count; ++idx) {
+        const uint16_t *keys      = combo_get(idx)->keys;
+        uint8_t         key_count = 0;
+        while (pgm_read_word(&keys[key_count]) != COMBO_END) {
+            key_count++;
+        }
+        for (uint8_t i = 0; i < key_count; i++) {
+            uint16_t keycode = pgm_read_word(&keys[i]);
+            bool     last    = true;
+            // like _find_key_index_and_count(), a keycode maps to its last key
+            for (uint8_t j = i + 1; j < key_count; j++) {
+                if (pgm_read_word(&keys[j]) == keycode) {
+                    last = false;
+                    break;
+                }
+            }
+            if (!last) {
+                continue;
+            }
+            if (combo_lookup_size >= COMBO_LOOKUP_SIZE) {
+                return;
+            }
+            combo_lookup[combo_lookup_size++] = (combo_lookup_entry_t){
+                .keycode     = keycode,
+                .combo_index = idx,
+                .key_index   = i,
+                .key_count   = key_count,
+            };
+        }
+    }
+
+    qsort(combo_lookup, combo_lookup_size, sizeof(combo_lookup[0]), combo_lookup_compare);
+    combo_lookup_valid = true;
+}
+
+/* Remembers a keycode for clear_combos(). */
+static void combo_lookup_touch(uint16_t keycode) {
+    for (uint8_t i = 0; i < combo_touched_count; i++) {
+        if (combo_touched[i] == keycode) {
+            return;
+        }
+    }
+    if (combo_touched_count < COMBO_KEY_BUFFER_LENGTH) {
+        combo_touched[combo_touched_count++] = keycode;
+    } else {
+        combo_touched_overflow = true;
+    }
+}
+
+/* Gets the first entry of a keycode, or combo_lookup_size if it has none. */
+static uint16_t combo_lookup_find(uint16_t keycode) {
+    const combo_lookup_entry_t *entry = bsearch(&keycode, combo_lookup, combo_lookup_size, sizeof(combo_lookup[0]), combo_lookup_compare_keycode);
+    if (!entry) {
+        return combo_lookup_size;
+    }
+    while (entry > combo_lookup && entry[-1].keycode == keycode) {
+        entry--;
+    }
+    return entry - combo_lookup;
+}
+#endif
+
 void clear_combos(void) {
     uint16_t index = 0;
     longest_term   = 0;
+    if (!combos_dirty) {
+        return;
+    }
+    combos_dirty = false;
+#ifdef COMBO_LOOKUP_SIZE
+    if (combo_lookup_valid && !combo_touched_overflow) {
+        uint8_t kept = 0;
+        for (uint8_t i = 0; i < combo_touched_count; i++) {
+            uint16_t keycode = combo_touched[i];
+            bool     active  = false;
+            for (index = combo_lookup_find(keycode); index < combo_lookup_size && combo_lookup[index].keycode == keycode; ++index) {
+                combo_t *combo = combo_get(combo_lookup[index].combo_index);
+                if (!COMBO_ACTIVE(combo)) {
+                    RESET_COMBO_STATE(combo);
+                } else {
+                    active = true;
+                }
+            }
+            if (active) {
+                combo_touched[kept++] = keycode;
+            }
+        }
+        combo_touched_count = kept;
+        combos_dirty        = kept > 0;
+        return;
+    }
+    combo_touched_count    = 0;
+    combo_touched_overflow = false;
+#endif
     for (index = 0; index < combo_count(); ++index) {
         combo_t *combo = combo_get(index);
         if (!COMBO_ACTIVE(combo)) {
             RESET_COMBO_STATE(combo);
+        } else {
+            // cleared once it is released
+            combos_dirty = true;
         }
     }
 }
@@ -264,7 +410,6 @@ static inline void dump_key_buffer(void) {
     key_buffer_next = key_buffer_size = 0;
 }
 
-#define NO_COMBO_KEYS_ARE_DOWN (0 == COMBO_STATE(combo))
 #define ALL_COMBO_KEYS_ARE_DOWN(state, key_count) (((1 << key_count) - 1) == state)
 #define ONLY_ONE_KEY_IS_DOWN(state) !(state & (state - 1))
 #define KEY_NOT_YET_RELEASED(state, key_index) ((1 << key_index) & state)
@@ -376,27 +521,54 @@ static inline void apply_combos(void) {
     clear_combos();
 }
 
-combo_t *overlaps(combo_t *combo1, combo_t *combo2) {
+/* A bit for a keycode, combos with no bit in common have no key in common. */
+static inline uint32_t combo_key_bit(uint16_t keycode) {
+    return (uint32_t)1 << ((keycode ^ (keycode >> 5) ^ (keycode >> 10)) & 31);
+}
+
+/* Gets what the overlap checks need to know about a combo, once when it is
+ * buffered rather than for every other buffered combo. */
+static queued_combo_t queue_combo(uint16_t combo_index, combo_t *combo, uint8_t key_count) {
+    queued_combo_t qcombo = {
+        .combo_index = combo_index,
+        .key_count   = key_count,
+        .key_bits    = 0,
+    };
+    for (uint8_t i = 0; i < key_count; i++) {
+        qcombo.key_bits |= combo_key_bit(pgm_read_word(&combo->keys[i]));
+    }
+    return qcombo;
+}
+
+static combo_t *overlaps(const queued_combo_t *qcombo1, const queued_combo_t *qcombo2) {
     /* Checks if the combos overlap and returns the combo that should be
      * dropped from the combo buffer.
      * The combo that has less keys will be dropped. If they have the same
      * amount of keys, drop combo1. */
 
-    uint8_t  idx1 = 0, idx2 = 0;
-    uint16_t key1, key2;
+    if (!(qcombo1->key_bits & qcombo2->key_bits)) {
+        return NULL;
+    }
+
+    combo_t *combo1   = combo_get(qcombo1->combo_index);
+    combo_t *combo2   = combo_get(qcombo2->combo_index);
     bool     overlaps = false;
 
-    while ((key1 = pgm_read_word(&combo1->keys[idx1])) != COMBO_END) {
-        idx2 = 0;
-        while ((key2 = pgm_read_word(&combo2->keys[idx2])) != COMBO_END) {
-            if (key1 == key2) overlaps = true;
-            idx2 += 1;
+    for (uint8_t idx1 = 0; idx1 < qcombo1->key_count && !overlaps; idx1++) {
+        uint16_t key1 = pgm_read_word(&combo1->keys[idx1]);
+        if (!(combo_key_bit(key1) & qcombo2->key_bits)) {
+            continue;
+        }
+        for (uint8_t idx2 = 0; idx2 < qcombo2->key_count; idx2++) {
+            if (key1 == pgm_read_word(&combo2->keys[idx2])) {
+                overlaps = true;
+                break;
+            }
         }
-        idx1 += 1;
     }
 
     if (!overlaps) return NULL;
-    if (idx2 < idx1) return combo2;
+    if (qcombo2->key_count < qcombo1->key_count) return combo2;
     return combo1;
 }
 
@@ -422,15 +594,8 @@ static bool keys_pressed_in_order(uint16_t combo_index, combo_t *combo, uint16_t
 }
 #endif
 
-static combo_key_action_t process_single_combo(combo_t *combo, uint16_t keycode, keyrecord_t *record, uint16_t combo_index) {
-    uint8_t  key_count = 0;
-    uint16_t key_index = -1;
-    _find_key_index_and_count(combo->keys, keycode, &key_index, &key_count);
-
-    /* Continue processing if key isn't part of current combo. */
-    if (-1 == (int16_t)key_index) {
-        return COMBO_KEY_NOT_PRESSED;
-    }
+static combo_key_action_t process_combo_key(combo_t *combo, uint16_t keycode, keyrecord_t *record, uint16_t combo_index, uint16_t key_index, uint8_t key_count) {
+    combos_dirty = true;
 
     bool key_is_part_of_combo = (!COMBO_DISABLED(combo) && is_combo_enabled()
 #if defined(COMBO_MUST_PRESS_IN_ORDER) || defined(COMBO_MUST_PRESS_IN_ORDER_PER_COMBO)
@@ -463,12 +628,13 @@ static combo_key_action_t process_single_combo(combo_t *combo, uint16_t keycode,
             {
 
                 // disable readied combos that overlap with this combo
-                combo_t *drop = NULL;
+                combo_t *      drop    = NULL;
+                queued_combo_t current = queue_combo(combo_index, combo, key_count);
                 for (uint8_t combo_buffer_i = combo_buffer_read; combo_buffer_i != combo_buffer_write; INCREMENT_MOD(combo_buffer_i)) {
                     queued_combo_t *qcombo         = &combo_buffer[combo_buffer_i];
                     combo_t *       buffered_combo = combo_get(qcombo->combo_index);
 
-                    if ((drop = overlaps(buffered_combo, combo))) {
+                    if ((drop = overlaps(qcombo, &current))) {
                         DISABLE_COMBO(drop);
                         if (drop == combo) {
                             // stop checking for overlaps if dropped combo was current combo.
@@ -483,9 +649,7 @@ static combo_key_action_t process_single_combo(combo_t *combo, uint16_t keycode,
 
                 if (drop != combo) {
                     // save this combo to buffer
-                    combo_buffer[combo_buffer_write] = (queued_combo_t){
-                        .combo_index = combo_index,
-                    };
+                    combo_buffer[combo_buffer_write] = current;
                     INCREMENT_MOD(combo_buffer_write);
 
                     // get possible longer waiting time for tap-/hold-only combos.
@@ -551,9 +715,20 @@ static combo_key_action_t process_single_combo(combo_t *combo, uint16_t keycode,
     return key_is_part_of_combo ? COMBO_KEY_PRESSED : COMBO_KEY_NOT_PRESSED;
 }
 
+static combo_key_action_t process_single_combo(combo_t *combo, uint16_t keycode, keyrecord_t *record, uint16_t combo_index) {
+    uint8_t  key_count = 0;
+    uint16_t key_index = -1;
+    _find_key_index_and_count(combo->keys, keycode, &key_index, &key_count);
+
+    /* Continue processing if key isn't part of current combo. */
+    if (-1 == (int16_t)key_index) {
+        return COMBO_KEY_NOT_PRESSED;
+    }
+    return process_combo_key(combo, keycode, record, combo_index, key_index, key_count);
+}
+
 bool process_combo(uint16_t keycode, keyrecord_t *record) {
-    uint8_t is_combo_key          = COMBO_KEY_NOT_PRESSED;
-    bool    no_combo_keys_pressed = true;
+    uint8_t is_combo_key = COMBO_KEY_NOT_PRESSED;
 
     if (keycode == QK_COMBO_ON && record->event.pressed) {
         combo_enable();
@@ -581,10 +756,28 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
     }
 #endif
 
-    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
-        combo_t *combo = combo_get(idx);
-        is_combo_key |= process_single_combo(combo, keycode, record, idx);
-        no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+#ifdef COMBO_LOOKUP_SIZE
+    if (!combo_lookup_built || combo_lookup_count != combo_count()) {
+        combo_lookup_build();
+        // the states of the previous combos are cleared by walking them all
+        combo_touched_overflow = true;
+    }
+    if (combo_lookup_valid) {
+        uint16_t i = combo_lookup_find(keycode);
+        if (i < combo_lookup_size && combo_lookup[i].keycode == keycode) {
+            combo_lookup_touch(keycode);
+        }
+        for (; i < combo_lookup_size && combo_lookup[i].keycode == keycode; ++i) {
+            const combo_lookup_entry_t *entry = &combo_lookup[i];
+            is_combo_key |= process_combo_key(combo_get(entry->combo_index), keycode, record, entry->combo_index, entry->key_index, entry->key_count);
+        }
+    } else
+#endif
+    {
+        for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+            combo_t *combo = combo_get(idx);
+            is_combo_key |= process_single_combo(combo, keycode, record, idx);
+        }
     }
 
     if (record->event.pressed && is_combo_key) {
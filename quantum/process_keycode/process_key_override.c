@@ -16,6 +16,7 @@
  */
 
 #include "process_key_override.h"
+#include <stdlib.h>
 #include "report.h"
 #include "timer.h"
 #include "debug.h"
@@ -243,152 +244,306 @@ static bool check_activation_event(const key_override_t *override, const bool ke
     }
 }
 
-/** Iterates through the list of key overrides and tries activating each, until it finds one that activates or reaches the end of overrides. Returns true if the key action for `keycode` should be sent */
-static bool try_activating_override(const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *activated) {
-    if (key_override_count() == 0) {
-        return true;
+/** Checks if the override can activate on the key event. Has no side effects. */
+static bool can_activate_override(const key_override_t *override, const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods) {
+    // Fast, but not full mods check. Most key presses will not have any mods down, and most overrides will require mods. Hence here we filter overrides that require mods to be down while no mods are down
+    if (active_mods == 0 && override->trigger_mods != 0) {
+        key_override_printf("Not activating override: Modifiers don't match\n");
+        return false;
     }
 
-    for (uint8_t i = 0; i < key_override_count(); i++) {
-        const key_override_t *const override = key_override_get(i);
-
-        // End of array
-        if (override == NULL) {
-            break;
-        }
+    // Check layer
+    if ((override->layers & ((layer_state_t)1 << layer)) == 0) {
+        key_override_printf("Not activating override: Not set to activate on pressed layer\n");
+        return false;
+    }
 
-        // Fast, but not full mods check. Most key presses will not have any mods down, and most overrides will require mods. Hence here we filter overrides that require mods to be down while no mods are down
-        if (active_mods == 0 && override->trigger_mods != 0) {
-            key_override_printf("Not activating override: Modifiers don't match\n");
-            continue;
-        }
+    // Check allowed activation events
+    if (!check_activation_event(override, key_down, is_mod)) {
+        key_override_printf("Not activating override: Activation event not allowed\n");
+        return false;
+    }
 
-        // Check layer
-        if ((override->layers & (1 << layer)) == 0) {
-            key_override_printf("Not activating override: Not set to activate on pressed layer\n");
-            continue;
-        }
+    const bool is_trigger = override->trigger == keycode;
 
-        // Check allowed activation events
-        if (!check_activation_event(override, key_down, is_mod)) {
-            key_override_printf("Not activating override: Activation event not allowed\n");
-            continue;
-        }
+    // Check if trigger lifted. This is a small optimization in order to skip the remaining checks
+    if (is_trigger && !key_down) {
+        key_override_printf("Not activating override: Trigger lifted\n");
+        return false;
+    }
 
-        const bool is_trigger = override->trigger == keycode;
+    // If the trigger is KC_NO it means 'no key', so only the required modifiers need to be down.
+    const bool no_trigger = override->trigger == KC_NO;
 
-        // Check if trigger lifted. This is a small optimization in order to skip the remaining checks
-        if (is_trigger && !key_down) {
-            key_override_printf("Not activating override: Trigger lifted\n");
-            continue;
-        }
+    // Check if aleady active
+    if (override == active_override) {
+        key_override_printf("Not activating override: Alerady actived\n");
+        return false;
+    }
 
-        // If the trigger is KC_NO it means 'no key', so only the required modifiers need to be down.
-        const bool no_trigger = override->trigger == KC_NO;
+    // Check if enabled
+    if (override->enabled != NULL && !((*(override->enabled) & 1))) {
+        key_override_printf("Not activating override: Not enabled\n");
+        return false;
+    }
 
-        // Check if aleady active
-        if (override == active_override) {
-            key_override_printf("Not activating override: Alerady actived\n");
-            continue;
-        }
+    // Check mods precisely
+    if (!key_override_matches_active_modifiers(override, active_mods)) {
+        key_override_printf("Not activating override: Modifiers don't match\n");
+        return false;
+    }
 
-        // Check if enabled
-        if (override->enabled != NULL && !((*(override->enabled) & 1))) {
-            key_override_printf("Not activating override: Not enabled\n");
-            continue;
-        }
+    // Check if trigger key is down.
+    const bool trigger_down = is_trigger && key_down;
 
-        // Check mods precisely
-        if (!key_override_matches_active_modifiers(override, active_mods)) {
-            key_override_printf("Not activating override: Modifiers don't match\n");
-            continue;
-        }
+    // At this point, all requirements for activation are checked, except whether the trigger key is pressed. Now we check if the required trigger is down
+    // If no trigger key is required, yes.
+    // If the trigger was just pressed, yes.
+    // If the last non-mod key that was pressed down is the trigger key, yes.
+    bool should_activate = no_trigger || trigger_down || last_key_down == override->trigger;
 
-        // Check if trigger key is down.
-        const bool trigger_down = is_trigger && key_down;
+    if (!should_activate) {
+        key_override_printf("Not activating override. Trigger not down\n");
+        return false;
+    }
 
-        // At this point, all requirements for activation are checked, except whether the trigger key is pressed. Now we check if the required trigger is down
-        // If no trigger key is required, yes.
-        // If the trigger was just pressed, yes.
-        // If the last non-mod key that was pressed down is the trigger key, yes.
-        bool should_activate = no_trigger || trigger_down || last_key_down == override->trigger;
+    return true;
+}
 
-        if (!should_activate) {
-            key_override_printf("Not activating override. Trigger not down\n");
-            continue;
-        }
+/** Activates an override that can activate on the key event. Returns true if the key action for `keycode` should be sent */
+static bool activate_override(const key_override_t *override, const uint16_t keycode, const bool key_down, const bool is_mod, const uint8_t active_mods) {
+    const bool trigger_down = override->trigger == keycode && key_down;
+    const bool no_trigger   = override->trigger == KC_NO;
 
-        key_override_printf("Activating override\n");
+    key_override_printf("Activating override\n");
 
-        clear_active_override(false);
+    clear_active_override(false);
 
 #ifdef DUMMY_MOD_NEUTRALIZER_KEYCODE
-        // Send a dummy keycode before unregistering the modifier(s)
-        // so that suppressing the modifier(s) doesn't falsely get interpreted
-        // by the host OS as a tap of a modifier key.
-        // For example, unintended activations of the start menu on Windows when
-        // using a GUI+<kc> key override with suppressed mods.
-        neutralize_flashing_modifiers(active_mods);
+    // Send a dummy keycode before unregistering the modifier(s)
+    // so that suppressing the modifier(s) doesn't falsely get interpreted
+    // by the host OS as a tap of a modifier key.
+    // For example, unintended activations of the start menu on Windows when
+    // using a GUI+<kc> key override with suppressed mods.
+    neutralize_flashing_modifiers(active_mods);
 #endif
 
-        active_override                 = override;
-        active_override_trigger_is_down = true;
+    active_override                 = override;
+    active_override_trigger_is_down = true;
+
+    set_suppressed_override_mods(override->suppressed_mods);
+
+    if (!trigger_down && !no_trigger) {
+        // When activating a key override the trigger is is always unregistered. In the case where the key that newly pressed is not the trigger key, we have to explicitly remove the trigger key from the keyboard report. If the trigger was just pressed down we simply suppress the event which also has the effect of the trigger key not being registered in the keyboard report.
+        if (IS_BASIC_KEYCODE(override->trigger)) {
+            del_key(override->trigger);
+        } else {
+            unregister_code(override->trigger);
+        }
+    }
+
+    const uint16_t mod_free_replacement = clear_mods_from(override->replacement);
 
-        set_suppressed_override_mods(override->suppressed_mods);
+    bool register_replacement = mod_free_replacement != KC_NO &&   // KC_NO is never registered
+                                mod_free_replacement < SAFE_RANGE; // Custom keycodes are never registered
 
-        if (!trigger_down && !no_trigger) {
-            // When activating a key override the trigger is is always unregistered. In the case where the key that newly pressed is not the trigger key, we have to explicitly remove the trigger key from the keyboard report. If the trigger was just pressed down we simply suppress the event which also has the effect of the trigger key not being registered in the keyboard report.
-            if (IS_BASIC_KEYCODE(override->trigger)) {
-                del_key(override->trigger);
+    // Try firing the custom handler
+    if (override->custom_action != NULL) {
+        register_replacement &= override->custom_action(true, override->context);
+    }
+
+    if (register_replacement) {
+        const uint8_t override_mods = extract_mod_bits(override->replacement);
+        set_weak_override_mods(override_mods);
+
+        // If this is a modifier event that activates the key override we _always_ defer the actual full activation of the override
+        if (is_mod) {
+            key_override_printf("Deferring register replacement key\n");
+            schedule_deferred_register(mod_free_replacement);
+            send_keyboard_report();
+        } else {
+            if (IS_BASIC_KEYCODE(mod_free_replacement)) {
+                add_key(mod_free_replacement);
             } else {
-                unregister_code(override->trigger);
+                key_override_printf("NOT KEY 2\n");
+                send_keyboard_report();
+                // On macOS there seems to be a race condition when it comes to the keyboard report and consumer keycodes. It seems the OS may recognize a consumer keycode before an updated keyboard report, even if the keyboard report is actually sent before the consumer key. I assume it is some sort of race condition because it happens infrequently and very irregularly. Waiting for about at least 10ms between sending the keyboard report and sending the consumer code has shown to fix this.
+                wait_ms(10);
+                register_code(mod_free_replacement);
             }
         }
+    } else {
+        // If not registering the replacement key send keyboard report to update the unregistered keys.
+        send_keyboard_report();
+    }
+
+    // If the trigger is down, suppress the event so that it does not get added to the keyboard report.
+    return !trigger_down;
+}
+
+#ifdef KEY_OVERRIDE_LOOKUP_SIZE
+/* Index of the overrides by their trigger, sorted by trigger and then by override,
+ * with the layers and mods needed for a quick check. Only the overrides of the
+ * triggers that can be down are checked, in the same order as without the index. */
+typedef struct {
+    uint16_t      trigger;
+    uint16_t      index;
+    layer_state_t layers;
+    uint8_t       trigger_mods;
+    uint8_t       negative_mod_mask;
+} key_override_lookup_entry_t;
+static key_override_lookup_entry_t key_override_lookup[KEY_OVERRIDE_LOOKUP_SIZE];
+static uint16_t                    key_override_lookup_size  = 0;
+static uint16_t                    key_override_lookup_count = 0;     // the index was built for this key_override_count()
+static bool                        key_override_lookup_built = false; // key_override_lookup_count is set
+static bool                        key_override_lookup_valid = false; // the overrides fit
+
+/* Orders the entries by trigger, and then by override. */
+static int key_override_lookup_compare(const void *a, const void *b) {
+    const key_override_lookup_entry_t *x = a, *y = b;
+    if (x->trigger != y->trigger) {
+        return x->trigger < y->trigger ? -1 : 1;
+    }
+    return x->index < y->index ? -1 : x->index > y->index;
+}
+
+/* Matches an entry against a trigger, for bsearch(). */
+static int key_override_lookup_compare_trigger(const void *key, const void *entry) {
+    uint16_t trigger = *(const uint16_t *)key, other = ((const key_override_lookup_entry_t *)entry)->trigger;
+    return trigger < other ? -1 : trigger > other;
+}
 
-        const uint16_t mod_free_replacement = clear_mods_from(override->replacement);
+/* Builds the index, it stays invalid if the overrides don't fit. */
+static void key_override_lookup_build(void) {
+    uint16_t count            = key_override_count();
+    key_override_lookup_count = count;
+    key_override_lookup_built = true;
+    key_override_lookup_size  = 0;
+    key_override_lookup_valid = false;
 
-        bool register_replacement = mod_free_replacement != KC_NO &&   // KC_NO is never registered
-                                    mod_free_replacement < SAFE_RANGE; // Custom keycodes are never registered
+    for (uint16_t i = 0; i < count; i++) {
+        const key_override_t *const override = key_override_get(i);
 
-        // Try firing the custom handler
-        if (override->custom_action != NULL) {
-            register_replacement &= override->custom_action(true, override->context);
+        // like try_activating_override(), the overrides end at the first NULL
+        if (override == NULL) {
+            break;
+        }
+        if (key_override_lookup_size >= KEY_OVERRIDE_LOOKUP_SIZE) {
+            return;
         }
+        key_override_lookup[key_override_lookup_size++] = (key_override_lookup_entry_t){
+            .trigger           = override->trigger,
+            .index             = i,
+            .layers            = override->layers,
+            .trigger_mods      = override->trigger_mods,
+            .negative_mod_mask = override->negative_mod_mask,
+        };
+    }
 
-        if (register_replacement) {
-            const uint8_t override_mods = extract_mod_bits(override->replacement);
-            set_weak_override_mods(override_mods);
+    qsort(key_override_lookup, key_override_lookup_size, sizeof(key_override_lookup[0]), key_override_lookup_compare);
+    key_override_lookup_valid = true;
+}
 
-            // If this is a modifier event that activates the key override we _always_ defer the actual full activation of the override
-            if (is_mod) {
-                key_override_printf("Deferring register replacement key\n");
-                schedule_deferred_register(mod_free_replacement);
-                send_keyboard_report();
-            } else {
-                if (IS_BASIC_KEYCODE(mod_free_replacement)) {
-                    add_key(mod_free_replacement);
-                } else {
-                    key_override_printf("NOT KEY 2\n");
-                    send_keyboard_report();
-                    // On macOS there seems to be a race condition when it comes to the keyboard report and consumer keycodes. It seems the OS may recognize a consumer keycode before an updated keyboard report, even if the keyboard report is actually sent before the consumer key. I assume it is some sort of race condition because it happens infrequently and very irregularly. Waiting for about at least 10ms between sending the keyboard report and sending the consumer code has shown to fix this.
-                    wait_ms(10);
-                    register_code(mod_free_replacement);
-                }
+/* Gets the first entry of a trigger, or key_override_lookup_size if it has none. */
+static uint16_t key_override_lookup_find(uint16_t trigger) {
+    const key_override_lookup_entry_t *entry = bsearch(&trigger, key_override_lookup, key_override_lookup_size, sizeof(key_override_lookup[0]), key_override_lookup_compare_trigger);
+    if (!entry) {
+        return key_override_lookup_size;
+    }
+    while (entry > key_override_lookup && entry[-1].trigger == trigger) {
+        entry--;
+    }
+    return entry - key_override_lookup;
+}
+
+/* Gets the first override that can activate, going through the overrides of
+ * every trigger that can be down by increasing index, or NULL if there is none. */
+static const key_override_t *key_override_lookup_first(const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods) {
+    // an override needs no trigger, its trigger just pressed, or its trigger as the last key down
+    const uint16_t      candidates[] = {KC_NO, keycode, last_key_down};
+    const layer_state_t layer_bit    = (layer_state_t)1 << layer;
+    uint16_t            triggers[ARRAY_SIZE(candidates)];
+    uint16_t            next[ARRAY_SIZE(candidates)];
+    uint8_t             ranges = 0;
+
+    for (uint8_t i = 0; i < ARRAY_SIZE(candidates); i++) {
+        bool seen = false;
+        for (uint8_t j = 0; j < ranges; j++) {
+            seen |= triggers[j] == candidates[i];
+        }
+        if (!seen) {
+            triggers[ranges] = candidates[i];
+            next[ranges]     = key_override_lookup_find(candidates[i]);
+            ranges++;
+        }
+    }
+
+    while (true) {
+        // the range with the lowest override index goes next
+        uint8_t  range = ranges;
+        uint16_t index = UINT16_MAX;
+        for (uint8_t i = 0; i < ranges; i++) {
+            if (next[i] < key_override_lookup_size && key_override_lookup[next[i]].trigger == triggers[i] && key_override_lookup[next[i]].index < index) {
+                range = i;
+                index = key_override_lookup[next[i]].index;
             }
-        } else {
-            // If not registering the replacement key send keyboard report to update the unregistered keys.
-            send_keyboard_report();
+        }
+        if (range == ranges) {
+            return NULL;
+        }
+
+        const key_override_lookup_entry_t *entry = &key_override_lookup[next[range]++];
+        if ((entry->layers & layer_bit) == 0 || (entry->negative_mod_mask & active_mods) != 0 || (active_mods == 0 && entry->trigger_mods != 0)) {
+            continue;
         }
 
-        *activated = true;
+        const key_override_t *const override = key_override_get(entry->index);
+        if (can_activate_override(override, keycode, layer, key_down, is_mod, active_mods)) {
+            return override;
+        }
+    }
+}
+#endif
 
-        // If the trigger is down, suppress the event so that it does not get added to the keyboard report.
-        return !trigger_down;
+/** Iterates through the list of key overrides and tries activating each, until it finds one that activates or reaches the end of overrides. Returns true if the key action for `keycode` should be sent */
+static bool try_activating_override(const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *activated) {
+    if (key_override_count() == 0) {
+        return true;
     }
 
-    *activated = false;
+    const key_override_t *override = NULL;
 
-    return true;
+#ifdef KEY_OVERRIDE_LOOKUP_SIZE
+    if (!key_override_lookup_built || key_override_lookup_count != key_override_count()) {
+        key_override_lookup_build();
+    }
+    if (key_override_lookup_valid) {
+        override = key_override_lookup_first(keycode, layer, key_down, is_mod, active_mods);
+    } else
+#endif
+    {
+        for (uint16_t i = 0; i < key_override_count(); i++) {
+            const key_override_t *const candidate = key_override_get(i);
+
+            // End of array
+            if (candidate == NULL) {
+                break;
+            }
+
+            if (can_activate_override(candidate, keycode, layer, key_down, is_mod, active_mods)) {
+                override = candidate;
+                break;
+            }
+        }
+    }
+
+    if (override == NULL) {
+        *activated = false;
+        return true;
+    }
+
+    *activated = true;
+    return activate_override(override, keycode, key_down, is_mod, active_mods);
 }
 
 void key_override_task(void) {
@@ -0,0 +1,107 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stddef.h>
+#include "profiler.h"
+#include "timer.h"
+
+#if defined(PROTOCOL_CHIBIOS)
+#    include <ch.h>
+#    include "chibios_config.h"
+#endif
+
+#if defined(PROTOCOL_CHIBIOS) && PORT_SUPPORTS_RT == TRUE
+#    define PROFILER_TIMESTAMP() ((uint32_t)chSysGetRealtimeCounterX())
+#    define PROFILER_TIMESTAMP_FREQUENCY REALTIME_COUNTER_CLOCK
+#else
+#    define PROFILER_TIMESTAMP() timer_read_us()
+#    define PROFILER_TIMESTAMP_FREQUENCY 1000000
+#endif
+
+static profiler_event_t buffer[PROFILER_BUFFER_SIZE];
+static uint16_t         head;
+static uint16_t         tail;
+static uint16_t         dropped;
+static uint8_t          depth;
+
+static const char *zone_names[PROFILER_MAX_ZONES];
+static uint8_t     zone_count;
+
+static void record(profiler_zone_t *zone, bool end) {
+    uint32_t timestamp = PROFILER_TIMESTAMP();
+
+    if (zone->id == 0) {
+        if (zone_count == PROFILER_MAX_ZONES) {
+            return;
+        }
+        zone_names[zone_count] = zone->name;
+        zone->id               = ++zone_count;
+    }
+
+    uint16_t next = (head + 1) % PROFILER_BUFFER_SIZE;
+    if (next == tail) {
+        if (dropped < UINT16_MAX) {
+            dropped++;
+        }
+        return;
+    }
+    buffer[head] = (profiler_event_t){
+        .timestamp = timestamp,
+        .zone      = zone->id,
+        .depth     = depth,
+        .end       = end,
+    };
+    head = next;
+}
+
+void profiler_begin(profiler_zone_t *zone) {
+    record(zone, false);
+    depth++;
+}
+
+void profiler_end(profiler_zone_t *zone) {
+    depth--;
+    record(zone, true);
+}
+
+void profiler_scope_exit(profiler_zone_t **zone) {
+    profiler_end(*zone);
+}
+
+bool profiler_read(profiler_event_t *event) {
+    if (head == tail) {
+        return false;
+    }
+    *event = buffer[tail];
+    tail   = (tail + 1) % PROFILER_BUFFER_SIZE;
+    return true;
+}
+
+const char *profiler_zone_name(uint8_t id) {
+    if (id == 0 || id > zone_count) {
+        return NULL;
+    }
+    return zone_names[id - 1];
+}
+
+uint8_t profiler_zone_count(void) {
+    return zone_count;
+}
+
+uint16_t profiler_dropped(void) {
+    return dropped;
+}
+
+void profiler_clear(void) {
+    head    = 0;
+    tail    = 0;
+    dropped = 0;
+}
+
+uint32_t profiler_timestamp(void) {
+    return PROFILER_TIMESTAMP();
+}
+
+uint32_t profiler_timestamp_frequency(void) {
+    return PROFILER_TIMESTAMP_FREQUENCY;
+}
@@ -0,0 +1,97 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Zone profiler.
+ *
+ * Code is split into named zones, which can be nested. Entering and leaving a
+ * zone records a timestamped event into a ring buffer, for a host tool to pull
+ * and turn into a flamegraph. Timestamps come from the cycle counter on ChibiOS
+ * ports that have one, and from timer_read_us() everywhere else, including the
+ * test platform.
+ *
+ *     void matrix_scan_user(void) {
+ *         PROFILER_SCOPE("matrix_scan_user");
+ *         ...
+ *     }
+ *
+ * The profiler is meant to be used from the main loop only. With PROFILER_ENABLE
+ * off, the macros compile to nothing.
+ */
+
+#ifndef PROFILER_BUFFER_SIZE
+#    define PROFILER_BUFFER_SIZE 128
+#endif
+
+#ifndef PROFILER_MAX_ZONES
+#    define PROFILER_MAX_ZONES 32
+#endif
+
+#if PROFILER_MAX_ZONES > 255
+#    error PROFILER_MAX_ZONES must be at most 255
+#endif
+
+typedef struct {
+    const char *name;
+    uint8_t     id; // set when the zone is first entered, 0 if there was no room left
+} profiler_zone_t;
+
+typedef struct {
+    uint32_t timestamp;
+    uint8_t  zone;
+    uint8_t  depth : 7; // nesting level of the zone, 0 for the outermost
+    bool     end : 1;   // leaving the zone rather than entering it
+} profiler_event_t;
+
+/** \brief Records entering a zone. */
+void profiler_begin(profiler_zone_t *zone);
+
+/** \brief Records leaving a zone, which must be the last one entered. */
+void profiler_end(profiler_zone_t *zone);
+
+/** \brief Takes the oldest event out of the buffer, returns false if it is empty. */
+bool profiler_read(profiler_event_t *event);
+
+/** \brief Gets the name of a zone from its id, NULL if there is no such zone. */
+const char *profiler_zone_name(uint8_t id);
+
+/** \brief Number of zones entered so far. */
+uint8_t profiler_zone_count(void);
+
+/** \brief Number of events lost because the buffer was full, since the last clear. */
+uint16_t profiler_dropped(void);
+
+/** \brief Empties the buffer and resets the dropped count. */
+void profiler_clear(void);
+
+/** \brief Gets the current timestamp. */
+uint32_t profiler_timestamp(void);
+
+/** \brief Timestamp ticks per second. */
+uint32_t profiler_timestamp_frequency(void);
+
+void profiler_scope_exit(profiler_zone_t **zone);
+
+#define PROFILER_CONCAT2(a, b) a##b
+#define PROFILER_CONCAT(a, b) PROFILER_CONCAT2(a, b)
+
+#ifdef PROFILER_ENABLE
+/** \brief Defines a zone for use with PROFILER_BEGIN() and PROFILER_END(). */
+#    define PROFILER_ZONE(var, zone_name) static profiler_zone_t var = {.name = (zone_name)}
+#    define PROFILER_BEGIN(var) profiler_begin(&(var))
+#    define PROFILER_END(var) profiler_end(&(var))
+/** \brief Profiles the rest of the enclosing block as a zone. */
+#    define PROFILER_SCOPE(zone_name)                                                                                                                           \
+        static profiler_zone_t PROFILER_CONCAT(profiler_zone_, __LINE__) = {.name = (zone_name)};                                                               \
+        __attribute__((cleanup(profiler_scope_exit))) profiler_zone_t *PROFILER_CONCAT(profiler_scope_, __LINE__) = &PROFILER_CONCAT(profiler_zone_, __LINE__); \
+        profiler_begin(PROFILER_CONCAT(profiler_scope_, __LINE__))
+#else
+#    define PROFILER_ZONE(var, zone_name)
+#    define PROFILER_BEGIN(var)
+#    define PROFILER_END(var)
+#    define PROFILER_SCOPE(zone_name)
+#endif
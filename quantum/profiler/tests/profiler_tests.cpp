@@ -0,0 +1,136 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "profiler.h"
+#include "timer.h"
+
+void advance_time(uint32_t ms);
+}
+
+#include <string>
+#include <vector>
+
+class ProfilerTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        timer_init();
+        profiler_clear();
+    }
+
+    std::vector<profiler_event_t> readAll() {
+        std::vector<profiler_event_t> events;
+        profiler_event_t              event;
+        while (profiler_read(&event)) {
+            events.push_back(event);
+        }
+        return events;
+    }
+
+    void expectEvent(const profiler_event_t &event, uint32_t timestamp, const std::string &zone, uint8_t depth, bool end) {
+        EXPECT_EQ(event.timestamp, timestamp);
+        ASSERT_NE(profiler_zone_name(event.zone), nullptr);
+        EXPECT_EQ(profiler_zone_name(event.zone), zone);
+        EXPECT_EQ(event.depth, depth);
+        EXPECT_EQ(event.end, end);
+    }
+};
+
+static void inner(void) {
+    PROFILER_SCOPE("inner");
+    advance_time(2);
+}
+
+static void outer(void) {
+    PROFILER_SCOPE("outer");
+    advance_time(1);
+    inner();
+    advance_time(1);
+}
+
+TEST_F(ProfilerTest, TestPlatformTimestamps) {
+    EXPECT_EQ(profiler_timestamp_frequency(), 1000000);
+    advance_time(5);
+    EXPECT_EQ(profiler_timestamp(), 5000);
+}
+
+TEST_F(ProfilerTest, NestedScopes) {
+    outer();
+
+    auto events = readAll();
+    ASSERT_EQ(events.size(), 4);
+    expectEvent(events[0], 0, "outer", 0, false);
+    expectEvent(events[1], 1000, "inner", 1, false);
+    expectEvent(events[2], 3000, "inner", 1, true);
+    expectEvent(events[3], 4000, "outer", 0, true);
+}
+
+TEST_F(ProfilerTest, ZonesKeepTheirId) {
+    outer();
+    auto first = readAll();
+    outer();
+    auto second = readAll();
+
+    ASSERT_EQ(first.size(), 4);
+    ASSERT_EQ(second.size(), 4);
+    EXPECT_EQ(first[0].zone, second[0].zone);
+    EXPECT_EQ(first[1].zone, second[1].zone);
+    EXPECT_NE(first[0].zone, first[1].zone);
+}
+
+TEST_F(ProfilerTest, ExplicitZone) {
+    PROFILER_ZONE(zone, "explicit");
+
+    PROFILER_BEGIN(zone);
+    advance_time(3);
+    PROFILER_END(zone);
+
+    auto events = readAll();
+    ASSERT_EQ(events.size(), 2);
+    expectEvent(events[0], 0, "explicit", 0, false);
+    expectEvent(events[1], 3000, "explicit", 0, true);
+}
+
+TEST_F(ProfilerTest, FullBufferDropsEvents) {
+    // the buffer holds PROFILER_BUFFER_SIZE - 1 events
+    for (int i = 0; i < 5; i++) {
+        inner();
+    }
+    EXPECT_EQ(profiler_dropped(), 3);
+
+    auto events = readAll();
+    ASSERT_EQ(events.size(), 7);
+    expectEvent(events[0], 0, "inner", 0, false);
+    expectEvent(events[6], 6000, "inner", 0, false);
+
+    profiler_clear();
+    EXPECT_EQ(profiler_dropped(), 0);
+    inner();
+    EXPECT_EQ(readAll().size(), 2);
+}
+
+TEST_F(ProfilerTest, FullZoneTable) {
+    static profiler_zone_t zones[PROFILER_MAX_ZONES] = {
+        {.name = "zone 0"},
+        {.name = "zone 1"},
+        {.name = "zone 2"},
+        {.name = "zone 3"},
+    };
+
+    uint8_t i = 0;
+    for (; profiler_zone_count() < PROFILER_MAX_ZONES; i++) {
+        profiler_begin(&zones[i]);
+        profiler_end(&zones[i]);
+    }
+    readAll();
+
+    // zones that don't fit aren't recorded
+    profiler_begin(&zones[i]);
+    profiler_end(&zones[i]);
+    EXPECT_EQ(zones[i].id, 0);
+    EXPECT_EQ(readAll().size(), 0);
+    EXPECT_EQ(profiler_zone_name(PROFILER_MAX_ZONES + 1), nullptr);
+    EXPECT_EQ(profiler_zone_name(0), nullptr);
+}
@@ -0,0 +1,7 @@
+profiler_DEFS := -DPROFILER_ENABLE -DPROFILER_BUFFER_SIZE=8 -DPROFILER_MAX_ZONES=4
+
+profiler_SRC := \
+    $(QUANTUM_PATH)/profiler/tests/profiler_tests.cpp \
+    $(QUANTUM_PATH)/profiler.c \
+    $(PLATFORM_PATH)/timer.c \
+    $(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
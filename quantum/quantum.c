@@ -297,6 +297,13 @@ void post_process_record_quantum(keyrecord_t *record) {
     post_process_record_kb(keycode, record);
 }
 
+/* Each handler of process_record_quantum() declares the keycodes it acts on, or
+ * that it needs to see all of them, and is only called for those. The handlers
+ * limited to their own keycodes mustn't have side effects on the other ones.
+ */
+#define PROCESS_ALL_KEYCODES(process) (process)(keycode, record)
+#define PROCESS_KEYCODES(process, first, last) (keycode < (first) || keycode > (last) || (process)(keycode, record))
+
 /** \brief Core keycode function
  *
  * Hands off handling to other quantum/process_keycode/ functions
@@ -345,110 +352,114 @@ bool process_record_quantum(keyrecord_t *record) {
 #endif
 #if defined(DYNAMIC_MACRO_ENABLE) && !defined(DYNAMIC_MACRO_USER_CALL)
             // Must run asap to ensure all keypresses are recorded.
-            process_dynamic_macro(keycode, record) &&
+            PROCESS_ALL_KEYCODES(process_dynamic_macro) &&
 #endif
 #ifdef REPEAT_KEY_ENABLE
-            process_last_key(keycode, record) && process_repeat_key(keycode, record) &&
+            PROCESS_ALL_KEYCODES(process_last_key) && PROCESS_ALL_KEYCODES(process_repeat_key) &&
 #endif
 #if defined(AUDIO_ENABLE) && defined(AUDIO_CLICKY)
-            process_clicky(keycode, record) &&
+            PROCESS_ALL_KEYCODES(process_clicky) &&
 #endif
 #ifdef HAPTIC_ENABLE
-            process_haptic(keycode, record) &&
+            PROCESS_ALL_KEYCODES(process_haptic) &&
 #endif
 #if defined(POINTING_DEVICE_ENABLE) && defined(POINTING_DEVICE_AUTO_MOUSE_ENABLE)
-            process_auto_mouse(keycode, record) &&
+            PROCESS_ALL_KEYCODES(process_auto_mouse) &&
 #endif
-            process_record_modules(keycode, record) && // modules must run before kb
-            process_record_kb(keycode, record) &&
+            PROCESS_ALL_KEYCODES(process_record_modules) && // modules must run before kb
+            PROCESS_ALL_KEYCODES(process_record_kb) &&
 #if defined(VIA_ENABLE)
-            process_record_via(keycode, record) &&
+            PROCESS_KEYCODES(process_record_via, QK_MACRO, QK_MACRO_MAX) &&
 #endif
 #if defined(SECURE_ENABLE)
-            process_secure(keycode, record) &&
+            PROCESS_KEYCODES(process_secure, QK_SECURE_LOCK, QK_SECURE_REQUEST) &&
 #endif
 #if defined(SEQUENCER_ENABLE)
-            process_sequencer(keycode, record) &&
+            PROCESS_KEYCODES(process_sequencer, QK_SEQUENCER, QK_SEQUENCER_MAX) &&
 #endif
 #if defined(MIDI_ENABLE) && defined(MIDI_ADVANCED)
-            process_midi(keycode, record) &&
+            PROCESS_KEYCODES(process_midi, QK_MIDI, QK_MIDI_MAX) &&
 #endif
 #ifdef AUDIO_ENABLE
-            process_audio(keycode, record) &&
+            PROCESS_KEYCODES(process_audio, QK_AUDIO, QK_AUDIO_MAX) &&
 #endif
 #if defined(BACKLIGHT_ENABLE)
-            process_backlight(keycode, record) &&
+            PROCESS_KEYCODES(process_backlight, QK_LIGHTING, QK_LIGHTING_MAX) &&
 #endif
 #if defined(LED_MATRIX_ENABLE)
-            process_led_matrix(keycode, record) &&
+            PROCESS_KEYCODES(process_led_matrix, QK_LIGHTING, QK_LIGHTING_MAX) &&
 #endif
 #ifdef STENO_ENABLE
-            process_steno(keycode, record) &&
+            PROCESS_KEYCODES(process_steno, QK_STENO, QK_STENO_MAX) &&
 #endif
 #if (defined(AUDIO_ENABLE) || (defined(MIDI_ENABLE) && defined(MIDI_BASIC))) && !defined(NO_MUSIC_MODE)
-            process_music(keycode, record) &&
+            PROCESS_ALL_KEYCODES(process_music) &&
 #endif
 #ifdef CAPS_WORD_ENABLE
-            process_caps_word(keycode, record) &&
+            PROCESS_ALL_KEYCODES(process_caps_word) &&
 #endif
 #ifdef KEY_OVERRIDE_ENABLE
-            process_key_override(keycode, record) &&
+            PROCESS_ALL_KEYCODES(process_key_override) &&
 #endif
 #ifdef TAP_DANCE_ENABLE
-            process_tap_dance(keycode, record) &&
+            PROCESS_KEYCODES(process_tap_dance, QK_TAP_DANCE, QK_TAP_DANCE_MAX) &&
 #endif
-#if defined(UNICODE_COMMON_ENABLE)
-            process_unicode_common(keycode, record) &&
+#if defined(UCIS_ENABLE)
+            // takes every key while a sequence is entered
+            PROCESS_ALL_KEYCODES(process_unicode_common) &&
+#elif defined(UNICODE_COMMON_ENABLE)
+            // input mode keycodes, then the unicode ranges
+            PROCESS_KEYCODES(process_unicode_common, QK_UNICODE_MODE_NEXT, QK_UNICODE_MAX) &&
 #endif
 #ifdef LEADER_ENABLE
-            process_leader(keycode, record) &&
+            PROCESS_ALL_KEYCODES(process_leader) &&
 #endif
 #ifdef AUTO_SHIFT_ENABLE
-            process_auto_shift(keycode, record) &&
+            PROCESS_ALL_KEYCODES(process_auto_shift) &&
 #endif
 #ifdef DYNAMIC_TAPPING_TERM_ENABLE
-            process_dynamic_tapping_term(keycode, record) &&
+            PROCESS_KEYCODES(process_dynamic_tapping_term, QK_DYNAMIC_TAPPING_TERM_PRINT, QK_DYNAMIC_TAPPING_TERM_DOWN) &&
 #endif
 #ifdef SPACE_CADET_ENABLE
-            process_space_cadet(keycode, record) &&
+            PROCESS_ALL_KEYCODES(process_space_cadet) &&
 #endif
 #ifdef MAGIC_ENABLE
-            process_magic(keycode, record) &&
+            PROCESS_KEYCODES(process_magic, QK_MAGIC, QK_MAGIC_MAX) &&
 #endif
 #ifdef GRAVE_ESC_ENABLE
-            process_grave_esc(keycode, record) &&
+            PROCESS_KEYCODES(process_grave_esc, QK_GRAVE_ESCAPE, QK_GRAVE_ESCAPE) &&
 #endif
 #if defined(RGBLIGHT_ENABLE) || defined(RGB_MATRIX_ENABLE)
-            process_underglow(keycode, record) &&
+            PROCESS_KEYCODES(process_underglow, QK_LIGHTING, QK_LIGHTING_MAX) &&
 #endif
 #if defined(RGB_MATRIX_ENABLE)
-            process_rgb_matrix(keycode, record) &&
+            PROCESS_KEYCODES(process_rgb_matrix, QK_LIGHTING, QK_LIGHTING_MAX) &&
 #endif
 #ifdef JOYSTICK_ENABLE
-            process_joystick(keycode, record) &&
+            PROCESS_KEYCODES(process_joystick, QK_JOYSTICK, QK_JOYSTICK_MAX) &&
 #endif
 #ifdef PROGRAMMABLE_BUTTON_ENABLE
-            process_programmable_button(keycode, record) &&
+            PROCESS_KEYCODES(process_programmable_button, QK_PROGRAMMABLE_BUTTON, QK_PROGRAMMABLE_BUTTON_MAX) &&
 #endif
 #ifdef AUTOCORRECT_ENABLE
-            process_autocorrect(keycode, record) &&
+            PROCESS_ALL_KEYCODES(process_autocorrect) &&
 #endif
 #ifdef TRI_LAYER_ENABLE
-            process_tri_layer(keycode, record) &&
+            PROCESS_KEYCODES(process_tri_layer, QK_TRI_LAYER_LOWER, QK_TRI_LAYER_UPPER) &&
 #endif
 #if !defined(NO_ACTION_LAYER)
-            process_default_layer(keycode, record) &&
+            PROCESS_KEYCODES(process_default_layer, QK_PERSISTENT_DEF_LAYER, QK_PERSISTENT_DEF_LAYER_MAX) &&
 #endif
 #ifdef LAYER_LOCK_ENABLE
-            process_layer_lock(keycode, record) &&
+            PROCESS_ALL_KEYCODES(process_layer_lock) &&
 #endif
 #ifdef CONNECTION_ENABLE
-            process_connection(keycode, record) &&
+            PROCESS_KEYCODES(process_connection, QK_CONNECTION, QK_CONNECTION_MAX) &&
 #endif
 #ifndef NO_ACTION_ONESHOT
-            process_oneshot(keycode, record) &&
+            PROCESS_KEYCODES(process_oneshot, QK_ONE_SHOT_ON, QK_ONE_SHOT_TOGGLE) &&
 #endif
-            process_quantum(keycode, record))) {
+            PROCESS_ALL_KEYCODES(process_quantum))) {
         return false;
     }
 
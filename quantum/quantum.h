@@ -53,6 +53,7 @@
 #include "action_tapping.h"
 #include "print.h"
 #include "debug.h"
+#include "profiler.h"
 #include "suspend.h"
 #include <stddef.h>
 #include <stdlib.h>
@@ -203,6 +204,18 @@ extern layer_state_t layer_state;
 #    include "via.h"
 #endif
 
+#ifdef DEBOUNCE_PER_KEY_ENABLE
+#    include "debounce_per_key.h"
+#endif
+
+#ifdef TAPPING_STATS_ENABLE
+#    include "tapping_stats.h"
+#endif
+
+#ifdef KEY_EVENT_QUEUE_ENABLE
+#    include "key_event_queue.h"
+#endif
+
 #ifdef WPM_ENABLE
 #    include "wpm.h"
 #endif
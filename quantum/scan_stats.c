@@ -0,0 +1,76 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "scan_stats.h"
+#include "timer.h"
+#include "debug.h"
+
+static histogram_t stats[SCAN_STATS_SECTIONS];
+static uint32_t    iteration[SCAN_STATS_SECTIONS];
+static uint32_t    start_time;
+static uint32_t    lap_time;
+#ifdef CONSOLE_ENABLE
+static uint32_t interval_start;
+#endif
+
+__attribute__((unused)) static const char *const section_names[SCAN_STATS_SECTIONS] = {
+    [SCAN_STATS_LOOP]     = "loop",
+    [SCAN_STATS_MATRIX]   = "matrix",
+    [SCAN_STATS_QUANTUM]  = "quantum",
+    [SCAN_STATS_LIGHTING] = "lighting",
+    [SCAN_STATS_POINTING] = "pointing",
+    [SCAN_STATS_DISPLAY]  = "display",
+    [SCAN_STATS_OTHER]    = "other",
+};
+
+void scan_stats_start(void) {
+    start_time = timer_read_us();
+    lap_time   = start_time;
+    memset(iteration, 0, sizeof(iteration));
+}
+
+void scan_stats_lap(scan_stats_section_t section) {
+    uint32_t now = timer_read_us();
+    iteration[section] += TIMER_DIFF_32(now, lap_time);
+    lap_time = now;
+}
+
+void scan_stats_end(void) {
+    uint32_t now = timer_read_us();
+    iteration[SCAN_STATS_OTHER] += TIMER_DIFF_32(now, lap_time);
+    iteration[SCAN_STATS_LOOP] = TIMER_DIFF_32(now, start_time);
+
+    for (uint8_t i = 0; i < SCAN_STATS_SECTIONS; i++) {
+        histogram_record(&stats[i], iteration[i]);
+    }
+
+#ifdef CONSOLE_ENABLE
+    if (TIMER_DIFF_32(now, interval_start) >= (uint32_t)SCAN_STATS_INTERVAL * 1000) {
+        interval_start = now;
+        scan_stats_print();
+        scan_stats_reset();
+    }
+#endif
+}
+
+void scan_stats_reset(void) {
+    memset(stats, 0, sizeof(stats));
+}
+
+void scan_stats_get(scan_stats_section_t section, scan_stats_summary_t *summary) {
+    histogram_get(&stats[section], summary);
+}
+
+void scan_stats_print(void) {
+    scan_stats_summary_t summary;
+
+    for (uint8_t i = 0; i < SCAN_STATS_SECTIONS; i++) {
+        scan_stats_get(i, &summary);
+        // sections of features that aren't enabled
+        if (summary.max == 0) {
+            continue;
+        }
+        dprintf("scan %s: n=%lu min=%u p50=%u p99=%u max=%u avg=%u us\n", section_names[i], (unsigned long)summary.count, summary.min, summary.p50, summary.p99, summary.max, summary.avg);
+    }
+}
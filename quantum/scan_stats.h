@@ -0,0 +1,54 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include "histogram.h"
+
+/* Scan time statistics.
+ *
+ * Every keyboard_task() iteration is timed with timer_read_us(), and split into
+ * sections with scan_stats_lap(). Each section keeps a histogram of its time per
+ * iteration, see histogram.h. Times are in microseconds and saturate at 65535.
+ */
+
+#ifndef SCAN_STATS_INTERVAL
+#    define SCAN_STATS_INTERVAL 10000
+#endif
+
+typedef enum {
+    SCAN_STATS_LOOP,     // whole keyboard_task() iteration
+    SCAN_STATS_MATRIX,   // matrix scan, debounce and key events
+    SCAN_STATS_QUANTUM,  // quantum_task()
+    SCAN_STATS_LIGHTING, // rgblight, LED matrix, RGB matrix and backlight
+    SCAN_STATS_POINTING, // pointing device
+    SCAN_STATS_DISPLAY,  // OLED and ST7565
+    SCAN_STATS_OTHER,    // everything else
+    SCAN_STATS_SECTIONS,
+} scan_stats_section_t;
+
+typedef histogram_summary_t scan_stats_summary_t;
+
+/** \brief Starts timing a keyboard_task() iteration. */
+void scan_stats_start(void);
+
+/** \brief Adds the time since the previous lap to a section. */
+void scan_stats_lap(scan_stats_section_t section);
+
+/**
+ * \brief Ends the iteration, the time since the last lap goes to SCAN_STATS_OTHER.
+ *
+ * With the console enabled, the statistics are printed and reset every
+ * SCAN_STATS_INTERVAL milliseconds.
+ */
+void scan_stats_end(void);
+
+/** \brief Clears the statistics of every section. */
+void scan_stats_reset(void);
+
+/** \brief Gets the statistics of a section, all zero if it has no samples. */
+void scan_stats_get(scan_stats_section_t section, scan_stats_summary_t *summary);
+
+/** \brief Prints the statistics of every section to the console. */
+void scan_stats_print(void);
@@ -0,0 +1,8 @@
+scan_stats_DEFS := -DSCAN_STATS_ENABLE
+
+scan_stats_SRC := \
+    $(QUANTUM_PATH)/scan_stats/tests/scan_stats_tests.cpp \
+    $(QUANTUM_PATH)/scan_stats.c \
+    $(QUANTUM_PATH)/histogram.c \
+    $(PLATFORM_PATH)/timer.c \
+    $(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
@@ -0,0 +1,138 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "scan_stats.h"
+#include "timer.h"
+
+void advance_time(uint32_t ms);
+}
+
+class ScanStatsTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        timer_init();
+        scan_stats_reset();
+    }
+
+    void iteration(uint32_t matrix_ms, uint32_t other_ms) {
+        scan_stats_start();
+        advance_time(matrix_ms);
+        scan_stats_lap(SCAN_STATS_MATRIX);
+        advance_time(other_ms);
+        scan_stats_end();
+    }
+};
+
+TEST_F(ScanStatsTest, Empty) {
+    scan_stats_summary_t summary;
+    scan_stats_get(SCAN_STATS_LOOP, &summary);
+    EXPECT_EQ(summary.count, 0);
+    EXPECT_EQ(summary.min, 0);
+    EXPECT_EQ(summary.max, 0);
+    EXPECT_EQ(summary.avg, 0);
+}
+
+TEST_F(ScanStatsTest, Sections) {
+    scan_stats_start();
+    advance_time(1);
+    scan_stats_lap(SCAN_STATS_MATRIX);
+    advance_time(2);
+    scan_stats_lap(SCAN_STATS_QUANTUM);
+    advance_time(3);
+    scan_stats_lap(SCAN_STATS_OTHER);
+    advance_time(4);
+    scan_stats_end();
+
+    scan_stats_summary_t summary;
+    scan_stats_get(SCAN_STATS_LOOP, &summary);
+    EXPECT_EQ(summary.count, 1);
+    EXPECT_EQ(summary.min, 10000);
+    EXPECT_EQ(summary.max, 10000);
+    EXPECT_EQ(summary.p50, 10000);
+
+    scan_stats_get(SCAN_STATS_MATRIX, &summary);
+    EXPECT_EQ(summary.max, 1000);
+    scan_stats_get(SCAN_STATS_QUANTUM, &summary);
+    EXPECT_EQ(summary.max, 2000);
+    // both laps of the same section add up
+    scan_stats_get(SCAN_STATS_OTHER, &summary);
+    EXPECT_EQ(summary.max, 7000);
+    // sections without laps get a time of 0
+    scan_stats_get(SCAN_STATS_LIGHTING, &summary);
+    EXPECT_EQ(summary.count, 1);
+    EXPECT_EQ(summary.max, 0);
+}
+
+TEST_F(ScanStatsTest, Percentiles) {
+    for (int i = 0; i < 97; i++) {
+        iteration(1, 0);
+    }
+    iteration(1, 2);
+    iteration(10, 0);
+    iteration(10, 0);
+
+    scan_stats_summary_t summary;
+    scan_stats_get(SCAN_STATS_LOOP, &summary);
+    EXPECT_EQ(summary.count, 100);
+    EXPECT_EQ(summary.min, 1000);
+    // rounded up to the end of the [768, 1024) bucket
+    EXPECT_EQ(summary.p50, 1023);
+    // within the [8192, 12288) bucket, but never more than the maximum
+    EXPECT_EQ(summary.p99, 10000);
+    EXPECT_EQ(summary.max, 10000);
+    EXPECT_EQ(summary.avg, 1200);
+}
+
+TEST_F(ScanStatsTest, Reset) {
+    iteration(1, 1);
+    scan_stats_reset();
+
+    scan_stats_summary_t summary;
+    scan_stats_get(SCAN_STATS_MATRIX, &summary);
+    EXPECT_EQ(summary.count, 0);
+    EXPECT_EQ(summary.max, 0);
+}
+
+TEST_F(ScanStatsTest, LongIteration) {
+    iteration(100, 0);
+
+    scan_stats_summary_t summary;
+    scan_stats_get(SCAN_STATS_MATRIX, &summary);
+    EXPECT_EQ(summary.max, 65535);
+    EXPECT_EQ(summary.p99, 65535);
+}
+
+TEST_F(ScanStatsTest, BucketOverflowHalvesCounts) {
+    for (uint32_t i = 0; i < 70000; i++) {
+        iteration(0, 0);
+    }
+    iteration(1, 0);
+
+    scan_stats_summary_t summary;
+    scan_stats_get(SCAN_STATS_LOOP, &summary);
+    EXPECT_EQ(summary.count, 65535 / 2 + (70000 - 65535) + 1);
+    EXPECT_EQ(summary.min, 0);
+    EXPECT_EQ(summary.p50, 0);
+    EXPECT_EQ(summary.max, 1000);
+}
+
+TEST_F(ScanStatsTest, SummaryPacking) {
+    histogram_summary_t summary;
+    summary.count    = 0x01020304;
+    summary.min      = 0x0506;
+    summary.p50      = 0x0708;
+    summary.p99      = 0x090A;
+    summary.max      = 0x0B0C;
+    summary.avg      = 0x0D0E;
+    uint8_t data[15] = {0};
+    data[14]         = 0xFF;
+
+    histogram_summary_pack(&summary, data);
+    for (uint8_t i = 0; i < 14; i++) {
+        EXPECT_EQ(data[i], i + 1);
+    }
+    EXPECT_EQ(data[14], 0xFF);
+}
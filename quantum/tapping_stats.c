@@ -0,0 +1,196 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "tapping_stats.h"
+#include "action_tapping.h"
+#include "keycodes.h"
+#include "timer.h"
+#include "util.h"
+
+#ifdef VIA_ENABLE
+#    include "nvm_via.h"
+#endif
+
+#ifdef NO_ACTION_TAPPING
+#    error "TAPPING_STATS_ENABLE requires tapping, remove NO_ACTION_TAPPING"
+#endif
+
+typedef struct {
+    uint16_t time;        // of the press
+    bool     pressed;     // the key is held
+    bool     interrupted; // another key was pressed since the press
+    uint8_t  fresh;       // release samples since the term was derived
+} slot_state_t;
+
+tapping_stats_table_t tapping_stats_table;
+
+static slot_state_t states[TAPPING_STATS_KEYS];
+static bool         dirty     = false; // a derived term changed since the last save
+static uint32_t     save_time = 0;
+static uint8_t      histograms[TAPPING_STATS_KEYS][TAPPING_STATS_INTERVALS][TAPPING_STATS_BUCKETS];
+
+static void record_sample(uint8_t slot, tapping_stats_interval_t interval, uint16_t time) {
+    uint8_t *buckets = histograms[slot][interval];
+    uint8_t  bucket  = MIN(time / TAPPING_STATS_BUCKET_WIDTH, TAPPING_STATS_BUCKETS - 1);
+
+    if (buckets[bucket] == UINT8_MAX) {
+        for (uint8_t i = 0; i < TAPPING_STATS_BUCKETS; i++) {
+            buckets[i] >>= 1;
+        }
+    }
+    buckets[bucket]++;
+}
+
+static void derive_term(uint8_t slot, keyrecord_t *record) {
+    tapping_stats_key_t *key     = &tapping_stats_table.keys[slot];
+    const uint8_t       *buckets = histograms[slot][TAPPING_STATS_RELEASE];
+    // only the buckets that end within the current term hold taps, the last
+    // bucket has no end
+    uint8_t  taps  = MIN(GET_TAPPING_TERM(key->keycode, record) / TAPPING_STATS_BUCKET_WIDTH, TAPPING_STATS_BUCKETS - 1);
+    uint16_t count = 0;
+
+    for (uint8_t i = 0; i < taps; i++) {
+        count += buckets[i];
+    }
+    if (count == 0) {
+        return;
+    }
+
+    uint16_t target = ((uint32_t)count * TAPPING_STATS_TUNE_PERCENTILE + 99) / 100;
+    uint16_t seen   = 0;
+    uint8_t  i      = 0;
+    for (; i < taps - 1; i++) {
+        seen += buckets[i];
+        if (seen >= target) {
+            break;
+        }
+    }
+
+    uint16_t term = (i + 1) * TAPPING_STATS_BUCKET_WIDTH + TAPPING_STATS_TUNE_MARGIN;
+    if (term < TAPPING_STATS_TUNE_MIN) {
+        term = TAPPING_STATS_TUNE_MIN;
+    } else if (term > TAPPING_STATS_TUNE_MAX) {
+        term = TAPPING_STATS_TUNE_MAX;
+    }
+
+    if (term != key->term) {
+        key->term = term;
+#ifdef TAPPING_STATS_AUTO_TUNE
+        // saved by tapping_stats_task(), not while the key events are processed
+        dirty = true;
+#endif
+    }
+}
+
+static int8_t add_key(keypos_t key, uint16_t keycode) {
+    for (uint8_t i = 0; i < TAPPING_STATS_KEYS; i++) {
+        if (tapping_stats_table.keys[i].keycode == KC_NO) {
+            tapping_stats_table.keys[i] = (tapping_stats_key_t){
+                .row     = key.row,
+                .col     = key.col,
+                .keycode = keycode,
+            };
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void press(keyrecord_t *record) {
+    for (uint8_t i = 0; i < TAPPING_STATS_KEYS; i++) {
+        if (states[i].pressed && !states[i].interrupted) {
+            record_sample(i, TAPPING_STATS_NEXT_KEY, TIMER_DIFF_16(record->event.time, states[i].time));
+            states[i].interrupted = true;
+        }
+    }
+
+    if (!is_tap_record(record)) {
+        return;
+    }
+    uint16_t keycode = get_record_keycode(record, false);
+    int8_t   slot    = tapping_stats_find(record->event.key, keycode);
+    if (slot < 0) {
+        slot = add_key(record->event.key, keycode);
+        if (slot < 0) {
+            return;
+        }
+    }
+    states[slot].time        = record->event.time;
+    states[slot].pressed     = true;
+    states[slot].interrupted = false;
+}
+
+static void release(keyrecord_t *record) {
+    for (uint8_t i = 0; i < TAPPING_STATS_KEYS; i++) {
+        tapping_stats_key_t *key = &tapping_stats_table.keys[i];
+        // the keycode may have changed with the layers, the key can only be held once
+        if (!states[i].pressed || key->row != record->event.key.row || key->col != record->event.key.col) {
+            continue;
+        }
+        states[i].pressed = false;
+        if (states[i].interrupted) {
+            return;
+        }
+        record_sample(i, TAPPING_STATS_RELEASE, TIMER_DIFF_16(record->event.time, states[i].time));
+        if (++states[i].fresh >= TAPPING_STATS_TUNE_SAMPLES) {
+            states[i].fresh = 0;
+            derive_term(i, record);
+        }
+        return;
+    }
+}
+
+void tapping_stats_event(keyrecord_t *record) {
+    if (record->event.pressed) {
+        press(record);
+    } else {
+        release(record);
+    }
+}
+
+void tapping_stats_reset(void) {
+    memset(states, 0, sizeof(states));
+    memset(histograms, 0, sizeof(histograms));
+}
+
+void tapping_stats_clear(void) {
+    memset(&tapping_stats_table, 0, sizeof(tapping_stats_table));
+    tapping_stats_reset();
+}
+
+int8_t tapping_stats_find(keypos_t key, uint16_t keycode) {
+    for (uint8_t i = 0; i < TAPPING_STATS_KEYS; i++) {
+        const tapping_stats_key_t *entry = &tapping_stats_table.keys[i];
+        if (entry->keycode == keycode && entry->row == key.row && entry->col == key.col) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+const uint8_t *tapping_stats_get_histogram(uint8_t slot, tapping_stats_interval_t interval) {
+    return histograms[slot][interval];
+}
+
+uint16_t tapping_stats_get_term(uint16_t keycode, keyrecord_t *record) {
+    if (keycode == KC_NO || record == NULL || !IS_EVENT(record->event)) {
+        return 0;
+    }
+    int8_t slot = tapping_stats_find(record->event.key, keycode);
+    return slot < 0 ? 0 : tapping_stats_table.keys[slot].term;
+}
+
+void tapping_stats_task(void) {
+    if (dirty && timer_elapsed32(save_time) >= TAPPING_STATS_SAVE_INTERVAL) {
+        tapping_stats_save();
+    }
+}
+
+void tapping_stats_save(void) {
+    dirty     = false;
+    save_time = timer_read32();
+#ifdef VIA_ENABLE
+    nvm_via_update_tapping_stats(&tapping_stats_table, sizeof(tapping_stats_table));
+#endif
+}
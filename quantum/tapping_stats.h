@@ -0,0 +1,118 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "action.h"
+#include "util.h"
+
+/* Tap-hold timing statistics.
+ *
+ * Up to TAPPING_STATS_KEYS tap-hold keys, told apart by their position and
+ * keycode, get a slot the first time they are pressed. Each press of a key ends
+ * up in one of its two histograms:
+ *
+ * - release: the key was released before any other key was pressed, this holds
+ *   the press to release time of taps (and of the rare holds without another key)
+ * - next key: another key was pressed while the key was held, this holds the time
+ *   from the press to the press of the other key
+ *
+ * Buckets are TAPPING_STATS_BUCKET_WIDTH milliseconds wide, the last one also
+ * holds every longer time. When a bucket is about to overflow, all the buckets of
+ * its histogram are halved.
+ *
+ * Once a key has TAPPING_STATS_TUNE_SAMPLES new release samples, a tapping term
+ * is derived for it: the end of the bucket holding the TAPPING_STATS_TUNE_PERCENTILE
+ * percentile of the releases that were within its current term, plus
+ * TAPPING_STATS_TUNE_MARGIN. With TAPPING_STATS_AUTO_TUNE, that term is returned
+ * by the default get_tapping_term() and, with VIA, saved to EEPROM by
+ * tapping_stats_task(), at most once per TAPPING_STATS_SAVE_INTERVAL.
+ */
+
+#ifndef TAPPING_STATS_KEYS
+#    define TAPPING_STATS_KEYS 8
+#endif
+
+#ifndef TAPPING_STATS_BUCKETS
+#    define TAPPING_STATS_BUCKETS 16
+#endif
+
+#ifndef TAPPING_STATS_BUCKET_WIDTH
+#    define TAPPING_STATS_BUCKET_WIDTH 25
+#endif
+
+#ifndef TAPPING_STATS_TUNE_SAMPLES
+#    define TAPPING_STATS_TUNE_SAMPLES 32
+#endif
+
+#ifndef TAPPING_STATS_TUNE_PERCENTILE
+#    define TAPPING_STATS_TUNE_PERCENTILE 95
+#endif
+
+#ifndef TAPPING_STATS_TUNE_MARGIN
+#    define TAPPING_STATS_TUNE_MARGIN 25
+#endif
+
+#ifndef TAPPING_STATS_TUNE_MIN
+#    define TAPPING_STATS_TUNE_MIN 100
+#endif
+
+#ifndef TAPPING_STATS_TUNE_MAX
+#    define TAPPING_STATS_TUNE_MAX (TAPPING_STATS_BUCKETS * TAPPING_STATS_BUCKET_WIDTH)
+#endif
+
+#ifndef TAPPING_STATS_SAVE_INTERVAL
+#    define TAPPING_STATS_SAVE_INTERVAL 60000
+#endif
+
+typedef enum {
+    TAPPING_STATS_RELEASE,  // press to release, without another key in between
+    TAPPING_STATS_NEXT_KEY, // press to the press of another key
+    TAPPING_STATS_INTERVALS,
+} tapping_stats_interval_t;
+
+typedef struct PACKED {
+    uint8_t  row;
+    uint8_t  col;
+    uint16_t keycode; // KC_NO for a free slot
+    uint16_t term;    // derived tapping term, 0 until there are enough samples
+} tapping_stats_key_t;
+
+typedef struct PACKED {
+    tapping_stats_key_t keys[TAPPING_STATS_KEYS];
+} tapping_stats_table_t;
+
+/** \brief Keys and derived terms, this is what gets saved to EEPROM */
+extern tapping_stats_table_t tapping_stats_table;
+
+/** \brief Records a key event, called by action_tapping_process(). */
+void tapping_stats_event(keyrecord_t *record);
+
+/** \brief Clears the histograms, keeping the keys and their terms. */
+void tapping_stats_reset(void);
+
+/** \brief Frees every slot. */
+void tapping_stats_clear(void);
+
+/** \brief Gets the slot of a key, or -1 if it has none. */
+int8_t tapping_stats_find(keypos_t key, uint16_t keycode);
+
+/** \brief Gets a histogram of a slot, TAPPING_STATS_BUCKETS counts. */
+const uint8_t *tapping_stats_get_histogram(uint8_t slot, tapping_stats_interval_t interval);
+
+/**
+ * \brief Gets the derived tapping term of a key.
+ *
+ * Custom get_tapping_term() functions can call it to use the derived terms.
+ *
+ * \return The term in milliseconds, or 0 if the key has none.
+ */
+uint16_t tapping_stats_get_term(uint16_t keycode, keyrecord_t *record);
+
+/** \brief Saves the derived terms if they changed since the last save, and that was TAPPING_STATS_SAVE_INTERVAL ago. */
+void tapping_stats_task(void);
+
+/** \brief Saves the keys and their terms, with VIA. */
+void tapping_stats_save(void);
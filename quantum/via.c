@@ -61,6 +61,26 @@
 #    include "led_matrix.h"
 #endif
 
+#if defined(DEBOUNCE_PER_KEY_ENABLE)
+#    include "debounce_per_key.h"
+#endif
+
+#if defined(SCAN_STATS_ENABLE)
+#    include "scan_stats.h"
+#endif
+
+#if defined(PROFILER_ENABLE)
+#    include "profiler.h"
+#endif
+
+#if defined(LATENCY_TRACE_ENABLE)
+#    include "latency_trace.h"
+#endif
+
+#if defined(TAPPING_STATS_ENABLE)
+#    include "tapping_stats.h"
+#endif
+
 // Can be called in an overriding via_init_kb() to test if keyboard level code usage of
 // EEPROM is invalid and use/save defaults.
 bool via_eeprom_is_valid(void) {
@@ -111,6 +131,12 @@ void via_init(void) {
     if (!via_eeprom_is_valid()) {
         eeconfig_init_via();
     }
+#if defined(DEBOUNCE_PER_KEY_ENABLE)
+    nvm_via_read_debounce_per_key(&debounce_per_key_table, sizeof(debounce_per_key_table));
+#endif
+#if defined(TAPPING_STATS_ENABLE)
+    nvm_via_read_tapping_stats(&tapping_stats_table, sizeof(tapping_stats_table));
+#endif
 }
 
 void eeconfig_init_via(void) {
@@ -124,6 +150,16 @@ void eeconfig_init_via(void) {
     dynamic_keymap_reset();
     // This resets the macros in EEPROM to nothing.
     dynamic_keymap_macro_reset();
+#if defined(DEBOUNCE_PER_KEY_ENABLE)
+    // This resets the per-key debounce times in EEPROM to what is in flash.
+    debounce_per_key_init();
+    via_qmk_debounce_save();
+#endif
+#if defined(TAPPING_STATS_ENABLE)
+    // This forgets the tap-hold keys and their derived tapping terms.
+    tapping_stats_clear();
+    via_qmk_tapping_stats_save();
+#endif
     // Save the magic number last, in case saving was interrupted
     via_eeprom_set_valid(true);
 }
@@ -223,11 +259,16 @@ __attribute__((weak)) void via_custom_value_command_kb(uint8_t *data, uint8_t le
 // This is the default handler for custom value commands.
 // It routes commands with channel IDs to command handlers as such:
 //
-//      id_qmk_backlight_channel    ->  via_qmk_backlight_command()
-//      id_qmk_rgblight_channel     ->  via_qmk_rgblight_command()
-//      id_qmk_rgb_matrix_channel   ->  via_qmk_rgb_matrix_command()
-//      id_qmk_led_matrix_channel   ->  via_qmk_led_matrix_command()
-//      id_qmk_audio_channel        ->  via_qmk_audio_command()
+//      id_qmk_backlight_channel      ->  via_qmk_backlight_command()
+//      id_qmk_rgblight_channel       ->  via_qmk_rgblight_command()
+//      id_qmk_rgb_matrix_channel     ->  via_qmk_rgb_matrix_command()
+//      id_qmk_led_matrix_channel     ->  via_qmk_led_matrix_command()
+//      id_qmk_audio_channel          ->  via_qmk_audio_command()
+//      id_qmk_debounce_channel       ->  via_qmk_debounce_command()
+//      id_qmk_scan_stats_channel     ->  via_qmk_scan_stats_command()
+//      id_qmk_profiler_channel       ->  via_qmk_profiler_command()
+//      id_qmk_latency_trace_channel  ->  via_qmk_latency_trace_command()
+//      id_qmk_tapping_stats_channel  ->  via_qmk_tapping_stats_command()
 //
 __attribute__((weak)) void via_custom_value_command(uint8_t *data, uint8_t length) {
     // data = [ command_id, channel_id, value_id, value_data ]
@@ -268,6 +309,41 @@ __attribute__((weak)) void via_custom_value_command(uint8_t *data, uint8_t lengt
     }
 #endif // AUDIO_ENABLE
 
+#if defined(DEBOUNCE_PER_KEY_ENABLE)
+    if (*channel_id == id_qmk_debounce_channel) {
+        via_qmk_debounce_command(data, length);
+        return;
+    }
+#endif // DEBOUNCE_PER_KEY_ENABLE
+
+#if defined(SCAN_STATS_ENABLE)
+    if (*channel_id == id_qmk_scan_stats_channel) {
+        via_qmk_scan_stats_command(data, length);
+        return;
+    }
+#endif // SCAN_STATS_ENABLE
+
+#if defined(PROFILER_ENABLE)
+    if (*channel_id == id_qmk_profiler_channel) {
+        via_qmk_profiler_command(data, length);
+        return;
+    }
+#endif // PROFILER_ENABLE
+
+#if defined(LATENCY_TRACE_ENABLE)
+    if (*channel_id == id_qmk_latency_trace_channel) {
+        via_qmk_latency_trace_command(data, length);
+        return;
+    }
+#endif // LATENCY_TRACE_ENABLE
+
+#if defined(TAPPING_STATS_ENABLE)
+    if (*channel_id == id_qmk_tapping_stats_channel) {
+        via_qmk_tapping_stats_command(data, length);
+        return;
+    }
+#endif // TAPPING_STATS_ENABLE
+
     (void)channel_id; // force use of variable
 
     // If we haven't returned before here, then let the keyboard level code
@@ -876,3 +952,370 @@ void via_qmk_audio_save(void) {
 }
 
 #endif // QMK_AUDIO_ENABLE
+
+#if defined(DEBOUNCE_PER_KEY_ENABLE)
+
+void via_qmk_debounce_command(uint8_t *data, uint8_t length) {
+    // data = [ command_id, channel_id, value_id, value_data ]
+    uint8_t *command_id        = &(data[0]);
+    uint8_t *value_id_and_data = &(data[2]);
+
+    switch (*command_id) {
+        case id_custom_set_value: {
+            via_qmk_debounce_set_value(value_id_and_data);
+            break;
+        }
+        case id_custom_get_value: {
+            via_qmk_debounce_get_value(value_id_and_data);
+            break;
+        }
+        case id_custom_save: {
+            via_qmk_debounce_save();
+            break;
+        }
+        default: {
+            *command_id = id_unhandled;
+            break;
+        }
+    }
+}
+
+void via_qmk_debounce_get_value(uint8_t *data) {
+    // data = [ value_id, value_data ]
+    uint8_t *value_id   = &(data[0]);
+    uint8_t *value_data = &(data[1]);
+    switch (*value_id) {
+        case id_qmk_debounce_key_time: {
+            // value_data = [ row, col, time ]
+            if (value_data[0] < MATRIX_ROWS && value_data[1] < MATRIX_COLS) {
+                value_data[2] = debounce_per_key_get_time(value_data[0], value_data[1]);
+            }
+            break;
+        }
+    }
+}
+
+void via_qmk_debounce_set_value(uint8_t *data) {
+    // data = [ value_id, value_data ]
+    uint8_t *value_id   = &(data[0]);
+    uint8_t *value_data = &(data[1]);
+    switch (*value_id) {
+        case id_qmk_debounce_key_time: {
+            // value_data = [ row, col, time ], time is replaced by the time
+            // actually in use if it could not be set as requested
+            if (value_data[0] < MATRIX_ROWS && value_data[1] < MATRIX_COLS) {
+                debounce_per_key_set_time(value_data[0], value_data[1], value_data[2]);
+                value_data[2] = debounce_per_key_get_time(value_data[0], value_data[1]);
+            }
+            break;
+        }
+    }
+}
+
+void via_qmk_debounce_save(void) {
+    nvm_via_update_debounce_per_key(&debounce_per_key_table, sizeof(debounce_per_key_table));
+}
+
+#endif // DEBOUNCE_PER_KEY_ENABLE
+
+#if defined(SCAN_STATS_ENABLE)
+
+void via_qmk_scan_stats_command(uint8_t *data, uint8_t length) {
+    // data = [ command_id, channel_id, value_id, value_data ]
+    uint8_t *command_id        = &(data[0]);
+    uint8_t *value_id_and_data = &(data[2]);
+
+    switch (*command_id) {
+        case id_custom_set_value: {
+            via_qmk_scan_stats_set_value(value_id_and_data);
+            break;
+        }
+        case id_custom_get_value: {
+            via_qmk_scan_stats_get_value(value_id_and_data);
+            break;
+        }
+        case id_custom_save: {
+            // nothing to save
+            break;
+        }
+        default: {
+            *command_id = id_unhandled;
+            break;
+        }
+    }
+}
+
+void via_qmk_scan_stats_get_value(uint8_t *data) {
+    // data = [ value_id, value_data ]
+    uint8_t *value_id   = &(data[0]);
+    uint8_t *value_data = &(data[1]);
+    switch (*value_id) {
+        case id_qmk_scan_stats_summary: {
+            // value_data = [ section, count (4 bytes), min, p50, p99, max, avg (2 bytes each) ]
+            // big-endian, times in microseconds
+            if (value_data[0] < SCAN_STATS_SECTIONS) {
+                scan_stats_summary_t summary;
+                scan_stats_get(value_data[0], &summary);
+                histogram_summary_pack(&summary, &value_data[1]);
+            }
+            break;
+        }
+    }
+}
+
+void via_qmk_scan_stats_set_value(uint8_t *data) {
+    // data = [ value_id, value_data ]
+    uint8_t *value_id = &(data[0]);
+    switch (*value_id) {
+        case id_qmk_scan_stats_reset: {
+            scan_stats_reset();
+            break;
+        }
+    }
+}
+
+#endif // SCAN_STATS_ENABLE
+
+#if defined(PROFILER_ENABLE)
+
+void via_qmk_profiler_command(uint8_t *data, uint8_t length) {
+    // data = [ command_id, channel_id, value_id, value_data ]
+    uint8_t *command_id        = &(data[0]);
+    uint8_t *value_id_and_data = &(data[2]);
+
+    switch (*command_id) {
+        case id_custom_set_value: {
+            via_qmk_profiler_set_value(value_id_and_data);
+            break;
+        }
+        case id_custom_get_value: {
+            via_qmk_profiler_get_value(value_id_and_data, length - 2);
+            break;
+        }
+        case id_custom_save: {
+            // nothing to save
+            break;
+        }
+        default: {
+            *command_id = id_unhandled;
+            break;
+        }
+    }
+}
+
+void via_qmk_profiler_get_value(uint8_t *data, uint8_t length) {
+    // data = [ value_id, value_data ], all values are big-endian
+    uint8_t *value_id   = &(data[0]);
+    uint8_t *value_data = &(data[1]);
+    switch (*value_id) {
+        case id_qmk_profiler_info: {
+            // value_data = [ timestamp frequency (4 bytes), zone count, dropped events (2 bytes) ]
+            uint32_t frequency = profiler_timestamp_frequency();
+            uint16_t dropped   = profiler_dropped();
+            value_data[0]      = frequency >> 24;
+            value_data[1]      = frequency >> 16;
+            value_data[2]      = frequency >> 8;
+            value_data[3]      = frequency & 0xFF;
+            value_data[4]      = profiler_zone_count();
+            value_data[5]      = dropped >> 8;
+            value_data[6]      = dropped & 0xFF;
+            break;
+        }
+        case id_qmk_profiler_zone_name: {
+            // value_data = [ zone id, name ], the name is null-terminated and cut to fit
+            const char *name = profiler_zone_name(value_data[0]);
+            uint8_t     i    = 0;
+            if (name != NULL) {
+                for (; name[i] != 0 && i < length - 3; i++) {
+                    value_data[1 + i] = name[i];
+                }
+            }
+            value_data[1 + i] = 0;
+            break;
+        }
+        case id_qmk_profiler_events: {
+            // value_data = [ count, events ], with events of 6 bytes each:
+            // [ timestamp (4 bytes), zone id, depth | end << 7 ]
+            profiler_event_t event;
+            uint8_t          count = 0;
+            uint8_t         *out   = &value_data[1];
+            while (count < (length - 2) / 6 && profiler_read(&event)) {
+                out[0] = event.timestamp >> 24;
+                out[1] = event.timestamp >> 16;
+                out[2] = event.timestamp >> 8;
+                out[3] = event.timestamp & 0xFF;
+                out[4] = event.zone;
+                out[5] = event.depth | (event.end << 7);
+                out += 6;
+                count++;
+            }
+            value_data[0] = count;
+            break;
+        }
+    }
+}
+
+void via_qmk_profiler_set_value(uint8_t *data) {
+    // data = [ value_id, value_data ]
+    uint8_t *value_id = &(data[0]);
+    switch (*value_id) {
+        case id_qmk_profiler_clear: {
+            profiler_clear();
+            break;
+        }
+    }
+}
+
+#endif // PROFILER_ENABLE
+
+#if defined(LATENCY_TRACE_ENABLE)
+
+void via_qmk_latency_trace_command(uint8_t *data, uint8_t length) {
+    // data = [ command_id, channel_id, value_id, value_data ]
+    uint8_t *command_id        = &(data[0]);
+    uint8_t *value_id_and_data = &(data[2]);
+
+    switch (*command_id) {
+        case id_custom_set_value: {
+            via_qmk_latency_trace_set_value(value_id_and_data);
+            break;
+        }
+        case id_custom_get_value: {
+            via_qmk_latency_trace_get_value(value_id_and_data);
+            break;
+        }
+        case id_custom_save: {
+            // nothing to save
+            break;
+        }
+        default: {
+            *command_id = id_unhandled;
+            break;
+        }
+    }
+}
+
+void via_qmk_latency_trace_get_value(uint8_t *data) {
+    // data = [ value_id, value_data ]
+    uint8_t *value_id   = &(data[0]);
+    uint8_t *value_data = &(data[1]);
+    switch (*value_id) {
+        case id_qmk_latency_trace_summary: {
+            // value_data = [ stage, count (4 bytes), min, p50, p99, max, avg (2 bytes each) ]
+            // big-endian, latencies in tens of microseconds
+            if (value_data[0] < LATENCY_TRACE_STAGES) {
+                latency_trace_summary_t summary;
+                latency_trace_get(value_data[0], &summary);
+                histogram_summary_pack(&summary, &value_data[1]);
+            }
+            break;
+        }
+    }
+}
+
+void via_qmk_latency_trace_set_value(uint8_t *data) {
+    // data = [ value_id, value_data ]
+    uint8_t *value_id = &(data[0]);
+    switch (*value_id) {
+        case id_qmk_latency_trace_reset: {
+            latency_trace_reset();
+            break;
+        }
+    }
+}
+
+#endif // LATENCY_TRACE_ENABLE
+
+#if defined(TAPPING_STATS_ENABLE)
+
+void via_qmk_tapping_stats_command(uint8_t *data, uint8_t length) {
+    // data = [ command_id, channel_id, value_id, value_data ]
+    uint8_t *command_id        = &(data[0]);
+    uint8_t *value_id_and_data = &(data[2]);
+
+    switch (*command_id) {
+        case id_custom_set_value: {
+            via_qmk_tapping_stats_set_value(value_id_and_data);
+            break;
+        }
+        case id_custom_get_value: {
+            via_qmk_tapping_stats_get_value(value_id_and_data, length - 2);
+            break;
+        }
+        case id_custom_save: {
+            via_qmk_tapping_stats_save();
+            break;
+        }
+        default: {
+            *command_id = id_unhandled;
+            break;
+        }
+    }
+}
+
+void via_qmk_tapping_stats_get_value(uint8_t *data, uint8_t length) {
+    // data = [ value_id, value_data ]
+    uint8_t *value_id   = &(data[0]);
+    uint8_t *value_data = &(data[1]);
+    switch (*value_id) {
+        case id_qmk_tapping_stats_key: {
+            // value_data = [ slot, row, col, keycode (2 bytes), term (2 bytes) ]
+            // big-endian, keycode is KC_NO for a free slot and term is 0 until derived
+            if (value_data[0] < TAPPING_STATS_KEYS) {
+                const tapping_stats_key_t *key = &tapping_stats_table.keys[value_data[0]];
+                value_data[1]                  = key->row;
+                value_data[2]                  = key->col;
+                value_data[3]                  = key->keycode >> 8;
+                value_data[4]                  = key->keycode & 0xFF;
+                value_data[5]                  = key->term >> 8;
+                value_data[6]                  = key->term & 0xFF;
+            }
+            break;
+        }
+        case id_qmk_tapping_stats_histogram: {
+            // value_data = [ slot, interval, bucket width (ms), bucket count, buckets ]
+            // the buckets that don't fit are left out
+            if (value_data[0] < TAPPING_STATS_KEYS && value_data[1] < TAPPING_STATS_INTERVALS) {
+                const uint8_t *buckets = tapping_stats_get_histogram(value_data[0], value_data[1]);
+                uint8_t        count   = 0;
+                for (; count < TAPPING_STATS_BUCKETS && count < length - 5; count++) {
+                    value_data[4 + count] = buckets[count];
+                }
+                value_data[2] = TAPPING_STATS_BUCKET_WIDTH;
+                value_data[3] = count;
+            }
+            break;
+        }
+    }
+}
+
+void via_qmk_tapping_stats_set_value(uint8_t *data) {
+    // data = [ value_id, value_data ]
+    uint8_t *value_id   = &(data[0]);
+    uint8_t *value_data = &(data[1]);
+    switch (*value_id) {
+        case id_qmk_tapping_stats_key: {
+            // value_data = [ slot, row, col, keycode (2 bytes), term (2 bytes) ]
+            // big-endian, a keycode of KC_NO frees the slot
+            if (value_data[0] < TAPPING_STATS_KEYS) {
+                tapping_stats_table.keys[value_data[0]] = (tapping_stats_key_t){
+                    .row     = value_data[1],
+                    .col     = value_data[2],
+                    .keycode = (value_data[3] << 8) | value_data[4],
+                    .term    = (value_data[5] << 8) | value_data[6],
+                };
+            }
+            break;
+        }
+        case id_qmk_tapping_stats_reset: {
+            tapping_stats_reset();
+            break;
+        }
+    }
+}
+
+void via_qmk_tapping_stats_save(void) {
+    tapping_stats_save();
+}
+
+#endif // TAPPING_STATS_ENABLE
@@ -85,12 +85,17 @@ enum via_keyboard_value_id {
 };
 
 enum via_channel_id {
-    id_custom_channel         = 0,
-    id_qmk_backlight_channel  = 1,
-    id_qmk_rgblight_channel   = 2,
-    id_qmk_rgb_matrix_channel = 3,
-    id_qmk_audio_channel      = 4,
-    id_qmk_led_matrix_channel = 5,
+    id_custom_channel            = 0,
+    id_qmk_backlight_channel     = 1,
+    id_qmk_rgblight_channel      = 2,
+    id_qmk_rgb_matrix_channel    = 3,
+    id_qmk_audio_channel         = 4,
+    id_qmk_led_matrix_channel    = 5,
+    id_qmk_debounce_channel      = 6,
+    id_qmk_scan_stats_channel    = 7,
+    id_qmk_profiler_channel      = 8,
+    id_qmk_latency_trace_channel = 9,
+    id_qmk_tapping_stats_channel = 10,
 };
 
 enum via_qmk_backlight_value {
@@ -123,6 +128,33 @@ enum via_qmk_audio_value {
     id_qmk_audio_clicky_enable = 2,
 };
 
+enum via_qmk_debounce_value {
+    id_qmk_debounce_key_time = 1,
+};
+
+enum via_qmk_scan_stats_value {
+    id_qmk_scan_stats_summary = 1,
+    id_qmk_scan_stats_reset   = 2,
+};
+
+enum via_qmk_profiler_value {
+    id_qmk_profiler_info      = 1,
+    id_qmk_profiler_zone_name = 2,
+    id_qmk_profiler_events    = 3,
+    id_qmk_profiler_clear     = 4,
+};
+
+enum via_qmk_latency_trace_value {
+    id_qmk_latency_trace_summary = 1,
+    id_qmk_latency_trace_reset   = 2,
+};
+
+enum via_qmk_tapping_stats_value {
+    id_qmk_tapping_stats_key       = 1,
+    id_qmk_tapping_stats_histogram = 2,
+    id_qmk_tapping_stats_reset     = 3,
+};
+
 // Can be called in an overriding via_init_kb() to test if keyboard level code usage of
 // EEPROM is invalid and use/save defaults.
 bool via_eeprom_is_valid(void);
@@ -188,3 +220,35 @@ void via_qmk_audio_set_value(uint8_t *data);
 void via_qmk_audio_get_value(uint8_t *data);
 void via_qmk_audio_save(void);
 #endif
+
+#if defined(DEBOUNCE_PER_KEY_ENABLE)
+void via_qmk_debounce_command(uint8_t *data, uint8_t length);
+void via_qmk_debounce_set_value(uint8_t *data);
+void via_qmk_debounce_get_value(uint8_t *data);
+void via_qmk_debounce_save(void);
+#endif
+
+#if defined(SCAN_STATS_ENABLE)
+void via_qmk_scan_stats_command(uint8_t *data, uint8_t length);
+void via_qmk_scan_stats_set_value(uint8_t *data);
+void via_qmk_scan_stats_get_value(uint8_t *data);
+#endif
+
+#if defined(PROFILER_ENABLE)
+void via_qmk_profiler_command(uint8_t *data, uint8_t length);
+void via_qmk_profiler_set_value(uint8_t *data);
+void via_qmk_profiler_get_value(uint8_t *data, uint8_t length);
+#endif
+
+#if defined(LATENCY_TRACE_ENABLE)
+void via_qmk_latency_trace_command(uint8_t *data, uint8_t length);
+void via_qmk_latency_trace_set_value(uint8_t *data);
+void via_qmk_latency_trace_get_value(uint8_t *data);
+#endif
+
+#if defined(TAPPING_STATS_ENABLE)
+void via_qmk_tapping_stats_command(uint8_t *data, uint8_t length);
+void via_qmk_tapping_stats_set_value(uint8_t *data);
+void via_qmk_tapping_stats_get_value(uint8_t *data, uint8_t length);
+void via_qmk_tapping_stats_save(void);
+#endif
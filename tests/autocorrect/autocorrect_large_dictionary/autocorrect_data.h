@@ -0,0 +1,5956 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*******************************************************************************
+  88888888888 888      d8b                .d888 d8b 888               d8b
+      888     888      Y8P               d88P"  Y8P 888               Y8P
+      888     888                        888        888
+      888     88888b.  888 .d8888b       888888 888 888  .d88b.       888 .d8888b
+      888     888 "88b 888 88K           888    888 888 d8P  Y8b      888 88K
+      888     888  888 888 "Y8888b.      888    888 888 88888888      888 "Y8888b.
+      888     888  888 888      X88      888    888 888 Y8b.          888      X88
+      888     888  888 888  88888P'      888    888 888  "Y8888       888  88888P'
+                                                        888                 888
+                                                        888                 888
+                                                        888                 888
+     .d88b.   .d88b.  88888b.   .d88b.  888d888 8888b.  888888 .d88b.   .d88888
+    d88P"88b d8P  Y8b 888 "88b d8P  Y8b 888P"      "88b 888   d8P  Y8b d88" 888
+    888  888 88888888 888  888 88888888 888    .d888888 888   88888888 888  888
+    Y88b 888 Y8b.     888  888 Y8b.     888    888  888 Y88b. Y8b.     Y88b 888
+     "Y88888  "Y8888  888  888  "Y8888  888    "Y888888  "Y888 "Y8888   "Y88888
+         888
+    Y8b d88P
+     "Y88P"
+*******************************************************************************/
+
+#pragma once
+
+// Autocorrection dictionary (3269 entries):
+//   :adn:               -> and
+//   :agin:              -> again
+//   :ahev:              -> have
+//   :ahve:              -> have
+//   :alot:              -> a lot
+//   :amke:              -> make
+//   :anbd:              -> and
+//   :apon:              -> upon
+//   :aslo:              -> also
+//   :awya:              -> away
+//   :bakc:              -> back
+//   :bcak:              -> back
+//   :beng:              -> being
+//   :cpoy:              -> copy
+//   :daed:              -> dead
+//   :eahc:              -> each
+//   :enxt:              -> next
+//   :eyar:              -> year
+//   :fatc:              -> fact
+//   :fidn:              -> find
+//   :fomr:              -> from
+//   :grwo:              -> grow
+//   :haev:              -> have
+//   :halp:              -> help
+//   :hten:              -> then
+//   :htey:              -> they
+//   :htis:              -> this
+//   :hvae:              -> have
+//   :inot:              -> into
+//   :isnt:              -> isn't
+//   :iwll:              -> will
+//   :iwth:              -> with
+//   :jstu:              -> just
+//   :jsut:              -> just
+//   :knwo:              -> know
+//   :konw:              -> know
+//   :kwno:              -> know
+//   :liek:              -> like
+//   :loev:              -> love
+//   :lsat:              -> last
+//   :lveo:              -> love
+//   :lvoe:              -> love
+//   :mkae:              -> make
+//   :mroe:              -> more
+//   :nkow:              -> know
+//   :nkwo:              -> know
+//   :nmae:              -> name
+//   :noth:              -> north
+//   :nto:               -> not
+//   :omre:              -> more
+//   :onot:              -> note
+//   :onyl:              -> only
+//   :owrk:              -> work
+//   :pary:              -> party
+//   :peom:              -> poem
+//   :smae:              -> same
+//   :smoe:              -> some
+//   :soem:              -> some
+//   :sohw:              -> show
+//   :stpo:              -> stop
+//   :suop:              -> soup
+//   :syas:              -> says
+//   :tahn:              -> than
+//   :taht:              -> that
+//   :tath:              -> that
+//   :teh:               -> the
+//   :tehy:              -> they
+//   :tghe:              -> the
+//   :thge:              -> the
+//   :thn:               -> then
+//   :thna:              -> than
+//   :thne:              -> then
+//   :thru:              -> through
+//   :thsi:              -> this
+//   :thta:              -> that
+//   :tiem:              -> time
+//   :tihs:              -> this
+//   :tje:               -> the
+//   :tjhe:              -> the
+//   :tkae:              -> take
+//   :tust:              -> trust
+//   :twon:              -> town
+//   :twpo:              -> two
+//   :tyhe:              -> they
+//   :uise:              -> use
+//   :veyr:              -> very
+//   :vrey:              -> very
+//   :vyer:              -> very
+//   :vyre:              -> very
+//   :waht:              -> what
+//   :wass:              -> was
+//   :watn:              -> want
+//   :weas:              -> was
+//   :wehn:              -> when
+//   :whic:              -> which
+//   :whn:               -> when
+//   :whta:              -> what
+//   :wich:              -> which
+//   :wief:              -> wife
+//   :wiew:              -> view
+//   :wih:               -> with
+//   :wiht:              -> with
+//   :witn:              -> with
+//   :wnat:              -> want
+//   :wokr:              -> work
+//   :wrok:              -> work
+//   :wtih:              -> with
+//   :yaer:              -> year
+//   :yera:              -> year
+//   :yrea:              -> year
+//   :ytou:              -> you
+//   :yuo:               -> you
+//   abandonned          -> abandoned
+//   aberation           -> aberration
+//   abilties            -> abilities
+//   abilty              -> ability
+//   abondon             -> abandon
+//   aborigene           -> aborigine
+//   abortificant        -> abortifacient
+//   abreviate           -> abbreviate
+//   abreviation         -> abbreviation
+//   abritrary           -> arbitrary
+//   absail              -> abseil
+//   absense             -> absence
+//   absolutly           -> absolutely
+//   absorbsion          -> absorption
+//   absorbtion          -> absorption
+//   abundacies          -> abundances
+//   abundancies         -> abundances
+//   abundunt            -> abundant
+//   abutts              -> abuts
+//   acadamy             -> academy
+//   acadmic             -> academic
+//   accademic           -> academic
+//   accademy            -> academy
+//   acccused            -> accused
+//   accelleration       -> acceleration
+//   accension           -> ascension
+//   acceptence          -> acceptance
+//   acceptible          -> acceptable
+//   accessable          -> accessible
+//   accidentaly         -> accidentally
+//   accidently          -> accidentally
+//   acclimitization     -> acclimatization
+//   accomadate          -> accommodate
+//   accomadating        -> accommodating
+//   accomadation        -> accommodation
+//   accomdate           -> accommodate
+//   accomodate          -> accommodate
+//   accomodating        -> accommodating
+//   accomodation        -> accommodation
+//   accompanyed         -> accompanied
+//   accordeon           -> accordion
+//   accordian           -> accordion
+//   accoring            -> according
+//   accoustic           -> acoustic
+//   accquainted         -> acquainted
+//   accrediation        -> accreditation
+//   accredidation       -> accreditation
+//   accross             -> across
+//   accussed            -> accused
+//   acedemic            -> academic
+//   acheive             -> achieve
+//   acheiving           -> achieving
+//   acheivment          -> achievement
+//   achievment          -> achievement
+//   achive              -> achieve
+//   acknowldeged        -> acknowledged
+//   acknowledgeing      -> acknowledging
+//   ackward             -> awkward
+//   acommodate          -> accommodate
+//   acomplish           -> accomplish
+//   acording            -> according
+//   acquaintence        -> acquaintance
+//   acquiantence        -> acquaintance
+//   acquited            -> acquitted
+//   activites           -> activities
+//   activly             -> actively
+//   actualy             -> actually
+//   acuracy             -> accuracy
+//   acused              -> accused
+//   acustom             -> accustom
+//   adavanced           -> advanced
+//   adbandon            -> abandon
+//   addional            -> additional
+//   additinally         -> additionally
+//   additionaly         -> additionally
+//   additonal           -> additional
+//   addmission          -> admission
+//   addopt              -> adopt
+//   addresable          -> addressable
+//   addresed            -> addressed
+//   addresing           -> addressing
+//   addressess          -> addresses
+//   addtion             -> addition
+//   adecuate            -> adequate
+//   adequit             -> adequate
+//   adhearing           -> adhering
+//   adherance           -> adherence
+//   admendment          -> amendment
+//   admininistrative    -> administrative
+//   adminstered         -> administered
+//   adminstrate         -> administrate
+//   adminstration       -> administration
+//   adminstrative       -> administrative
+//   adminstrator        -> administrator
+//   admissability       -> admissibility
+//   admissable          -> admissible
+//   admited             -> admitted
+//   adolecent           -> adolescent
+//   adquire             -> acquire
+//   adquiring           -> acquiring
+//   adres               -> address
+//   adventrous          -> adventurous
+//   advertisment        -> advertisement
+//   advesary            -> adversary
+//   adviced             -> advised
+//   aeriel              -> aerial
+//   afair               -> affair
+//   afficianados        -> aficionados
+//   afficionado         -> aficionado
+//   affilate            -> affiliate
+//   affilliate          -> affiliate
+//   affort              -> afford
+//   aforememtioned      -> aforementioned
+//   againnst            -> against
+//   agains:             -> against
+//   agaisnt             -> against
+//   aganist             -> against
+//   aggaravates         -> aggravates
+//   aggreed             -> agreed
+//   aggreement          -> agreement
+//   aggregious          -> egregious
+//   aggresive           -> aggressive
+//   agian               -> again
+//   aginst              -> against
+//   agravate            -> aggravate
+//   agred               -> agreed
+//   agreeement          -> agreement
+//   agreemnt            -> agreement
+//   agregate            -> aggregate
+//   agreing             -> agreeing
+//   agression           -> aggression
+//   agressive           -> aggressive
+//   agressor            -> aggressor
+//   agricultue          -> agriculture
+//   agriculure          -> agriculture
+//   agricuture          -> agriculture
+//   agrieved            -> aggrieved
+//   ahppen              -> happen
+//   aicraft             -> aircraft
+//   aiport              -> airport
+//   airbourne           -> airborne
+//   aircaft             -> aircraft
+//   aircrafts           -> aircraft
+//   airporta            -> airports
+//   airrcraft           -> aircraft
+//   aisian              -> asian
+//   albiet              -> albeit
+//   alchohol            -> alcohol
+//   alchol              -> alcohol
+//   alcohal             -> alcohol
+//   alcoholical         -> alcoholic
+//   aledge              -> allege
+//   alege               -> allege
+//   alegience           -> allegiance
+//   algebraical         -> algebraic
+//   algorhitms          -> algorithms
+//   algoritm            -> algorithm
+//   alientating         -> alienating
+//   alledge             -> allege
+//   allegedely          -> allegedly
+//   allegedy            -> allegedly
+//   allegely            -> allegedly
+//   allegence           -> allegiance
+//   allegience          -> allegiance
+//   allign              -> align
+//   alliviate           -> alleviate
+//   allopone            -> allophone
+//   allready            -> already
+//   allthough           -> although
+//   alltime             -> all-time
+//   alltogether         -> altogether
+//   almsot              -> almost
+//   alochol             -> alcohol
+//   alomst              -> almost
+//   alotted             -> allotted
+//   alowed              -> allowed
+//   alowing             -> allowing
+//   alreayd             -> already
+//   alsot               -> also
+//   alternitives        -> alternatives
+//   altho:              -> although
+//   altough             -> although
+//   alusion             -> allusion
+//   alwasy              -> always
+//   alwyas              -> always
+//   amalgomated         -> amalgamated
+//   amatuer             -> amateur
+//   amature             -> armature
+//   amendmant           -> amendment
+//   amerliorate         -> ameliorate
+//   amking              -> making
+//   ammend              -> amend
+//   ammount             -> amount
+//   ammused             -> amused
+//   amoung              -> among
+//   amung               -> among
+//   amunition           -> ammunition
+//   analagous           -> analogous
+//   analitic            -> analytic
+//   analogeous          -> analogous
+//   anarchim            -> anarchism
+//   anarchistm          -> anarchism
+//   ancestory           -> ancestry
+//   ancilliary          -> ancillary
+//   androgenous         -> androgynous
+//   androgeny           -> androgyny
+//   anihilation         -> annihilation
+//   aniversary          -> anniversary
+//   annoint             -> anoint
+//   annouced            -> announced
+//   annualy             -> annually
+//   annuled             -> annulled
+//   anohter             -> another
+//   anomolies           -> anomalies
+//   anomolous           -> anomalous
+//   anomoly             -> anomaly
+//   anonimity           -> anonymity
+//   anounced            -> announced
+//   anouncement         -> announcement
+//   ansalisation        -> nasalisation
+//   ansalization        -> nasalization
+//   ansestors           -> ancestors
+//   antartic            -> antarctic
+//   anthromorphization  -> anthropomorphization
+//   anthropolgist       -> anthropologist
+//   anthropolgy         -> anthropology
+//   anticipiate         -> anticipate
+//   antiquaries         -> antiquities
+//   antropological      -> anthropological
+//   anual               -> annual
+//   anulled             -> annulled
+//   anwsered            -> answered
+//   anyhwere            -> anywhere
+//   anyother            -> any other
+//   anytying            -> anything
+//   aparent             -> apparent
+//   aparment            -> apartment
+//   apenines            -> apennines
+//   aplication          -> application
+//   aplied              -> applied
+//   apolegetics         -> apologetics
+//   apparant            -> apparent
+//   appart              -> apart
+//   appealling          -> appealing
+//   appeareance         -> appearance
+//   appearence          -> appearance
+//   apperance           -> appearance
+//   appereance          -> appearance
+//   applicaiton         -> application
+//   appologies          -> apologies
+//   appology            -> apology
+//   apprearance         -> appearance
+//   apprieciate         -> appreciate
+//   approachs           -> approaches
+//   appropiate          -> appropriate
+//   appropraite         -> appropriate
+//   appropropiate       -> appropriate
+//   approproximate      -> approximate
+//   approxamately       -> approximately
+//   approxiately        -> approximately
+//   approximitely       -> approximately
+//   aprehensive         -> apprehensive
+//   apropriate          -> appropriate
+//   aproval             -> approval
+//   aproximate          -> approximate
+//   aquaduct            -> aqueduct
+//   aquaintance         -> acquaintance
+//   aquainted           -> acquainted
+//   aquiantance         -> acquaintance
+//   aquire              -> acquire
+//   aquiring            -> acquiring
+//   aquisition          -> acquisition
+//   aranged             -> arranged
+//   arangement          -> arrangement
+//   arbitarily          -> arbitrarily
+//   arbitary            -> arbitrary
+//   archaelogical       -> archaeological
+//   archaelogists       -> archaeologists
+//   archaelogy          -> archaeology
+//   archaoelogy         -> archaeology
+//   archaology          -> archaeology
+//   archeaologist       -> archaeologist
+//   archetect           -> architect
+//   archiac             -> archaic
+//   archictect          -> architect
+//   archimedian         -> archimedean
+//   architecht          -> architect
+//   architectual        -> architectural
+//   archtype            -> archetype
+//   aready              -> already
+//   areodynamics        -> aerodynamics
+//   argubly             -> arguably
+//   arguement           -> argument
+//   arival              -> arrival
+//   armamant            -> armament
+//   armistace           -> armistice
+//   arogant             -> arrogant
+//   arogent             -> arrogant
+//   aroud               -> around
+//   arrangment          -> arrangement
+//   arround             -> around
+//   artical             -> article
+//   artice              -> article
+//   artifical           -> artificial
+//   artillary           -> artillery
+//   arund               -> around
+//   asetic              -> ascetic
+//   asign               -> assign
+//   asociated           -> associated
+//   asorbed             -> absorbed
+//   asphyxation         -> asphyxiation
+//   assasin             -> assassin
+//   assassintation      -> assassination
+//   assemple            -> assemble
+//   assertation         -> assertion
+//   asside              -> aside
+//   assisnate           -> assassinate
+//   assit               -> assist
+//   assocation          -> association
+//   assoicate           -> associate
+//   assosication        -> assassination
+//   asssassans          -> assassins
+//   assualt             -> assault
+//   assymetric          -> asymmetric
+//   asteriod            -> asteroid
+//   asthetic            -> aesthetic
+//   asume               -> assume
+//   aswell              -> as well
+//   atain               -> attain
+//   atempting           -> attempting
+//   atheistical         -> atheistic
+//   athenean            -> athenian
+//   athiesm             -> atheism
+//   athiest             -> atheist
+//   atorney             -> attorney
+//   atribute            -> attribute
+//   attaindre           -> attainder
+//   attemp:             -> attempt
+//   attemt              -> attempt
+//   attendence          -> attendance
+//   attendent           -> attendant
+//   attened             -> attended
+//   attension           -> attention
+//   attitide            -> attitude
+//   attributred         -> attributed
+//   attrocities         -> atrocities
+//   audeince            -> audience
+//   auromated           -> automated
+//   austrailia          -> australia
+//   auther              -> author
+//   authobiographic     -> autobiographic
+//   authobiography      -> autobiography
+//   authorative         -> authoritative
+//   authorites          -> authorities
+//   authorithy          -> authority
+//   authoritiers        -> authorities
+//   authoritive         -> authoritative
+//   authrorities        -> authorities
+//   autochtonous        -> autochthonous
+//   autoctonous         -> autochthonous
+//   automaticly         -> automatically
+//   automibile          -> automobile
+//   automonomous        -> autonomous
+//   autor               -> author
+//   auxilary            -> auxiliary
+//   auxillaries         -> auxiliaries
+//   auxillary           -> auxiliary
+//   auxilliaries        -> auxiliaries
+//   auxilliary          -> auxiliary
+//   availabe            -> available
+//   availablity         -> availability
+//   availaible          -> available
+//   availble            -> available
+//   availiable          -> available
+//   avalable            -> available
+//   avalance            -> avalanche
+//   avaliable           -> available
+//   avation             -> aviation
+//   averageed           -> averaged
+//   avilable            -> available
+//   awared              -> awarded
+//   baloon              -> balloon
+//   bananna             -> banana
+//   bandwith            -> bandwidth
+//   bankrupcy           -> bankruptcy
+//   banruptcy           -> bankruptcy
+//   baout               -> about
+//   basicaly            -> basically
+//   basicly             -> basically
+//   beachead            -> beachhead
+//   beacuse             -> because
+//   beastiality         -> bestiality
+//   beatiful            -> beautiful
+//   beaurocracy         -> bureaucracy
+//   beaurocratic        -> bureaucratic
+//   beautyfull          -> beautiful
+//   becamae             -> became
+//   becames             -> becomes
+//   becasue             -> because
+//   beccause            -> because
+//   becomeing           -> becoming
+//   becouse             -> because
+//   becuase             -> because
+//   bedore              -> before
+//   beeing              -> being
+//   befoer              -> before
+//   beggin              -> begin
+//   begining            -> beginning
+//   beginnig            -> beginning
+//   behavour            -> behavior
+//   beleagured          -> beleaguered
+//   beleif              -> belief
+//   beleive             -> believe
+//   beleiving           -> believing
+//   beligum             -> belgium
+//   belive              -> believe
+//   belligerant         -> belligerent
+//   bellweather         -> bellwether
+//   bemusemnt           -> bemusement
+//   beneficary          -> beneficiary
+//   benificial          -> beneficial
+//   benifit             -> benefit
+//   bergamont           -> bergamot
+//   beseiging           -> besieging
+//   beteen              -> between
+//   betwen              -> between
+//   beween              -> between
+//   bewteen             -> between
+//   bigining            -> beginning
+//   biginning           -> beginning
+//   bilateraly          -> bilaterally
+//   billingualism       -> bilingualism
+//   binominal           -> binomial
+//   bizzare             -> bizarre
+//   blaim               -> blame
+//   blessure            -> blessing
+//   blitzkreig          -> blitzkrieg
+//   boaut               -> about
+//   bodydbuilder        -> bodybuilder
+//   bombardement        -> bombardment
+//   bombarment          -> bombardment
+//   bondary             -> boundary
+//   boook               -> book
+//   borke               -> broke
+//   boundry             -> boundary
+//   bouyancy            -> buoyancy
+//   bouyant             -> buoyant
+//   boyant              -> buoyant
+//   bradcast            -> broadcast
+//   brasillian          -> brazilian
+//   breakthough         -> breakthrough
+//   breif               -> brief
+//   brethen             -> brethren
+//   bretheren           -> brethren
+//   briliant            -> brilliant
+//   brillant            -> brilliant
+//   brimestone          -> brimstone
+//   britian             -> britain
+//   brittish            -> british
+//   broacasted          -> broadcast
+//   broadacasting       -> broadcasting
+//   broady              -> broadly
+//   buddah              -> buddha
+//   buddist             -> buddhist
+//   buisness            -> business
+//   buoancy             -> buoyancy
+//   buring              -> burying
+//   burried             -> buried
+//   busines:            -> business
+//   busness             -> business
+//   bussiness           -> business
+//   caculater           -> calculator
+//   cacuses             -> caucuses
+//   cahracters          -> characters
+//   calaber             -> caliber
+//   calculater          -> calculator
+//   calculs             -> calculus
+//   calenders           -> calendars
+//   caligraphy          -> calligraphy
+//   caluclate           -> calculate
+//   caluculate          -> calculate
+//   calulate            -> calculate
+//   camoflage           -> camouflage
+//   campagin            -> campaign
+//   campain             -> campaign
+//   cancelation         -> cancellation
+//   candadate           -> candidate
+//   candiate            -> candidate
+//   candidiate          -> candidate
+//   cannister           -> canister
+//   cannnot             -> cannot
+//   cannonical          -> canonical
+//   cannotation         -> connotation
+//   cant'               -> can't
+//   caost               -> coast
+//   caperbility         -> capability
+//   capible             -> capable
+//   captial             -> capital
+//   captued             -> captured
+//   capturd             -> captured
+//   carachter           -> character
+//   caracterized        -> characterized
+//   carcas:             -> carcass
+//   carefull            -> careful
+//   careing             -> caring
+//   carismatic          -> charismatic
+//   carmalite           -> carmelite
+//   carnagie            -> carnegie
+//   carnege             -> carnage
+//   carnige             -> carnage
+//   carnigie            -> carnegie
+//   carreer             -> career
+//   carrers             -> careers
+//   carribbean          -> caribbean
+//   carribean           -> caribbean
+//   cartdridge          -> cartridge
+//   carthographer       -> cartographer
+//   cartilege           -> cartilage
+//   cartilidge          -> cartilage
+//   cartrige            -> cartridge
+//   casette             -> cassette
+//   cassawory           -> cassowary
+//   cassowarry          -> cassowary
+//   casulaties          -> casualties
+//   casulaty            -> casualty
+//   catagories          -> categories
+//   catagorized         -> categorized
+//   catagory            -> category
+//   cataline            -> catiline
+//   catapillar          -> caterpillar
+//   catapiller          -> caterpillar
+//   catepillar          -> caterpillar
+//   catergorize         -> categorize
+//   caterpilar          -> caterpillar
+//   caterpiller         -> caterpillar
+//   cathlic             -> catholic
+//   catholocism         -> catholicism
+//   catterpilar         -> caterpillar
+//   catterpillar        -> caterpillar
+//   cattleship          -> battleship
+//   causalities         -> casualties
+//   ceasar              -> caesar
+//   ceaser              -> caesar
+//   cecause             -> because
+//   celcius             -> celsius
+//   cementary           -> cemetery
+//   cemetarey           -> cemetery
+//   cemetaries          -> cemeteries
+//   cemetary            -> cemetery
+//   cencus              -> census
+//   cententenial        -> centennial
+//   centruies           -> centuries
+//   centuties           -> centuries
+//   centuty             -> century
+//   cerimonial          -> ceremonial
+//   cerimonies          -> ceremonies
+//   cerimonious         -> ceremonious
+//   cerimony            -> ceremony
+//   ceromony            -> ceremony
+//   certainity          -> certainty
+//   certian             -> certain
+//   cervial             -> cervical
+//   chalenging          -> challenging
+//   challange           -> challenge
+//   challege            -> challenge
+//   champange           -> champagne
+//   changable           -> changeable
+//   charachter          -> character
+//   charactersistic     -> characteristic
+//   charactor           -> character
+//   charasmatic         -> charismatic
+//   charaterized        -> characterized
+//   chariman            -> chairman
+//   charistics          -> characteristics
+//   cheif               -> chief
+//   chemcial            -> chemical
+//   chemestry           -> chemistry
+//   chemicaly           -> chemically
+//   childbird           -> childbirth
+//   childen             -> children
+//   choosen             -> chosen
+//   chracter            -> character
+//   chuch               -> church
+//   churchs             -> churches
+//   cilinder            -> cylinder
+//   cincinatti          -> cincinnati
+//   cincinnatti         -> cincinnati
+//   circulaton          -> circulation
+//   circumsicion        -> circumcision
+//   circut              -> circuit
+//   ciricuit            -> circuit
+//   ciriculum           -> curriculum
+//   claer               -> clear
+//   claimes             -> claims
+//   clasic              -> classic
+//   cleareance          -> clearance
+//   clera               -> clear
+//   clincial            -> clinical
+//   clinicaly           -> clinically
+//   cmoputer            -> computer
+//   coctail             -> cocktail
+//   coform              -> conform
+//   cognizent           -> cognizant
+//   coincedentally      -> coincidentally
+//   colaborations       -> collaborations
+//   colateral           -> collateral
+//   colelctive          -> collective
+//   collaberative       -> collaborative
+//   collecton           -> collection
+//   collegue            -> colleague
+//   collonade           -> colonnade
+//   collonies           -> colonies
+//   collony             -> colony
+//   collosal            -> colossal
+//   colonizators        -> colonizers
+//   comander            -> commander
+//   comando             -> commando
+//   comany              -> company
+//   comapany            -> company
+//   comback             -> comeback
+//   combanations        -> combinations
+//   combinatins         -> combinations
+//   combusion           -> combustion
+//   comdemnation        -> condemnation
+//   comemmorates        -> commemorates
+//   comemoretion        -> commemoration
+//   comission           -> commission
+//   comitted            -> committed
+//   comittee            -> committee
+//   comitting           -> committing
+//   commandoes          -> commandos
+//   commedic            -> comedic
+//   commemerative       -> commemorative
+//   commemmorate        -> commemorate
+//   commemmorating      -> commemorating
+//   commerical          -> commercial
+//   commericial         -> commercial
+//   commerorative       -> commemorative
+//   comming             -> coming
+//   comminication       -> communication
+//   commitee            -> committee
+//   committe:           -> committee
+//   committment         -> commitment
+//   commmemorated       -> commemorated
+//   commongly           -> commonly
+//   commonweath         -> commonwealth
+//   commuications       -> communications
+//   commuinications     -> communications
+//   communciation       -> communication
+//   communiation        -> communication
+//   communites          -> communities
+//   compability         -> compatibility
+//   comparision         -> comparison
+//   comparitive         -> comparative
+//   compatabilities     -> compatibilities
+//   compatability       -> compatibility
+//   compatable          -> compatible
+//   compatablities      -> compatibilities
+//   compatablity        -> compatibility
+//   compatiable         -> compatible
+//   compatiblities      -> compatibilities
+//   compatiblity        -> compatibility
+//   compeitions         -> competitions
+//   compensantion       -> compensation
+//   competance          -> competence
+//   competant           -> competent
+//   competative         -> competitive
+//   competion           -> competition
+//   competitiion        -> competition
+//   competive           -> competitive
+//   comphrehensive      -> comprehensive
+//   compitent           -> competent
+//   completedthe        -> completed the
+//   completelyl         -> completely
+//   completetion        -> completion
+//   complier            -> compiler
+//   componant           -> component
+//   comprable           -> comparable
+//   comprimise          -> compromise
+//   compulsary          -> compulsory
+//   compulsery          -> compulsory
+//   computarized        -> computerized
+//   concensus           -> consensus
+//   concider            -> consider
+//   concieted           -> conceited
+//   concieve            -> conceive
+//   concious            -> conscious
+//   condamned           -> condemned
+//   condemmed           -> condemned
+//   condidtion          -> condition
+//   conditionsof        -> conditions of
+//   conected            -> connected
+//   conection           -> connection
+//   conesencus          -> consensus
+//   confidental         -> confidential
+//   confids             -> confides
+//   configureable       -> configurable
+//   confortable         -> comfortable
+//   congradulations     -> congratulations
+//   congresional        -> congressional
+//   conived             -> connived
+//   conjecutre          -> conjecture
+//   conjuction          -> conjunction
+//   conotations         -> connotations
+//   conquerd            -> conquered
+//   conquerer           -> conqueror
+//   conqured            -> conquered
+//   conscent            -> consent
+//   consciouness        -> consciousness
+//   consdider           -> consider
+//   consdiered          -> considered
+//   consectutive        -> consecutive
+//   consenquently       -> consequently
+//   consentrate         -> concentrate
+//   consept             -> concept
+//   consequentually     -> consequently
+//   consequeseces       -> consequences
+//   consern             -> concern
+//   conservitive        -> conservative
+//   consiciousness      -> consciousness
+//   consicousness       -> consciousness
+//   considerd           -> considered
+//   consideres          -> considered
+//   consious            -> conscious
+//   consistant          -> consistent
+//   consituencies       -> constituencies
+//   consituency         -> constituency
+//   consituted          -> constituted
+//   consitution         -> constitution
+//   consolodate         -> consolidate
+//   consonent           -> consonant
+//   consorcium          -> consortium
+//   conspiracys         -> conspiracies
+//   conspiriator        -> conspirator
+//   constaints          -> constraints
+//   constanly           -> constantly
+//   constarnation       -> consternation
+//   constatn            -> constant
+//   constinually        -> continually
+//   constituant         -> constituent
+//   constituion         -> constitution
+//   consttruction       -> construction
+//   constuction         -> construction
+//   consulant           -> consultant
+//   consumate           -> consummate
+//   contaiminate        -> contaminate
+//   containes           -> contains
+//   contamporaries      -> contemporaries
+//   contamporary        -> contemporary
+//   contempoary         -> contemporary
+//   contemporaneus      -> contemporaneous
+//   contempory          -> contemporary
+//   contendor           -> contender
+//   contined            -> continued
+//   continous           -> continuous
+//   continueing         -> continuing
+//   contravercial       -> controversial
+//   contraversy         -> controversy
+//   contributer         -> contributor
+//   contritutions       -> contributions
+//   controled           -> controlled
+//   controvercial       -> controversial
+//   controvercy         -> controversy
+//   controveries        -> controversies
+//   controversal        -> controversial
+//   controversey        -> controversy
+//   controvertial       -> controversial
+//   controvery          -> controversy
+//   contruction         -> construction
+//   contstruction       -> construction
+//   conveinent          -> convenient
+//   convenant           -> covenant
+//   convential          -> conventional
+//   convertables        -> convertibles
+//   convertion          -> conversion
+//   conviced            -> convinced
+//   convienient         -> convenient
+//   coordiantion        -> coordination
+//   coorperation        -> cooperation
+//   copmetitors         -> competitors
+//   coputer             -> computer
+//   copywrite           -> copyright
+//   coridal             -> cordial
+//   cornmitted          -> committed
+//   corosion            -> corrosion
+//   corparate           -> corporate
+//   corperations        -> corporations
+//   correcters          -> correctors
+//   correponding        -> corresponding
+//   correposding        -> corresponding
+//   correspondant       -> correspondent
+//   corridoors          -> corridors
+//   corrispond          -> correspond
+//   costitution         -> constitution
+//   coucil              -> council
+//   coudl               -> could
+//   councellor          -> councillor
+//   counries            -> countries
+//   countains           -> contains
+//   countires           -> countries
+//   coururier           -> courier
+//   coverted            -> converted
+//   creaeted            -> created
+//   creedence           -> credence
+//   critereon           -> criterion
+//   criterias           -> criteria
+//   criticists          -> critics
+//   critisising         -> criticising
+//   critisism           -> criticism
+//   critized            -> criticized
+//   critizing           -> criticizing
+//   crockodiles         -> crocodiles
+//   crowm               -> crown
+//   crtical             -> critical
+//   crucifiction        -> crucifixion
+//   crusies             -> cruises
+//   crystalisation      -> crystallisation
+//   culiminating        -> culminating
+//   cumulatative        -> cumulative
+//   curch               -> church
+//   curcuit             -> circuit
+//   currenly            -> currently
+//   curriculem          -> curriculum
+//   cyclinder           -> cylinder
+//   dacquiri            -> daiquiri
+//   dalmation           -> dalmatian
+//   damenor             -> demeanor
+//   dammage             -> damage
+//   dardenelles         -> dardanelles
+//   daugher             -> daughter
+//   debateable          -> debatable
+//   decendant           -> descendant
+//   decendent           -> descendant
+//   decideable          -> decidable
+//   decidely            -> decidedly
+//   decieved            -> deceived
+//   decison             -> decision
+//   decomposit          -> decompose
+//   decress             -> decrees
+//   decribe             -> describe
+//   decribing           -> describing
+//   dectect             -> detect
+//   defendent           -> defendant
+//   deffensively        -> defensively
+//   deffine             -> define
+//   definance           -> defiance
+//   definate            -> definite
+//   definatly           -> definitely
+//   definetly           -> definitely
+//   definining          -> defining
+//   definit:            -> definite
+//   defintion           -> definition
+//   degrate             -> degrade
+//   delagates           -> delegates
+//   delapidated         -> dilapidated
+//   delerious           -> delirious
+//   delevopment         -> development
+//   deliberatly         -> deliberately
+//   demenor             -> demeanor
+//   demographical       -> demographic
+//   demolision          -> demolition
+//   demorcracy          -> democracy
+//   demostration        -> demonstration
+//   denegrating         -> denigrating
+//   densly              -> densely
+//   deparment           -> department
+//   dependance          -> dependence
+//   dependancy          -> dependency
+//   deriviated          -> derived
+//   derivitive          -> derivative
+//   derogitory          -> derogatory
+//   descendands         -> descendants
+//   descibed            -> described
+//   descision           -> decision
+//   descriibes          -> describes
+//   descripters         -> descriptors
+//   descripton          -> description
+//   desctruction        -> destruction
+//   descuss             -> discuss
+//   desgined            -> designed
+//   deside              -> decide
+//   desigining          -> designing
+//   desinations         -> destinations
+//   desintegrated       -> disintegrated
+//   desintegration      -> disintegration
+//   desireable          -> desirable
+//   desitned            -> destined
+//   desktiop            -> desktop
+//   desorder            -> disorder
+//   desoriented         -> disoriented
+//   desparate           -> desperate
+//   despatched          -> dispatched
+//   despict             -> depict
+//   despiration         -> desperation
+//   dessicated          -> desiccated
+//   dessigned           -> designed
+//   destablized         -> destabilized
+//   destory             -> destroy
+//   detailled           -> detailed
+//   detatched           -> detached
+//   deteoriated         -> deteriorated
+//   deteriate           -> deteriorate
+//   deterioriating      -> deteriorating
+//   determinining       -> determining
+//   detremental         -> detrimental
+//   devasted            -> devastated
+//   develeoprs          -> developers
+//   devellop            -> develop
+//   developor           -> developer
+//   develpment          -> development
+//   diablical           -> diabolical
+//   diamons             -> diamonds
+//   diaster             -> disaster
+//   dichtomy            -> dichotomy
+//   diconnects          -> disconnects
+//   dicover             -> discover
+//   dictionarys         -> dictionaries
+//   dieties             -> deities
+//   diety               -> deity
+//   diferent            -> different
+//   diferrent           -> different
+//   differentiatiations -> differentiations
+//   differnt            -> different
+//   difficulity         -> difficulty
+//   diffrent            -> different
+//   dificulties         -> difficulties
+//   dificulty           -> difficulty
+//   dimenions           -> dimensions
+//   dimention           -> dimension
+//   dimesnional         -> dimensional
+//   diminuitive         -> diminutive
+//   dimunitive          -> diminutive
+//   diosese             -> diocese
+//   diphtong            -> diphthong
+//   diplomancy          -> diplomacy
+//   dipthong            -> diphthong
+//   directoty           -> directory
+//   dirived             -> derived
+//   disagreeed          -> disagreed
+//   disapeared          -> disappeared
+//   disapointing        -> disappointing
+//   disappearred        -> disappeared
+//   disasterous         -> disastrous
+//   disatisfaction      -> dissatisfaction
+//   disatisfied         -> dissatisfied
+//   disatrous           -> disastrous
+//   discontentment      -> discontent
+//   discribe            -> describe
+//   discribing          -> describing
+//   disctinction        -> distinction
+//   disctinctive        -> distinctive
+//   disemination        -> dissemination
+//   disenchanged        -> disenchanted
+//   disiplined          -> disciplined
+//   disolved            -> dissolved
+//   disover             -> discover
+//   dispair             -> despair
+//   disparingly         -> disparagingly
+//   dispence            -> dispense
+//   dispencing          -> dispensing
+//   dispicable          -> despicable
+//   dispite             -> despite
+//   disproportiate      -> disproportionate
+//   disputandem         -> disputandum
+//   disricts            -> districts
+//   dissagreement       -> disagreement
+//   dissapear           -> disappear
+//   dissappear          -> disappear
+//   dissappointed       -> disappointed
+//   dissarray           -> disarray
+//   dissobedience       -> disobedience
+//   dissobedient        -> disobedient
+//   distiction          -> distinction
+//   distingish          -> distinguish
+//   distingquished      -> distinguished
+//   distrubution        -> distribution
+//   distruction         -> destruction
+//   distructive         -> destructive
+//   ditributed          -> distributed
+//   diversed            -> diverged
+//   divice              -> device
+//   divinition          -> divination
+//   divison             -> division
+//   doccument           -> document
+//   docrines            -> doctrines
+//   doctines            -> doctrines
+//   documenatry         -> documentary
+//   doens               -> does
+//   doese               -> does
+//   doesnt              -> doesn't
+//   doign               -> doing
+//   dominaton           -> domination
+//   dominent            -> dominant
+//   dominiant           -> dominant
+//   donig               -> doing
+//   dosen't             -> doesn't
+//   doulbe              -> double
+//   dowloads            -> downloads
+//   dramtic             -> dramatic
+//   draughtman          -> draughtsman
+//   dravadian           -> dravidian
+//   dreasm              -> dreams
+//   driectly            -> directly
+//   drnik               -> drink
+//   druming             -> drumming
+//   drummless           -> drumless
+//   dupicate            -> duplicate
+//   durig               -> during
+//   durring             -> during
+//   duting              -> during
+//   ealier              -> earlier
+//   earlies:            -> earliest
+//   earnt               -> earned
+//   ecclectic           -> eclectic
+//   eceonomy            -> economy
+//   ecidious            -> deciduous
+//   eclispe             -> eclipse
+//   ecomonic            -> economic
+//   ecspecially         -> especially
+//   edditable           -> editable
+//   edoema              -> edema
+//   effeciency          -> efficiency
+//   effecient           -> efficient
+//   efficency           -> efficiency
+//   efficent            -> efficient
+//   efford              -> effort
+//   effulence           -> effluence
+//   eigth               -> eighth
+//   eiter               -> either
+//   elction             -> election
+//   electic             -> eclectic
+//   electon             -> election
+//   electrial           -> electrical
+//   electricly          -> electrically
+//   electricty          -> electricity
+//   elementay           -> elementary
+//   eleminating         -> eliminating
+//   eletricity          -> electricity
+//   elicided            -> elicited
+//   eligable            -> eligible
+//   elimentary          -> elementary
+//   ellected            -> elected
+//   elphant             -> elephant
+//   embarass            -> embarrass
+//   embargos            -> embargoes
+//   embarras:           -> embarrass
+//   embezelled          -> embezzled
+//   emblamatic          -> emblematic
+//   eminate             -> emanate
+//   emision             -> emission
+//   emited              -> emitted
+//   emiting             -> emitting
+//   emition             -> emission
+//   emmediately         -> immediately
+//   emmigrated          -> emigrated
+//   emminent            -> eminent
+//   emmisaries          -> emissaries
+//   emmisarries         -> emissaries
+//   emmisarry           -> emissary
+//   emmisary            -> emissary
+//   emmision            -> emission
+//   emmited             -> emitted
+//   emmiting            -> emitting
+//   emmitted            -> emitted
+//   emmitting           -> emitting
+//   emnity              -> enmity
+//   emperical           -> empirical
+//   emphaised           -> emphasised
+//   emphsis             -> emphasis
+//   emphysyma           -> emphysema
+//   empirial            -> empirical
+//   emporer             -> emperor
+//   emprisoned          -> imprisoned
+//   enameld             -> enameled
+//   enchancement        -> enhancement
+//   encouraing          -> encouraging
+//   encryptiion         -> encryption
+//   encylopedia         -> encyclopedia
+//   endevors            -> endeavors
+//   endevour            -> endeavour
+//   endig               -> ending
+//   endolithes          -> endoliths
+//   enduce              -> induce
+//   enflamed            -> inflamed
+//   enforceing          -> enforcing
+//   engagment           -> engagement
+//   engeneer            -> engineer
+//   engieneer           -> engineer
+//   enlargment          -> enlargement
+//   enourmous           -> enormous
+//   ensconsed           -> ensconced
+//   entaglements        -> entanglements
+//   enteratinment       -> entertainment
+//   enthusiatic         -> enthusiastic
+//   entitity            -> entity
+//   entitlied           -> entitled
+//   entrepeneur         -> entrepreneur
+//   enviorment          -> environment
+//   enviornment         -> environment
+//   enviroment          -> environment
+//   envolutionary       -> evolutionary
+//   envrionments        -> environments
+//   epidsodes           -> episodes
+//   epsiode             -> episode
+//   equialent           -> equivalent
+//   equilibium          -> equilibrium
+//   equilibrum          -> equilibrium
+//   equiped             -> equipped
+//   equippment          -> equipment
+//   equitorial          -> equatorial
+//   equivelant          -> equivalent
+//   equivelent          -> equivalent
+//   equivilant          -> equivalent
+//   equivilent          -> equivalent
+//   equivlalent         -> equivalent
+//   eratic              -> erratic
+//   erested             -> arrested
+//   esential            -> essential
+//   esitmated           -> estimated
+//   especialy           -> especially
+//   essencial           -> essential
+//   essense             -> essence
+//   essentail           -> essential
+//   essentialy          -> essentially
+//   essentual           -> essential
+//   essesital           -> essential
+//   estabishes          -> establishes
+//   establising         -> establishing
+//   ethnocentricm       -> ethnocentrism
+//   ethose              -> those
+//   evenhtually         -> eventually
+//   eventally           -> eventually
+//   eventhough          -> even though
+//   eventially          -> eventually
+//   eventualy           -> eventually
+//   everthing           -> everything
+//   everytime           -> every time
+//   everyting           -> everything
+//   eveyr               -> every
+//   evidentally         -> evidently
+//   exagerrate          -> exaggerate
+//   exagerrating        -> exaggerating
+//   examinated          -> examined
+//   exampt              -> exempt
+//   exapansion          -> expansion
+//   excact              -> exact
+//   excange             -> exchange
+//   excecute            -> execute
+//   excecuting          -> executing
+//   excecution          -> execution
+//   excedded            -> exceeded
+//   excelent            -> excellent
+//   excercise           -> exercise
+//   exchanching         -> exchanging
+//   excisted            -> existed
+//   exculsivly          -> exclusively
+//   execising           -> exercising
+//   exection            -> execution
+//   exectued            -> executed
+//   exeedingly          -> exceedingly
+//   exelent             -> excellent
+//   exellent            -> excellent
+//   exemple             -> example
+//   exept               -> except
+//   exerbate            -> exacerbate
+//   exerciese           -> exercises
+//   exerpt              -> excerpt
+//   exersize            -> exercise
+//   exerternal          -> external
+//   exhalted            -> exalted
+//   exhibtion           -> exhibition
+//   exibition           -> exhibition
+//   exicting            -> exciting
+//   exinct              -> extinct
+//   existance           -> existence
+//   existant            -> existent
+//   existince           -> existence
+//   exliled             -> exiled
+//   exludes             -> excludes
+//   exmaple             -> example
+//   exonorate           -> exonerate
+//   exoskelaton         -> exoskeleton
+//   expalin             -> explain
+//   expatriot           -> expatriate
+//   expeced             -> expected
+//   expecially          -> especially
+//   expeditonary        -> expeditionary
+//   expeiments          -> experiments
+//   expell              -> expel
+//   experiance          -> experience
+//   expiditions         -> expeditions
+//   expierence          -> experience
+//   explaination        -> explanation
+//   explaning           -> explaining
+//   explictly           -> explicitly
+//   exploititive        -> exploitative
+//   explotation         -> exploitation
+//   expropiated         -> expropriated
+//   expropiation        -> expropriation
+//   exressed            -> expressed
+//   extemely            -> extremely
+//   extention           -> extension
+//   extered             -> exerted
+//   extermist           -> extremist
+//   extint              -> extinct
+//   extradiction        -> extradition
+//   extravagent         -> extravagant
+//   extrememly          -> extremely
+//   extremeophile       -> extremophile
+//   extremly            -> extremely
+//   extrordinarily      -> extraordinarily
+//   extrordinary        -> extraordinary
+//   eyars               -> years
+//   eyasr               -> years
+//   faciliate           -> facilitate
+//   facilites           -> facilities
+//   facillitate         -> facilitate
+//   facinated           -> fascinated
+//   facist              -> fascist
+//   familes             -> families
+//   familliar           -> familiar
+//   famoust             -> famous
+//   fanatism            -> fanaticism
+//   farenheit           -> fahrenheit
+//   faught              -> fought
+//   favoutrable         -> favourable
+//   feasable            -> feasible
+//   febuary             -> february
+//   fedreally           -> federally
+//   feromone            -> pheromone
+//   fertily             -> fertility
+//   fianite             -> finite
+//   fianlly             -> finally
+//   ficticious          -> fictitious
+//   fictious            -> fictitious
+//   fiercly             -> fiercely
+//   filiament           -> filament
+//   fimilies            -> families
+//   finacial            -> financial
+//   finaly              -> finally
+//   financialy          -> financially
+//   firends             -> friends
+//   firts               -> first
+//   fisionable          -> fissionable
+//   flamable            -> flammable
+//   flawess             -> flawless
+//   flemmish            -> flemish
+//   florescent          -> fluorescent
+//   flourescent         -> fluorescent
+//   flourine            -> fluorine
+//   fluorish            -> flourish
+//   follwoing           -> following
+//   folowing            -> following
+//   fomed               -> formed
+//   fonetic             -> phonetic
+//   foootball           -> football
+//   forbad:             -> forbade
+//   forbiden            -> forbidden
+//   foreward            -> foreword
+//   forfiet             -> forfeit
+//   forhead             -> forehead
+//   foriegn             -> foreign
+//   formallize          -> formalize
+//   formaly             -> formally
+//   formelly            -> formerly
+//   formidible          -> formidable
+//   formost             -> foremost
+//   forsaw              -> foresaw
+//   forseeable          -> foreseeable
+//   fortelling          -> foretelling
+//   forunner            -> forerunner
+//   foucs               -> focus
+//   foudn               -> found
+//   fougth              -> fought
+//   foundaries          -> foundries
+//   foundary            -> foundry
+//   fourties            -> forties
+//   fourty              -> forty
+//   fouth               -> fourth
+//   foward              -> forward
+//   fransiscan          -> franciscan
+//   freind              -> friend
+//   frequentily         -> frequently
+//   frome               -> from
+//   froniter            -> frontier
+//   fucntion            -> function
+//   fufill              -> fulfill
+//   fulfiled            -> fulfilled
+//   fullfill            -> fulfill
+//   fundametal          -> fundamental
+//   funguses            -> fungi
+//   funtion             -> function
+//   furuther            -> further
+//   futher              -> further
+//   galatic             -> galactic
+//   galations           -> galatians
+//   gallaxies           -> galaxies
+//   galvinized          -> galvanized
+//   ganerate            -> generate
+//   ganes               -> games
+//   ganster             -> gangster
+//   garantee            -> guarantee
+//   garnison            -> garrison
+//   gaurantee           -> guarantee
+//   gaurd               -> guard
+//   gaurentee           -> guarantee
+//   geneological        -> genealogical
+//   geneologies         -> genealogies
+//   geneology           -> genealogy
+//   generaly            -> generally
+//   generatting         -> generating
+//   genialia            -> genitalia
+//   geographicial       -> geographical
+//   geometrician        -> geometer
+//   ghandi              -> gandhi
+//   glamourous          -> glamorous
+//   glight              -> flight
+//   gnawwed             -> gnawed
+//   godess              -> goddess
+//   godounov            -> godunov
+//   gogin               -> going
+//   goign               -> going
+//   gonig               -> going
+//   gouvener            -> governor
+//   govement            -> government
+//   govenment           -> government
+//   govenrment          -> government
+//   goverance           -> governance
+//   goverment           -> government
+//   governer            -> governor
+//   governmnet          -> government
+//   govorment           -> government
+//   govornment          -> government
+//   gracefull           -> graceful
+//   graet               -> great
+//   grafitti            -> graffiti
+//   gramatically        -> grammatically
+//   grammaticaly        -> grammatically
+//   grammer             -> grammar
+//   gratuitious         -> gratuitous
+//   greatful            -> grateful
+//   greif               -> grief
+//   gridles             -> griddles
+//   gropu               -> group
+//   guage               -> gauge
+//   guarentee           -> guarantee
+//   guerilla            -> guerrilla
+//   guerrila            -> guerrilla
+//   guidence            -> guidance
+//   gunanine            -> guanine
+//   gurantee            -> guarantee
+//   guttaral            -> guttural
+//   gutteral            -> guttural
+//   habaeus             -> habeas
+//   habeus              -> habeas
+//   habsbourg           -> habsburg
+//   hadbeen             -> had been
+//   haemorrage          -> haemorrhage
+//   halarious           -> hilarious
+//   hallowean           -> halloween
+//   hapen               -> happen
+//   happend             -> happened
+//   happenned           -> happened
+//   harased             -> harassed
+//   harases             -> harasses
+//   harasment           -> harassment
+//   harassement         -> harassment
+//   harras              -> harass
+//   hatian              -> haitian
+//   haveing             -> having
+//   haviest             -> heaviest
+//   headquarer          -> headquarter
+//   headquater          -> headquarter
+//   healthercare        -> healthcare
+//   heared              -> heard
+//   heathy              -> healthy
+//   heidelburg          -> heidelberg
+//   heigher             -> higher
+//   heirarchy           -> hierarchy
+//   heiroglyphics       -> hieroglyphics
+//   helment             -> helmet
+//   helpfull            -> helpful
+//   helpped             -> helped
+//   hemmorhage          -> hemorrhage
+//   herad               -> heard
+//   heridity            -> heredity
+//   heros               -> heroes
+//   hertiage            -> heritage
+//   hertzs              -> hertz
+//   hesistant           -> hesitant
+//   heterogenous        -> heterogeneous
+//   hieght              -> height
+//   hierachical         -> hierarchical
+//   hierachies          -> hierarchies
+//   hierachy            -> hierarchy
+//   hierarcical         -> hierarchical
+//   hierarcy            -> hierarchy
+//   hieroglph           -> hieroglyph
+//   higer               -> higher
+//   higest              -> highest
+//   higway              -> highway
+//   hillarious          -> hilarious
+//   himselv             -> himself
+//   hinderance          -> hindrance
+//   hinderence          -> hindrance
+//   hindrence           -> hindrance
+//   hipopotamus         -> hippopotamus
+//   hismelf             -> himself
+//   historicians        -> historians
+//   hitsingles          -> hit singles
+//   holliday            -> holiday
+//   homestate           -> home state
+//   homogeneize         -> homogenize
+//   honory              -> honorary
+//   horrifing           -> horrifying
+//   hosited             -> hoisted
+//   hospitible          -> hospitable
+//   hounour             -> honour
+//   housr               -> hours
+//   howver              -> however
+//   hsitorians          -> historians
+//   hstory              -> history
+//   htere               -> there
+//   htikn               -> think
+//   htink               -> think
+//   humer               -> humor
+//   huminoid            -> humanoid
+//   humoural            -> humoral
+//   humurous            -> humorous
+//   husban:             -> husband
+//   hvaing              -> having
+//   hwihc               -> which
+//   hwile               -> while
+//   hwole               -> whole
+//   hydogen             -> hydrogen
+//   hydropile           -> hydrophile
+//   hydropilic          -> hydrophilic
+//   hydropobe           -> hydrophobe
+//   hydropobic          -> hydrophobic
+//   hygeine             -> hygiene
+//   hypocracy           -> hypocrisy
+//   hypocrasy           -> hypocrisy
+//   hypocricy           -> hypocrisy
+//   hypocrit:           -> hypocrite
+//   iconclastic         -> iconoclastic
+//   idaes               -> ideas
+//   idealogies          -> ideologies
+//   idealogy            -> ideology
+//   identicial          -> identical
+//   identifers          -> identifiers
+//   ideosyncratic       -> idiosyncratic
+//   idesa               -> ideas
+//   idiosyncracy        -> idiosyncrasy
+//   illegimacy          -> illegitimacy
+//   illess              -> illness
+//   illiegal            -> illegal
+//   illution            -> illusion
+//   ilness              -> illness
+//   ilogical            -> illogical
+//   imagenary           -> imaginary
+//   imagin:             -> imagine
+//   imanent             -> eminent
+//   imcomplete          -> incomplete
+//   imediate            -> immediate
+//   imediatly           -> immediately
+//   imense              -> immense
+//   imigrant            -> immigrant
+//   imigrated           -> immigrated
+//   imigration          -> immigration
+//   iminent             -> imminent
+//   immediatley         -> immediately
+//   immediatly          -> immediately
+//   immidately          -> immediately
+//   immidiately         -> immediately
+//   immitate            -> imitate
+//   immitating          -> imitating
+//   immitator           -> imitator
+//   impecabbly          -> impeccably
+//   impedence           -> impedance
+//   implamenting        -> implementing
+//   impliment           -> implement
+//   imploys             -> employs
+//   importamt           -> important
+//   impressario         -> impresario
+//   imprioned           -> imprisoned
+//   imprisonned         -> imprisoned
+//   improvision         -> improvisation
+//   improvments         -> improvements
+//   inablility          -> inability
+//   inadiquate          -> inadequate
+//   inadquate           -> inadequate
+//   inadvertant         -> inadvertent
+//   inagurated          -> inaugurated
+//   inaguration         -> inauguration
+//   inaugures           -> inaugurates
+//   inbalance           -> imbalance
+//   inbetween           -> between
+//   incarcirated        -> incarcerated
+//   incidentially       -> incidentally
+//   incidently          -> incidentally
+//   inclreased          -> increased
+//   includ:             -> include
+//   incomptable         -> incompatible
+//   incomptetent        -> incompetent
+//   incoroporated       -> incorporated
+//   incorperation       -> incorporation
+//   incorportaed        -> incorporated
+//   incorprates         -> incorporates
+//   incorruptable       -> incorruptible
+//   incramentally       -> incrementally
+//   increadible         -> incredible
+//   incredable          -> incredible
+//   inctroduce          -> introduce
+//   incuding            -> including
+//   incunabla           -> incunabula
+//   indefineable        -> undefinable
+//   indentical          -> identical
+//   indepedantly        -> independently
+//   indepedence         -> independence
+//   independant         -> independent
+//   independece         -> independence
+//   independendet       -> independent
+//   indespensable       -> indispensable
+//   indespensible       -> indispensable
+//   indictement         -> indictment
+//   indigineous         -> indigenous
+//   indipendence        -> independence
+//   indipendent         -> independent
+//   indispensible       -> indispensable
+//   indisputible        -> indisputable
+//   indisputibly        -> indisputably
+//   indite              -> indict
+//   individualy         -> individually
+//   indpendent          -> independent
+//   indulgue            -> indulge
+//   indutrial           -> industrial
+//   indviduals          -> individuals
+//   inefficienty        -> inefficiently
+//   inevatible          -> inevitable
+//   inevitible          -> inevitable
+//   inevititably        -> inevitably
+//   infalability        -> infallibility
+//   infallable          -> infallible
+//   infectuous          -> infectious
+//   infered             -> inferred
+//   infilitrate         -> infiltrate
+//   infilitration       -> infiltration
+//   infinit:            -> infinite
+//   inflamation         -> inflammation
+//   influencial         -> influential
+//   influented          -> influenced
+//   infomation          -> information
+//   informtion          -> information
+//   infrantryman        -> infantryman
+//   infrigement         -> infringement
+//   ingenius            -> ingenious
+//   ingreediants        -> ingredients
+//   inhabitans          -> inhabitants
+//   inherantly          -> inherently
+//   inheritage          -> heritage
+//   inheritence         -> inheritance
+//   inital              -> initial
+//   initation           -> initiation
+//   initiaitive         -> initiative
+//   inlcuding           -> including
+//   inmigrant           -> immigrant
+//   innoculated         -> inoculated
+//   inocence            -> innocence
+//   inofficial          -> unofficial
+//   inpeach             -> impeach
+//   inpending           -> impending
+//   inpenetrable        -> impenetrable
+//   inpolite            -> impolite
+//   inprisonment        -> imprisonment
+//   inproving           -> improving
+//   insectiverous       -> insectivorous
+//   insensative         -> insensitive
+//   inseperable         -> inseparable
+//   insistance          -> insistence
+//   insitution          -> institution
+//   inspite             -> in spite
+//   instade             -> instead
+//   instatance          -> instance
+//   institue            -> institute
+//   instuction          -> instruction
+//   instuments          -> instruments
+//   instutionalized     -> institutionalized
+//   instutions          -> intuitions
+//   insurence           -> insurance
+//   intelectual         -> intellectual
+//   inteligence         -> intelligence
+//   inteligent          -> intelligent
+//   intenational        -> international
+//   intented            -> intended
+//   intepretation       -> interpretation
+//   interational        -> international
+//   interbread          -> interbreed
+//   interchangably      -> interchangeably
+//   intercontinetal     -> intercontinental
+//   intered             -> interred
+//   interelated         -> interrelated
+//   interferance        -> interference
+//   interfereing        -> interfering
+//   intergrated         -> integrated
+//   intergration        -> integration
+//   interm              -> interim
+//   internation:        -> international
+//   interpet            -> interpret
+//   interrim            -> interim
+//   interrugum          -> interregnum
+//   intertaining        -> entertaining
+//   interupt            -> interrupt
+//   intervines          -> intervenes
+//   intevene            -> intervene
+//   intial              -> initial
+//   intrduced           -> introduced
+//   intrest             -> interest
+//   introdued           -> introduced
+//   intruduced          -> introduced
+//   intrument           -> instrument
+//   intrusted           -> entrusted
+//   intutive            -> intuitive
+//   inudstry            -> industry
+//   inumerable          -> innumerable
+//   inventer            -> inventor
+//   invertibrates       -> invertebrates
+//   investingate        -> investigate
+//   involvment          -> involvement
+//   iresistably         -> irresistibly
+//   iresistible         -> irresistible
+//   iresistibly         -> irresistibly
+//   iritable            -> irritable
+//   iritated            -> irritated
+//   ironicly            -> ironically
+//   irregardless        -> regardless
+//   irreplacable        -> irreplaceable
+//   irresistably        -> irresistibly
+//   issueing            -> issuing
+//   itnroduced          -> introduced
+//   iunior              -> junior
+//   janurary            -> january
+//   januray             -> january
+//   jeapardy            -> jeopardy
+//   jewllery            -> jewellery
+//   johanine            -> johannine
+//   jorunal             -> journal
+//   jospeh              -> joseph
+//   jouney              -> journey
+//   journied            -> journeyed
+//   journies            -> journeys
+//   juadaism            -> judaism
+//   juadism             -> judaism
+//   judical             -> judicial
+//   judisuary           -> judiciary
+//   juducial            -> judicial
+//   juristiction        -> jurisdiction
+//   kindergarden        -> kindergarten
+//   klenex              -> kleenex
+//   knifes              -> knives
+//   knowlege            -> knowledge
+//   knwos               -> knows
+//   konws               -> knows
+//   labatory            -> laboratory
+//   labled              -> labelled
+//   labratory           -> laboratory
+//   largst              -> largest
+//   lastr               -> last
+//   lattitude           -> latitude
+//   launchs             -> launches
+//   launhed             -> launched
+//   lavae               -> larvae
+//   layed               -> laid
+//   lazyness            -> laziness
+//   leage               -> league
+//   leanr               -> learn
+//   leathal             -> lethal
+//   lefted              -> left
+//   legitamate          -> legitimate
+//   legitmate           -> legitimate
+//   leibnitz            -> leibniz
+//   lenght              -> length
+//   leutenant           -> lieutenant
+//   levetate            -> levitate
+//   levetating          -> levitating
+//   levle               -> level
+//   liasion             -> liaison
+//   liason              -> liaison
+//   libary              -> library
+//   libell              -> libel
+//   libguistic          -> linguistic
+//   libitarianisn       -> libertarianism
+//   lieing              -> lying
+//   liekd               -> liked
+//   liesure             -> leisure
+//   lieuenant           -> lieutenant
+//   lieved              -> lived
+//   liftime             -> lifetime
+//   lightyear           -> light year
+//   likelyhood          -> likelihood
+//   linnaena            -> linnaean
+//   lippizaner          -> lipizzaner
+//   liquify             -> liquefy
+//   liscense            -> license
+//   lisense             -> license
+//   listners            -> listeners
+//   litature            -> literature
+//   literaly            -> literally
+//   literture           -> literature
+//   littel              -> little
+//   liuke               -> like
+//   livley              -> lively
+//   lmits               -> limits
+//   lonelyness          -> loneliness
+//   longitudonal        -> longitudinal
+//   lonley              -> lonely
+//   lonly               -> lonely
+//   loosing             -> losing
+//   lotharingen         -> lothringen
+//   lybia               -> libya
+//   mackeral            -> mackerel
+//   magasine            -> magazine
+//   magincian           -> magician
+//   magnificient        -> magnificent
+//   magolia             -> magnolia
+//   mailny              -> mainly
+//   maintainance        -> maintenance
+//   maintainence        -> maintenance
+//   maintance           -> maintenance
+//   maintenence         -> maintenance
+//   maintinaing         -> maintaining
+//   maintioned          -> mentioned
+//   majoroty            -> majority
+//   maked               -> marked
+//   makse               -> makes
+//   maltesian           -> maltese
+//   mamal               -> mammal
+//   managable           -> manageable
+//   managment           -> management
+//   maneouvre           -> manoeuvre
+//   maneouvring         -> manoeuvring
+//   manisfestations     -> manifestations
+//   manoeuverability    -> maneuverability
+//   manouver            -> maneuver
+//   mantained           -> maintained
+//   manuever            -> maneuver
+//   manufacturedd       -> manufactured
+//   manufature          -> manufacture
+//   manufaturing        -> manufacturing
+//   manuver             -> maneuver
+//   mariage             -> marriage
+//   marjority           -> majority
+//   markes              -> marks
+//   marketting          -> marketing
+//   marmelade           -> marmalade
+//   marrage             -> marriage
+//   marraige            -> marriage
+//   marrtyred           -> martyred
+//   marryied            -> married
+//   massachussets       -> massachusetts
+//   massachussetts      -> massachusetts
+//   massmedia           -> mass media
+//   masterbation        -> masturbation
+//   mataphysical        -> metaphysical
+//   materalists         -> materialist
+//   mathamatics         -> mathematics
+//   mathematican        -> mathematician
+//   mathematicas        -> mathematics
+//   matheticians        -> mathematicians
+//   mathmatically       -> mathematically
+//   mathmatician        -> mathematician
+//   mccarthyst          -> mccarthyist
+//   mchanics            -> mechanics
+//   meaninng            -> meaning
+//   mechandise          -> merchandise
+//   medacine            -> medicine
+//   medeival            -> medieval
+//   medevial            -> medieval
+//   medievel            -> medieval
+//   mediterainnean      -> mediterranean
+//   mediteranean        -> mediterranean
+//   meerkrat            -> meerkat
+//   melieux             -> milieux
+//   membranaphone       -> membranophone
+//   memeber             -> member
+//   meranda             -> veranda
+//   mercentile          -> mercantile
+//   messanger           -> messenger
+//   messenging          -> messaging
+//   metalic             -> metallic
+//   metalurgic          -> metallurgic
+//   metalurgy           -> metallurgy
+//   metamorphysis       -> metamorphosis
+//   metaphoricial       -> metaphorical
+//   meterologist        -> meteorologist
+//   meterology          -> meteorology
+//   methaphor           -> metaphor
+//   michagan            -> michigan
+//   micoscopy           -> microscopy
+//   midwifes            -> midwives
+//   mileau              -> milieu
+//   milennia            -> millennia
+//   milennium           -> millennium
+//   mileu               -> milieu
+//   miliary             -> military
+//   miligram            -> milligram
+//   miliraty            -> military
+//   millenia            -> millennia
+//   millenium           -> millennium
+//   millepede           -> millipede
+//   millioniare         -> millionaire
+//   millitant           -> militant
+//   millitary           -> military
+//   millon              -> million
+//   miltary             -> military
+//   minature            -> miniature
+//   minerial            -> mineral
+//   ministery           -> ministry
+//   minsitry            -> ministry
+//   minstries           -> ministries
+//   minstry             -> ministry
+//   minumum             -> minimum
+//   mirrorred           -> mirrored
+//   miscelaneous        -> miscellaneous
+//   miscellanious       -> miscellaneous
+//   miscellanous        -> miscellaneous
+//   mischeivous         -> mischievous
+//   mischevious         -> mischievous
+//   mischievious        -> mischievous
+//   misdameanor         -> misdemeanor
+//   misfourtunes        -> misfortunes
+//   misile              -> missile
+//   misouri             -> missouri
+//   mispell             -> misspell
+//   missisipi           -> mississippi
+//   missisippi          -> mississippi
+//   missle              -> missile
+//   missonary           -> missionary
+//   misterious          -> mysterious
+//   mistery             -> mystery
+//   mkaes               -> makes
+//   mkaing              -> making
+//   moeny               -> money
+//   moleclues           -> molecules
+//   momento             -> memento
+//   monestaries         -> monasteries
+//   monestary           -> monastery
+//   monickers           -> monikers
+//   monolite            -> monolithic
+//   montains            -> mountains
+//   montanous           -> mountainous
+//   monts               -> months
+//   montypic            -> monotypic
+//   moreso              -> more so
+//   morgage             -> mortgage
+//   morisette           -> morissette
+//   morrisette          -> morissette
+//   morroccan           -> moroccan
+//   morrocco            -> morocco
+//   morroco             -> morocco
+//   mortage             -> mortgage
+//   mosture             -> moisture
+//   motiviated          -> motivated
+//   mounth              -> month
+//   movei               -> movie
+//   movment             -> movement
+//   mucuous             -> mucous
+//   muder               -> murder
+//   muhammadan          -> muslim
+//   multicultralism     -> multiculturalism
+//   multipled           -> multiplied
+//   multiplers          -> multipliers
+//   munbers             -> numbers
+//   muncipalities       -> municipalities
+//   muncipality         -> municipality
+//   munnicipality       -> municipality
+//   muscels             -> muscles
+//   muscial             -> musical
+//   muscician           -> musician
+//   mutiliated          -> mutilated
+//   myraid              -> myriad
+//   mysef               -> myself
+//   mysogynist          -> misogynist
+//   mysogyny            -> misogyny
+//   mysterous           -> mysterious
+//   mythraic            -> mithraic
+//   naieve              -> naive
+//   naploeon            -> napoleon
+//   napolean            -> napoleon
+//   napoleonian         -> napoleonic
+//   naturaly            -> naturally
+//   naturely            -> naturally
+//   naturual            -> natural
+//   nazereth            -> nazareth
+//   neccesarily         -> necessarily
+//   neccesary           -> necessary
+//   neccessarily        -> necessarily
+//   neccessary          -> necessary
+//   neccessities        -> necessities
+//   necesarily          -> necessarily
+//   necesary            -> necessary
+//   necessiate          -> necessitate
+//   negligable          -> negligible
+//   negociate           -> negotiate
+//   negociation         -> negotiation
+//   negotation          -> negotiation
+//   neice               -> niece
+//   neigborhood         -> neighborhood
+//   neigbour            -> neighbour
+//   neolitic            -> neolithic
+//   nessasarily         -> necessarily
+//   nessecary           -> necessary
+//   neverthless         -> nevertheless
+//   newletters          -> newsletters
+//   nickle              -> nickel
+//   nightime            -> nighttime
+//   nineth              -> ninth
+//   ninteenth           -> nineteenth
+//   ninties             -> nineties
+//   ninty               -> ninety
+//   noncombatents       -> noncombatants
+//   nontheless          -> nonetheless
+//   noone               -> no one
+//   norhern             -> northern
+//   northen             -> northern
+//   northereastern      -> northeastern
+//   notabley            -> notably
+//   noteable            -> notable
+//   noteably            -> notably
+//   noteriety           -> notoriety
+//   nothern             -> northern
+//   noticable           -> noticeable
+//   noticably           -> noticeably
+//   noticeing           -> noticing
+//   noticible           -> noticeable
+//   noveau              -> nouveau
+//   nowdays             -> nowadays
+//   nucular             -> nuclear
+//   nuculear            -> nuclear
+//   nuisanse            -> nuisance
+//   numberous           -> numerous
+//   nusance             -> nuisance
+//   nutritent           -> nutrient
+//   nuturing            -> nurturing
+//   obediance           -> obedience
+//   obediant            -> obedient
+//   obession            -> obsession
+//   obssessed           -> obsessed
+//   obstacal            -> obstacle
+//   obstancles          -> obstacles
+//   obstruced           -> obstructed
+//   ocassion            -> occasion
+//   occaison            -> occasion
+//   occassion           -> occasion
+//   occationally        -> occasionally
+//   occour              -> occur
+//   occurance           -> occurrence
+//   occured             -> occurred
+//   occurence           -> occurrence
+//   occuring            -> occurring
+//   octohedra           -> octahedra
+//   octohedron          -> octahedron
+//   ocuntries           -> countries
+//   ocuntry             -> country
+//   ocurr               -> occur
+//   offcers             -> officers
+//   offcially           -> officially
+//   offereings          -> offerings
+//   offical             -> official
+//   officialy           -> officially
+//   offred              -> offered
+//   oftenly             -> often
+//   oging               -> going
+//   omision             -> omission
+//   omited              -> omitted
+//   omiting             -> omitting
+//   omlette             -> omelette
+//   ommision            -> omission
+//   ommited             -> omitted
+//   ommiting            -> omitting
+//   omniverous          -> omnivorous
+//   openess             -> openness
+//   oponent             -> opponent
+//   oportunity          -> opportunity
+//   opose               -> oppose
+//   oposite             -> opposite
+//   oposition           -> opposition
+//   oppenly             -> openly
+//   oppinion            -> opinion
+//   opponant            -> opponent
+//   oppononent          -> opponent
+//   oppositition        -> opposition
+//   oppossed            -> opposed
+//   opprotunity         -> opportunity
+//   opression           -> oppression
+//   opressive           -> oppressive
+//   opthalmic           -> ophthalmic
+//   opthalmologist      -> ophthalmologist
+//   opthalmology        -> ophthalmology
+//   opthamologist       -> ophthalmologist
+//   optmizations        -> optimizations
+//   optomism            -> optimism
+//   orded               -> ordered
+//   organim             -> organism
+//   organistion         -> organisation
+//   organiztion         -> organization
+//   orgin               -> origin
+//   oridinarily         -> ordinarily
+//   origanaly           -> originally
+//   originaly           -> originally
+//   originially         -> originally
+//   originnally         -> originally
+//   origional           -> original
+//   orignally           -> originally
+//   orignially          -> originally
+//   otehr               -> other
+//   ouevre              -> oeuvre
+//   oustanding          -> outstanding
+//   overthere           -> over there
+//   overwelming         -> overwhelming
+//   overwheliming       -> overwhelming
+//   owudl               -> would
+//   oxigen              -> oxygen
+//   oximoron            -> oxymoron
+//   paide               -> paid
+//   paitience           -> patience
+//   palce               -> place
+//   paleolitic          -> paleolithic
+//   paliamentarian      -> parliamentarian
+//   pallete             -> palette
+//   pamflet             -> pamphlet
+//   pamplet             -> pamphlet
+//   pantomine           -> pantomime
+//   paralel             -> parallel
+//   parallely           -> parallelly
+//   paranthesis         -> parenthesis
+//   paraphenalia        -> paraphernalia
+//   parellels           -> parallels
+//   parisitic           -> parasitic
+//   parituclar          -> particular
+//   parliment           -> parliament
+//   parrakeets          -> parakeets
+//   parralel            -> parallel
+//   parrallel           -> parallel
+//   partialy            -> partially
+//   particually         -> particularly
+//   particualr          -> particular
+//   particuarly         -> particularly
+//   particularily       -> particularly
+//   particulary         -> particularly
+//   pased               -> passed
+//   pasengers           -> passengers
+//   passerbys           -> passersby
+//   pasttime            -> pastime
+//   pastural            -> pastoral
+//   paticular           -> particular
+//   pattented           -> patented
+//   pavillion           -> pavilion
+//   payed               -> paid
+//   peacefuland         -> peaceful and
+//   peageant            -> pageant
+//   peculure            -> peculiar
+//   pedestrain          -> pedestrian
+//   peformed            -> performed
+//   peice               -> piece
+//   penatly             -> penalty
+//   penerator           -> penetrator
+//   penisula            -> peninsula
+//   penninsula          -> peninsula
+//   pennisula           -> peninsula
+//   pensinula           -> peninsula
+//   peoms               -> poems
+//   peopel              -> people
+//   peotry              -> poetry
+//   perade              -> parade
+//   percepted           -> perceived
+//   percieve            -> perceive
+//   perenially          -> perennially
+//   perfomance          -> performance
+//   perfomers           -> performers
+//   performence         -> performance
+//   performes           -> performs
+//   perhasp             -> perhaps
+//   perheaps            -> perhaps
+//   perhpas             -> perhaps
+//   peripathetic        -> peripatetic
+//   peristent           -> persistent
+//   perjery             -> perjury
+//   perjorative         -> pejorative
+//   permanant           -> permanent
+//   permenant           -> permanent
+//   permissable         -> permissible
+//   perogative          -> prerogative
+//   peronal             -> personal
+//   perosnality         -> personality
+//   perphas             -> perhaps
+//   perpindicular       -> perpendicular
+//   perseverence        -> perseverance
+//   persistance         -> persistence
+//   persistant          -> persistent
+//   personel            -> personnel
+//   personnell          -> personnel
+//   persuded            -> persuaded
+//   persue              -> pursue
+//   persuing            -> pursuing
+//   persuit             -> pursuit
+//   pertubation         -> perturbation
+//   pessiary            -> pessary
+//   petetion            -> petition
+//   pharoah             -> pharaoh
+//   phenomenom          -> phenomenon
+//   phenomenonal        -> phenomenal
+//   phenomenonly        -> phenomenally
+//   phenomonenon        -> phenomenon
+//   phenomonon          -> phenomenon
+//   phenonmena          -> phenomena
+//   philisopher         -> philosopher
+//   philisophical       -> philosophical
+//   philisophy          -> philosophy
+//   phillipine          -> philippine
+//   phillosophically    -> philosophically
+//   philospher          -> philosopher
+//   philosphies         -> philosophies
+//   philosphy           -> philosophy
+//   phongraph           -> phonograph
+//   phylosophical       -> philosophical
+//   physicaly           -> physically
+//   piblisher           -> publisher
+//   pilgrimmage         -> pilgrimage
+//   pinapple            -> pineapple
+//   pinnaple            -> pineapple
+//   pinoneered          -> pioneered
+//   plagarism           -> plagiarism
+//   planed              -> planned
+//   plantiff            -> plaintiff
+//   plateu              -> plateau
+//   plausable           -> plausible
+//   playright           -> playwright
+//   playwrite           -> playwright
+//   pleasent            -> pleasant
+//   plebicite           -> plebiscite
+//   plesant             -> pleasant
+//   poenis              -> penis
+//   poeoples            -> peoples
+//   poety               -> poetry
+//   poisin              -> poison
+//   polical             -> political
+//   polinator           -> pollinator
+//   politican           -> politician
+//   poltical            -> political
+//   polute              -> pollute
+//   poluting            -> polluting
+//   polution            -> pollution
+//   polyphonyic         -> polyphonic
+//   polysaccaride       -> polysaccharide
+//   polysaccharid:      -> polysaccharide
+//   pomegranite         -> pomegranate
+//   pomotion            -> promotion
+//   poportional         -> proportional
+//   popoulation         -> population
+//   popularaty          -> popularity
+//   populare            -> popular
+//   populer             -> popular
+//   porshan             -> portion
+//   porshon             -> portion
+//   portait             -> portrait
+//   portayed            -> portrayed
+//   portraing           -> portraying
+//   portugese           -> portuguese
+//   portuguease         -> portuguese
+//   portugues:          -> portuguese
+//   posess              -> possess
+//   posion              -> poison
+//   positon             -> position
+//   possabilites        -> possibilities
+//   possabilities       -> possibilities
+//   possability         -> possibility
+//   possable            -> possible
+//   possably            -> possibly
+//   possesion           -> possession
+//   possesive           -> possessive
+//   possessess          -> possesses
+//   possibile           -> possible
+//   possibilty          -> possibility
+//   possiblility        -> possibility
+//   possiblilty         -> possibility
+//   possiblities        -> possibilities
+//   possiblity          -> possibility
+//   possition           -> position
+//   postdam             -> potsdam
+//   posthomous          -> posthumous
+//   postion             -> position
+//   postive             -> positive
+//   potatos             -> potatoes
+//   potrait             -> portrait
+//   potrayed            -> portrayed
+//   poulations          -> populations
+//   poverful            -> powerful
+//   poweful             -> powerful
+//   powerfull           -> powerful
+//   practial            -> practical
+//   practicaly          -> practically
+//   practicioner        -> practitioner
+//   practicly           -> practically
+//   practioner          -> practitioner
+//   prairy              -> prairie
+//   prarie              -> prairie
+//   pratice             -> practice
+//   preample            -> preamble
+//   precedessor         -> predecessor
+//   preceed             -> precede
+//   precentage          -> percentage
+//   precice             -> precise
+//   precisly            -> precisely
+//   precurser           -> precursor
+//   predecesors         -> predecessors
+//   predicatble         -> predictable
+//   predicitons         -> predictions
+//   predomiantly        -> predominately
+//   preferrably         -> preferably
+//   pregancies          -> pregnancies
+//   preiod              -> period
+//   preliferation       -> proliferation
+//   premeire            -> premiere
+//   preminence          -> preeminence
+//   premission          -> permission
+//   preocupation        -> preoccupation
+//   prepair             -> prepare
+//   prepartion          -> preparation
+//   prepatory           -> preparatory
+//   preperation         -> preparation
+//   preriod             -> period
+//   presedential        -> presidential
+//   presense            -> presence
+//   presidenital        -> presidential
+//   presitgious         -> prestigious
+//   prespective         -> perspective
+//   prestigeous         -> prestigious
+//   prestigous          -> prestigious
+//   presumabely         -> presumably
+//   presumibly          -> presumably
+//   pretection          -> protection
+//   prevelant           -> prevalent
+//   preverse            -> perverse
+//   previvous           -> previous
+//   pricipal            -> principal
+//   priciple            -> principle
+//   priestood           -> priesthood
+//   primarly            -> primarily
+//   primative           -> primitive
+//   primordal           -> primordial
+//   principaly          -> principality
+//   principial          -> principal
+//   principlaity        -> principality
+//   principly           -> principally
+//   prinicipal          -> principal
+//   priveledges         -> privileges
+//   privelege           -> privilege
+//   privelige           -> privilege
+//   privelleges         -> privileges
+//   privilage           -> privilege
+//   priviledge          -> privilege
+//   privledge           -> privilege
+//   privte              -> private
+//   probabilaty         -> probability
+//   probablistic        -> probabilistic
+//   probablly           -> probably
+//   probalibity         -> probability
+//   probaly             -> probably
+//   probelm             -> problem
+//   proccess            -> process
+//   procede             -> proceed
+//   procedger           -> procedure
+//   proceding           -> proceeding
+//   proceedure          -> procedure
+//   proces:             -> process
+//   proclaimation       -> proclamation
+//   proclamed           -> proclaimed
+//   proclaming          -> proclaiming
+//   proclomation        -> proclamation
+//   profesion           -> profession
+//   profesor            -> professor
+//   professer           -> professor
+//   proffesed           -> professed
+//   proffesion          -> profession
+//   proffesor           -> professor
+//   profilic            -> prolific
+//   progessed           -> progressed
+//   progidy             -> prodigy
+//   programable         -> programmable
+//   progrom             -> pogrom
+//   prohabition         -> prohibition
+//   prologomena         -> prolegomena
+//   prominance          -> prominence
+//   prominant           -> prominent
+//   promiscous          -> promiscuous
+//   promotted           -> promoted
+//   pronomial           -> pronominal
+//   pronouced           -> pronounced
+//   pronounched         -> pronounced
+//   pronounciation      -> pronunciation
+//   proove              -> prove
+//   prophacy            -> prophecy
+//   propietary          -> proprietary
+//   propmted            -> prompted
+//   propoganda          -> propaganda
+//   propogate           -> propagate
+//   propogation         -> propagation
+//   propotions          -> proportions
+//   propper             -> proper
+//   proprietory         -> proprietary
+//   proseletyzing       -> proselytizing
+//   protocal            -> protocol
+//   protoganist         -> protagonist
+//   prototpe            -> prototype
+//   protoype            -> prototype
+//   protrayed           -> portrayed
+//   protruberance       -> protuberance
+//   prouncements        -> pronouncements
+//   provacative         -> provocative
+//   provded             -> provided
+//   provicial           -> provincial
+//   provinicial         -> provincial
+//   provisiosn          -> provision
+//   provisonal          -> provisional
+//   proximty            -> proximity
+//   pseudononymous      -> pseudonymous
+//   pseudonyn           -> pseudonym
+//   psuedo              -> pseudo
+//   psycology           -> psychology
+//   psyhic              -> psychic
+//   publicaly           -> publicly
+//   puchasing           -> purchasing
+//   pulication          -> publication
+//   pumkin              -> pumpkin
+//   puritannical        -> puritanical
+//   purposedly          -> purposely
+//   purpotedly          -> purportedly
+//   pursuade            -> persuade
+//   pususading          -> persuading
+//   puting              -> putting
+//   pwoer               -> power
+//   pyscic              -> psychic
+//   qtuie               -> quiet
+//   quantaty            -> quantity
+//   quantitiy           -> quantity
+//   quarantaine         -> quarantine
+//   questonable         -> questionable
+//   quicklyu            -> quickly
+//   quinessential       -> quintessential
+//   quizes              -> quizzes
+//   qutie               -> quite
+//   rabinnical          -> rabbinical
+//   racaus              -> raucous
+//   radiactive          -> radioactive
+//   radify              -> ratify
+//   raelly              -> really
+//   rarified            -> rarefied
+//   reaccurring         -> recurring
+//   reacing             -> reaching
+//   reacll              -> recall
+//   readmition          -> readmission
+//   realitvely          -> relatively
+//   realsitic           -> realistic
+//   realtions           -> relations
+//   realy               -> really
+//   reasearch           -> research
+//   rebiulding          -> rebuilding
+//   rebllions           -> rebellions
+//   rebounce            -> rebound
+//   reccomend           -> recommend
+//   reccommend          -> recommend
+//   reccuring           -> recurring
+//   receeded            -> receded
+//   receeding           -> receding
+//   recepient           -> recipient
+//   receving            -> receiving
+//   rechargable         -> rechargeable
+//   reched              -> reached
+//   recide              -> reside
+//   reciding            -> residing
+//   reciepents          -> recipients
+//   reciept             -> receipt
+//   recieve             -> receive
+//   recieving           -> receiving
+//   recipiant           -> recipient
+//   recived             -> received
+//   recivership         -> receivership
+//   recogise            -> recognise
+//   recogize            -> recognize
+//   recomend            -> recommend
+//   recommedations      -> recommendations
+//   recompence          -> recompense
+//   reconaissance       -> reconnaissance
+//   reconcilation       -> reconciliation
+//   reconized           -> recognized
+//   reconnaisance       -> reconnaissance
+//   recontructed        -> reconstructed
+//   recquired           -> required
+//   recrational         -> recreational
+//   recrod              -> record
+//   recuiting           -> recruiting
+//   recuring            -> recurring
+//   recurrance          -> recurrence
+//   rediculous          -> ridiculous
+//   reedeming           -> redeeming
+//   reenforced          -> reinforced
+//   refect              -> reflect
+//   refedendum          -> referendum
+//   referal             -> referral
+//   referece            -> reference
+//   refered             -> referred
+//   referemce           -> reference
+//   referencs           -> references
+//   referenece          -> reference
+//   referiang           -> referring
+//   refering            -> referring
+//   refernce            -> reference
+//   referrence          -> reference
+//   referrs             -> refers
+//   reffered            -> referred
+//   refference          -> reference
+//   reffering           -> referring
+//   refrence            -> reference
+//   refrers             -> refers
+//   refromist           -> reformist
+//   refusla             -> refusal
+//   regardes            -> regards
+//   regluar             -> regular
+//   reguarly            -> regularly
+//   regulaion           -> regulation
+//   regulaotrs          -> regulators
+//   regularily          -> regularly
+//   rehersal            -> rehearsal
+//   reicarnation        -> reincarnation
+//   reigining           -> reigning
+//   reknown             -> renown
+//   relaly              -> really
+//   relatiopnship       -> relationship
+//   relativly           -> relatively
+//   relected            -> reelected
+//   releive             -> relieve
+//   releses             -> releases
+//   relevence           -> relevance
+//   relevent            -> relevant
+//   reliablity          -> reliability
+//   relient             -> reliant
+//   religeous           -> religious
+//   religously          -> religiously
+//   relinqushment       -> relinquishment
+//   relitavely          -> relatively
+//   relized             -> realized
+//   relpacement         -> replacement
+//   remaing             -> remaining
+//   remeber             -> remember
+//   rememberable        -> memorable
+//   rememberance        -> remembrance
+//   remembrence         -> remembrance
+//   remenant            -> remnant
+//   remenicent          -> reminiscent
+//   reminent            -> remnant
+//   reminescent         -> reminiscent
+//   reminscent          -> reminiscent
+//   reminsicent         -> reminiscent
+//   rendevous           -> rendezvous
+//   rendezous           -> rendezvous
+//   renewl              -> renewal
+//   rennovate           -> renovate
+//   rennovating         -> renovating
+//   rennovation         -> renovation
+//   rentors             -> renters
+//   reorganision        -> reorganisation
+//   repatition          -> repetition
+//   repentence          -> repentance
+//   repentent           -> repentant
+//   repeteadly          -> repeatedly
+//   repetion            -> repetition
+//   repid               -> rapid
+//   reponse             -> response
+//   reponsible          -> responsible
+//   reportadly          -> reportedly
+//   represantative      -> representative
+//   representive        -> representative
+//   reproducable        -> reproducible
+//   reprtoire           -> repertoire
+//   repsectively        -> respectively
+//   reptition           -> repetition
+//   requirment          -> requirement
+//   requred             -> required
+//   resaurant           -> restaurant
+//   resembelance        -> resemblance
+//   resembes            -> resembles
+//   resemblence         -> resemblance
+//   resevoir            -> reservoir
+//   residental          -> residential
+//   resignement         -> resignment
+//   resistable          -> resistible
+//   resistence          -> resistance
+//   resistent           -> resistant
+//   respectivly         -> respectively
+//   responce            -> response
+//   responibilities     -> responsibilities
+//   responisble         -> responsible
+//   responnsibilty      -> responsibility
+//   responsability      -> responsibility
+//   responsibile        -> responsible
+//   responsibilites     -> responsibilities
+//   responsiblities     -> responsibilities
+//   responsiblity       -> responsibility
+//   ressemblance        -> resemblance
+//   ressemble           -> resemble
+//   ressembling         -> resembling
+//   resssurecting       -> resurrecting
+//   ressurect           -> resurrect
+//   ressurrection       -> resurrection
+//   restarant           -> restaurant
+//   restaraunt          -> restaurant
+//   restauranteurs      -> restaurateurs
+//   restauration        -> restoration
+//   restauraunt         -> restaurant
+//   resteraunt          -> restaurant
+//   resticted           -> restricted
+//   resturant           -> restaurant
+//   resturaunt          -> restaurant
+//   resurecting         -> resurrecting
+//   retalitated         -> retaliated
+//   retalitation        -> retaliation
+//   retreive            -> retrieve
+//   retrun              -> return
+//   returnd             -> returned
+//   revaluated          -> reevaluated
+//   reveiw              -> review
+//   reveral             -> reversal
+//   reversable          -> reversible
+//   revolutionar:       -> revolutionary
+//   rewitten            -> rewritten
+//   rhymme              -> rhyme
+//   rhythem             -> rhythm
+//   rhythim             -> rhythm
+//   rhytmic             -> rhythmic
+//   rigourous           -> rigorous
+//   rininging           -> ringing
+//   rised               -> raised
+//   rockerfeller        -> rockefeller
+//   rococco             -> rococo
+//   rocord              -> record
+//   roomate             -> roommate
+//   rougly              -> roughly
+//   rucuperate          -> recuperate
+//   rudimentatry        -> rudimentary
+//   rulle               -> rule
+//   runing              -> running
+//   runnung             -> running
+//   russina             -> russian
+//   rwite               -> write
+//   rythem              -> rhythm
+//   rythim              -> rhythm
+//   rythm               -> rhythm
+//   rythyms             -> rhythms
+//   sacrafice           -> sacrifice
+//   sacreligious        -> sacrilegious
+//   sacrifical          -> sacrificial
+//   saftey              -> safety
+//   safty               -> safety
+//   salery              -> salary
+//   sanctionning        -> sanctioning
+//   sandwhich           -> sandwich
+//   santioned           -> sanctioned
+//   sargant             -> sergeant
+//   sargeant            -> sergeant
+//   satelite            -> satellite
+//   saterday            -> saturday
+//   satisfactority      -> satisfactorily
+//   satric              -> satiric
+//   sattelite           -> satellite
+//   saught              -> sought
+//   saveing             -> saving
+//   saxaphone           -> saxophone
+//   scaleable           -> scalable
+//   scandanavia         -> scandinavia
+//   scaricity           -> scarcity
+//   scavanged           -> scavenged
+//   schedual            -> schedule
+//   scholarhip          -> scholarship
+//   scholarstic         -> scholastic
+//   scientfic           -> scientific
+//   scientifc           -> scientific
+//   scientis:           -> scientist
+//   scince              -> science
+//   scinece             -> science
+//   scirpt              -> script
+//   scoll               -> scroll
+//   screenwrighter      -> screenwriter
+//   scrutinity          -> scrutiny
+//   scuptures           -> sculptures
+//   seach               -> search
+//   secceeded           -> seceded
+//   seceed              -> succeed
+//   secratary           -> secretary
+//   secretery           -> secretary
+//   sedereal            -> sidereal
+//   seeked              -> sought
+//   segementation       -> segmentation
+//   seguoys             -> segues
+//   seige               -> siege
+//   seing               -> seeing
+//   seinor              -> senior
+//   seldomly            -> seldom
+//   senarios            -> scenarios
+//   senstive            -> sensitive
+//   sensure             -> censure
+//   seperate            -> separate
+//   seperating          -> separating
+//   seperation          -> separation
+//   seperatism          -> separatism
+//   seperatist          -> separatist
+//   seperator           -> separator
+//   sepulchure          -> sepulchre
+//   sepulcre            -> sepulchre
+//   sergent             -> sergeant
+//   settelement         -> settlement
+//   settlment           -> settlement
+//   severeal            -> several
+//   severley            -> severely
+//   severly             -> severely
+//   sevice              -> service
+//   shaddow             -> shadow
+//   shamen              -> shaman
+//   sheild              -> shield
+//   sherif:             -> sheriff
+//   shineing            -> shining
+//   shiped              -> shipped
+//   shiping             -> shipping
+//   shopkeeepers        -> shopkeepers
+//   shorly              -> shortly
+//   shortwhile          -> short while
+//   shoudl              -> should
+//   shouldnt            -> shouldn't
+//   shreak              -> shriek
+//   shrinked            -> shrunk
+//   sicne               -> since
+//   sideral             -> sidereal
+//   sieze               -> seize
+//   siezing             -> seizing
+//   siezure             -> seizure
+//   siginificant        -> significant
+//   signficant          -> significant
+//   signficiant         -> significant
+//   signfies            -> signifies
+//   signifantly         -> significantly
+//   significently       -> significantly
+//   signifigant         -> significant
+//   signitories         -> signatories
+//   signitory           -> signatory
+//   similarily          -> similarly
+//   similiar            -> similar
+//   simmilar            -> similar
+//   simpley             -> simply
+//   simplier            -> simpler
+//   simultanous         -> simultaneous
+//   sincerley           -> sincerely
+//   singsog             -> singsong
+//   sinse               -> since
+//   skateing            -> skating
+//   slaugterhouses      -> slaughterhouses
+//   slighly             -> slightly
+//   slowy               -> slowly
+//   smealting           -> smelting
+//   sneeks              -> sneaks
+//   snese               -> sneeze
+//   socalism            -> socialism
+//   socities            -> societies
+//   sofware             -> software
+//   soilders            -> soldiers
+//   solatary            -> solitary
+//   soley               -> solely
+//   soliders            -> soldiers
+//   soliliquy           -> soliloquy
+//   soluable            -> soluble
+//   somene              -> someone
+//   somtimes            -> sometimes
+//   somwhere            -> somewhere
+//   sophicated          -> sophisticated
+//   sophmore            -> sophomore
+//   sorceror            -> sorcerer
+//   sorrounding         -> surrounding
+//   sotry               -> story
+//   sotyr               -> story
+//   soudn               -> sound
+//   sould               -> could
+//   sountrack           -> soundtrack
+//   sourth              -> south
+//   souvenier           -> souvenir
+//   soveits             -> soviets
+//   sovereignity        -> sovereignty
+//   soverign            -> sovereign
+//   spainish            -> spanish
+//   speach              -> speech
+//   specfic             -> specific
+//   specifiying         -> specifying
+//   speciman            -> specimen
+//   spectauclar         -> spectacular
+//   spectaulars         -> spectaculars
+//   spectum             -> spectrum
+//   spendour            -> splendour
+//   spermatozoan        -> spermatozoon
+//   spoace              -> space
+//   sponser             -> sponsor
+//   spontanous          -> spontaneous
+//   sponzored           -> sponsored
+//   spoonfulls          -> spoonfuls
+//   sppeches            -> speeches
+//   spreaded            -> spread
+//   sprech              -> speech
+//   spririt             -> spirit
+//   spritual            -> spiritual
+//   spyed               -> spied
+//   squence             -> sequence
+//   stainlees           -> stainless
+//   staion              -> station
+//   standars            -> standards
+//   stange              -> strange
+//   startegic           -> strategic
+//   startegies          -> strategies
+//   startegy            -> strategy
+//   stateman            -> statesman
+//   statememts          -> statements
+//   statment            -> statement
+//   steriods            -> steroids
+//   sterotypes          -> stereotypes
+//   stilus              -> stylus
+//   stingent            -> stringent
+//   stiring             -> stirring
+//   stirrs              -> stirs
+//   stlye               -> style
+//   stomache            -> stomach
+//   stong               -> strong
+//   stopry              -> story
+//   storeis             -> stories
+//   storise             -> stories
+//   stornegst           -> strongest
+//   stoyr               -> story
+//   stradegies          -> strategies
+//   stradegy            -> strategy
+//   stratagically       -> strategically
+//   streemlining        -> streamlining
+//   stregth             -> strength
+//   strenghen           -> strengthen
+//   strenght            -> strength
+//   strengtened         -> strengthened
+//   strenous            -> strenuous
+//   strictist           -> strictest
+//   strikely            -> strikingly
+//   strnad              -> strand
+//   structual           -> structural
+//   stubborness         -> stubbornness
+//   stucture            -> structure
+//   studdy              -> study
+//   studing             -> studying
+//   stuggling           -> struggling
+//   sturcture           -> structure
+//   subjudgation        -> subjugation
+//   submachne           -> submachine
+//   subpecies           -> subspecies
+//   subsidary           -> subsidiary
+//   subsiduary          -> subsidiary
+//   subsquent           -> subsequent
+//   substace            -> substance
+//   substancial         -> substantial
+//   substatial          -> substantial
+//   substituded         -> substituted
+//   substract           -> subtract
+//   subtances           -> substances
+//   subterranian        -> subterranean
+//   suburburban         -> suburban
+//   succceeded          -> succeeded
+//   succcesses          -> successes
+//   succedded           -> succeeded
+//   succeded            -> succeeded
+//   succeds             -> succeeds
+//   succesful           -> successful
+//   succesion           -> succession
+//   succesive           -> successive
+//   successully         -> successfully
+//   succsess            -> success
+//   suceed              -> succeed
+//   sucesful            -> successful
+//   sucesion            -> succession
+//   sucess              -> success
+//   sucide              -> suicide
+//   sucidial            -> suicidal
+//   sudent              -> student
+//   sufferage           -> suffrage
+//   sufferred           -> suffered
+//   sufferring          -> suffering
+//   sufficent           -> sufficient
+//   sumary              -> summary
+//   sunglases           -> sunglasses
+//   superceeded         -> superseded
+//   superintendant      -> superintendent
+//   suphisticated       -> sophisticated
+//   suplimented         -> supplemented
+//   supose              -> suppose
+//   suposing            -> supposing
+//   supplamented        -> supplemented
+//   suppliementing      -> supplementing
+//   suppoed             -> supposed
+//   supposingly         -> supposedly
+//   suppy               -> supply
+//   supress             -> suppress
+//   suprise             -> surprise
+//   suprising           -> surprising
+//   suprize             -> surprise
+//   suprizing           -> surprising
+//   surfce              -> surface
+//   surley              -> surely
+//   suround             -> surround
+//   surplanted          -> supplanted
+//   surpress            -> suppress
+//   surprize            -> surprise
+//   surprizing          -> surprising
+//   surrended           -> surrendered
+//   surrepetitious      -> surreptitious
+//   surreptious         -> surreptitious
+//   surronded           -> surrounded
+//   surrouded           -> surrounded
+//   surrouding          -> surrounding
+//   surrundering        -> surrendering
+//   surveilence         -> surveillance
+//   surveyer            -> surveyor
+//   surviver            -> survivor
+//   survivied           -> survived
+//   suseptable          -> susceptible
+//   suseptible          -> susceptible
+//   suspention          -> suspension
+//   swaer               -> swear
+//   swepth              -> swept
+//   swiming             -> swimming
+//   symetrical          -> symmetrical
+//   symetry             -> symmetry
+//   symettric           -> symmetric
+//   symmetral           -> symmetric
+//   symmetricaly        -> symmetrically
+//   synagouge           -> synagogue
+//   syncronization      -> synchronization
+//   synonomous          -> synonymous
+//   synonymns           -> synonyms
+//   synphony            -> symphony
+//   syphyllis           -> syphilis
+//   sypmtoms            -> symptoms
+//   syrap               -> syrup
+//   sysmatically        -> systematically
+//   sytem               -> system
+//   sytle               -> style
+//   tabacco             -> tobacco
+//   talekd              -> talked
+//   targetted           -> targeted
+//   targetting          -> targeting
+//   tatoo               -> tattoo
+//   tattooes            -> tattoos
+//   taxanomic           -> taxonomic
+//   taxanomy            -> taxonomy
+//   teached             -> taught
+//   techician           -> technician
+//   techiniques         -> techniques
+//   technitian          -> technician
+//   technnology         -> technology
+//   technolgy           -> technology
+//   telelevision        -> television
+//   televsion           -> television
+//   telphony            -> telephony
+//   temerature          -> temperature
+//   tempalte            -> template
+//   temparate           -> temperate
+//   temperarily         -> temporarily
+//   temperment          -> temperament
+//   tempertaure         -> temperature
+//   temperture          -> temperature
+//   temprary            -> temporary
+//   tenacle             -> tentacle
+//   tendacy             -> tendency
+//   tendancies          -> tendencies
+//   tendancy            -> tendency
+//   tepmorarily         -> temporarily
+//   terrestial          -> terrestrial
+//   terriories          -> territories
+//   terriory            -> territory
+//   territorist         -> terrorist
+//   territoy            -> territory
+//   terroist            -> terrorist
+//   testiclular         -> testicular
+//   testomony           -> testimony
+//   thast               -> that
+//   theather            -> theater
+//   theese              -> these
+//   theif               -> thief
+//   theives             -> thieves
+//   themselfs           -> themselves
+//   themslves           -> themselves
+//   therafter           -> thereafter
+//   therby              -> thereby
+//   theri               -> their
+//   thgat               -> that
+//   thier               -> their
+//   thign               -> thing
+//   thigsn              -> things
+//   thikn               -> think
+//   thiunk              -> think
+//   thnig               -> thing
+//   thoughout           -> throughout
+//   threatend           -> threatened
+//   threatning          -> threatening
+//   threee              -> three
+//   threshhold          -> threshold
+//   thrid               -> third
+//   throrough           -> thorough
+//   throughly           -> thoroughly
+//   throught            -> through
+//   througout           -> throughout
+//   thsoe               -> those
+//   thyat               -> that
+//   tihkn               -> think
+//   timne               -> time
+//   tiome               -> time
+//   tkaes               -> takes
+//   tkaing              -> taking
+//   tlaking             -> talking
+//   tobbaco             -> tobacco
+//   todya               -> today
+//   toghether           -> together
+//   tolerence           -> tolerance
+//   tomatos             -> tomatoes
+//   tommorow            -> tomorrow
+//   tommorrow           -> tomorrow
+//   tongiht             -> tonight
+//   toriodal            -> toroidal
+//   tormenters          -> tormentors
+//   tornadoe            -> tornado
+//   torpeados           -> torpedoes
+//   torpedos            -> torpedoes
+//   tortise             -> tortoise
+//   tothe               -> to the
+//   toubles             -> troubles
+//   tounge              -> tongue
+//   tourch              -> torch
+//   towords             -> towards
+//   towrad              -> toward
+//   tradionally         -> traditionally
+//   traditionaly        -> traditionally
+//   traditionnal        -> traditional
+//   traditition         -> tradition
+//   tradtionally        -> traditionally
+//   trafficed           -> trafficked
+//   trafficing          -> trafficking
+//   trafic              -> traffic
+//   trancendent         -> transcendent
+//   trancending         -> transcending
+//   tranform            -> transform
+//   transcendance       -> transcendence
+//   transcendant        -> transcendent
+//   transcendentational -> transcendental
+//   transcripting       -> transcribing
+//   transending         -> transcending
+//   transesxuals        -> transsexuals
+//   transfered          -> transferred
+//   transfering         -> transferring
+//   transformaton       -> transformation
+//   transistion         -> transition
+//   translater          -> translator
+//   transmissable       -> transmissible
+//   transporation       -> transportation
+//   tremelo             -> tremolo
+//   triguered           -> triggered
+//   triology            -> trilogy
+//   troling             -> trolling
+//   troups              -> troops
+//   truely              -> truly
+//   trustworthyness     -> trustworthiness
+//   turnk               -> trunk
+//   tuscon              -> tucson
+//   twelth              -> twelfth
+//   tyhat               -> that
+//   typcial             -> typical
+//   typicaly            -> typically
+//   tyranies            -> tyrannies
+//   tyrany              -> tyranny
+//   tyrranies           -> tyrannies
+//   tyrrany             -> tyranny
+//   ubiquitious         -> ubiquitous
+//   ukranian            -> ukrainian
+//   ultimely            -> ultimately
+//   unacompanied        -> unaccompanied
+//   unahppy             -> unhappy
+//   unanymous           -> unanimous
+//   unballance          -> unbalance
+//   unbeknowst          -> unbeknownst
+//   unbeleivable        -> unbelievable
+//   unchallengable      -> unchallengeable
+//   unconfortability    -> discomfort
+//   uncontitutional     -> unconstitutional
+//   understoon          -> understood
+//   undetecable         -> undetectable
+//   undoubtely          -> undoubtedly
+//   undreground         -> underground
+//   unecessary          -> unnecessary
+//   unequalities        -> inequalities
+//   unforetunately      -> unfortunately
+//   unforgetable        -> unforgettable
+//   unforgiveable       -> unforgivable
+//   unfortunatley       -> unfortunately
+//   unfortunatly        -> unfortunately
+//   unfourtunately      -> unfortunately
+//   unihabited          -> uninhabited
+//   unilateraly         -> unilaterally
+//   unilatreal          -> unilateral
+//   uninterruped        -> uninterrupted
+//   univeral            -> universal
+//   univeristies        -> universities
+//   univeristy          -> university
+//   univerity           -> university
+//   universtiy          -> university
+//   univesities         -> universities
+//   univesity           -> university
+//   unkown              -> unknown
+//   unlikey             -> unlikely
+//   unmistakeably       -> unmistakably
+//   unoperational       -> nonoperational
+//   unoticeable         -> unnoticeable
+//   unplease            -> displease
+//   unprecendented      -> unprecedented
+//   unrepetant          -> unrepentant
+//   unrepetent          -> unrepentant
+//   unsed               -> unused
+//   unsubstanciated     -> unsubstantiated
+//   untill              -> until
+//   untranslateable     -> untranslatable
+//   unuseable           -> unusable
+//   unusuable           -> unusable
+//   unviersity          -> university
+//   unwieldly           -> unwieldy
+//   upgradded           -> upgraded
+//   usally              -> usually
+//   useage              -> usage
+//   usefuly             -> usefully
+//   usualy              -> usually
+//   vaccum              -> vacuum
+//   vacinity            -> vicinity
+//   vaguaries           -> vagaries
+//   vaieties            -> varieties
+//   vailidty            -> validity
+//   valetta             -> valletta
+//   valuble             -> valuable
+//   valueable           -> valuable
+//   varations           -> variations
+//   varient             -> variant
+//   variey              -> variety
+//   varing              -> varying
+//   varities            -> varieties
+//   varity              -> variety
+//   vasall              -> vassal
+//   vegatarian          -> vegetarian
+//   vegitable           -> vegetable
+//   vegtable            -> vegetable
+//   vehicule            -> vehicle
+//   venemous            -> venomous
+//   vengance            -> vengeance
+//   vengence            -> vengeance
+//   verfication         -> verification
+//   verison             -> version
+//   vermillion          -> vermilion
+//   versitilaty         -> versatility
+//   versitlity          -> versatility
+//   vetween             -> between
+//   vigilence           -> vigilance
+//   vigourous           -> vigorous
+//   villian             -> villain
+//   villification       -> vilification
+//   villify             -> vilify
+//   villin              -> villain
+//   vincinity           -> vicinity
+//   violentce           -> violence
+//   virtualy            -> virtually
+//   virutal             -> virtual
+//   visable             -> visible
+//   visably             -> visibly
+//   visting             -> visiting
+//   vistors             -> visitors
+//   vitories            -> victories
+//   volcanoe            -> volcano
+//   voleyball           -> volleyball
+//   volontary           -> voluntary
+//   volonteer           -> volunteer
+//   volounteer          -> volunteer
+//   volumne             -> volume
+//   vreity              -> variety
+//   vriety              -> variety
+//   vulnerablility      -> vulnerability
+//   wanna               -> want to
+//   warantee            -> warranty
+//   wardobe             -> wardrobe
+//   warrent             -> warrant
+//   warrriors           -> warriors
+//   wasnt               -> wasn't
+//   wayword             -> wayward
+//   weaponary           -> weaponry
+//   weild               -> wield
+//   wendsay             -> wednesday
+//   wensday             -> wednesday
+//   wereabouts          -> whereabouts
+//   whant               -> want
+//   whcih               -> which
+//   wheras              -> whereas
+//   wherease            -> whereas
+//   whereever           -> wherever
+//   whihc               -> which
+//   whith               -> with
+//   whlch               -> which
+//   wholey              -> wholly
+//   wholy               -> wholly
+//   whther              -> whether
+//   widesread           -> widespread
+//   wierd               -> weird
+//   willingless         -> willingness
+//   wirting             -> writing
+//   witheld             -> withheld
+//   withing             -> within
+//   withold             -> withhold
+//   witht               -> with
+//   wiull               -> will
+//   wnated              -> wanted
+//   wnats               -> wants
+//   wohle               -> whole
+//   wokring             -> working
+//   wonderfull          -> wonderful
+//   wordlwide           -> worldwide
+//   workststion         -> workstation
+//   worls               -> world
+//   worstened           -> worsened
+//   woudl               -> would
+//   wresters            -> wrestlers
+//   wriet               -> write
+//   writen              -> written
+//   wroet               -> wrote
+//   wroking             -> working
+//   wupport             -> support
+//   xenophoby           -> xenophobia
+//   yaching             -> yachting
+//   yaerly              -> yearly
+//   yaers               -> years
+//   yatch               -> yacht
+//   yearm               -> year
+//   yeasr               -> years
+//   yeild               -> yield
+//   yeras               -> years
+//   yersa               -> years
+//   yotube              -> youtube
+//   youself             -> yourself
+//   zeebra              -> zebra
+
+#define AUTOCORRECT_MIN_LENGTH 5 // ":adn:"
+#define AUTOCORRECT_MAX_LENGTH 19 // "differentiatiations"
+#define DICTIONARY_SIZE 42407
+#define AUTOCORRECT_DATA_DAWG
+
+static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {
+    0x59, 0x84, 0x4C, 0x00, 0x86, 0x37, 0x02, 0x87, 0xA3, 0x05, 0x88, 0x27, 0x15, 0x89, 0x71, 0x31,
+    0x8A, 0xD5, 0x31, 0x8B, 0x1A, 0x3B, 0x8C, 0x12, 0x3D, 0x8E, 0x9C, 0x3D, 0x8F, 0xF5, 0x3D, 0x90,
+    0x36, 0x47, 0x91, 0xDF, 0x49, 0x92, 0x2F, 0x5A, 0x93, 0xE0, 0x5A, 0x95, 0x54, 0x5B, 0x96, 0x4A,
+    0x63, 0x97, 0x81, 0x7A, 0x98, 0xDF, 0x88, 0x99, 0x20, 0x89, 0x9A, 0x39, 0x89, 0x9B, 0x7B, 0x89,
+    0x9C, 0x97, 0x89, 0x9D, 0x95, 0xA0, 0xAC, 0x9F, 0xA0, 0xB4, 0x9F, 0xA5, 0x49, 0x87, 0x1C, 0x00,
+    0x8C, 0x3B, 0x00, 0x8F, 0xD4, 0x00, 0x90, 0x3A, 0x01, 0x91, 0x52, 0x01, 0x95, 0x9C, 0x01, 0x96,
+    0xBD, 0x01, 0x97, 0xCC, 0x01, 0x9C, 0xE4, 0x01, 0x11, 0x04, 0x42, 0x4A, 0x05, 0x55, 0x12, 0x12,
+    0x13, 0x12, 0x15, 0x13, 0x85, 0x61, 0x67, 0x61, 0x6E, 0x64, 0x61, 0x00, 0x08, 0x10, 0x86, 0x76,
+    0x65, 0x72, 0x61, 0x6E, 0x64, 0x61, 0x00, 0x45, 0x45, 0x0B, 0x47, 0x13, 0x4F, 0x35, 0x51, 0x6F,
+    0x59, 0x89, 0x1C, 0x0F, 0x83, 0x69, 0x62, 0x79, 0x61, 0x00, 0x08, 0x42, 0x50, 0x05, 0x53, 0x11,
+    0x16, 0x16, 0x04, 0x10, 0x84, 0x20, 0x6D, 0x65, 0x64, 0x69, 0x61, 0x00, 0x12, 0x0F, 0x1C, 0x06,
+    0x11, 0x08, 0x86, 0x63, 0x6C, 0x6F, 0x70, 0x65, 0x64, 0x69, 0x61, 0x00, 0x43, 0x44, 0x07, 0x4C,
+    0x25, 0x52, 0x30, 0x42, 0x4C, 0x05, 0x51, 0x0F, 0x11, 0x08, 0x0A, 0x83, 0x74, 0x61, 0x6C, 0x69,
+    0x61, 0x00, 0x08, 0x0B, 0x13, 0x04, 0x15, 0x04, 0x13, 0x84, 0x72, 0x6E, 0x61, 0x6C, 0x69, 0x61,
+    0x00, 0x04, 0x15, 0x17, 0x16, 0x18, 0x04, 0x83, 0x6C, 0x69, 0x61, 0x00, 0x0A, 0x04, 0x10, 0x83,
+    0x6E, 0x6F, 0x6C, 0x69, 0x61, 0x00, 0x42, 0x48, 0x05, 0x51, 0x0E, 0x0F, 0x0F, 0x0C, 0x10, 0x81,
+    0x6E, 0x69, 0x61, 0x00, 0x08, 0x0F, 0x0C, 0x10, 0x84, 0x6C, 0x65, 0x6E, 0x6E, 0x69, 0x61, 0x00,
+    0x04, 0x11, 0x04, 0x07, 0x11, 0x04, 0x06, 0x16, 0x85, 0x69, 0x6E, 0x61, 0x76, 0x69, 0x61, 0x00,
+    0x45, 0x45, 0x0B, 0x4C, 0x16, 0x4F, 0x1F, 0x56, 0x2B, 0x58, 0x32, 0x04, 0x11, 0x18, 0x06, 0x11,
+    0x0C, 0x81, 0x75, 0x6C, 0x61, 0x00, 0x15, 0x15, 0x08, 0x18, 0x0A, 0x80, 0x6C, 0x61, 0x00, 0x0C,
+    0x15, 0x08, 0x18, 0x0A, 0x83, 0x72, 0x69, 0x6C, 0x6C, 0x61, 0x00, 0x18, 0x09, 0x08, 0x15, 0x02,
+    0x54, 0x44, 0x42, 0x51, 0x05, 0x56, 0x0A, 0x0C, 0x16, 0x11, 0x01, 0x15, 0x42, 0x4C, 0x05, 0x51,
+    0x1D, 0x11, 0x42, 0x48, 0x05, 0x51, 0x0D, 0x13, 0x83, 0x6E, 0x73, 0x75, 0x6C, 0x61, 0x00, 0x08,
+    0x13, 0x85, 0x69, 0x6E, 0x73, 0x75, 0x6C, 0x61, 0x00, 0x0C, 0x11, 0x11, 0x08, 0x13, 0x86, 0x69,
+    0x6E, 0x73, 0x75, 0x6C, 0x61, 0x00, 0x42, 0x48, 0x05, 0x5C, 0x0D, 0x12, 0x07, 0x08, 0x83, 0x65,
+    0x6D, 0x61, 0x00, 0x16, 0x1C, 0x0B, 0x13, 0x10, 0x08, 0x82, 0x65, 0x6D, 0x61, 0x00, 0x43, 0x48,
+    0x07, 0x4C, 0x32, 0x51, 0x39, 0x42, 0x44, 0x05, 0x50, 0x0C, 0x11, 0x11, 0x0C, 0x0F, 0x02, 0xFF,
+    0x50, 0x42, 0x51, 0x05, 0x52, 0x10, 0x12, 0x11, 0x08, 0x0B, 0x13, 0x84, 0x6D, 0x65, 0x6E, 0x61,
+    0x00, 0x0A, 0x12, 0x0F, 0x12, 0x15, 0x13, 0x86, 0x65, 0x67, 0x6F, 0x6D, 0x65, 0x6E, 0x61, 0x00,
+    0x16, 0x16, 0x18, 0x15, 0x02, 0xD9, 0x50, 0x04, 0x42, 0x51, 0x05, 0x5A, 0x0A, 0x04, 0x05, 0x81,
+    0x61, 0x00, 0x81, 0x74, 0x20, 0x74, 0x6F, 0x00, 0x43, 0x45, 0x07, 0x47, 0x0F, 0x48, 0x1D, 0x08,
+    0x08, 0x1D, 0x83, 0x62, 0x72, 0x61, 0x00, 0x08, 0x0B, 0x12, 0x17, 0x06, 0x12, 0x85, 0x61, 0x68,
+    0x65, 0x64, 0x72, 0x61, 0x00, 0x0F, 0x02, 0x05, 0x5D, 0x42, 0x48, 0x05, 0x55, 0x0A, 0x07, 0x0C,
+    0x02, 0x4A, 0x74, 0x08, 0x1C, 0x02, 0x24, 0x6F, 0x42, 0x55, 0x05, 0x57, 0x0D, 0x12, 0x13, 0x15,
+    0x0C, 0x04, 0x02, 0x2B, 0xA2, 0x08, 0x0F, 0x04, 0x19, 0x83, 0x6C, 0x65, 0x74, 0x74, 0x61, 0x00,
+    0x07, 0x12, 0x17, 0x81, 0x61, 0x79, 0x00, 0x44, 0x44, 0x09, 0x49, 0x13, 0x4B, 0x1E, 0x4C, 0x31,
+    0x0C, 0x0B, 0x06, 0x15, 0x04, 0x82, 0x61, 0x69, 0x63, 0x00, 0x0C, 0x17, 0x11, 0x08, 0x0C, 0x06,
+    0x16, 0x80, 0x69, 0x63, 0x00, 0x0C, 0x42, 0x4B, 0x05, 0x5A, 0x0A, 0x1A, 0x81, 0x63, 0x68, 0x00,
+    0x0B, 0x84, 0x77, 0x68, 0x69, 0x63, 0x68, 0x00, 0x4F, 0x84, 0x2E, 0x00, 0x85, 0x3C, 0x00, 0x86,
+    0x4A, 0x00, 0x87, 0x55, 0x00, 0x89, 0x60, 0x00, 0x8A, 0x7D, 0x00, 0x8B, 0x9E, 0x00, 0x8F, 0xC3,
+    0x00, 0x90, 0xF6, 0x00, 0x91, 0x4A, 0x01, 0x93, 0x56, 0x01, 0x95, 0x63, 0x01, 0x96, 0x8D, 0x01,
+    0x97, 0x95, 0x01, 0x9C, 0x2F, 0x03, 0x15, 0x0B, 0x17, 0x1C, 0x10, 0x86, 0x69, 0x74, 0x68, 0x72,
+    0x61, 0x69, 0x63, 0x00, 0x12, 0x13, 0x12, 0x15, 0x07, 0x1C, 0x0B, 0x83, 0x68, 0x6F, 0x62, 0x69,
+    0x63, 0x00, 0x16, 0x1C, 0x13, 0x84, 0x73, 0x79, 0x63, 0x68, 0x69, 0x63, 0x00, 0x08, 0x10, 0x10,
+    0x12, 0x06, 0x84, 0x65, 0x64, 0x69, 0x63, 0x00, 0x43, 0x44, 0x07, 0x46, 0x0E, 0x57, 0x12, 0x15,
+    0x17, 0x81, 0x66, 0x69, 0x63, 0x00, 0x08, 0x13, 0x01, 0x06, 0x11, 0x08, 0x0C, 0x06, 0x16, 0x82,
+    0x69, 0x66, 0x69, 0x63, 0x00, 0x42, 0x48, 0x05, 0x55, 0x13, 0x17, 0x15, 0x04, 0x17, 0x16, 0x86,
+    0x72, 0x61, 0x74, 0x65, 0x67, 0x69, 0x63, 0x00, 0x18, 0x0F, 0x04, 0x17, 0x08, 0x10, 0x84, 0x6C,
+    0x75, 0x72, 0x67, 0x69, 0x63, 0x00, 0x42, 0x53, 0x05, 0x5C, 0x1D, 0x04, 0x15, 0x0A, 0x12, 0x0C,
+    0x05, 0x12, 0x0B, 0x17, 0x18, 0x04, 0x8B, 0x6F, 0x62, 0x69, 0x6F, 0x67, 0x72, 0x61, 0x70, 0x68,
+    0x69, 0x63, 0x00, 0x16, 0x13, 0x82, 0x63, 0x68, 0x69, 0x63, 0x00, 0x43, 0x44, 0x07, 0x4B, 0x0F,
+    0x4C, 0x18, 0x17, 0x08, 0x10, 0x81, 0x6C, 0x69, 0x63, 0x00, 0x17, 0x04, 0x06, 0x82, 0x6F, 0x6C,
+    0x69, 0x63, 0x00, 0x42, 0x49, 0x05, 0x53, 0x0F, 0x12, 0x15, 0x13, 0x84, 0x6C, 0x69, 0x66, 0x69,
+    0x63, 0x00, 0x12, 0x15, 0x07, 0x1C, 0x0B, 0x83, 0x68, 0x69, 0x6C, 0x69, 0x63, 0x00, 0x45, 0x47,
+    0x0B, 0x48, 0x14, 0x4F, 0x2F, 0x52, 0x3E, 0x57, 0x4B, 0x04, 0x06, 0x04, 0x82, 0x65, 0x6D, 0x69,
+    0x63, 0x00, 0x07, 0x42, 0x44, 0x05, 0x48, 0x10, 0x06, 0x06, 0x04, 0x86, 0x61, 0x64, 0x65, 0x6D,
+    0x69, 0x63, 0x00, 0x06, 0x04, 0x85, 0x61, 0x64, 0x65, 0x6D, 0x69, 0x63, 0x00, 0x04, 0x0B, 0x17,
+    0x13, 0x12, 0x86, 0x68, 0x74, 0x68, 0x61, 0x6C, 0x6D, 0x69, 0x63, 0x00, 0x11, 0x04, 0x1B, 0x04,
+    0x17, 0x85, 0x6F, 0x6E, 0x6F, 0x6D, 0x69, 0x63, 0x00, 0x1C, 0x0B, 0x15, 0x82, 0x68, 0x6D, 0x69,
+    0x63, 0x00, 0x12, 0x10, 0x12, 0x06, 0x08, 0x84, 0x6E, 0x6F, 0x6D, 0x69, 0x63, 0x00, 0x1C, 0x17,
+    0x11, 0x12, 0x10, 0x84, 0x6F, 0x74, 0x79, 0x70, 0x69, 0x63, 0x00, 0x17, 0x43, 0x44, 0x07, 0x48,
+    0x0E, 0x57, 0x1D, 0x16, 0x82, 0x69, 0x72, 0x69, 0x63, 0x00, 0x10, 0x1C, 0x16, 0x16, 0x04, 0x87,
+    0x79, 0x6D, 0x6D, 0x65, 0x74, 0x72, 0x69, 0x63, 0x00, 0x08, 0x10, 0x1C, 0x16, 0x85, 0x6D, 0x65,
+    0x74, 0x72, 0x69, 0x63, 0x00, 0x04, 0x0F, 0x06, 0x81, 0x73, 0x69, 0x63, 0x00, 0x47, 0x84, 0x16,
+    0x00, 0x86, 0x98, 0x00, 0x88, 0xB2, 0x00, 0x8C, 0xE9, 0x00, 0x90, 0x22, 0x01, 0x95, 0x2B, 0x01,
+    0x96, 0x35, 0x01, 0x44, 0x4C, 0x09, 0x4F, 0x15, 0x50, 0x1A, 0x55, 0x4C, 0x16, 0x18, 0x0B, 0x17,
+    0x11, 0x08, 0x82, 0x73, 0x74, 0x69, 0x63, 0x00, 0x04, 0x0A, 0x02, 0x02, 0x01, 0x42, 0x44, 0x05,
+    0x56, 0x11, 0x0F, 0x05, 0x10, 0x08, 0x85, 0x65, 0x6D, 0x61, 0x74, 0x69, 0x63, 0x00, 0x42, 0x44,
+    0x05, 0x4C, 0x12, 0x15, 0x04, 0x0B, 0x06, 0x86, 0x69, 0x73, 0x6D, 0x61, 0x74, 0x69, 0x63, 0x00,
+    0x15, 0x04, 0x06, 0x88, 0x68, 0x61, 0x72, 0x69, 0x73, 0x6D, 0x61, 0x74, 0x69, 0x63, 0x00, 0x42,
+    0x46, 0x05, 0x48, 0x2F, 0x42, 0x51, 0x05, 0x52, 0x18, 0x1C, 0x16, 0x12, 0x08, 0x07, 0x0C, 0x8A,
+    0x69, 0x6F, 0x73, 0x79, 0x6E, 0x63, 0x72, 0x61, 0x74, 0x69, 0x63, 0x00, 0x15, 0x18, 0x04, 0x08,
+    0x05, 0x8A, 0x75, 0x72, 0x65, 0x61, 0x75, 0x63, 0x72, 0x61, 0x74, 0x69, 0x63, 0x00, 0x83, 0x72,
+    0x61, 0x74, 0x69, 0x63, 0x00, 0x08, 0x0F, 0x42, 0x46, 0x05, 0x48, 0x0F, 0x06, 0x08, 0x86, 0x6C,
+    0x65, 0x63, 0x74, 0x69, 0x63, 0x00, 0x85, 0x63, 0x6C, 0x65, 0x63, 0x74, 0x69, 0x63, 0x00, 0x43,
+    0x4B, 0x07, 0x51, 0x23, 0x56, 0x2F, 0x17, 0x42, 0x44, 0x05, 0x56, 0x10, 0x13, 0x0C, 0x15, 0x08,
+    0x13, 0x84, 0x65, 0x74, 0x69, 0x63, 0x00, 0x04, 0x86, 0x65, 0x73, 0x74, 0x68, 0x65, 0x74, 0x69,
+    0x63, 0x00, 0x12, 0x09, 0x86, 0x70, 0x68, 0x6F, 0x6E, 0x65, 0x74, 0x69, 0x63, 0x00, 0x04, 0x83,
+    0x63, 0x65, 0x74, 0x69, 0x63, 0x00, 0x42, 0x4F, 0x05, 0x56, 0x1F, 0x42, 0x44, 0x05, 0x52, 0x0D,
+    0x11, 0x04, 0x83, 0x79, 0x74, 0x69, 0x63, 0x00, 0x08, 0x42, 0x4F, 0x05, 0x51, 0x07, 0x04, 0x13,
+    0x81, 0x68, 0x69, 0x63, 0x00, 0x42, 0x4C, 0x05, 0x4F, 0x10, 0x15, 0x04, 0x13, 0x85, 0x61, 0x73,
+    0x69, 0x74, 0x69, 0x63, 0x00, 0x04, 0x08, 0x15, 0x84, 0x69, 0x73, 0x74, 0x69, 0x63, 0x00, 0x04,
+    0x15, 0x07, 0x82, 0x61, 0x74, 0x69, 0x63, 0x00, 0x04, 0x17, 0x11, 0x04, 0x82, 0x63, 0x74, 0x69,
+    0x63, 0x00, 0x44, 0x44, 0x09, 0x4C, 0x19, 0x55, 0x4D, 0x58, 0x59, 0x0F, 0x06, 0x11, 0x12, 0x06,
+    0x0C, 0x86, 0x6F, 0x63, 0x6C, 0x61, 0x73, 0x74, 0x69, 0x63, 0x00, 0x43, 0x4F, 0x07, 0x56, 0x16,
+    0x58, 0x26, 0x05, 0x04, 0x05, 0x12, 0x15, 0x13, 0x85, 0x69, 0x6C, 0x69, 0x73, 0x74, 0x69, 0x63,
+    0x00, 0x15, 0x08, 0x17, 0x06, 0x04, 0x15, 0x04, 0x0B, 0x06, 0x85, 0x69, 0x73, 0x74, 0x69, 0x63,
+    0x00, 0x0A, 0x05, 0x0C, 0x0F, 0x87, 0x6E, 0x67, 0x75, 0x69, 0x73, 0x74, 0x69, 0x63, 0x00, 0x04,
+    0x0F, 0x12, 0x0B, 0x06, 0x16, 0x84, 0x73, 0x74, 0x69, 0x63, 0x00, 0x12, 0x06, 0x06, 0x04, 0x86,
+    0x6F, 0x75, 0x73, 0x74, 0x69, 0x63, 0x00, 0x11, 0x12, 0x0B, 0x13, 0x1C, 0x0F, 0x12, 0x13, 0x82,
+    0x69, 0x63, 0x00, 0x4B, 0x84, 0x22, 0x00, 0x87, 0x73, 0x00, 0x88, 0x81, 0x00, 0x8C, 0x5D, 0x0D,
+    0x8E, 0x89, 0x0D, 0x8F, 0x99, 0x0D, 0x91, 0xE5, 0x0D, 0x92, 0x98, 0x0E, 0x95, 0xF8, 0x0E, 0x98,
+    0x74, 0x0F, 0x9C, 0x7B, 0x0F, 0x43, 0x48, 0x07, 0x51, 0x3B, 0x55, 0x43, 0x42, 0x4B, 0x05, 0x55,
+    0x1C, 0x42, 0x46, 0x05, 0x55, 0x0E, 0x04, 0x08, 0x05, 0x82, 0x68, 0x65, 0x61, 0x64, 0x00, 0x12,
+    0x09, 0x83, 0x65, 0x68, 0x65, 0x61, 0x64, 0x00, 0x42, 0x45, 0x05, 0x56, 0x0D, 0x15, 0x08, 0x17,
+    0x11, 0x0C, 0x02, 0x37, 0x15, 0x08, 0x07, 0x0C, 0x1A, 0x83, 0x70, 0x72, 0x65, 0x61, 0x64, 0x00,
+    0x15, 0x17, 0x16, 0x82, 0x61, 0x6E, 0x64, 0x00, 0x42, 0x48, 0x05, 0x5A, 0x09, 0x0B, 0x02, 0xF2,
+    0x0E, 0x12, 0x17, 0x02, 0xED, 0x0E, 0x08, 0x15, 0x18, 0x17, 0x06, 0x04, 0x09, 0x18, 0x11, 0x04,
+    0x10, 0x02, 0xFD, 0x82, 0x56, 0x84, 0x43, 0x00, 0x85, 0x52, 0x00, 0x86, 0x6E, 0x00, 0x87, 0x15,
+    0x01, 0x88, 0xD2, 0x01, 0x8A, 0x12, 0x02, 0x8B, 0x4C, 0x02, 0x8C, 0xAA, 0x02, 0x8E, 0x1F, 0x03,
+    0x8F, 0x3B, 0x03, 0x90, 0x9E, 0x03, 0x91, 0xE0, 0x03, 0x92, 0xE5, 0x04, 0x93, 0xEC, 0x04, 0x95,
+    0x13, 0x05, 0x96, 0x47, 0x06, 0x97, 0x0E, 0x07, 0x98, 0x55, 0x0B, 0x99, 0x79, 0x0B, 0x9A, 0xD0,
+    0x0B, 0x9C, 0xE5, 0x0B, 0x9D, 0x2D, 0x0C, 0x17, 0x15, 0x12, 0x13, 0x15, 0x12, 0x06, 0x11, 0x0C,
+    0x83, 0x61, 0x74, 0x65, 0x64, 0x00, 0x42, 0x4C, 0x05, 0x55, 0x10, 0x06, 0x16, 0x08, 0x07, 0x83,
+    0x72, 0x69, 0x62, 0x65, 0x64, 0x00, 0x12, 0x16, 0x04, 0x85, 0x62, 0x73, 0x6F, 0x72, 0x62, 0x65,
+    0x64, 0x00, 0x45, 0x48, 0x0B, 0x4C, 0x11, 0x51, 0x2E, 0x55, 0x4B, 0x58, 0x5B, 0x13, 0x1B, 0x08,
+    0x02, 0x42, 0x09, 0x42, 0x49, 0x05, 0x59, 0x0E, 0x09, 0x04, 0x15, 0x17, 0x81, 0x6B, 0x65, 0x64,
+    0x00, 0x42, 0x47, 0x05, 0x51, 0x0B, 0x04, 0x82, 0x73, 0x65, 0x64, 0x00, 0x12, 0x06, 0x01, 0x6E,
+    0x42, 0x44, 0x05, 0x58, 0x11, 0x19, 0x04, 0x07, 0x04, 0x86, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x64,
+    0x00, 0x12, 0x11, 0x04, 0x85, 0x6E, 0x6F, 0x75, 0x6E, 0x63, 0x65, 0x64, 0x00, 0x12, 0x09, 0x11,
+    0x08, 0x08, 0x15, 0x87, 0x69, 0x6E, 0x66, 0x6F, 0x72, 0x63, 0x65, 0x64, 0x00, 0x43, 0x47, 0x07,
+    0x52, 0x34, 0x55, 0x45, 0x43, 0x52, 0x07, 0x55, 0x16, 0x58, 0x21, 0x15, 0x11, 0x17, 0x0C, 0x88,
+    0x6E, 0x74, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x65, 0x64, 0x00, 0x17, 0x11, 0x0C, 0x84, 0x6F, 0x64,
+    0x75, 0x63, 0x65, 0x64, 0x00, 0x15, 0x17, 0x11, 0x0C, 0x85, 0x6F, 0x64, 0x75, 0x63, 0x65, 0x64,
+    0x00, 0x11, 0x42, 0x51, 0x05, 0x52, 0x08, 0x04, 0x01, 0x04, 0x15, 0x13, 0x82, 0x6E, 0x63, 0x65,
+    0x64, 0x00, 0x17, 0x16, 0x05, 0x12, 0x02, 0xAC, 0x08, 0x48, 0x44, 0x11, 0x47, 0x17, 0x48, 0x34,
+    0x4C, 0x70, 0x51, 0x76, 0x55, 0x8C, 0x58, 0x92, 0x59, 0xB4, 0x08, 0x15, 0x13, 0x02, 0xF0, 0x8D,
+    0x42, 0x44, 0x05, 0x48, 0x0C, 0x15, 0x0A, 0x13, 0x18, 0x02, 0xAC, 0x0A, 0x06, 0x42, 0x46, 0x05,
+    0x5B, 0x09, 0x18, 0x16, 0x01, 0x03, 0x08, 0x83, 0x65, 0x64, 0x65, 0x64, 0x00, 0x42, 0x46, 0x05,
+    0x48, 0x0E, 0x06, 0x18, 0x16, 0x82, 0x65, 0x64, 0x65, 0x64, 0x00, 0x06, 0x43, 0x46, 0x07, 0x48,
+    0x1C, 0x55, 0x22, 0x42, 0x46, 0x05, 0x48, 0x0E, 0x18, 0x16, 0x85, 0x65, 0x65, 0x64, 0x65, 0x64,
+    0x00, 0x16, 0x85, 0x65, 0x64, 0x65, 0x64, 0x00, 0x15, 0x83, 0x64, 0x65, 0x64, 0x00, 0x08, 0x13,
+    0x18, 0x16, 0x85, 0x73, 0x65, 0x64, 0x65, 0x64, 0x00, 0x06, 0x0C, 0x0F, 0x08, 0x01, 0xAB, 0x42,
+    0x48, 0x05, 0x52, 0x0B, 0x15, 0x15, 0x18, 0x16, 0x01, 0x0E, 0x15, 0x15, 0x18, 0x16, 0x83, 0x75,
+    0x6E, 0x64, 0x65, 0x64, 0x00, 0x12, 0x80, 0x72, 0x65, 0x64, 0x00, 0x43, 0x52, 0x07, 0x56, 0x11,
+    0x57, 0x1A, 0x15, 0x15, 0x18, 0x16, 0x82, 0x6E, 0x64, 0x65, 0x64, 0x00, 0x15, 0x08, 0x13, 0x82,
+    0x61, 0x64, 0x65, 0x64, 0x00, 0x0C, 0x17, 0x16, 0x05, 0x18, 0x16, 0x01, 0x6D, 0x12, 0x15, 0x13,
+    0x82, 0x69, 0x64, 0x65, 0x64, 0x00, 0x44, 0x46, 0x09, 0x48, 0x26, 0x4A, 0x2F, 0x55, 0x37, 0x42,
+    0x48, 0x05, 0x58, 0x16, 0x42, 0x55, 0x05, 0x56, 0x09, 0x13, 0x02, 0xD7, 0x23, 0x84, 0x75, 0x63,
+    0x63, 0x65, 0x65, 0x64, 0x00, 0x16, 0x82, 0x63, 0x65, 0x65, 0x64, 0x00, 0x15, 0x0A, 0x04, 0x16,
+    0x0C, 0x07, 0x02, 0x88, 0x12, 0x04, 0x15, 0x08, 0x19, 0x04, 0x02, 0x80, 0x12, 0x0A, 0x0A, 0x04,
+    0x84, 0x72, 0x65, 0x65, 0x64, 0x00, 0x42, 0x48, 0x05, 0x51, 0x14, 0x07, 0x0F, 0x1A, 0x12, 0x11,
+    0x0E, 0x06, 0x04, 0x84, 0x65, 0x64, 0x67, 0x65, 0x64, 0x00, 0x04, 0x43, 0x4B, 0x07, 0x55, 0x12,
+    0x59, 0x1B, 0x06, 0x11, 0x08, 0x16, 0x0C, 0x07, 0x82, 0x74, 0x65, 0x64, 0x00, 0x04, 0x84, 0x72,
+    0x61, 0x6E, 0x67, 0x65, 0x64, 0x00, 0x04, 0x06, 0x16, 0x84, 0x65, 0x6E, 0x67, 0x65, 0x64, 0x00,
+    0x43, 0x46, 0x07, 0x51, 0x43, 0x56, 0x4C, 0x44, 0x44, 0x09, 0x48, 0x12, 0x51, 0x1A, 0x57, 0x20,
+    0x08, 0x17, 0x85, 0x61, 0x75, 0x67, 0x68, 0x74, 0x00, 0x15, 0x83, 0x61, 0x63, 0x68, 0x65, 0x64,
+    0x00, 0x18, 0x12, 0x11, 0x02, 0xBD, 0x08, 0x04, 0x42, 0x53, 0x05, 0x57, 0x13, 0x16, 0x08, 0x07,
+    0x88, 0x69, 0x73, 0x70, 0x61, 0x74, 0x63, 0x68, 0x65, 0x64, 0x00, 0x08, 0x07, 0x84, 0x63, 0x68,
+    0x65, 0x64, 0x00, 0x18, 0x04, 0x0F, 0x82, 0x63, 0x68, 0x65, 0x64, 0x00, 0x0C, 0x18, 0x14, 0x0A,
+    0x11, 0x0C, 0x17, 0x16, 0x0C, 0x07, 0x86, 0x75, 0x69, 0x73, 0x68, 0x65, 0x64, 0x00, 0x46, 0x49,
+    0x0D, 0x4F, 0x2D, 0x51, 0x41, 0x55, 0x61, 0x59, 0x66, 0x5C, 0x6C, 0x42, 0x4C, 0x05, 0x56, 0x0F,
+    0x15, 0x04, 0x15, 0x84, 0x65, 0x66, 0x69, 0x65, 0x64, 0x00, 0x0C, 0x17, 0x04, 0x16, 0x0C, 0x07,
+    0x87, 0x73, 0x61, 0x74, 0x69, 0x73, 0x66, 0x69, 0x65, 0x64, 0x00, 0x42, 0x53, 0x05, 0x57, 0x0D,
+    0x04, 0x83, 0x70, 0x6C, 0x69, 0x65, 0x64, 0x00, 0x0C, 0x17, 0x11, 0x08, 0x02, 0xF9, 0x08, 0x42,
+    0x44, 0x05, 0x55, 0x17, 0x13, 0x10, 0x12, 0x06, 0x04, 0x11, 0x18, 0x87, 0x63, 0x6F, 0x6D, 0x70,
+    0x61, 0x6E, 0x69, 0x65, 0x64, 0x00, 0x18, 0x12, 0x0D, 0x82, 0x65, 0x79, 0x65, 0x64, 0x00, 0x15,
+    0x18, 0x05, 0x01, 0x0C, 0x0C, 0x19, 0x15, 0x02, 0xED, 0x02, 0x15, 0x15, 0x04, 0x10, 0x83, 0x69,
+    0x65, 0x64, 0x00, 0x43, 0x44, 0x07, 0x48, 0x0E, 0x51, 0x13, 0x10, 0x82, 0x72, 0x6B, 0x65, 0x64,
+    0x00, 0x08, 0x16, 0x02, 0xDE, 0x72, 0x0C, 0x15, 0x0B, 0x16, 0x84, 0x75, 0x6E, 0x6B, 0x00, 0x46,
+    0x45, 0x0D, 0x4C, 0x16, 0x4F, 0x28, 0x52, 0x4A, 0x53, 0x51, 0x58, 0x5B, 0x04, 0x0F, 0x82, 0x65,
+    0x6C, 0x6C, 0x65, 0x64, 0x00, 0x42, 0x49, 0x05, 0x4F, 0x0A, 0x0F, 0x18, 0x09, 0x01, 0x40, 0x1B,
+    0x08, 0x84, 0x69, 0x6C, 0x65, 0x64, 0x00, 0x43, 0x48, 0x07, 0x4C, 0x12, 0x58, 0x18, 0x1D, 0x08,
+    0x05, 0x10, 0x08, 0x84, 0x7A, 0x6C, 0x65, 0x64, 0x00, 0x04, 0x17, 0x08, 0x02, 0x82, 0x02, 0x11,
+    0x04, 0x84, 0x6E, 0x75, 0x6C, 0x6C, 0x65, 0x64, 0x00, 0x15, 0x17, 0x11, 0x12, 0x06, 0x01, 0x0F,
+    0x0C, 0x17, 0x0F, 0x18, 0x10, 0x81, 0x69, 0x65, 0x64, 0x00, 0x11, 0x11, 0x04, 0x81, 0x6C, 0x65,
+    0x64, 0x00, 0x44, 0x44, 0x09, 0x50, 0x24, 0x52, 0x2E, 0x55, 0x35, 0x0F, 0x42, 0x46, 0x05, 0x49,
+    0x0E, 0x12, 0x15, 0x13, 0x82, 0x69, 0x6D, 0x65, 0x64, 0x00, 0x11, 0x08, 0x87, 0x69, 0x6E, 0x66,
+    0x6C, 0x61, 0x6D, 0x65, 0x64, 0x00, 0x08, 0x07, 0x11, 0x12, 0x06, 0x82, 0x6E, 0x65, 0x64, 0x00,
+    0x09, 0x82, 0x72, 0x6D, 0x65, 0x64, 0x00, 0x12, 0x09, 0x08, 0x13, 0x85, 0x72, 0x66, 0x6F, 0x72,
+    0x6D, 0x65, 0x64, 0x00, 0x48, 0x44, 0x11, 0x48, 0x18, 0x4A, 0x38, 0x4C, 0x44, 0x50, 0x7C, 0x51,
+    0x88, 0x52, 0xA5, 0x57, 0xFA, 0x0F, 0x13, 0x81, 0x6E, 0x65, 0x64, 0x00, 0x17, 0x43, 0x8A, 0x0A,
+    0x00, 0x96, 0x16, 0x00, 0x97, 0x51, 0x01, 0x11, 0x08, 0x15, 0x17, 0x16, 0x83, 0x68, 0x65, 0x6E,
+    0x65, 0x64, 0x00, 0x15, 0x12, 0x1A, 0x84, 0x65, 0x6E, 0x65, 0x64, 0x00, 0x0C, 0x16, 0x16, 0x08,
+    0x07, 0x85, 0x69, 0x67, 0x6E, 0x65, 0x64, 0x00, 0x44, 0x44, 0x09, 0x4A, 0x17, 0x4F, 0x21, 0x57,
+    0x30, 0x17, 0x11, 0x04, 0x10, 0x86, 0x69, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x65, 0x64, 0x00, 0x16,
+    0x08, 0x07, 0x84, 0x69, 0x67, 0x6E, 0x65, 0x64, 0x00, 0x13, 0x0C, 0x16, 0x0C, 0x07, 0x86, 0x63,
+    0x69, 0x70, 0x6C, 0x69, 0x6E, 0x65, 0x64, 0x00, 0x11, 0x12, 0x06, 0x81, 0x75, 0x65, 0x64, 0x00,
+    0x04, 0x07, 0x11, 0x12, 0x06, 0x84, 0x65, 0x6D, 0x6E, 0x65, 0x64, 0x00, 0x42, 0x48, 0x05, 0x52,
+    0x0A, 0x13, 0x13, 0x04, 0x01, 0x94, 0x42, 0x47, 0x05, 0x56, 0x0B, 0x11, 0x04, 0x05, 0x02, 0x74,
+    0x02, 0x0C, 0x15, 0x13, 0x10, 0x0C, 0x02, 0x5F, 0x07, 0x42, 0x4C, 0x05, 0x56, 0x44, 0x42, 0x55,
+    0x05, 0x57, 0x0F, 0x13, 0x10, 0x0C, 0x83, 0x73, 0x6F, 0x6E, 0x65, 0x64, 0x00, 0x42, 0x50, 0x05,
+    0x51, 0x15, 0x08, 0x10, 0x08, 0x15, 0x12, 0x09, 0x04, 0x86, 0x6E, 0x74, 0x69, 0x6F, 0x6E, 0x65,
+    0x64, 0x00, 0x42, 0x44, 0x05, 0x4C, 0x0F, 0x16, 0x85, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x65, 0x64,
+    0x00, 0x04, 0x10, 0x88, 0x65, 0x6E, 0x74, 0x69, 0x6F, 0x6E, 0x65, 0x64, 0x00, 0x0C, 0x15, 0x13,
+    0x10, 0x08, 0x89, 0x69, 0x6D, 0x70, 0x72, 0x69, 0x73, 0x6F, 0x6E, 0x65, 0x64, 0x00, 0x0C, 0x16,
+    0x08, 0x07, 0x84, 0x74, 0x69, 0x6E, 0x65, 0x64, 0x00, 0x13, 0x13, 0x18, 0x16, 0x02, 0x98, 0x01,
+    0x43, 0x4C, 0x07, 0x53, 0x16, 0x58, 0x1C, 0x42, 0x4B, 0x05, 0x58, 0x08, 0x16, 0x01, 0x04, 0x14,
+    0x08, 0x81, 0x70, 0x65, 0x64, 0x00, 0x0F, 0x08, 0x0B, 0x02, 0xDC, 0x06, 0x15, 0x15, 0x08, 0x17,
+    0x11, 0x0C, 0x11, 0x18, 0x02, 0xAE, 0x04, 0x4A, 0x84, 0x1F, 0x00, 0x88, 0x3D, 0x00, 0x89, 0xB9,
+    0x00, 0x8A, 0xBD, 0x00, 0x8C, 0xC1, 0x00, 0x92, 0xCE, 0x00, 0x95, 0xDA, 0x00, 0x97, 0xF9, 0x00,
+    0x98, 0x01, 0x01, 0x9C, 0x28, 0x01, 0x42, 0x48, 0x05, 0x5A, 0x18, 0x42, 0x8B, 0x4F, 0x0F, 0x93,
+    0x07, 0x00, 0x04, 0x16, 0x0C, 0x07, 0x84, 0x70, 0x65, 0x61, 0x72, 0x65, 0x64, 0x00, 0x04, 0x81,
+    0x64, 0x65, 0x64, 0x00, 0x46, 0x48, 0x0D, 0x49, 0x1B, 0x4C, 0x38, 0x56, 0x45, 0x57, 0x50, 0x58,
+    0x71, 0x11, 0x12, 0x11, 0x0C, 0x13, 0x87, 0x6F, 0x6E, 0x65, 0x65, 0x72, 0x65, 0x64, 0x00, 0x44,
+    0x48, 0x09, 0x49, 0x0D, 0x51, 0x3C, 0x56, 0x16, 0x15, 0x02, 0xFF, 0x05, 0x08, 0x15, 0x84, 0x65,
+    0x72, 0x72, 0x65, 0x64, 0x00, 0x11, 0x04, 0x15, 0x17, 0x02, 0xEF, 0x05, 0x07, 0x16, 0x11, 0x12,
+    0x06, 0x85, 0x69, 0x64, 0x65, 0x72, 0x65, 0x64, 0x00, 0x1A, 0x11, 0x04, 0x85, 0x73, 0x77, 0x65,
+    0x72, 0x65, 0x64, 0x00, 0x43, 0x51, 0x07, 0x56, 0x0B, 0x5B, 0x19, 0x0C, 0x02, 0xCC, 0x05, 0x11,
+    0x0C, 0x10, 0x07, 0x04, 0x85, 0x69, 0x73, 0x74, 0x65, 0x72, 0x65, 0x64, 0x00, 0x08, 0x84, 0x65,
+    0x72, 0x74, 0x65, 0x64, 0x00, 0x0A, 0x0C, 0x15, 0x17, 0x84, 0x67, 0x65, 0x72, 0x65, 0x64, 0x00,
+    0x09, 0x12, 0x01, 0x67, 0x04, 0x02, 0xA7, 0x79, 0x18, 0x14, 0x06, 0x08, 0x15, 0x86, 0x71, 0x75,
+    0x69, 0x72, 0x65, 0x64, 0x00, 0x1D, 0x11, 0x12, 0x13, 0x16, 0x84, 0x73, 0x6F, 0x72, 0x65, 0x64,
+    0x00, 0x43, 0x44, 0x07, 0x48, 0x11, 0x52, 0x18, 0x08, 0x13, 0x13, 0x04, 0x16, 0x0C, 0x07, 0x02,
+    0xE6, 0x05, 0x09, 0x09, 0x18, 0x16, 0x02, 0xDF, 0x05, 0x15, 0x15, 0x0C, 0x10, 0x02, 0xD8, 0x05,
+    0x18, 0x05, 0x0C, 0x15, 0x17, 0x17, 0x01, 0xDC, 0x43, 0x46, 0x07, 0x4A, 0x0C, 0x54, 0x13, 0x06,
+    0x12, 0x02, 0x57, 0x05, 0x04, 0x08, 0x0F, 0x08, 0x05, 0x01, 0x10, 0x42, 0x48, 0x05, 0x51, 0x0C,
+    0x15, 0x82, 0x69, 0x72, 0x65, 0x64, 0x00, 0x12, 0x06, 0x82, 0x65, 0x72, 0x65, 0x64, 0x00, 0x17,
+    0x15, 0x15, 0x04, 0x10, 0x85, 0x74, 0x79, 0x72, 0x65, 0x64, 0x00, 0x47, 0x44, 0x0F, 0x48, 0x27,
+    0x4C, 0x3F, 0x51, 0x56, 0x55, 0x68, 0x56, 0x71, 0x58, 0xAB, 0x43, 0x48, 0x07, 0x53, 0x2B, 0x55,
+    0x14, 0x15, 0x0F, 0x06, 0x11, 0x0C, 0x86, 0x72, 0x65, 0x61, 0x73, 0x65, 0x64, 0x00, 0x04, 0x0B,
+    0x01, 0x15, 0x42, 0x49, 0x05, 0x55, 0x10, 0x09, 0x12, 0x15, 0x13, 0x84, 0x65, 0x73, 0x73, 0x65,
+    0x64, 0x00, 0x07, 0x07, 0x04, 0x81, 0x73, 0x65, 0x64, 0x00, 0x42, 0x44, 0x05, 0x55, 0x10, 0x0B,
+    0x13, 0x10, 0x08, 0x83, 0x73, 0x69, 0x73, 0x65, 0x64, 0x00, 0x83, 0x61, 0x69, 0x73, 0x65, 0x64,
+    0x00, 0x42, 0x52, 0x05, 0x58, 0x0C, 0x06, 0x16, 0x11, 0x08, 0x02, 0xAF, 0x03, 0x82, 0x75, 0x73,
+    0x65, 0x64, 0x00, 0x08, 0x19, 0x0C, 0x07, 0x82, 0x67, 0x65, 0x64, 0x00, 0x43, 0x48, 0x07, 0x52,
+    0x2E, 0x58, 0x34, 0x43, 0x4A, 0x07, 0x55, 0x12, 0x56, 0x1D, 0x12, 0x15, 0x13, 0x84, 0x72, 0x65,
+    0x73, 0x73, 0x65, 0x64, 0x00, 0x1B, 0x08, 0x85, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x00,
+    0x16, 0x05, 0x12, 0x85, 0x65, 0x73, 0x73, 0x65, 0x64, 0x00, 0x13, 0x13, 0x12, 0x02, 0xF8, 0x04,
+    0x06, 0x06, 0x04, 0x02, 0xF2, 0x04, 0x42, 0x46, 0x05, 0x50, 0x14, 0x42, 0x44, 0x05, 0x46, 0x0C,
+    0x83, 0x63, 0x75, 0x73, 0x65, 0x64, 0x00, 0x06, 0x01, 0x03, 0x10, 0x04, 0x84, 0x75, 0x73, 0x65,
+    0x64, 0x00, 0x4D, 0x84, 0x28, 0x00, 0x86, 0x10, 0x02, 0x88, 0x5A, 0x02, 0x89, 0x72, 0x02, 0x8C,
+    0x77, 0x02, 0x8F, 0xB5, 0x02, 0x90, 0xC0, 0x02, 0x91, 0xCB, 0x02, 0x93, 0x81, 0x03, 0x95, 0x8C,
+    0x03, 0x96, 0x99, 0x03, 0x97, 0xDF, 0x03, 0x98, 0x24, 0x04, 0x49, 0x86, 0x1C, 0x00, 0x87, 0x51,
+    0x00, 0x8C, 0x63, 0x00, 0x8F, 0xC1, 0x00, 0x90, 0xE3, 0x00, 0x91, 0x10, 0x01, 0x95, 0x34, 0x01,
+    0x97, 0xBE, 0x01, 0x98, 0xD8, 0x01, 0x0C, 0x43, 0x4B, 0x07, 0x56, 0x14, 0x57, 0x20, 0x13, 0x12,
+    0x16, 0x84, 0x73, 0x74, 0x69, 0x63, 0x61, 0x74, 0x65, 0x64, 0x00, 0x16, 0x08, 0x07, 0x86, 0x69,
+    0x63, 0x63, 0x61, 0x74, 0x65, 0x64, 0x00, 0x16, 0x0C, 0x0B, 0x13, 0x18, 0x16, 0x8B, 0x6F, 0x70,
+    0x68, 0x69, 0x73, 0x74, 0x69, 0x63, 0x61, 0x74, 0x65, 0x64, 0x00, 0x0C, 0x13, 0x04, 0x0F, 0x08,
+    0x07, 0x89, 0x69, 0x6C, 0x61, 0x70, 0x69, 0x64, 0x61, 0x74, 0x65, 0x64, 0x00, 0x45, 0x46, 0x0B,
+    0x4F, 0x2C, 0x53, 0x31, 0x55, 0x3E, 0x59, 0x4D, 0x42, 0x51, 0x05, 0x52, 0x15, 0x04, 0x17, 0x16,
+    0x05, 0x18, 0x16, 0x11, 0x18, 0x85, 0x74, 0x69, 0x61, 0x74, 0x65, 0x64, 0x00, 0x16, 0x04, 0x86,
+    0x73, 0x6F, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x00, 0x0C, 0x17, 0x18, 0x01, 0x2B, 0x12, 0x15,
+    0x13, 0x1B, 0x08, 0x84, 0x72, 0x69, 0x61, 0x74, 0x65, 0x64, 0x00, 0x12, 0x08, 0x17, 0x08, 0x07,
+    0x86, 0x72, 0x69, 0x6F, 0x72, 0x61, 0x74, 0x65, 0x64, 0x00, 0x0C, 0x42, 0x55, 0x05, 0x57, 0x0B,
+    0x08, 0x07, 0x84, 0x65, 0x64, 0x00, 0x12, 0x10, 0x02, 0x0A, 0x01, 0x42, 0x48, 0x05, 0x58, 0x13,
+    0x15, 0x08, 0x17, 0x11, 0x0C, 0x85, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x65, 0x64, 0x00, 0x06, 0x12,
+    0x11, 0x11, 0x0C, 0x88, 0x6F, 0x63, 0x75, 0x6C, 0x61, 0x74, 0x65, 0x64, 0x00, 0x42, 0x52, 0x05,
+    0x57, 0x21, 0x42, 0x4A, 0x05, 0x55, 0x11, 0x0F, 0x04, 0x10, 0x04, 0x85, 0x61, 0x6D, 0x61, 0x74,
+    0x65, 0x64, 0x00, 0x18, 0x04, 0x86, 0x74, 0x6F, 0x6D, 0x61, 0x74, 0x65, 0x64, 0x00, 0x0C, 0x16,
+    0x08, 0x86, 0x74, 0x69, 0x6D, 0x61, 0x74, 0x65, 0x64, 0x00, 0x42, 0x4C, 0x05, 0x5A, 0x1D, 0x42,
+    0x46, 0x05, 0x50, 0x11, 0x04, 0x09, 0x86, 0x73, 0x63, 0x69, 0x6E, 0x61, 0x74, 0x65, 0x64, 0x00,
+    0x04, 0x1B, 0x08, 0x83, 0x65, 0x64, 0x00, 0x84, 0x61, 0x6E, 0x74, 0x65, 0x64, 0x00, 0x44, 0x4A,
+    0x09, 0x4C, 0x4A, 0x52, 0x58, 0x58, 0x7C, 0x43, 0x48, 0x07, 0x4C, 0x1B, 0x55, 0x35, 0x17, 0x11,
+    0x0C, 0x16, 0x08, 0x07, 0x8B, 0x69, 0x73, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x72, 0x61, 0x74, 0x65,
+    0x64, 0x00, 0x10, 0x42, 0x4C, 0x05, 0x50, 0x0F, 0x86, 0x6D, 0x69, 0x67, 0x72, 0x61, 0x74, 0x65,
+    0x64, 0x00, 0x08, 0x87, 0x69, 0x67, 0x72, 0x61, 0x74, 0x65, 0x64, 0x00, 0x08, 0x17, 0x11, 0x0C,
+    0x86, 0x67, 0x72, 0x61, 0x74, 0x65, 0x64, 0x00, 0x06, 0x15, 0x04, 0x06, 0x11, 0x0C, 0x85, 0x65,
+    0x72, 0x61, 0x74, 0x65, 0x64, 0x00, 0x42, 0x50, 0x05, 0x53, 0x15, 0x08, 0x10, 0x10, 0x10, 0x12,
+    0x06, 0x88, 0x65, 0x6D, 0x6F, 0x72, 0x61, 0x74, 0x65, 0x64, 0x00, 0x12, 0x15, 0x12, 0x06, 0x11,
+    0x0C, 0x87, 0x70, 0x6F, 0x72, 0x61, 0x74, 0x65, 0x64, 0x00, 0x0A, 0x04, 0x11, 0x0C, 0x86, 0x75,
+    0x67, 0x75, 0x72, 0x61, 0x74, 0x65, 0x64, 0x00, 0x0C, 0x42, 0x4F, 0x05, 0x55, 0x0F, 0x04, 0x17,
+    0x08, 0x15, 0x84, 0x61, 0x74, 0x65, 0x64, 0x00, 0x0C, 0x85, 0x72, 0x69, 0x74, 0x61, 0x74, 0x65,
+    0x64, 0x00, 0x0F, 0x04, 0x19, 0x08, 0x15, 0x87, 0x65, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65,
+    0x64, 0x00, 0x43, 0x48, 0x07, 0x4C, 0x2D, 0x58, 0x39, 0x42, 0x4F, 0x05, 0x51, 0x1C, 0x42, 0x48,
+    0x05, 0x4F, 0x0F, 0x15, 0x85, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x00, 0x08, 0x85, 0x65,
+    0x63, 0x74, 0x65, 0x64, 0x00, 0x12, 0x06, 0x84, 0x6E, 0x65, 0x63, 0x74, 0x65, 0x64, 0x00, 0x17,
+    0x16, 0x08, 0x15, 0x84, 0x72, 0x69, 0x63, 0x74, 0x65, 0x64, 0x00, 0x15, 0x17, 0x11, 0x12, 0x06,
+    0x08, 0x15, 0x86, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x65, 0x64, 0x00, 0x42, 0x44, 0x05, 0x4C,
+    0x0D, 0x08, 0x15, 0x06, 0x83, 0x74, 0x65, 0x64, 0x00, 0x06, 0x11, 0x12, 0x06, 0x84, 0x65, 0x69,
+    0x74, 0x65, 0x64, 0x00, 0x08, 0x0F, 0x02, 0xD7, 0x94, 0x44, 0x45, 0x09, 0x50, 0x18, 0x56, 0x2D,
+    0x58, 0x36, 0x04, 0x0B, 0x0C, 0x11, 0x18, 0x86, 0x6E, 0x68, 0x61, 0x62, 0x69, 0x74, 0x65, 0x64,
+    0x00, 0x44, 0x47, 0x20, 0x48, 0x21, 0x50, 0x09, 0x52, 0x21, 0x42, 0x48, 0x05, 0x52, 0x05, 0x84,
+    0x69, 0x74, 0x74, 0x65, 0x64, 0x00, 0x12, 0x0B, 0x84, 0x69, 0x73, 0x74, 0x65, 0x64, 0x00, 0x14,
+    0x06, 0x04, 0x81, 0x74, 0x65, 0x64, 0x00, 0x04, 0x0B, 0x1B, 0x08, 0x85, 0x61, 0x6C, 0x74, 0x65,
+    0x64, 0x00, 0x13, 0x12, 0x15, 0x13, 0x84, 0x6D, 0x70, 0x74, 0x65, 0x64, 0x00, 0x43, 0x44, 0x07,
+    0x48, 0x16, 0x4C, 0x81, 0x0F, 0x13, 0x15, 0x18, 0x16, 0x87, 0x70, 0x70, 0x6C, 0x61, 0x6E, 0x74,
+    0x65, 0x64, 0x00, 0x45, 0x47, 0x0B, 0x4C, 0x1B, 0x50, 0x2C, 0x57, 0x4E, 0x58, 0x62, 0x11, 0x08,
+    0x06, 0x08, 0x15, 0x13, 0x11, 0x18, 0x86, 0x64, 0x65, 0x6E, 0x74, 0x65, 0x64, 0x00, 0x15, 0x12,
+    0x16, 0x08, 0x07, 0x89, 0x69, 0x73, 0x6F, 0x72, 0x69, 0x65, 0x6E, 0x74, 0x65, 0x64, 0x00, 0x42,
+    0x44, 0x05, 0x4C, 0x13, 0x0F, 0x13, 0x13, 0x18, 0x16, 0x86, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x65,
+    0x64, 0x00, 0x0F, 0x13, 0x18, 0x16, 0x87, 0x70, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x65, 0x64,
+    0x00, 0x42, 0x51, 0x05, 0x57, 0x0B, 0x0C, 0x82, 0x64, 0x65, 0x64, 0x00, 0x04, 0x13, 0x85, 0x65,
+    0x6E, 0x74, 0x65, 0x64, 0x00, 0x0F, 0x09, 0x11, 0x0C, 0x82, 0x63, 0x65, 0x64, 0x00, 0x42, 0x44,
+    0x05, 0x52, 0x23, 0x18, 0x14, 0x42, 0x44, 0x05, 0x46, 0x10, 0x87, 0x63, 0x71, 0x75, 0x61, 0x69,
+    0x6E, 0x74, 0x65, 0x64, 0x00, 0x06, 0x04, 0x88, 0x71, 0x75, 0x61, 0x69, 0x6E, 0x74, 0x65, 0x64,
+    0x00, 0x13, 0x13, 0x04, 0x16, 0x16, 0x0C, 0x07, 0x89, 0x61, 0x70, 0x70, 0x6F, 0x69, 0x6E, 0x74,
+    0x65, 0x64, 0x00, 0x08, 0x06, 0x15, 0x08, 0x13, 0x83, 0x69, 0x76, 0x65, 0x64, 0x00, 0x08, 0x19,
+    0x12, 0x06, 0x85, 0x6E, 0x76, 0x65, 0x72, 0x74, 0x65, 0x64, 0x00, 0x44, 0x44, 0x09, 0x48, 0x21,
+    0x4C, 0x2D, 0x58, 0x37, 0x42, 0x46, 0x05, 0x59, 0x10, 0x04, 0x12, 0x15, 0x05, 0x85, 0x64, 0x63,
+    0x61, 0x73, 0x74, 0x00, 0x08, 0x07, 0x81, 0x61, 0x74, 0x65, 0x64, 0x00, 0x15, 0x08, 0x86, 0x61,
+    0x72, 0x72, 0x65, 0x73, 0x74, 0x65, 0x64, 0x00, 0x06, 0x1B, 0x08, 0x85, 0x69, 0x73, 0x74, 0x65,
+    0x64, 0x00, 0x15, 0x17, 0x11, 0x0C, 0x88, 0x65, 0x6E, 0x74, 0x72, 0x75, 0x73, 0x74, 0x65, 0x64,
+    0x00, 0x43, 0x48, 0x07, 0x4C, 0x0D, 0x52, 0x32, 0x0A, 0x15, 0x04, 0x17, 0x01, 0xE9, 0x10, 0x43,
+    0x50, 0x07, 0x51, 0x0F, 0x52, 0x1B, 0x08, 0x85, 0x69, 0x74, 0x74, 0x65, 0x64, 0x00, 0x15, 0x12,
+    0x06, 0x87, 0x6D, 0x6D, 0x69, 0x74, 0x74, 0x65, 0x64, 0x00, 0x06, 0x84, 0x6D, 0x69, 0x74, 0x74,
+    0x65, 0x64, 0x00, 0x42, 0x4F, 0x05, 0x50, 0x0E, 0x04, 0x84, 0x6C, 0x6F, 0x74, 0x74, 0x65, 0x64,
+    0x00, 0x12, 0x15, 0x13, 0x01, 0xB1, 0x42, 0x45, 0x05, 0x57, 0x15, 0x0C, 0x15, 0x17, 0x0C, 0x07,
+    0x87, 0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x64, 0x00, 0x0C, 0x16, 0x11, 0x12, 0x06,
+    0x85, 0x74, 0x69, 0x74, 0x75, 0x74, 0x65, 0x64, 0x00, 0x42, 0x47, 0x05, 0x57, 0x0F, 0x12, 0x15,
+    0x17, 0x11, 0x0C, 0x81, 0x63, 0x65, 0x64, 0x00, 0x42, 0x46, 0x05, 0x53, 0x0E, 0x08, 0x1B, 0x08,
+    0x83, 0x75, 0x74, 0x65, 0x64, 0x00, 0x04, 0x06, 0x81, 0x72, 0x65, 0x64, 0x00, 0x43, 0x48, 0x07,
+    0x4C, 0x28, 0x4F, 0x4B, 0x0C, 0x43, 0x46, 0x07, 0x4F, 0x10, 0x55, 0x15, 0x08, 0x07, 0x84, 0x65,
+    0x69, 0x76, 0x65, 0x64, 0x00, 0x83, 0x76, 0x65, 0x64, 0x00, 0x0A, 0x04, 0x85, 0x67, 0x72, 0x69,
+    0x65, 0x76, 0x65, 0x64, 0x00, 0x43, 0x46, 0x07, 0x51, 0x10, 0x55, 0x19, 0x08, 0x15, 0x83, 0x65,
+    0x69, 0x76, 0x65, 0x64, 0x00, 0x12, 0x06, 0x83, 0x6E, 0x69, 0x76, 0x65, 0x64, 0x00, 0x0C, 0x07,
+    0x85, 0x65, 0x72, 0x69, 0x76, 0x65, 0x64, 0x00, 0x12, 0x16, 0x0C, 0x07, 0x84, 0x73, 0x6F, 0x6C,
+    0x76, 0x65, 0x64, 0x00, 0x42, 0x52, 0x05, 0x5A, 0x0E, 0x0F, 0x04, 0x83, 0x6C, 0x6F, 0x77, 0x65,
+    0x64, 0x00, 0x04, 0x11, 0x0A, 0x82, 0x65, 0x64, 0x00, 0x43, 0x44, 0x07, 0x51, 0x39, 0x53, 0x42,
+    0x44, 0x4F, 0x09, 0x53, 0x09, 0x55, 0x0D, 0x57, 0x28, 0x82, 0x69, 0x64, 0x00, 0x17, 0x12, 0x42,
+    0x53, 0x05, 0x55, 0x0E, 0x85, 0x72, 0x74, 0x72, 0x61, 0x79, 0x65, 0x64, 0x00, 0x13, 0x87, 0x6F,
+    0x72, 0x74, 0x72, 0x61, 0x79, 0x65, 0x64, 0x00, 0x15, 0x12, 0x13, 0x83, 0x72, 0x61, 0x79, 0x65,
+    0x64, 0x00, 0x04, 0x13, 0x10, 0x12, 0x06, 0x06, 0x04, 0x01, 0x03, 0x16, 0x82, 0x69, 0x65, 0x64,
+    0x00, 0x0C, 0x44, 0x4F, 0x09, 0x51, 0x3E, 0x55, 0x5A, 0x57, 0xA4, 0x43, 0x44, 0x07, 0x45, 0x1F,
+    0x48, 0x2C, 0x11, 0x12, 0x0C, 0x17, 0x18, 0x17, 0x16, 0x11, 0x0C, 0x8A, 0x69, 0x74, 0x75, 0x74,
+    0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x69, 0x7A, 0x65, 0x64, 0x00, 0x04, 0x17, 0x16, 0x08, 0x07, 0x84,
+    0x69, 0x6C, 0x69, 0x7A, 0x65, 0x64, 0x00, 0x15, 0x84, 0x61, 0x6C, 0x69, 0x7A, 0x65, 0x64, 0x00,
+    0x42, 0x4C, 0x05, 0x52, 0x11, 0x19, 0x0F, 0x04, 0x0A, 0x85, 0x61, 0x6E, 0x69, 0x7A, 0x65, 0x64,
+    0x00, 0x06, 0x08, 0x15, 0x84, 0x67, 0x6E, 0x69, 0x7A, 0x65, 0x64, 0x00, 0x43, 0x44, 0x07, 0x48,
+    0x15, 0x52, 0x3B, 0x17, 0x18, 0x13, 0x10, 0x12, 0x06, 0x85, 0x65, 0x72, 0x69, 0x7A, 0x65, 0x64,
+    0x00, 0x17, 0x42, 0x44, 0x05, 0x46, 0x13, 0x15, 0x04, 0x0B, 0x06, 0x86, 0x63, 0x74, 0x65, 0x72,
+    0x69, 0x7A, 0x65, 0x64, 0x00, 0x04, 0x15, 0x04, 0x06, 0x8A, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74,
+    0x65, 0x72, 0x69, 0x7A, 0x65, 0x64, 0x00, 0x0A, 0x04, 0x17, 0x04, 0x06, 0x87, 0x65, 0x67, 0x6F,
+    0x72, 0x69, 0x7A, 0x65, 0x64, 0x00, 0x0C, 0x15, 0x06, 0x82, 0x63, 0x69, 0x7A, 0x65, 0x64, 0x00,
+    0x44, 0x44, 0x09, 0x52, 0x11, 0x53, 0x1D, 0x55, 0x25, 0x15, 0x1C, 0x10, 0x82, 0x69, 0x61, 0x64,
+    0x00, 0x11, 0x0C, 0x10, 0x18, 0x0B, 0x84, 0x61, 0x6E, 0x6F, 0x69, 0x64, 0x00, 0x08, 0x15, 0x83,
+    0x61, 0x70, 0x69, 0x64, 0x00, 0x0B, 0x17, 0x82, 0x69, 0x72, 0x64, 0x00, 0x08, 0x42, 0x4C, 0x05,
+    0x4F, 0x08, 0x0F, 0x01, 0x04, 0x04, 0x17, 0x82, 0x6B, 0x65, 0x64, 0x00, 0x44, 0x48, 0x09, 0x4C,
+    0x1C, 0x52, 0x2B, 0x58, 0x43, 0x42, 0x4B, 0x05, 0x50, 0x0E, 0x17, 0x0C, 0x1A, 0x82, 0x68, 0x65,
+    0x6C, 0x64, 0x00, 0x04, 0x11, 0x02, 0x46, 0x72, 0x08, 0x43, 0x4B, 0x07, 0x5A, 0x08, 0x5C, 0x08,
+    0x16, 0x83, 0x69, 0x65, 0x6C, 0x64, 0x00, 0x0B, 0x42, 0x4B, 0x05, 0x57, 0x0F, 0x16, 0x08, 0x15,
+    0x0B, 0x17, 0x83, 0x6F, 0x6C, 0x64, 0x00, 0x0C, 0x1A, 0x82, 0x68, 0x6F, 0x6C, 0x64, 0x00, 0x12,
+    0x16, 0x84, 0x63, 0x6F, 0x75, 0x6C, 0x64, 0x00, 0x46, 0x44, 0x0D, 0x48, 0x1B, 0x4C, 0x62, 0x52,
+    0x6B, 0x55, 0x7A, 0x58, 0x81, 0x0F, 0x18, 0x09, 0x08, 0x06, 0x04, 0x08, 0x13, 0x82, 0x20, 0x61,
+    0x6E, 0x64, 0x00, 0x43, 0x50, 0x07, 0x53, 0x39, 0x57, 0x3F, 0x42, 0x50, 0x05, 0x52, 0x1B, 0x42,
+    0x44, 0x05, 0x52, 0x0A, 0x83, 0x65, 0x6E, 0x64, 0x00, 0x06, 0x06, 0x08, 0x15, 0x86, 0x6F, 0x6D,
+    0x6D, 0x65, 0x6E, 0x64, 0x00, 0x06, 0x42, 0x46, 0x05, 0x48, 0x0F, 0x08, 0x15, 0x85, 0x6F, 0x6D,
+    0x6D, 0x65, 0x6E, 0x64, 0x00, 0x15, 0x82, 0x6D, 0x65, 0x6E, 0x64, 0x00, 0x13, 0x04, 0x0B, 0x02,
+    0xBD, 0x71, 0x04, 0x08, 0x15, 0x0B, 0x17, 0x02, 0xB5, 0x71, 0x08, 0x15, 0x09, 0x83, 0x69, 0x65,
+    0x6E, 0x64, 0x00, 0x13, 0x16, 0x0C, 0x15, 0x15, 0x12, 0x06, 0x85, 0x65, 0x73, 0x70, 0x6F, 0x6E,
+    0x64, 0x00, 0x18, 0x17, 0x08, 0x15, 0x02, 0x96, 0x71, 0x42, 0x52, 0x05, 0x55, 0x2B, 0x15, 0x43,
+    0x4A, 0x07, 0x55, 0x16, 0x58, 0x1D, 0x08, 0x15, 0x07, 0x11, 0x18, 0x87, 0x65, 0x72, 0x67, 0x72,
+    0x6F, 0x75, 0x6E, 0x64, 0x00, 0x04, 0x84, 0x6F, 0x75, 0x6E, 0x64, 0x00, 0x16, 0x83, 0x72, 0x6F,
+    0x75, 0x6E, 0x64, 0x00, 0x04, 0x82, 0x6F, 0x75, 0x6E, 0x64, 0x00, 0x43, 0x4C, 0x07, 0x52, 0x2A,
+    0x55, 0x5B, 0x42, 0x48, 0x05, 0x55, 0x0E, 0x15, 0x13, 0x84, 0x65, 0x72, 0x69, 0x6F, 0x64, 0x00,
+    0x08, 0x42, 0x55, 0x05, 0x57, 0x0D, 0x13, 0x85, 0x65, 0x72, 0x69, 0x6F, 0x64, 0x00, 0x16, 0x04,
+    0x82, 0x6F, 0x69, 0x64, 0x00, 0x42, 0x4B, 0x05, 0x57, 0x26, 0x42, 0x55, 0x05, 0x5C, 0x15, 0x12,
+    0x05, 0x0A, 0x0C, 0x08, 0x11, 0x86, 0x68, 0x62, 0x6F, 0x72, 0x68, 0x6F, 0x6F, 0x64, 0x00, 0x0F,
+    0x08, 0x0E, 0x0C, 0x0F, 0x84, 0x69, 0x68, 0x6F, 0x6F, 0x64, 0x00, 0x16, 0x08, 0x0C, 0x15, 0x13,
+    0x82, 0x68, 0x6F, 0x6F, 0x64, 0x00, 0x06, 0x08, 0x15, 0x01, 0x18, 0x45, 0x44, 0x0B, 0x48, 0x2D,
+    0x4C, 0x44, 0x52, 0x4E, 0x58, 0x6A, 0x1A, 0x43, 0x48, 0x07, 0x4E, 0x0F, 0x52, 0x19, 0x15, 0x12,
+    0x09, 0x82, 0x6F, 0x72, 0x64, 0x00, 0x06, 0x04, 0x85, 0x77, 0x6B, 0x77, 0x61, 0x72, 0x64, 0x00,
+    0x09, 0x83, 0x72, 0x77, 0x61, 0x72, 0x64, 0x00, 0x43, 0x47, 0x07, 0x4C, 0x0B, 0x58, 0x12, 0x0C,
+    0x16, 0x01, 0x0A, 0x1A, 0x83, 0x65, 0x69, 0x72, 0x64, 0x00, 0x14, 0x11, 0x12, 0x01, 0x36, 0x05,
+    0x07, 0x0F, 0x0C, 0x0B, 0x06, 0x80, 0x74, 0x68, 0x00, 0x43, 0x46, 0x07, 0x49, 0x10, 0x5A, 0x14,
+    0x12, 0x15, 0x84, 0x65, 0x63, 0x6F, 0x72, 0x64, 0x00, 0x09, 0x02, 0x4C, 0x8F, 0x1C, 0x04, 0x1A,
+    0x82, 0x61, 0x72, 0x64, 0x00, 0x42, 0x44, 0x05, 0x57, 0x0C, 0x0A, 0x83, 0x75, 0x61, 0x72, 0x64,
+    0x00, 0x13, 0x04, 0x06, 0x02, 0x88, 0x70, 0x12, 0x15, 0x04, 0x80, 0x6E, 0x64, 0x00, 0x04, 0x08,
+    0x15, 0x0F, 0x04, 0x81, 0x64, 0x79, 0x00, 0x55, 0x84, 0x40, 0x00, 0x85, 0x54, 0x00, 0x86, 0xA9,
+    0x00, 0x87, 0xAD, 0x05, 0x88, 0x8A, 0x06, 0x8A, 0xF7, 0x06, 0x8B, 0xBD, 0x08, 0x8C, 0xDF, 0x08,
+    0x8E, 0x0D, 0x09, 0x8F, 0x1F, 0x09, 0x90, 0x57, 0x0E, 0x91, 0xB3, 0x0E, 0x92, 0xF1, 0x0F, 0x93,
+    0x0E, 0x10, 0x95, 0x42, 0x10, 0x96, 0x65, 0x12, 0x97, 0xED, 0x13, 0x98, 0xF2, 0x18, 0x99, 0x3C,
+    0x19, 0x9C, 0xDB, 0x1B, 0x9D, 0xE3, 0x1B, 0x42, 0x50, 0x05, 0x59, 0x0C, 0x04, 0x06, 0x08, 0x05,
+    0x02, 0x32, 0x67, 0x04, 0x0F, 0x82, 0x72, 0x76, 0x61, 0x65, 0x00, 0x45, 0x44, 0x0B, 0x4C, 0x11,
+    0x4F, 0x2C, 0x52, 0x32, 0x58, 0x4B, 0x0F, 0x0C, 0x04, 0x19, 0x01, 0xE9, 0x15, 0x06, 0x42, 0x48,
+    0x05, 0x56, 0x0E, 0x07, 0x84, 0x73, 0x63, 0x72, 0x69, 0x62, 0x65, 0x00, 0x0C, 0x07, 0x86, 0x65,
+    0x73, 0x63, 0x72, 0x69, 0x62, 0x65, 0x00, 0x18, 0x12, 0x07, 0x02, 0x9D, 0x0D, 0x42, 0x47, 0x05,
+    0x53, 0x0E, 0x15, 0x04, 0x1A, 0x82, 0x72, 0x6F, 0x62, 0x65, 0x00, 0x12, 0x15, 0x07, 0x1C, 0x0B,
+    0x82, 0x68, 0x6F, 0x62, 0x65, 0x00, 0x17, 0x12, 0x1C, 0x83, 0x75, 0x74, 0x75, 0x62, 0x65, 0x00,
+    0x49, 0x84, 0x1C, 0x00, 0x88, 0x3A, 0x00, 0x89, 0x65, 0x00, 0x8C, 0x6D, 0x00, 0x8F, 0xBD, 0x00,
+    0x90, 0xC5, 0x00, 0x91, 0xCE, 0x00, 0x97, 0xDD, 0x04, 0x98, 0xE7, 0x04, 0x42, 0x52, 0x05, 0x57,
+    0x0C, 0x13, 0x16, 0x83, 0x61, 0x63, 0x65, 0x00, 0x16, 0x42, 0x45, 0x05, 0x4C, 0x09, 0x18, 0x16,
+    0x01, 0x30, 0x10, 0x15, 0x04, 0x82, 0x69, 0x63, 0x65, 0x00, 0x43, 0x47, 0x07, 0x51, 0x10, 0x55,
+    0x22, 0x11, 0x08, 0x13, 0x08, 0x07, 0x11, 0x0C, 0x01, 0x18, 0x42, 0x48, 0x05, 0x4C, 0x0D, 0x15,
+    0x08, 0x09, 0x08, 0x15, 0x02, 0x8F, 0x04, 0x06, 0x16, 0x02, 0x66, 0x04, 0x08, 0x09, 0x08, 0x15,
+    0x81, 0x6E, 0x63, 0x65, 0x00, 0x15, 0x18, 0x16, 0x81, 0x61, 0x63, 0x65, 0x00, 0x45, 0x46, 0x0B,
+    0x48, 0x11, 0x49, 0x1C, 0x57, 0x28, 0x59, 0x3B, 0x08, 0x15, 0x13, 0x02, 0x0F, 0x1B, 0x42, 0x51,
+    0x05, 0x53, 0x05, 0x83, 0x69, 0x65, 0x63, 0x65, 0x00, 0x04, 0x15, 0x06, 0x04, 0x16, 0x84, 0x69,
+    0x66, 0x69, 0x63, 0x65, 0x00, 0x42, 0x44, 0x05, 0x55, 0x0E, 0x15, 0x13, 0x83, 0x63, 0x74, 0x69,
+    0x63, 0x65, 0x00, 0x04, 0x80, 0x6C, 0x65, 0x00, 0x42, 0x48, 0x05, 0x4C, 0x0D, 0x16, 0x83, 0x72,
+    0x76, 0x69, 0x63, 0x65, 0x00, 0x07, 0x84, 0x65, 0x76, 0x69, 0x63, 0x65, 0x00, 0x04, 0x13, 0x83,
+    0x6C, 0x61, 0x63, 0x65, 0x00, 0x08, 0x15, 0x08, 0x09, 0x08, 0x15, 0x02, 0x57, 0x0D, 0x46, 0x84,
+    0x13, 0x00, 0x88, 0xD7, 0x01, 0x8C, 0xD9, 0x03, 0x92, 0xF7, 0x03, 0x95, 0xFE, 0x03, 0x98, 0x08,
+    0x04, 0x4A, 0x87, 0x1F, 0x00, 0x88, 0x33, 0x00, 0x8A, 0x51, 0x00, 0x8C, 0x5B, 0x00, 0x8F, 0x6B,
+    0x00, 0x90, 0xAD, 0x00, 0x91, 0xBA, 0x00, 0x95, 0xD1, 0x00, 0x96, 0x3F, 0x01, 0x97, 0x6F, 0x01,
+    0x11, 0x08, 0x42, 0x46, 0x05, 0x53, 0x0D, 0x16, 0x11, 0x04, 0x15, 0x17, 0x02, 0xB3, 0x03, 0x08,
+    0x07, 0x02, 0xAE, 0x03, 0x15, 0x42, 0x44, 0x05, 0x48, 0x12, 0x08, 0x42, 0x4F, 0x05, 0x53, 0x08,
+    0x06, 0x01, 0x87, 0x13, 0x04, 0x01, 0x83, 0x13, 0x13, 0x04, 0x85, 0x61, 0x72, 0x61, 0x6E, 0x63,
+    0x65, 0x00, 0x11, 0x08, 0x19, 0x83, 0x65, 0x61, 0x6E, 0x63, 0x65, 0x00, 0x42, 0x47, 0x05, 0x55,
+    0x0B, 0x08, 0x05, 0x12, 0x02, 0x7B, 0x03, 0x08, 0x13, 0x02, 0x74, 0x03, 0x44, 0x44, 0x09, 0x45,
+    0x1F, 0x48, 0x2F, 0x4F, 0x3C, 0x42, 0x45, 0x05, 0x59, 0x11, 0x11, 0x0C, 0x87, 0x6D, 0x62, 0x61,
+    0x6C, 0x61, 0x6E, 0x63, 0x65, 0x00, 0x04, 0x80, 0x68, 0x65, 0x00, 0x10, 0x08, 0x16, 0x16, 0x08,
+    0x15, 0x88, 0x65, 0x6D, 0x62, 0x6C, 0x61, 0x6E, 0x63, 0x65, 0x00, 0x05, 0x10, 0x08, 0x16, 0x08,
+    0x15, 0x85, 0x6C, 0x61, 0x6E, 0x63, 0x65, 0x00, 0x04, 0x05, 0x11, 0x18, 0x01, 0x1C, 0x12, 0x09,
+    0x15, 0x08, 0x13, 0x84, 0x72, 0x6D, 0x61, 0x6E, 0x63, 0x65, 0x00, 0x0C, 0x43, 0x84, 0x1F, 0x02,
+    0x89, 0x0A, 0x00, 0x90, 0x12, 0x00, 0x08, 0x07, 0x84, 0x61, 0x6E, 0x63, 0x65, 0x00, 0x12, 0x15,
+    0x01, 0xF1, 0x44, 0x44, 0x09, 0x48, 0x17, 0x55, 0x63, 0x58, 0x6A, 0x08, 0x15, 0x13, 0x13, 0x04,
+    0x87, 0x65, 0x61, 0x72, 0x61, 0x6E, 0x63, 0x65, 0x00, 0x46, 0x85, 0x13, 0x00, 0x87, 0x43, 0x02,
+    0x89, 0x2E, 0x00, 0x8B, 0x34, 0x00, 0x93, 0x39, 0x00, 0x99, 0x43, 0x00, 0x42, 0x50, 0x05, 0x58,
+    0x0C, 0x08, 0x10, 0x08, 0x15, 0x02, 0x2A, 0x02, 0x15, 0x17, 0x12, 0x15, 0x13, 0x88, 0x75, 0x62,
+    0x65, 0x72, 0x61, 0x6E, 0x63, 0x65, 0x00, 0x15, 0x08, 0x17, 0x11, 0x01, 0xA1, 0x07, 0x04, 0x02,
+    0xC0, 0x02, 0x13, 0x04, 0x84, 0x61, 0x72, 0x61, 0x6E, 0x63, 0x65, 0x00, 0x12, 0x0A, 0x83, 0x6E,
+    0x61, 0x6E, 0x63, 0x65, 0x00, 0x18, 0x06, 0x08, 0x15, 0x02, 0xA6, 0x02, 0x06, 0x02, 0x34, 0x02,
+    0x43, 0x4C, 0x07, 0x56, 0x15, 0x58, 0x27, 0x04, 0x11, 0x11, 0x12, 0x06, 0x08, 0x15, 0x83, 0x73,
+    0x61, 0x6E, 0x63, 0x65, 0x00, 0x0C, 0x04, 0x11, 0x12, 0x06, 0x08, 0x15, 0x87, 0x6E, 0x61, 0x69,
+    0x73, 0x73, 0x61, 0x6E, 0x63, 0x65, 0x00, 0x11, 0x84, 0x69, 0x73, 0x61, 0x6E, 0x63, 0x65, 0x00,
+    0x44, 0x44, 0x09, 0x48, 0x12, 0x51, 0x19, 0x56, 0x3F, 0x17, 0x16, 0x11, 0x0C, 0x84, 0x6E, 0x63,
+    0x65, 0x00, 0x13, 0x10, 0x12, 0x06, 0x02, 0x59, 0x02, 0x42, 0x44, 0x05, 0x4C, 0x09, 0x0C, 0x18,
+    0x01, 0x10, 0x04, 0x42, 0x50, 0x05, 0x58, 0x0D, 0x83, 0x65, 0x6E, 0x61, 0x6E, 0x63, 0x65, 0x00,
+    0x14, 0x04, 0x89, 0x63, 0x71, 0x75, 0x61, 0x69, 0x6E, 0x74, 0x61, 0x6E, 0x63, 0x65, 0x00, 0x0C,
+    0x42, 0x96, 0x07, 0x00, 0x9B, 0x2E, 0x02, 0x42, 0x51, 0x05, 0x55, 0x09, 0x0C, 0x02, 0x22, 0x02,
+    0x08, 0x13, 0x02, 0x1D, 0x02, 0x4C, 0x86, 0x25, 0x00, 0x87, 0x31, 0x00, 0x8A, 0x76, 0x00, 0x8C,
+    0x9D, 0x00, 0x8F, 0xD4, 0x00, 0x90, 0x00, 0x01, 0x91, 0x05, 0x01, 0x93, 0x30, 0x01, 0x95, 0x3E,
+    0x01, 0x97, 0xB5, 0x01, 0x98, 0xED, 0x01, 0x99, 0xF8, 0x01, 0x12, 0x11, 0x0C, 0x85, 0x6E, 0x6F,
+    0x63, 0x65, 0x6E, 0x63, 0x65, 0x00, 0x43, 0x48, 0x07, 0x4C, 0x27, 0x51, 0x2C, 0x42, 0x48, 0x05,
+    0x53, 0x0E, 0x15, 0x06, 0x85, 0x64, 0x65, 0x6E, 0x63, 0x65, 0x00, 0x42, 0x88, 0x07, 0x00, 0x90,
+    0x7C, 0x01, 0x07, 0x11, 0x0C, 0x84, 0x6E, 0x64, 0x65, 0x6E, 0x63, 0x65, 0x00, 0x18, 0x0A, 0x02,
+    0xA2, 0x01, 0x08, 0x42, 0x53, 0x05, 0x57, 0x14, 0x0C, 0x07, 0x11, 0x0C, 0x88, 0x65, 0x70, 0x65,
+    0x6E, 0x64, 0x65, 0x6E, 0x63, 0x65, 0x00, 0x17, 0x02, 0x73, 0x01, 0x43, 0x48, 0x07, 0x4C, 0x11,
+    0x51, 0x1F, 0x0F, 0x0F, 0x04, 0x83, 0x69, 0x61, 0x6E, 0x63, 0x65, 0x00, 0x0F, 0x08, 0x17, 0x11,
+    0x0C, 0x85, 0x6C, 0x69, 0x67, 0x65, 0x6E, 0x63, 0x65, 0x00, 0x08, 0x19, 0x82, 0x61, 0x6E, 0x63,
+    0x65, 0x00, 0x43, 0x47, 0x07, 0x4A, 0x19, 0x57, 0x2C, 0x08, 0x05, 0x12, 0x16, 0x16, 0x0C, 0x07,
+    0x89, 0x6F, 0x62, 0x65, 0x64, 0x69, 0x65, 0x6E, 0x63, 0x65, 0x00, 0x08, 0x0F, 0x42, 0x84, 0x07,
+    0x00, 0x8F, 0x2E, 0x01, 0x86, 0x6C, 0x65, 0x67, 0x69, 0x61, 0x6E, 0x63, 0x65, 0x00, 0x0C, 0x04,
+    0x13, 0x86, 0x74, 0x69, 0x65, 0x6E, 0x63, 0x65, 0x00, 0x43, 0x45, 0x07, 0x4C, 0x0C, 0x58, 0x21,
+    0x10, 0x08, 0x02, 0x0D, 0x01, 0x42, 0x48, 0x05, 0x4A, 0x10, 0x19, 0x15, 0x18, 0x16, 0x83, 0x6C,
+    0x61, 0x6E, 0x63, 0x65, 0x00, 0x0C, 0x19, 0x02, 0x0A, 0x01, 0x09, 0x09, 0x08, 0x85, 0x6C, 0x75,
+    0x65, 0x6E, 0x63, 0x65, 0x00, 0x15, 0x12, 0x09, 0x01, 0x8B, 0x42, 0x48, 0x05, 0x4C, 0x0C, 0x17,
+    0x11, 0x0C, 0x04, 0x10, 0x01, 0xED, 0x42, 0x44, 0x05, 0x50, 0x12, 0x17, 0x11, 0x0C, 0x04, 0x10,
+    0x86, 0x65, 0x6E, 0x61, 0x6E, 0x63, 0x65, 0x00, 0x08, 0x15, 0x13, 0x86, 0x65, 0x6D, 0x69, 0x6E,
+    0x65, 0x6E, 0x63, 0x65, 0x00, 0x42, 0x50, 0x05, 0x56, 0x09, 0x12, 0x06, 0x01, 0xEB, 0x0C, 0x07,
+    0x02, 0xAA, 0x17, 0x47, 0x44, 0x0F, 0x45, 0x14, 0x47, 0x19, 0x48, 0x1E, 0x49, 0x55, 0x55, 0x5F,
+    0x58, 0x69, 0x08, 0x13, 0x13, 0x01, 0x96, 0x10, 0x08, 0x10, 0x01, 0xA5, 0x11, 0x0C, 0x0B, 0x01,
+    0xA2, 0x45, 0x47, 0x0B, 0x49, 0x15, 0x4C, 0x20, 0x4F, 0x2C, 0x59, 0x30, 0x11, 0x0C, 0x0B, 0x85,
+    0x72, 0x61, 0x6E, 0x63, 0x65, 0x00, 0x09, 0x08, 0x15, 0x86, 0x65, 0x72, 0x65, 0x6E, 0x63, 0x65,
+    0x00, 0x13, 0x1B, 0x08, 0x86, 0x65, 0x72, 0x69, 0x65, 0x6E, 0x63, 0x65, 0x00, 0x12, 0x17, 0x01,
+    0x72, 0x08, 0x16, 0x15, 0x08, 0x13, 0x01, 0x6B, 0x08, 0x15, 0x84, 0x65, 0x72, 0x65, 0x6E, 0x63,
+    0x65, 0x00, 0x08, 0x09, 0x08, 0x15, 0x84, 0x65, 0x6E, 0x63, 0x65, 0x00, 0x42, 0x46, 0x05, 0x56,
+    0x1A, 0x06, 0x12, 0x83, 0x72, 0x65, 0x6E, 0x63, 0x65, 0x00, 0x44, 0x4C, 0x09, 0x51, 0x10, 0x53,
+    0x2E, 0x56, 0x34, 0x15, 0x08, 0x0B, 0x11, 0x0C, 0x01, 0x39, 0x43, 0x44, 0x07, 0x48, 0x16, 0x4C,
+    0x19, 0x0C, 0x18, 0x14, 0x06, 0x04, 0x87, 0x61, 0x69, 0x6E, 0x74, 0x61, 0x6E, 0x63, 0x65, 0x00,
+    0x13, 0x01, 0x1E, 0x04, 0x18, 0x14, 0x01, 0x04, 0x08, 0x06, 0x06, 0x04, 0x01, 0x15, 0x0C, 0x16,
+    0x01, 0x0F, 0x14, 0x16, 0x85, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x00, 0x08, 0x0F, 0x08,
+    0x15, 0x83, 0x61, 0x6E, 0x63, 0x65, 0x00, 0x43, 0x46, 0x07, 0x48, 0x0A, 0x57, 0x14, 0x16, 0x01,
+    0x21, 0x07, 0x18, 0x04, 0x84, 0x69, 0x65, 0x6E, 0x63, 0x65, 0x00, 0x16, 0x0C, 0x1B, 0x08, 0x83,
+    0x65, 0x6E, 0x63, 0x65, 0x00, 0x13, 0x16, 0x08, 0x15, 0x02, 0xC1, 0x16, 0x08, 0x09, 0x08, 0x15,
+    0x82, 0x65, 0x6E, 0x63, 0x65, 0x00, 0x12, 0x05, 0x08, 0x15, 0x81, 0x64, 0x00, 0x11, 0x08, 0x0F,
+    0x12, 0x0C, 0x19, 0x82, 0x63, 0x65, 0x00, 0x07, 0x42, 0x51, 0x05, 0x52, 0x0E, 0x08, 0x85, 0x69,
+    0x6E, 0x64, 0x75, 0x63, 0x65, 0x00, 0x15, 0x17, 0x06, 0x11, 0x0C, 0x87, 0x74, 0x72, 0x6F, 0x64,
+    0x75, 0x63, 0x65, 0x00, 0x45, 0x44, 0x0B, 0x48, 0x4D, 0x4C, 0x65, 0x52, 0xC5, 0x58, 0xD0, 0x45,
+    0x4F, 0x0B, 0x51, 0x17, 0x55, 0x24, 0x57, 0x2D, 0x58, 0x35, 0x08, 0x10, 0x15, 0x04, 0x10, 0x84,
+    0x61, 0x6C, 0x61, 0x64, 0x65, 0x00, 0x12, 0x0F, 0x0F, 0x12, 0x06, 0x85, 0x6F, 0x6E, 0x6E, 0x61,
+    0x64, 0x65, 0x00, 0x08, 0x13, 0x84, 0x61, 0x72, 0x61, 0x64, 0x65, 0x00, 0x16, 0x11, 0x0C, 0x82,
+    0x65, 0x61, 0x64, 0x00, 0x16, 0x15, 0x18, 0x13, 0x86, 0x65, 0x72, 0x73, 0x75, 0x61, 0x64, 0x65,
+    0x00, 0x42, 0x46, 0x05, 0x53, 0x0C, 0x12, 0x15, 0x13, 0x81, 0x65, 0x64, 0x00, 0x08, 0x0F, 0x0F,
+    0x0C, 0x10, 0x84, 0x69, 0x70, 0x65, 0x64, 0x65, 0x00, 0x46, 0x84, 0x02, 0x59, 0x86, 0x13, 0x00,
+    0x95, 0x27, 0x00, 0x96, 0x38, 0x00, 0x97, 0x4A, 0x00, 0x9A, 0x53, 0x00, 0x42, 0x48, 0x05, 0x58,
+    0x0C, 0x15, 0x83, 0x73, 0x69, 0x64, 0x65, 0x00, 0x16, 0x83, 0x69, 0x63, 0x69, 0x64, 0x65, 0x00,
+    0x04, 0x06, 0x06, 0x04, 0x16, 0x1C, 0x0F, 0x12, 0x13, 0x84, 0x68, 0x61, 0x72, 0x69, 0x64, 0x65,
+    0x00, 0x42, 0x48, 0x05, 0x56, 0x0C, 0x07, 0x83, 0x63, 0x69, 0x64, 0x65, 0x00, 0x04, 0x83, 0x69,
+    0x64, 0x65, 0x00, 0x0C, 0x17, 0x17, 0x04, 0x82, 0x75, 0x64, 0x65, 0x00, 0x0F, 0x07, 0x15, 0x12,
+    0x1A, 0x85, 0x6C, 0x64, 0x77, 0x69, 0x64, 0x65, 0x00, 0x0C, 0x16, 0x13, 0x08, 0x84, 0x69, 0x73,
+    0x6F, 0x64, 0x65, 0x00, 0x17, 0x0C, 0x17, 0x17, 0x04, 0x0F, 0x85, 0x69, 0x74, 0x75, 0x64, 0x65,
+    0x00, 0x42, 0x88, 0x87, 0x60, 0x97, 0x07, 0x00, 0x43, 0x4C, 0x07, 0x51, 0x10, 0x57, 0x5A, 0x10,
+    0x10, 0x12, 0x06, 0x81, 0x74, 0x65, 0x65, 0x00, 0x42, 0x44, 0x05, 0x48, 0x2F, 0x15, 0x42, 0x44,
+    0x05, 0x58, 0x1B, 0x42, 0x4A, 0x05, 0x5A, 0x0F, 0x86, 0x75, 0x61, 0x72, 0x61, 0x6E, 0x74, 0x65,
+    0x65, 0x00, 0x84, 0x72, 0x61, 0x6E, 0x74, 0x79, 0x00, 0x42, 0x44, 0x1E, 0x4A, 0x05, 0x85, 0x61,
+    0x72, 0x61, 0x6E, 0x74, 0x65, 0x65, 0x00, 0x15, 0x42, 0x44, 0x05, 0x58, 0x0E, 0x18, 0x0A, 0x84,
+    0x61, 0x6E, 0x74, 0x65, 0x65, 0x00, 0x04, 0x0A, 0x87, 0x75, 0x61, 0x72, 0x61, 0x6E, 0x74, 0x65,
+    0x65, 0x00, 0x0C, 0x10, 0x12, 0x06, 0x84, 0x6D, 0x69, 0x74, 0x74, 0x65, 0x65, 0x00, 0x46, 0x84,
+    0x13, 0x00, 0x87, 0xE7, 0x00, 0x88, 0x22, 0x01, 0x8C, 0x48, 0x01, 0x91, 0x81, 0x01, 0x98, 0xBB,
+    0x01, 0x49, 0x48, 0x13, 0x4A, 0x1F, 0x4B, 0x29, 0x4C, 0x38, 0x4F, 0x50, 0x50, 0x6A, 0x55, 0x7A,
+    0x57, 0x9F, 0x58, 0xCD, 0x42, 0x4F, 0x05, 0x56, 0x09, 0x80, 0x75, 0x65, 0x00, 0x18, 0x01, 0xE1,
+    0x15, 0x12, 0x10, 0x83, 0x74, 0x67, 0x61, 0x67, 0x65, 0x00, 0x15, 0x12, 0x10, 0x10, 0x08, 0x0B,
+    0x86, 0x6F, 0x72, 0x72, 0x68, 0x61, 0x67, 0x65, 0x00, 0x42, 0x55, 0x05, 0x57, 0x0E, 0x04, 0x10,
+    0x83, 0x72, 0x69, 0x61, 0x67, 0x65, 0x00, 0x15, 0x08, 0x0B, 0x84, 0x69, 0x74, 0x61, 0x67, 0x65,
+    0x00, 0x42, 0x49, 0x05, 0x4C, 0x11, 0x12, 0x10, 0x04, 0x06, 0x84, 0x75, 0x66, 0x6C, 0x61, 0x67,
+    0x65, 0x00, 0x19, 0x0C, 0x15, 0x13, 0x82, 0x65, 0x67, 0x65, 0x00, 0x10, 0x42, 0x44, 0x05, 0x4C,
+    0x08, 0x07, 0x01, 0x8D, 0x15, 0x0A, 0x0F, 0x0C, 0x13, 0x01, 0x86, 0x42, 0x48, 0x05, 0x55, 0x0F,
+    0x09, 0x09, 0x18, 0x16, 0x84, 0x72, 0x61, 0x67, 0x65, 0x00, 0x42, 0x44, 0x05, 0x52, 0x0C, 0x10,
+    0x82, 0x69, 0x61, 0x67, 0x65, 0x00, 0x10, 0x08, 0x04, 0x0B, 0x82, 0x68, 0x61, 0x67, 0x65, 0x00,
+    0x43, 0x4C, 0x07, 0x51, 0x16, 0x55, 0x26, 0x15, 0x08, 0x0B, 0x11, 0x0C, 0x89, 0x68, 0x65, 0x72,
+    0x69, 0x74, 0x61, 0x67, 0x65, 0x00, 0x08, 0x06, 0x08, 0x15, 0x13, 0x88, 0x65, 0x72, 0x63, 0x65,
+    0x6E, 0x74, 0x61, 0x67, 0x65, 0x00, 0x12, 0x10, 0x82, 0x67, 0x61, 0x67, 0x65, 0x00, 0x0A, 0x83,
+    0x61, 0x75, 0x67, 0x65, 0x00, 0x42, 0x48, 0x05, 0x4C, 0x20, 0x0F, 0x44, 0x44, 0x09, 0x4C, 0x0F,
+    0x4F, 0x15, 0x59, 0x79, 0x83, 0x6C, 0x65, 0x67, 0x65, 0x00, 0x19, 0x0C, 0x15, 0x13, 0x01, 0x03,
+    0x04, 0x82, 0x67, 0x65, 0x00, 0x42, 0x4F, 0x05, 0x55, 0x0F, 0x0C, 0x17, 0x15, 0x04, 0x06, 0x83,
+    0x61, 0x67, 0x65, 0x00, 0x07, 0x17, 0x15, 0x04, 0x06, 0x85, 0x72, 0x69, 0x64, 0x67, 0x65, 0x00,
+    0x42, 0x4F, 0x05, 0x51, 0x4E, 0x45, 0x44, 0x0B, 0x48, 0x3E, 0x4C, 0x11, 0x4F, 0x14, 0x5A, 0x1C,
+    0x82, 0x6C, 0x65, 0x67, 0x65, 0x00, 0x17, 0x01, 0x37, 0x04, 0x0B, 0x06, 0x81, 0x6E, 0x67, 0x65,
+    0x00, 0x12, 0x11, 0x0E, 0x01, 0x36, 0x45, 0x44, 0x0B, 0x48, 0x15, 0x4F, 0x1C, 0x51, 0x28, 0x55,
+    0x30, 0x15, 0x15, 0x04, 0x10, 0x83, 0x69, 0x61, 0x67, 0x65, 0x00, 0x16, 0x83, 0x69, 0x65, 0x67,
+    0x65, 0x00, 0x08, 0x19, 0x0C, 0x15, 0x13, 0x84, 0x69, 0x6C, 0x65, 0x67, 0x65, 0x00, 0x15, 0x04,
+    0x06, 0x82, 0x61, 0x67, 0x65, 0x00, 0x17, 0x15, 0x04, 0x06, 0x81, 0x64, 0x67, 0x65, 0x00, 0x42,
+    0x44, 0x05, 0x58, 0x32, 0x44, 0x46, 0x09, 0x4F, 0x12, 0x53, 0x1C, 0x57, 0x25, 0x1B, 0x08, 0x83,
+    0x68, 0x61, 0x6E, 0x67, 0x65, 0x00, 0x0F, 0x04, 0x0B, 0x06, 0x83, 0x65, 0x6E, 0x67, 0x65, 0x00,
+    0x10, 0x04, 0x0B, 0x06, 0x82, 0x67, 0x6E, 0x65, 0x00, 0x16, 0x83, 0x72, 0x61, 0x6E, 0x67, 0x65,
+    0x00, 0x12, 0x17, 0x83, 0x6E, 0x67, 0x75, 0x65, 0x00, 0x12, 0x0A, 0x04, 0x11, 0x1C, 0x16, 0x82,
+    0x67, 0x75, 0x65, 0x00, 0x42, 0x46, 0x05, 0x57, 0x0C, 0x04, 0x10, 0x12, 0x17, 0x02, 0x14, 0x1F,
+    0x42, 0x47, 0x05, 0x52, 0x0F, 0x08, 0x17, 0x08, 0x0F, 0x13, 0x10, 0x12, 0x06, 0x01, 0x03, 0x17,
+    0x82, 0x20, 0x74, 0x68, 0x65, 0x00, 0x44, 0x4A, 0x09, 0x55, 0x18, 0x57, 0x21, 0x58, 0x26, 0x42,
+    0x44, 0x05, 0x4C, 0x05, 0x11, 0x15, 0x04, 0x06, 0x83, 0x65, 0x67, 0x69, 0x65, 0x00, 0x04, 0x15,
+    0x13, 0x82, 0x69, 0x72, 0x69, 0x65, 0x00, 0x18, 0x14, 0x02, 0x39, 0x0D, 0x17, 0x14, 0x83, 0x75,
+    0x69, 0x65, 0x74, 0x00, 0x42, 0x55, 0x05, 0x58, 0x0D, 0x12, 0x05, 0x83, 0x72, 0x6F, 0x6B, 0x65,
+    0x00, 0x0C, 0x0F, 0x02, 0x38, 0x84, 0x4C, 0x85, 0x25, 0x00, 0x86, 0x35, 0x04, 0x8B, 0x40, 0x04,
+    0x8C, 0x48, 0x04, 0x8E, 0xC1, 0x04, 0x8F, 0xC7, 0x04, 0x92, 0xCA, 0x04, 0x93, 0xD3, 0x04, 0x96,
+    0x1A, 0x05, 0x97, 0x22, 0x05, 0x98, 0x2A, 0x05, 0x99, 0x33, 0x05, 0x47, 0x84, 0x16, 0x00, 0x8C,
+    0x1B, 0x03, 0x8F, 0xD9, 0x03, 0x90, 0xDF, 0x03, 0x96, 0xEB, 0x03, 0x97, 0xF9, 0x03, 0x98, 0x07,
+    0x04, 0x4D, 0x86, 0x28, 0x00, 0x87, 0x5C, 0x00, 0x88, 0x61, 0x00, 0x8A, 0xF6, 0x00, 0x8C, 0x2E,
+    0x01, 0x8F, 0x50, 0x01, 0x90, 0x71, 0x01, 0x91, 0x85, 0x01, 0x95, 0xA5, 0x01, 0x96, 0x0A, 0x02,
+    0x97, 0x5A, 0x02, 0x98, 0xE3, 0x02, 0x99, 0xF5, 0x02, 0x44, 0x44, 0x09, 0x48, 0x12, 0x4C, 0x18,
+    0x58, 0x2D, 0x0F, 0x13, 0x08, 0x15, 0x15, 0x0C, 0x02, 0xE9, 0x02, 0x17, 0x08, 0x07, 0x02, 0x36,
+    0x02, 0x42, 0x93, 0x07, 0x00, 0x97, 0xDE, 0x02, 0x16, 0x0C, 0x07, 0x88, 0x65, 0x73, 0x70, 0x69,
+    0x63, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x07, 0x12, 0x15, 0x13, 0x02, 0x82, 0x02, 0x08, 0x15, 0x02,
+    0x66, 0x02, 0x4A, 0x86, 0x1F, 0x00, 0x87, 0x30, 0x00, 0x88, 0x34, 0x00, 0x8F, 0x42, 0x00, 0x91,
+    0x48, 0x00, 0x95, 0x5B, 0x00, 0x96, 0x8B, 0x02, 0x97, 0x6C, 0x00, 0x98, 0x87, 0x00, 0x99, 0x8D,
+    0x00, 0x0C, 0x17, 0x12, 0x11, 0x18, 0x88, 0x6E, 0x6F, 0x74, 0x69, 0x63, 0x65, 0x61, 0x62, 0x6C,
+    0x65, 0x00, 0x0C, 0x06, 0x01, 0x44, 0x16, 0x15, 0x12, 0x09, 0x86, 0x65, 0x73, 0x65, 0x65, 0x61,
+    0x62, 0x6C, 0x65, 0x00, 0x04, 0x06, 0x16, 0x02, 0x49, 0x02, 0x0C, 0x09, 0x08, 0x07, 0x11, 0x0C,
+    0x8B, 0x75, 0x6E, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x42, 0x4C, 0x05,
+    0x58, 0x08, 0x16, 0x01, 0x15, 0x0A, 0x0C, 0x09, 0x11, 0x12, 0x06, 0x02, 0x25, 0x02, 0x42, 0x44,
+    0x05, 0x52, 0x17, 0x42, 0x45, 0x05, 0x4F, 0x0A, 0x08, 0x07, 0x02, 0x16, 0x02, 0x16, 0x11, 0x04,
+    0x15, 0x17, 0x02, 0x0C, 0x02, 0x11, 0x02, 0x0A, 0x02, 0x0F, 0x04, 0x19, 0x02, 0x04, 0x02, 0x0C,
+    0x0A, 0x15, 0x12, 0x09, 0x02, 0xFA, 0x01, 0x44, 0x44, 0x09, 0x4C, 0x0F, 0x51, 0x1C, 0x55, 0x30,
+    0x11, 0x04, 0x10, 0x02, 0x1E, 0x02, 0x0F, 0x42, 0x88, 0xD7, 0x01, 0x8A, 0x07, 0x00, 0x08, 0x11,
+    0x02, 0xCE, 0x01, 0x42, 0x44, 0x05, 0x48, 0x0A, 0x0B, 0x06, 0x02, 0x07, 0x02, 0x0F, 0x0F, 0x04,
+    0x0B, 0x06, 0x11, 0x18, 0x02, 0xFD, 0x01, 0x04, 0x0B, 0x06, 0x08, 0x15, 0x02, 0xF5, 0x01, 0x42,
+    0x4F, 0x05, 0x57, 0x1A, 0x42, 0x44, 0x05, 0x4C, 0x0F, 0x19, 0x04, 0x85, 0x69, 0x6C, 0x61, 0x62,
+    0x6C, 0x65, 0x00, 0x04, 0x19, 0x04, 0x02, 0xAA, 0x01, 0x04, 0x13, 0x10, 0x12, 0x06, 0x02, 0xCA,
+    0x01, 0x43, 0x44, 0x07, 0x4C, 0x11, 0x4F, 0x1C, 0x19, 0x04, 0x84, 0x69, 0x6C, 0x61, 0x62, 0x6C,
+    0x65, 0x00, 0x19, 0x04, 0x85, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x04, 0x09, 0x02,
+    0x57, 0x01, 0x04, 0x42, 0x4F, 0x05, 0x55, 0x08, 0x09, 0x01, 0x06, 0x0A, 0x12, 0x15, 0x13, 0x83,
+    0x6D, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x12, 0x42, 0x4C, 0x05, 0x57, 0x12, 0x16, 0x0C, 0x09, 0x86,
+    0x73, 0x69, 0x6F, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x16, 0x08, 0x18, 0x14, 0x85, 0x69, 0x6F,
+    0x6E, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x43, 0x48, 0x07, 0x53, 0x38, 0x57, 0x43, 0x43, 0x45, 0x07,
+    0x50, 0x17, 0x53, 0x25, 0x10, 0x08, 0x10, 0x08, 0x15, 0x8B, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x61,
+    0x62, 0x6C, 0x65, 0x00, 0x18, 0x11, 0x0C, 0x87, 0x6E, 0x75, 0x6D, 0x65, 0x72, 0x61, 0x62, 0x6C,
+    0x65, 0x00, 0x08, 0x16, 0x11, 0x0C, 0x85, 0x61, 0x72, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x10, 0x12,
+    0x06, 0x84, 0x61, 0x72, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x42, 0x48, 0x05, 0x58, 0x17, 0x11, 0x08,
+    0x13, 0x11, 0x0C, 0x8A, 0x6D, 0x70, 0x65, 0x6E, 0x65, 0x74, 0x72, 0x61, 0x62, 0x6C, 0x65, 0x00,
+    0x12, 0x19, 0x04, 0x09, 0x85, 0x72, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x47, 0x44, 0x0F, 0x48, 0x13,
+    0x4C, 0x1E, 0x51, 0x21, 0x55, 0x28, 0x56, 0x2C, 0x58, 0x4B, 0x08, 0x09, 0x01, 0xC2, 0x15, 0x07,
+    0x07, 0x04, 0x83, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x19, 0x01, 0xB4, 0x08, 0x13, 0x16, 0x08,
+    0x02, 0x20, 0x01, 0x08, 0x19, 0x01, 0xA7, 0x43, 0x48, 0x07, 0x4C, 0x0B, 0x52, 0x21, 0x06, 0x06,
+    0x01, 0x0A, 0x10, 0x43, 0x47, 0x07, 0x55, 0x0A, 0x56, 0x0D, 0x04, 0x01, 0x93, 0x08, 0x01, 0x0A,
+    0x11, 0x04, 0x15, 0x17, 0x01, 0x8A, 0x04, 0x0F, 0x13, 0x01, 0x85, 0x47, 0x44, 0x0F, 0x48, 0x15,
+    0x4A, 0x22, 0x4C, 0x2C, 0x53, 0x51, 0x55, 0x6F, 0x56, 0x7F, 0x13, 0x10, 0x12, 0x06, 0x01, 0x70,
+    0x0A, 0x15, 0x12, 0x09, 0x11, 0x18, 0x83, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x08, 0x19, 0x84,
+    0x65, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x43, 0x47, 0x07, 0x4A, 0x11, 0x55, 0x1B, 0x07, 0x08,
+    0x86, 0x69, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x08, 0x19, 0x85, 0x65, 0x74, 0x61, 0x62, 0x6C,
+    0x65, 0x00, 0x0C, 0x85, 0x72, 0x69, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x43, 0x48, 0x07, 0x50,
+    0x0A, 0x58, 0x16, 0x16, 0x01, 0xE7, 0x12, 0x06, 0x11, 0x0C, 0x84, 0x61, 0x74, 0x69, 0x62, 0x6C,
+    0x65, 0x00, 0x15, 0x15, 0x12, 0x06, 0x11, 0x0C, 0x01, 0x16, 0x12, 0x09, 0x11, 0x12, 0x06, 0x88,
+    0x6D, 0x66, 0x6F, 0x72, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x0C, 0x16, 0x08, 0x15, 0x83, 0x69,
+    0x62, 0x6C, 0x65, 0x00, 0x42, 0x4F, 0x05, 0x56, 0x09, 0x12, 0x16, 0x01, 0x2D, 0x18, 0x11, 0x18,
+    0x84, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x0C, 0x08, 0x0F, 0x08, 0x05, 0x11, 0x18, 0x86, 0x69, 0x65,
+    0x76, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x46, 0x44, 0x0D, 0x46, 0x17, 0x47, 0x22, 0x53, 0x39, 0x56,
+    0x3D, 0x57, 0x67, 0x0F, 0x0C, 0x04, 0x19, 0x04, 0x83, 0x62, 0x6C, 0x65, 0x00, 0x0C, 0x17, 0x12,
+    0x11, 0x83, 0x65, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x42, 0x44, 0x05, 0x4C, 0x11, 0x08, 0x15, 0x06,
+    0x11, 0x0C, 0x85, 0x64, 0x69, 0x62, 0x6C, 0x65, 0x00, 0x10, 0x15, 0x12, 0x09, 0x01, 0x81, 0x04,
+    0x06, 0x01, 0x7D, 0x11, 0x42, 0x48, 0x05, 0x52, 0x1B, 0x13, 0x16, 0x42, 0x48, 0x05, 0x4C, 0x70,
+    0x07, 0x11, 0x0C, 0x89, 0x69, 0x73, 0x70, 0x65, 0x6E, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x13,
+    0x08, 0x15, 0x87, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x69, 0x62, 0x6C, 0x65, 0x00, 0x45, 0x44, 0x0B,
+    0x4C, 0x17, 0x53, 0x24, 0x56, 0x3A, 0x58, 0x4B, 0x19, 0x08, 0x11, 0x0C, 0x85, 0x69, 0x74, 0x61,
+    0x62, 0x6C, 0x65, 0x00, 0x42, 0x53, 0x05, 0x59, 0x0A, 0x16, 0x12, 0x0B, 0x01, 0x32, 0x08, 0x01,
+    0x2D, 0x08, 0x42, 0x46, 0x05, 0x56, 0x09, 0x06, 0x04, 0x01, 0x25, 0x18, 0x16, 0x86, 0x63, 0x65,
+    0x70, 0x74, 0x69, 0x62, 0x6C, 0x65, 0x00, 0x0C, 0x16, 0x08, 0x15, 0x0C, 0x88, 0x72, 0x65, 0x73,
+    0x69, 0x73, 0x74, 0x69, 0x62, 0x6C, 0x65, 0x00, 0x13, 0x16, 0x0C, 0x07, 0x11, 0x0C, 0x83, 0x61,
+    0x62, 0x6C, 0x65, 0x00, 0x0C, 0x04, 0x19, 0x04, 0x01, 0x2D, 0x08, 0x16, 0x16, 0x08, 0x15, 0x85,
+    0x65, 0x6D, 0x62, 0x6C, 0x65, 0x00, 0x0C, 0x11, 0x12, 0x13, 0x16, 0x08, 0x15, 0x84, 0x73, 0x69,
+    0x62, 0x6C, 0x65, 0x00, 0x04, 0x06, 0x0C, 0x07, 0x08, 0x15, 0x13, 0x84, 0x74, 0x61, 0x62, 0x6C,
+    0x65, 0x00, 0x0F, 0x04, 0x19, 0x82, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x04, 0x11, 0x08, 0x17, 0x83,
+    0x74, 0x61, 0x63, 0x6C, 0x65, 0x00, 0x12, 0x1A, 0x83, 0x68, 0x6F, 0x6C, 0x65, 0x00, 0x46, 0x45,
+    0x0D, 0x4B, 0x2E, 0x53, 0x50, 0x56, 0x5B, 0x57, 0x63, 0x5A, 0x71, 0x0C, 0x42, 0x50, 0x05, 0x56,
+    0x10, 0x12, 0x17, 0x18, 0x04, 0x84, 0x6F, 0x62, 0x69, 0x6C, 0x65, 0x00, 0x42, 0x51, 0x05, 0x56,
+    0x0C, 0x12, 0x13, 0x16, 0x08, 0x15, 0x01, 0xBF, 0x12, 0x13, 0x01, 0xBB, 0x42, 0x53, 0x05, 0x5A,
+    0x15, 0x12, 0x08, 0x10, 0x08, 0x15, 0x17, 0x1B, 0x08, 0x86, 0x6F, 0x70, 0x68, 0x69, 0x6C, 0x65,
+    0x00, 0x17, 0x15, 0x12, 0x0B, 0x16, 0x84, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x00, 0x12, 0x15,
+    0x07, 0x1C, 0x0B, 0x82, 0x68, 0x69, 0x6C, 0x65, 0x00, 0x0C, 0x10, 0x82, 0x73, 0x69, 0x6C, 0x65,
+    0x00, 0x11, 0x08, 0x06, 0x15, 0x08, 0x10, 0x85, 0x61, 0x6E, 0x74, 0x69, 0x6C, 0x65, 0x00, 0x0B,
+    0x84, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x00, 0x06, 0x0C, 0x11, 0x02, 0xCA, 0x20, 0x18, 0x01, 0xB5,
+    0x1A, 0x0B, 0x84, 0x77, 0x68, 0x6F, 0x6C, 0x65, 0x00, 0x44, 0x44, 0x09, 0x4C, 0x11, 0x50, 0x1D,
+    0x53, 0x3B, 0x42, 0x50, 0x05, 0x51, 0x33, 0x1B, 0x01, 0x24, 0x06, 0x0C, 0x15, 0x13, 0x84, 0x6E,
+    0x63, 0x69, 0x70, 0x6C, 0x65, 0x00, 0x42, 0x44, 0x05, 0x48, 0x0A, 0x08, 0x15, 0x13, 0x01, 0x09,
+    0x42, 0x56, 0x05, 0x5B, 0x0C, 0x16, 0x04, 0x82, 0x62, 0x6C, 0x65, 0x00, 0x08, 0x84, 0x61, 0x6D,
+    0x70, 0x6C, 0x65, 0x00, 0x04, 0x11, 0x0C, 0x13, 0x84, 0x65, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x00,
+    0x16, 0x0C, 0x10, 0x81, 0x69, 0x6C, 0x65, 0x00, 0x1C, 0x16, 0x83, 0x74, 0x79, 0x6C, 0x65, 0x00,
+    0x06, 0x0C, 0x0B, 0x08, 0x19, 0x82, 0x6C, 0x65, 0x00, 0x08, 0x0F, 0x02, 0x59, 0x20, 0x44, 0x4C,
+    0x09, 0x50, 0x43, 0x52, 0x49, 0x58, 0x54, 0x17, 0x45, 0x49, 0x0B, 0x4B, 0x14, 0x4F, 0x1D, 0x57,
+    0x26, 0x5C, 0x2E, 0x0C, 0x0F, 0x83, 0x65, 0x74, 0x69, 0x6D, 0x65, 0x00, 0x0A, 0x0C, 0x11, 0x82,
+    0x74, 0x69, 0x6D, 0x65, 0x00, 0x0F, 0x04, 0x83, 0x2D, 0x74, 0x69, 0x6D, 0x65, 0x00, 0x16, 0x04,
+    0x13, 0x83, 0x69, 0x6D, 0x65, 0x00, 0x15, 0x08, 0x19, 0x08, 0x83, 0x20, 0x74, 0x69, 0x6D, 0x65,
+    0x00, 0x1C, 0x0B, 0x15, 0x02, 0xDE, 0x58, 0x42, 0x8C, 0x07, 0x00, 0x95, 0xB7, 0x64, 0x17, 0x02,
+    0xE5, 0x7E, 0x16, 0x04, 0x82, 0x73, 0x75, 0x6D, 0x65, 0x00, 0x47, 0x86, 0x16, 0x00, 0x88, 0x1D,
+    0x00, 0x8B, 0x40, 0x00, 0x8C, 0x4B, 0x00, 0x90, 0xD3, 0x00, 0x92, 0xE2, 0x00, 0x95, 0x33, 0x01,
+    0x0C, 0x16, 0x82, 0x6E, 0x63, 0x65, 0x00, 0x43, 0x4A, 0x07, 0x50, 0x11, 0x59, 0x18, 0x0C, 0x15,
+    0x12, 0x05, 0x04, 0x82, 0x69, 0x6E, 0x65, 0x00, 0x12, 0x16, 0x81, 0x6F, 0x6E, 0x65, 0x00, 0x08,
+    0x17, 0x11, 0x0C, 0x83, 0x72, 0x76, 0x65, 0x6E, 0x65, 0x00, 0x06, 0x04, 0x10, 0x05, 0x18, 0x16,
+    0x81, 0x69, 0x6E, 0x65, 0x00, 0x4A, 0x44, 0x15, 0x46, 0x1E, 0x48, 0x29, 0x49, 0x32, 0x4F, 0x3A,
+    0x50, 0x45, 0x51, 0x4D, 0x53, 0x64, 0x55, 0x72, 0x56, 0x7E, 0x17, 0x11, 0x04, 0x15, 0x04, 0x18,
+    0x14, 0x01, 0x19, 0x04, 0x07, 0x08, 0x10, 0x84, 0x69, 0x63, 0x69, 0x6E, 0x65, 0x00, 0x0A, 0x1C,
+    0x0B, 0x83, 0x69, 0x65, 0x6E, 0x65, 0x00, 0x09, 0x08, 0x07, 0x83, 0x69, 0x6E, 0x65, 0x00, 0x04,
+    0x17, 0x04, 0x06, 0x84, 0x69, 0x6C, 0x69, 0x6E, 0x65, 0x00, 0x12, 0x17, 0x11, 0x04, 0x13, 0x02,
+    0x56, 0x23, 0x04, 0x42, 0x4B, 0x05, 0x51, 0x0D, 0x12, 0x0D, 0x82, 0x6E, 0x69, 0x6E, 0x65, 0x00,
+    0x18, 0x0A, 0x85, 0x61, 0x6E, 0x69, 0x6E, 0x65, 0x00, 0x0C, 0x0F, 0x0F, 0x0C, 0x0B, 0x13, 0x85,
+    0x69, 0x70, 0x70, 0x69, 0x6E, 0x65, 0x00, 0x18, 0x12, 0x0F, 0x09, 0x85, 0x75, 0x6F, 0x72, 0x69,
+    0x6E, 0x65, 0x00, 0x04, 0x0A, 0x04, 0x10, 0x83, 0x7A, 0x69, 0x6E, 0x65, 0x00, 0x42, 0x4C, 0x05,
+    0x58, 0x09, 0x17, 0x02, 0xEF, 0x57, 0x0F, 0x12, 0x19, 0x02, 0xE9, 0x57, 0x45, 0x4B, 0x0B, 0x50,
+    0x24, 0x52, 0x33, 0x53, 0x3A, 0x57, 0x44, 0x13, 0x04, 0x42, 0x51, 0x05, 0x5B, 0x0D, 0x04, 0x15,
+    0x05, 0x10, 0x08, 0x10, 0x01, 0x04, 0x04, 0x16, 0x85, 0x6F, 0x70, 0x68, 0x6F, 0x6E, 0x65, 0x00,
+    0x12, 0x15, 0x08, 0x09, 0x87, 0x70, 0x68, 0x65, 0x72, 0x6F, 0x6D, 0x6F, 0x6E, 0x65, 0x00, 0x11,
+    0x82, 0x20, 0x6F, 0x6E, 0x65, 0x00, 0x12, 0x0F, 0x0F, 0x04, 0x82, 0x68, 0x6F, 0x6E, 0x65, 0x00,
+    0x16, 0x08, 0x10, 0x0C, 0x15, 0x05, 0x85, 0x73, 0x74, 0x6F, 0x6E, 0x65, 0x00, 0x18, 0x12, 0x05,
+    0x15, 0x0C, 0x04, 0x83, 0x72, 0x6E, 0x65, 0x00, 0x43, 0x47, 0x07, 0x51, 0x0E, 0x56, 0x16, 0x04,
+    0x11, 0x15, 0x12, 0x02, 0x17, 0x57, 0x04, 0x06, 0x0F, 0x12, 0x19, 0x02, 0xF3, 0x63, 0x0B, 0x17,
+    0x82, 0x6F, 0x73, 0x65, 0x00, 0x43, 0x56, 0x07, 0x57, 0x10, 0x5C, 0x1A, 0x0C, 0x0F, 0x06, 0x08,
+    0x82, 0x70, 0x73, 0x65, 0x00, 0x12, 0x17, 0x12, 0x15, 0x13, 0x81, 0x79, 0x70, 0x65, 0x00, 0x42,
+    0x52, 0x05, 0x57, 0x0F, 0x17, 0x12, 0x15, 0x13, 0x82, 0x74, 0x79, 0x70, 0x65, 0x00, 0x0B, 0x06,
+    0x15, 0x04, 0x83, 0x65, 0x74, 0x79, 0x70, 0x65, 0x00, 0x49, 0x84, 0x1C, 0x00, 0x86, 0x5A, 0x00,
+    0x87, 0x64, 0x00, 0x88, 0x6D, 0x00, 0x8C, 0xA3, 0x00, 0x92, 0xD9, 0x00, 0x97, 0xF1, 0x00, 0x98,
+    0xFE, 0x00, 0x99, 0x08, 0x02, 0x45, 0x46, 0x0B, 0x4C, 0x19, 0x4F, 0x26, 0x5A, 0x2B, 0x5D, 0x35,
+    0x15, 0x08, 0x0B, 0x17, 0x0F, 0x04, 0x08, 0x0B, 0x85, 0x63, 0x61, 0x72, 0x65, 0x00, 0x11, 0x12,
+    0x0C, 0x0F, 0x0F, 0x0C, 0x10, 0x83, 0x61, 0x69, 0x72, 0x65, 0x00, 0x18, 0x13, 0x02, 0x8D, 0x4E,
+    0x09, 0x12, 0x16, 0x83, 0x74, 0x77, 0x61, 0x72, 0x65, 0x00, 0x1D, 0x0C, 0x05, 0x83, 0x61, 0x72,
+    0x72, 0x65, 0x00, 0x0F, 0x18, 0x13, 0x08, 0x16, 0x81, 0x68, 0x72, 0x65, 0x00, 0x11, 0x0C, 0x04,
+    0x17, 0x17, 0x04, 0x02, 0xD6, 0x3C, 0x43, 0x4B, 0x07, 0x57, 0x23, 0x5A, 0x2B, 0x42, 0x57, 0x05,
+    0x5A, 0x11, 0x15, 0x08, 0x19, 0x12, 0x84, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x00, 0x10, 0x12,
+    0x16, 0x84, 0x65, 0x77, 0x68, 0x65, 0x72, 0x65, 0x00, 0x0B, 0x84, 0x74, 0x68, 0x65, 0x72, 0x65,
+    0x00, 0x0B, 0x1C, 0x11, 0x04, 0x84, 0x77, 0x68, 0x65, 0x72, 0x65, 0x00, 0x43, 0x48, 0x07, 0x52,
+    0x11, 0x58, 0x1F, 0x10, 0x08, 0x15, 0x13, 0x83, 0x69, 0x65, 0x72, 0x65, 0x00, 0x17, 0x15, 0x13,
+    0x08, 0x15, 0x85, 0x65, 0x72, 0x74, 0x6F, 0x69, 0x72, 0x65, 0x00, 0x14, 0x42, 0x44, 0x05, 0x47,
+    0x0D, 0x84, 0x63, 0x71, 0x75, 0x69, 0x72, 0x65, 0x00, 0x04, 0x85, 0x63, 0x71, 0x75, 0x69, 0x72,
+    0x65, 0x00, 0x42, 0x47, 0x05, 0x50, 0x0D, 0x08, 0x05, 0x83, 0x66, 0x6F, 0x72, 0x65, 0x00, 0x0B,
+    0x13, 0x12, 0x16, 0x83, 0x6F, 0x6D, 0x6F, 0x72, 0x65, 0x00, 0x18, 0x06, 0x08, 0x0D, 0x11, 0x12,
+    0x06, 0x83, 0x74, 0x75, 0x72, 0x65, 0x00, 0x47, 0x44, 0x0F, 0x47, 0x1D, 0x4B, 0x29, 0x4F, 0x33,
+    0x56, 0x49, 0x57, 0x6B, 0x5D, 0xFF, 0x17, 0x15, 0x08, 0x13, 0x10, 0x08, 0x17, 0x84, 0x61, 0x74,
+    0x75, 0x72, 0x65, 0x00, 0x08, 0x08, 0x06, 0x12, 0x15, 0x13, 0x84, 0x64, 0x75, 0x72, 0x65, 0x00,
+    0x06, 0x0F, 0x18, 0x13, 0x08, 0x16, 0x82, 0x72, 0x65, 0x00, 0x18, 0x06, 0x42, 0x48, 0x05, 0x4C,
+    0x0B, 0x13, 0x82, 0x69, 0x61, 0x72, 0x00, 0x15, 0x0A, 0x04, 0x82, 0x74, 0x75, 0x72, 0x65, 0x00,
+    0x43, 0x48, 0x07, 0x51, 0x11, 0x56, 0x1C, 0x0C, 0x0F, 0x85, 0x65, 0x69, 0x73, 0x75, 0x72, 0x65,
+    0x00, 0x08, 0x16, 0x86, 0x63, 0x65, 0x6E, 0x73, 0x75, 0x72, 0x65, 0x00, 0x08, 0x0F, 0x05, 0x02,
+    0x48, 0x7B, 0x45, 0x44, 0x0B, 0x46, 0x4E, 0x55, 0x6A, 0x56, 0x7E, 0x58, 0x88, 0x45, 0x49, 0x0B,
+    0x50, 0x16, 0x51, 0x20, 0x55, 0x2A, 0x57, 0x38, 0x18, 0x11, 0x04, 0x10, 0x83, 0x63, 0x74, 0x75,
+    0x72, 0x65, 0x00, 0x04, 0x85, 0x72, 0x6D, 0x61, 0x74, 0x75, 0x72, 0x65, 0x00, 0x0C, 0x10, 0x84,
+    0x69, 0x61, 0x74, 0x75, 0x72, 0x65, 0x00, 0x08, 0x10, 0x08, 0x17, 0x86, 0x70, 0x65, 0x72, 0x61,
+    0x74, 0x75, 0x72, 0x65, 0x00, 0x0C, 0x0F, 0x84, 0x65, 0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x00,
+    0x42, 0x55, 0x05, 0x58, 0x11, 0x18, 0x17, 0x16, 0x86, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65,
+    0x00, 0x17, 0x16, 0x85, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x00, 0x08, 0x42, 0x53, 0x05,
+    0x57, 0x0A, 0x10, 0x08, 0x17, 0x01, 0x04, 0x0C, 0x0F, 0x83, 0x61, 0x74, 0x75, 0x72, 0x65, 0x00,
+    0x12, 0x10, 0x84, 0x69, 0x73, 0x74, 0x75, 0x72, 0x65, 0x00, 0x06, 0x0C, 0x15, 0x0A, 0x04, 0x83,
+    0x6C, 0x74, 0x75, 0x72, 0x65, 0x00, 0x08, 0x0C, 0x16, 0x85, 0x65, 0x69, 0x7A, 0x75, 0x72, 0x65,
+    0x00, 0x42, 0x48, 0x05, 0x58, 0x0E, 0x18, 0x12, 0x84, 0x65, 0x75, 0x76, 0x72, 0x65, 0x00, 0x12,
+    0x08, 0x11, 0x04, 0x10, 0x85, 0x6F, 0x65, 0x75, 0x76, 0x72, 0x65, 0x00, 0x48, 0x84, 0x19, 0x00,
+    0x88, 0x42, 0x00, 0x8C, 0x7D, 0x00, 0x8E, 0xD6, 0x00, 0x91, 0xDB, 0x00, 0x92, 0x2E, 0x01, 0x95,
+    0x48, 0x01, 0x98, 0x56, 0x01, 0x42, 0x88, 0x07, 0x00, 0x98, 0x66, 0x01, 0x43, 0x4F, 0x07, 0x55,
+    0x15, 0x58, 0x1A, 0x13, 0x11, 0x18, 0x87, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x65, 0x61, 0x73, 0x65,
+    0x00, 0x08, 0x0B, 0x02, 0x86, 0x54, 0x0A, 0x18, 0x17, 0x15, 0x12, 0x13, 0x01, 0x11, 0x46, 0x48,
+    0x0D, 0x4A, 0x13, 0x4C, 0x1E, 0x51, 0x28, 0x52, 0x2E, 0x56, 0x32, 0x0B, 0x17, 0x82, 0x73, 0x65,
+    0x00, 0x18, 0x17, 0x15, 0x12, 0x13, 0x82, 0x75, 0x65, 0x73, 0x65, 0x00, 0x06, 0x15, 0x08, 0x1B,
+    0x08, 0x82, 0x73, 0x65, 0x73, 0x00, 0x16, 0x81, 0x65, 0x7A, 0x65, 0x00, 0x07, 0x02, 0x21, 0x61,
+    0x12, 0x0C, 0x07, 0x83, 0x63, 0x65, 0x73, 0x65, 0x00, 0x46, 0x46, 0x0D, 0x47, 0x1A, 0x4A, 0x2B,
+    0x50, 0x35, 0x55, 0x42, 0x57, 0x50, 0x15, 0x08, 0x06, 0x1B, 0x08, 0x86, 0x65, 0x72, 0x63, 0x69,
+    0x73, 0x65, 0x00, 0x11, 0x04, 0x0B, 0x06, 0x08, 0x10, 0x87, 0x72, 0x63, 0x68, 0x61, 0x6E, 0x64,
+    0x69, 0x73, 0x65, 0x00, 0x12, 0x06, 0x08, 0x15, 0x82, 0x6E, 0x69, 0x73, 0x65, 0x00, 0x0C, 0x15,
+    0x13, 0x10, 0x12, 0x06, 0x84, 0x6F, 0x6D, 0x69, 0x73, 0x65, 0x00, 0x42, 0x52, 0x05, 0x53, 0x0A,
+    0x17, 0x16, 0x02, 0xAB, 0x4B, 0x18, 0x02, 0x08, 0x09, 0x15, 0x12, 0x17, 0x82, 0x6F, 0x69, 0x73,
+    0x65, 0x00, 0x04, 0x10, 0x02, 0x99, 0x4B, 0x44, 0x44, 0x09, 0x48, 0x0F, 0x4C, 0x43, 0x52, 0x48,
+    0x16, 0x0C, 0x18, 0x11, 0x01, 0x37, 0x43, 0x46, 0x07, 0x50, 0x11, 0x56, 0x19, 0x16, 0x0C, 0x0F,
+    0x85, 0x63, 0x65, 0x6E, 0x73, 0x65, 0x00, 0x0C, 0x83, 0x6D, 0x65, 0x6E, 0x73, 0x65, 0x00, 0x44,
+    0x45, 0x09, 0x48, 0x0C, 0x4C, 0x10, 0x56, 0x18, 0x04, 0x01, 0x12, 0x15, 0x13, 0x01, 0x0E, 0x0F,
+    0x84, 0x63, 0x65, 0x6E, 0x73, 0x65, 0x00, 0x08, 0x01, 0x03, 0x16, 0x81, 0x63, 0x65, 0x00, 0x13,
+    0x08, 0x15, 0x84, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x00, 0x42, 0x4B, 0x05, 0x53, 0x0E, 0x17,
+    0x08, 0x85, 0x74, 0x68, 0x6F, 0x73, 0x65, 0x00, 0x42, 0x52, 0x06, 0x58, 0x05, 0x16, 0x82, 0x70,
+    0x6F, 0x73, 0x65, 0x00, 0x08, 0x19, 0x08, 0x15, 0x13, 0x86, 0x65, 0x72, 0x76, 0x65, 0x72, 0x73,
+    0x65, 0x00, 0x43, 0x44, 0x07, 0x46, 0x1F, 0x52, 0x29, 0x06, 0x42, 0x46, 0x05, 0x48, 0x0D, 0x08,
+    0x05, 0x84, 0x61, 0x75, 0x73, 0x65, 0x00, 0x06, 0x86, 0x62, 0x65, 0x63, 0x61, 0x75, 0x73, 0x65,
+    0x00, 0x04, 0x08, 0x05, 0x84, 0x63, 0x61, 0x75, 0x73, 0x65, 0x00, 0x06, 0x08, 0x05, 0x83, 0x61,
+    0x75, 0x73, 0x65, 0x00, 0x47, 0x84, 0x16, 0x00, 0x88, 0xB3, 0x03, 0x8C, 0xD1, 0x03, 0x8F, 0x9C,
+    0x04, 0x97, 0xA7, 0x04, 0x98, 0xD8, 0x04, 0x99, 0xFF, 0x04, 0x4C, 0x85, 0x25, 0x00, 0x86, 0x33,
+    0x00, 0x87, 0x4D, 0x00, 0x8A, 0x9B, 0x00, 0x8C, 0xC6, 0x00, 0x8F, 0xA5, 0x01, 0x90, 0xDC, 0x01,
+    0x91, 0x2C, 0x02, 0x95, 0x64, 0x02, 0x97, 0x24, 0x03, 0x98, 0x56, 0x03, 0x99, 0x81, 0x03, 0x15,
+    0x08, 0x1B, 0x08, 0x85, 0x61, 0x63, 0x65, 0x72, 0x62, 0x61, 0x74, 0x65, 0x00, 0x0C, 0x42, 0x52,
+    0x05, 0x53, 0x0F, 0x16, 0x16, 0x04, 0x84, 0x63, 0x69, 0x61, 0x74, 0x65, 0x00, 0x18, 0x07, 0x84,
+    0x6C, 0x69, 0x63, 0x61, 0x74, 0x65, 0x00, 0x43, 0x44, 0x07, 0x50, 0x13, 0x52, 0x1F, 0x42, 0x47,
+    0x05, 0x50, 0x09, 0x11, 0x04, 0x01, 0x1A, 0x12, 0x01, 0x32, 0x12, 0x06, 0x06, 0x04, 0x83, 0x6D,
+    0x6F, 0x64, 0x61, 0x74, 0x65, 0x00, 0x42, 0x4F, 0x05, 0x50, 0x11, 0x12, 0x16, 0x11, 0x12, 0x06,
+    0x84, 0x69, 0x64, 0x61, 0x74, 0x65, 0x00, 0x42, 0x50, 0x05, 0x52, 0x13, 0x12, 0x06, 0x04, 0x87,
+    0x63, 0x6F, 0x6D, 0x6D, 0x6F, 0x64, 0x61, 0x74, 0x65, 0x00, 0x06, 0x06, 0x04, 0x84, 0x6D, 0x6F,
+    0x64, 0x61, 0x74, 0x65, 0x00, 0x43, 0x48, 0x07, 0x51, 0x13, 0x52, 0x20, 0x15, 0x0A, 0x04, 0x85,
+    0x67, 0x72, 0x65, 0x67, 0x61, 0x74, 0x65, 0x00, 0x0C, 0x17, 0x16, 0x08, 0x19, 0x11, 0x0C, 0x84,
+    0x67, 0x61, 0x74, 0x65, 0x00, 0x13, 0x12, 0x15, 0x13, 0x84, 0x61, 0x67, 0x61, 0x74, 0x65, 0x00,
+    0x48, 0x46, 0x11, 0x47, 0x2D, 0x4F, 0x4D, 0x53, 0x61, 0x55, 0x89, 0x56, 0xA7, 0x57, 0xB2, 0x59,
+    0xC2, 0x42, 0x48, 0x05, 0x52, 0x12, 0x0C, 0x15, 0x13, 0x13, 0x04, 0x86, 0x65, 0x63, 0x69, 0x61,
+    0x74, 0x65, 0x00, 0x0A, 0x08, 0x11, 0x84, 0x74, 0x69, 0x61, 0x74, 0x65, 0x00, 0x43, 0x48, 0x07,
+    0x4C, 0x12, 0x51, 0x18, 0x10, 0x0C, 0x85, 0x6D, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x00, 0x07,
+    0x11, 0x04, 0x06, 0x01, 0x28, 0x04, 0x06, 0x82, 0x64, 0x61, 0x74, 0x65, 0x00, 0x42, 0x4C, 0x05,
+    0x4F, 0x0A, 0x06, 0x04, 0x09, 0x01, 0x57, 0x0C, 0x09, 0x09, 0x04, 0x84, 0x69, 0x61, 0x74, 0x65,
+    0x00, 0x42, 0x4C, 0x05, 0x52, 0x0F, 0x06, 0x0C, 0x17, 0x11, 0x04, 0x83, 0x61, 0x74, 0x65, 0x00,
+    0x15, 0x13, 0x42, 0x52, 0x05, 0x53, 0x0F, 0x15, 0x13, 0x13, 0x04, 0x85, 0x69, 0x61, 0x74, 0x65,
+    0x00, 0x04, 0x83, 0x72, 0x69, 0x61, 0x74, 0x65, 0x00, 0x42, 0x48, 0x05, 0x53, 0x0F, 0x17, 0x08,
+    0x07, 0x82, 0x6F, 0x72, 0x61, 0x74, 0x65, 0x00, 0x12, 0x15, 0x13, 0x04, 0x87, 0x70, 0x72, 0x6F,
+    0x70, 0x72, 0x69, 0x61, 0x74, 0x65, 0x00, 0x16, 0x08, 0x06, 0x08, 0x11, 0x82, 0x74, 0x61, 0x74,
+    0x65, 0x00, 0x15, 0x12, 0x13, 0x12, 0x15, 0x13, 0x16, 0x0C, 0x07, 0x82, 0x6F, 0x6E, 0x61, 0x74,
+    0x65, 0x00, 0x42, 0x48, 0x05, 0x4C, 0x12, 0x15, 0x05, 0x04, 0x86, 0x62, 0x72, 0x65, 0x76, 0x69,
+    0x61, 0x74, 0x65, 0x00, 0x0F, 0x0F, 0x04, 0x85, 0x65, 0x76, 0x69, 0x61, 0x74, 0x65, 0x00, 0x43,
+    0x46, 0x07, 0x4C, 0x13, 0x58, 0x1C, 0x18, 0x0F, 0x04, 0x06, 0x85, 0x63, 0x75, 0x6C, 0x61, 0x74,
+    0x65, 0x00, 0x09, 0x09, 0x04, 0x82, 0x69, 0x61, 0x74, 0x65, 0x00, 0x42, 0x46, 0x05, 0x4F, 0x11,
+    0x18, 0x0F, 0x04, 0x06, 0x86, 0x63, 0x75, 0x6C, 0x61, 0x74, 0x65, 0x00, 0x04, 0x06, 0x84, 0x63,
+    0x75, 0x6C, 0x61, 0x74, 0x65, 0x00, 0x45, 0x44, 0x0B, 0x4C, 0x17, 0x52, 0x37, 0x57, 0x3B, 0x58,
+    0x46, 0x17, 0x0C, 0x0A, 0x08, 0x0F, 0x84, 0x69, 0x6D, 0x61, 0x74, 0x65, 0x00, 0x1B, 0x12, 0x15,
+    0x13, 0x42, 0x44, 0x05, 0x52, 0x10, 0x87, 0x70, 0x72, 0x6F, 0x78, 0x69, 0x6D, 0x61, 0x74, 0x65,
+    0x00, 0x15, 0x13, 0x13, 0x04, 0x88, 0x78, 0x69, 0x6D, 0x61, 0x74, 0x65, 0x00, 0x12, 0x15, 0x01,
+    0x11, 0x0C, 0x0A, 0x08, 0x0F, 0x83, 0x69, 0x6D, 0x61, 0x74, 0x65, 0x00, 0x16, 0x11, 0x12, 0x06,
+    0x82, 0x6D, 0x61, 0x74, 0x65, 0x00, 0x42, 0x4C, 0x05, 0x56, 0x2A, 0x42, 0x49, 0x05, 0x50, 0x0C,
+    0x08, 0x07, 0x82, 0x69, 0x74, 0x65, 0x00, 0x42, 0x48, 0x05, 0x4C, 0x0C, 0x84, 0x61, 0x6E, 0x61,
+    0x74, 0x65, 0x00, 0x04, 0x17, 0x11, 0x12, 0x06, 0x86, 0x6D, 0x69, 0x6E, 0x61, 0x74, 0x65, 0x00,
+    0x0C, 0x16, 0x16, 0x04, 0x85, 0x61, 0x73, 0x73, 0x69, 0x6E, 0x61, 0x74, 0x65, 0x00, 0x46, 0x44,
+    0x0D, 0x48, 0x26, 0x4A, 0x51, 0x52, 0x57, 0x55, 0x83, 0x57, 0x90, 0x13, 0x43, 0x50, 0x07, 0x55,
+    0x0B, 0x56, 0x14, 0x08, 0x17, 0x01, 0x65, 0x12, 0x06, 0x84, 0x6F, 0x72, 0x61, 0x74, 0x65, 0x00,
+    0x08, 0x07, 0x01, 0x58, 0x42, 0x51, 0x05, 0x53, 0x10, 0x04, 0x0A, 0x86, 0x65, 0x6E, 0x65, 0x72,
+    0x61, 0x74, 0x65, 0x00, 0x42, 0x48, 0x05, 0x58, 0x0D, 0x16, 0x84, 0x61, 0x72, 0x61, 0x74, 0x65,
+    0x00, 0x06, 0x18, 0x15, 0x88, 0x65, 0x63, 0x75, 0x70, 0x65, 0x72, 0x61, 0x74, 0x65, 0x00, 0x08,
+    0x07, 0x81, 0x64, 0x65, 0x00, 0x43, 0x4C, 0x07, 0x50, 0x15, 0x51, 0x22, 0x0F, 0x15, 0x08, 0x10,
+    0x04, 0x87, 0x6C, 0x69, 0x6F, 0x72, 0x61, 0x74, 0x65, 0x00, 0x10, 0x08, 0x10, 0x10, 0x12, 0x06,
+    0x85, 0x6F, 0x72, 0x61, 0x74, 0x65, 0x00, 0x12, 0x1B, 0x08, 0x84, 0x65, 0x72, 0x61, 0x74, 0x65,
+    0x00, 0x08, 0x0A, 0x04, 0x1B, 0x08, 0x85, 0x67, 0x65, 0x72, 0x61, 0x74, 0x65, 0x00, 0x43, 0x4C,
+    0x07, 0x51, 0x13, 0x56, 0x22, 0x0F, 0x0C, 0x09, 0x11, 0x0C, 0x85, 0x74, 0x72, 0x61, 0x74, 0x65,
+    0x00, 0x08, 0x16, 0x11, 0x12, 0x06, 0x87, 0x63, 0x65, 0x6E, 0x74, 0x72, 0x61, 0x74, 0x65, 0x00,
+    0x11, 0x0C, 0x10, 0x07, 0x04, 0x85, 0x69, 0x73, 0x74, 0x72, 0x61, 0x74, 0x65, 0x00, 0x43, 0x48,
+    0x07, 0x4C, 0x11, 0x56, 0x26, 0x19, 0x08, 0x0F, 0x84, 0x69, 0x74, 0x61, 0x74, 0x65, 0x00, 0x42,
+    0x4F, 0x05, 0x50, 0x0C, 0x0F, 0x0C, 0x06, 0x04, 0x09, 0x01, 0x04, 0x10, 0x0C, 0x85, 0x69, 0x74,
+    0x61, 0x74, 0x65, 0x00, 0x08, 0x10, 0x12, 0x0B, 0x84, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x00,
+    0x42, 0x46, 0x05, 0x54, 0x0F, 0x08, 0x07, 0x04, 0x84, 0x71, 0x75, 0x61, 0x74, 0x65, 0x00, 0x42,
+    0x47, 0x05, 0x4C, 0x10, 0x04, 0x11, 0x0C, 0x84, 0x65, 0x71, 0x75, 0x61, 0x74, 0x65, 0x00, 0x07,
+    0x04, 0x11, 0x0C, 0x85, 0x65, 0x71, 0x75, 0x61, 0x74, 0x65, 0x00, 0x42, 0x44, 0x05, 0x52, 0x11,
+    0x15, 0x0A, 0x04, 0x85, 0x67, 0x72, 0x61, 0x76, 0x61, 0x74, 0x65, 0x00, 0x11, 0x11, 0x08, 0x15,
+    0x85, 0x6F, 0x76, 0x61, 0x74, 0x65, 0x00, 0x0F, 0x42, 0x4F, 0x05, 0x53, 0x0D, 0x04, 0x13, 0x83,
+    0x65, 0x74, 0x74, 0x65, 0x00, 0x10, 0x12, 0x06, 0x10, 0x0C, 0x88, 0x6E, 0x63, 0x6F, 0x6D, 0x70,
+    0x6C, 0x65, 0x74, 0x65, 0x00, 0x49, 0x44, 0x13, 0x46, 0x20, 0x47, 0x2C, 0x4F, 0x32, 0x51, 0x72,
+    0x53, 0x89, 0x55, 0xA1, 0x56, 0xB8, 0x5A, 0xC3, 0x15, 0x13, 0x12, 0x15, 0x13, 0x13, 0x04, 0x83,
+    0x69, 0x61, 0x74, 0x65, 0x00, 0x0C, 0x05, 0x08, 0x0F, 0x13, 0x83, 0x73, 0x63, 0x69, 0x74, 0x65,
+    0x00, 0x11, 0x0C, 0x81, 0x63, 0x74, 0x00, 0x43, 0x44, 0x07, 0x48, 0x12, 0x52, 0x29, 0x10, 0x15,
+    0x04, 0x06, 0x84, 0x65, 0x6C, 0x69, 0x74, 0x65, 0x00, 0x17, 0x42, 0x44, 0x05, 0x57, 0x0C, 0x16,
+    0x82, 0x6C, 0x69, 0x74, 0x65, 0x00, 0x04, 0x16, 0x85, 0x65, 0x6C, 0x6C, 0x69, 0x74, 0x65, 0x00,
+    0x42, 0x51, 0x05, 0x53, 0x0C, 0x12, 0x10, 0x80, 0x68, 0x69, 0x63, 0x00, 0x11, 0x0C, 0x86, 0x6D,
+    0x70, 0x6F, 0x6C, 0x69, 0x74, 0x65, 0x00, 0x04, 0x42, 0x4C, 0x05, 0x55, 0x0C, 0x09, 0x84, 0x6E,
+    0x69, 0x74, 0x65, 0x00, 0x0A, 0x08, 0x10, 0x12, 0x13, 0x82, 0x61, 0x74, 0x65, 0x00, 0x16, 0x42,
+    0x4C, 0x05, 0x51, 0x0E, 0x07, 0x85, 0x65, 0x73, 0x70, 0x69, 0x74, 0x65, 0x00, 0x0C, 0x84, 0x20,
+    0x73, 0x70, 0x69, 0x74, 0x65, 0x00, 0x1A, 0x1C, 0x42, 0x44, 0x05, 0x53, 0x0C, 0x0F, 0x13, 0x81,
+    0x67, 0x68, 0x74, 0x00, 0x12, 0x06, 0x84, 0x72, 0x69, 0x67, 0x68, 0x74, 0x00, 0x12, 0x13, 0x12,
+    0x84, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x65, 0x00, 0x15, 0x84, 0x77, 0x72, 0x69, 0x74, 0x65, 0x00,
+    0x04, 0x13, 0x10, 0x08, 0x17, 0x83, 0x6C, 0x61, 0x74, 0x65, 0x00, 0x08, 0x42, 0x4F, 0x05, 0x56,
+    0x0F, 0x10, 0x12, 0x84, 0x65, 0x6C, 0x65, 0x74, 0x74, 0x65, 0x00, 0x42, 0x44, 0x05, 0x4C, 0x08,
+    0x06, 0x01, 0x09, 0x15, 0x42, 0x52, 0x05, 0x55, 0x0D, 0x10, 0x83, 0x73, 0x65, 0x74, 0x74, 0x65,
+    0x00, 0x12, 0x10, 0x86, 0x69, 0x73, 0x73, 0x65, 0x74, 0x74, 0x65, 0x00, 0x43, 0x45, 0x07, 0x46,
+    0x14, 0x4F, 0x1F, 0x0C, 0x15, 0x17, 0x04, 0x85, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x00,
+    0x08, 0x06, 0x1B, 0x08, 0x85, 0x65, 0x63, 0x75, 0x74, 0x65, 0x00, 0x12, 0x13, 0x82, 0x6C, 0x75,
+    0x74, 0x65, 0x00, 0x0C, 0x15, 0x13, 0x02, 0xFE, 0x57, 0x43, 0x4A, 0x07, 0x56, 0x1D, 0x57, 0x33,
+    0x42, 0x48, 0x05, 0x4F, 0x0F, 0x0F, 0x0F, 0x12, 0x06, 0x82, 0x61, 0x67, 0x75, 0x65, 0x00, 0x18,
+    0x07, 0x11, 0x0C, 0x02, 0x6F, 0x4E, 0x42, 0x44, 0x05, 0x55, 0x0D, 0x06, 0x08, 0x05, 0x82, 0x75,
+    0x73, 0x65, 0x00, 0x08, 0x13, 0x84, 0x75, 0x72, 0x73, 0x75, 0x65, 0x00, 0x42, 0x4C, 0x05, 0x4F,
+    0x0D, 0x17, 0x16, 0x11, 0x0C, 0x80, 0x74, 0x65, 0x00, 0x18, 0x06, 0x0C, 0x15, 0x0A, 0x04, 0x80,
+    0x72, 0x65, 0x00, 0x43, 0x88, 0x0A, 0x00, 0x8C, 0x2A, 0x00, 0x92, 0x99, 0x02, 0x0C, 0x42, 0x44,
+    0x05, 0x46, 0x09, 0x11, 0x02, 0xC8, 0x76, 0x43, 0x48, 0x07, 0x51, 0x0A, 0x55, 0x0E, 0x15, 0x01,
+    0x08, 0x12, 0x06, 0x01, 0x04, 0x08, 0x13, 0x83, 0x65, 0x69, 0x76, 0x65, 0x00, 0x45, 0x48, 0x0B,
+    0x4B, 0x25, 0x4F, 0x29, 0x56, 0x30, 0x57, 0x93, 0x43, 0x4B, 0x07, 0x4F, 0x0B, 0x55, 0x11, 0x06,
+    0x04, 0x01, 0x0B, 0x08, 0x42, 0x45, 0x08, 0x55, 0x08, 0x17, 0x08, 0x15, 0x83, 0x69, 0x65, 0x76,
+    0x65, 0x00, 0x06, 0x04, 0x01, 0x04, 0x08, 0x05, 0x81, 0x65, 0x76, 0x65, 0x00, 0x43, 0x48, 0x07,
+    0x51, 0x21, 0x56, 0x46, 0x43, 0x46, 0x07, 0x55, 0x0C, 0x56, 0x11, 0x06, 0x18, 0x16, 0x01, 0x0A,
+    0x0A, 0x0A, 0x04, 0x01, 0x05, 0x16, 0x12, 0x13, 0x82, 0x73, 0x69, 0x76, 0x65, 0x00, 0x08, 0x0B,
+    0x08, 0x15, 0x42, 0x4B, 0x05, 0x53, 0x14, 0x13, 0x10, 0x12, 0x06, 0x89, 0x72, 0x65, 0x68, 0x65,
+    0x6E, 0x73, 0x69, 0x76, 0x65, 0x00, 0x04, 0x88, 0x70, 0x72, 0x65, 0x68, 0x65, 0x6E, 0x73, 0x69,
+    0x76, 0x65, 0x00, 0x08, 0x15, 0x42, 0x4A, 0x05, 0x53, 0x10, 0x04, 0x86, 0x67, 0x72, 0x65, 0x73,
+    0x73, 0x69, 0x76, 0x65, 0x00, 0x12, 0x86, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x76, 0x65, 0x00,
+    0x47, 0x84, 0x16, 0x00, 0x86, 0xEE, 0x00, 0x88, 0x45, 0x01, 0x8C, 0x4F, 0x01, 0x91, 0xA8, 0x01,
+    0x96, 0xB6, 0x01, 0x98, 0xC2, 0x01, 0x46, 0x46, 0x0D, 0x4A, 0x1B, 0x50, 0x2B, 0x55, 0x30, 0x56,
+    0xA4, 0x57, 0xAB, 0x04, 0x19, 0x12, 0x15, 0x13, 0x86, 0x6F, 0x63, 0x61, 0x74, 0x69, 0x76, 0x65,
+    0x00, 0x12, 0x15, 0x08, 0x13, 0x88, 0x72, 0x65, 0x72, 0x6F, 0x67, 0x61, 0x74, 0x69, 0x76, 0x65,
+    0x00, 0x0C, 0x15, 0x13, 0x01, 0x92, 0x43, 0x48, 0x07, 0x52, 0x1F, 0x57, 0x4E, 0x42, 0x45, 0x05,
+    0x50, 0x0A, 0x04, 0x0F, 0x0F, 0x01, 0x05, 0x08, 0x10, 0x10, 0x12, 0x06, 0x86, 0x6F, 0x72, 0x61,
+    0x74, 0x69, 0x76, 0x65, 0x00, 0x43, 0x4B, 0x07, 0x4D, 0x13, 0x55, 0x20, 0x17, 0x18, 0x04, 0x84,
+    0x69, 0x74, 0x61, 0x74, 0x69, 0x76, 0x65, 0x00, 0x15, 0x08, 0x13, 0x88, 0x6A, 0x6F, 0x72, 0x61,
+    0x74, 0x69, 0x76, 0x65, 0x00, 0x08, 0x10, 0x10, 0x12, 0x06, 0x87, 0x6D, 0x6F, 0x72, 0x61, 0x74,
+    0x69, 0x76, 0x65, 0x00, 0x16, 0x42, 0x4C, 0x05, 0x51, 0x16, 0x11, 0x0C, 0x11, 0x0C, 0x10, 0x07,
+    0x04, 0x89, 0x73, 0x74, 0x72, 0x61, 0x74, 0x69, 0x76, 0x65, 0x00, 0x0C, 0x10, 0x07, 0x04, 0x87,
+    0x69, 0x73, 0x74, 0x72, 0x61, 0x74, 0x69, 0x76, 0x65, 0x00, 0x11, 0x08, 0x16, 0x11, 0x0C, 0x01,
+    0x17, 0x43, 0x44, 0x07, 0x48, 0x11, 0x51, 0x1C, 0x0F, 0x18, 0x10, 0x18, 0x06, 0x84, 0x69, 0x76,
+    0x65, 0x00, 0x13, 0x10, 0x12, 0x06, 0x84, 0x69, 0x74, 0x69, 0x76, 0x65, 0x00, 0x04, 0x16, 0x08,
+    0x15, 0x13, 0x08, 0x15, 0x87, 0x65, 0x6E, 0x74, 0x61, 0x74, 0x69, 0x76, 0x65, 0x00, 0x45, 0x44,
+    0x0B, 0x48, 0x18, 0x4F, 0x29, 0x51, 0x36, 0x58, 0x46, 0x0C, 0x07, 0x04, 0x15, 0x85, 0x6F, 0x61,
+    0x63, 0x74, 0x69, 0x76, 0x65, 0x00, 0x13, 0x16, 0x08, 0x15, 0x13, 0x89, 0x65, 0x72, 0x73, 0x70,
+    0x65, 0x63, 0x74, 0x69, 0x76, 0x65, 0x00, 0x08, 0x0F, 0x12, 0x06, 0x86, 0x6C, 0x65, 0x63, 0x74,
+    0x69, 0x76, 0x65, 0x00, 0x0C, 0x17, 0x06, 0x16, 0x0C, 0x07, 0x88, 0x74, 0x69, 0x6E, 0x63, 0x74,
+    0x69, 0x76, 0x65, 0x00, 0x15, 0x17, 0x16, 0x0C, 0x07, 0x89, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63,
+    0x74, 0x69, 0x76, 0x65, 0x00, 0x13, 0x10, 0x12, 0x06, 0x81, 0x74, 0x69, 0x76, 0x65, 0x00, 0x46,
+    0x44, 0x0D, 0x51, 0x14, 0x55, 0x21, 0x57, 0x30, 0x58, 0x38, 0x59, 0x43, 0x0C, 0x17, 0x0C, 0x11,
+    0x0C, 0x01, 0x2B, 0x18, 0x10, 0x0C, 0x07, 0x86, 0x69, 0x6E, 0x75, 0x74, 0x69, 0x76, 0x65, 0x00,
+    0x42, 0x44, 0x05, 0x52, 0x09, 0x13, 0x10, 0x01, 0x28, 0x0B, 0x17, 0x18, 0x04, 0x01, 0x32, 0x0C,
+    0x12, 0x0F, 0x13, 0x1B, 0x08, 0x01, 0x1C, 0x11, 0x0C, 0x10, 0x0C, 0x07, 0x84, 0x74, 0x69, 0x76,
+    0x65, 0x00, 0x42, 0x4C, 0x05, 0x55, 0x0A, 0x15, 0x08, 0x07, 0x01, 0x07, 0x08, 0x16, 0x11, 0x12,
+    0x06, 0x84, 0x61, 0x74, 0x69, 0x76, 0x65, 0x00, 0x08, 0x16, 0x08, 0x15, 0x13, 0x08, 0x15, 0x82,
+    0x61, 0x74, 0x69, 0x76, 0x65, 0x00, 0x42, 0x51, 0x05, 0x52, 0x09, 0x08, 0x16, 0x01, 0x18, 0x13,
+    0x01, 0x15, 0x17, 0x42, 0x46, 0x05, 0x51, 0x11, 0x08, 0x16, 0x11, 0x12, 0x06, 0x85, 0x75, 0x74,
+    0x69, 0x76, 0x65, 0x00, 0x0C, 0x83, 0x69, 0x74, 0x69, 0x76, 0x65, 0x00, 0x12, 0x15, 0x13, 0x02,
+    0x3D, 0x74, 0x0F, 0x17, 0x16, 0x82, 0x79, 0x6C, 0x65, 0x00, 0x42, 0x48, 0x05, 0x4C, 0x0D, 0x0C,
+    0x16, 0x83, 0x65, 0x69, 0x7A, 0x65, 0x00, 0x45, 0x48, 0x0B, 0x4A, 0x14, 0x4F, 0x1E, 0x55, 0x29,
+    0x56, 0x50, 0x11, 0x08, 0x0A, 0x12, 0x10, 0x12, 0x0B, 0x01, 0x12, 0x12, 0x06, 0x08, 0x15, 0x82,
+    0x6E, 0x69, 0x7A, 0x65, 0x00, 0x0F, 0x04, 0x10, 0x15, 0x12, 0x09, 0x83, 0x69, 0x7A, 0x65, 0x00,
+    0x42, 0x52, 0x05, 0x53, 0x13, 0x0A, 0x15, 0x08, 0x17, 0x04, 0x06, 0x86, 0x67, 0x6F, 0x72, 0x69,
+    0x7A, 0x65, 0x00, 0x42, 0x55, 0x05, 0x58, 0x0B, 0x18, 0x16, 0x81, 0x73, 0x65, 0x00, 0x16, 0x84,
+    0x72, 0x70, 0x72, 0x69, 0x73, 0x65, 0x00, 0x15, 0x08, 0x1B, 0x08, 0x83, 0x63, 0x69, 0x73, 0x65,
+    0x00, 0x45, 0x48, 0x0B, 0x49, 0x12, 0x4C, 0x20, 0x4F, 0x3B, 0x52, 0x55, 0x16, 0x1C, 0x10, 0x80,
+    0x6C, 0x66, 0x00, 0x0C, 0x17, 0x11, 0x04, 0x0F, 0x13, 0x84, 0x69, 0x6E, 0x74, 0x69, 0x66, 0x66,
+    0x00, 0x08, 0x43, 0x4B, 0x07, 0x4F, 0x0C, 0x55, 0x10, 0x42, 0x46, 0x0E, 0x57, 0x0E, 0x08, 0x05,
+    0x01, 0x07, 0x42, 0x45, 0x05, 0x4A, 0x05, 0x82, 0x69, 0x65, 0x66, 0x00, 0x08, 0x42, 0x50, 0x05,
+    0x56, 0x0F, 0x16, 0x0C, 0x0B, 0x84, 0x6D, 0x73, 0x65, 0x6C, 0x66, 0x00, 0x18, 0x12, 0x1C, 0x83,
+    0x72, 0x73, 0x65, 0x6C, 0x66, 0x00, 0x16, 0x11, 0x12, 0x0C, 0x17, 0x0C, 0x07, 0x11, 0x12, 0x06,
+    0x81, 0x20, 0x6F, 0x66, 0x00, 0x44, 0x8C, 0x0D, 0x00, 0x91, 0x45, 0x00, 0x92, 0x21, 0x09, 0x95,
+    0x2A, 0x09, 0x44, 0x47, 0x09, 0x48, 0x0E, 0x51, 0x1A, 0x55, 0x33, 0x11, 0x08, 0x02, 0x0E, 0x09,
+    0x15, 0x0E, 0x1D, 0x17, 0x0C, 0x0F, 0x05, 0x82, 0x69, 0x65, 0x67, 0x00, 0x43, 0x4B, 0x07, 0x51,
+    0x0B, 0x52, 0x12, 0x17, 0x02, 0x13, 0x70, 0x0C, 0x0A, 0x08, 0x05, 0x02, 0xF0, 0x08, 0x42, 0x87,
+    0x09, 0x70, 0x8A, 0x09, 0x70, 0x18, 0x07, 0x02, 0xE4, 0x08, 0x45, 0x84, 0x10, 0x00, 0x8C, 0x19,
+    0x00, 0x91, 0x96, 0x08, 0x92, 0x9E, 0x08, 0x98, 0xC3, 0x08, 0x0C, 0x15, 0x08, 0x09, 0x08, 0x15,
+    0x02, 0x9C, 0x07, 0x56, 0x84, 0x43, 0x00, 0x85, 0x8C, 0x00, 0x86, 0xAC, 0x00, 0x87, 0xCB, 0x00,
+    0x88, 0xC0, 0x01, 0x89, 0x39, 0x02, 0x8A, 0x41, 0x02, 0x8B, 0x84, 0x02, 0x8E, 0xAF, 0x02, 0x8F,
+    0xD3, 0x02, 0x90, 0x1B, 0x03, 0x91, 0x72, 0x03, 0x92, 0x13, 0x04, 0x93, 0x1F, 0x04, 0x95, 0x28,
+    0x04, 0x96, 0x1C, 0x05, 0x97, 0x81, 0x05, 0x98, 0xB9, 0x07, 0x99, 0xC6, 0x07, 0x9A, 0x08, 0x08,
+    0x9C, 0x18, 0x08, 0x9D, 0x32, 0x08, 0x45, 0x4E, 0x0B, 0x50, 0x17, 0x51, 0x1E, 0x55, 0x2C, 0x59,
+    0x41, 0x42, 0x50, 0x05, 0x57, 0x05, 0x84, 0x61, 0x6B, 0x69, 0x6E, 0x67, 0x00, 0x08, 0x15, 0x80,
+    0x69, 0x6E, 0x67, 0x00, 0x0C, 0x17, 0x11, 0x0C, 0x04, 0x10, 0x85, 0x61, 0x69, 0x6E, 0x69, 0x6E,
+    0x67, 0x00, 0x42, 0x57, 0x05, 0x58, 0x0B, 0x15, 0x12, 0x13, 0x02, 0x58, 0x04, 0x12, 0x06, 0x11,
+    0x08, 0x82, 0x67, 0x69, 0x6E, 0x67, 0x00, 0x0B, 0x84, 0x61, 0x76, 0x69, 0x6E, 0x67, 0x00, 0x0C,
+    0x15, 0x06, 0x42, 0x48, 0x05, 0x56, 0x10, 0x07, 0x86, 0x73, 0x63, 0x72, 0x69, 0x62, 0x69, 0x6E,
+    0x67, 0x00, 0x0C, 0x07, 0x88, 0x65, 0x73, 0x63, 0x72, 0x69, 0x62, 0x69, 0x6E, 0x67, 0x00, 0x43,
+    0x44, 0x07, 0x4C, 0x0C, 0x51, 0x17, 0x08, 0x15, 0x02, 0xFE, 0x06, 0x09, 0x09, 0x04, 0x15, 0x17,
+    0x82, 0x6B, 0x69, 0x6E, 0x67, 0x00, 0x08, 0x13, 0x16, 0x0C, 0x07, 0x02, 0x88, 0x07, 0x48, 0x44,
+    0x11, 0x48, 0x21, 0x4C, 0x39, 0x4F, 0x44, 0x51, 0x52, 0x55, 0xA9, 0x56, 0xB5, 0x58, 0xC6, 0x16,
+    0x18, 0x16, 0x18, 0x13, 0x88, 0x65, 0x72, 0x73, 0x75, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x00, 0x42,
+    0x46, 0x05, 0x48, 0x0F, 0x12, 0x15, 0x13, 0x83, 0x65, 0x64, 0x69, 0x6E, 0x67, 0x00, 0x06, 0x08,
+    0x15, 0x84, 0x64, 0x69, 0x6E, 0x67, 0x00, 0x06, 0x08, 0x15, 0x85, 0x73, 0x69, 0x64, 0x69, 0x6E,
+    0x67, 0x00, 0x18, 0x0C, 0x05, 0x08, 0x15, 0x86, 0x75, 0x69, 0x6C, 0x64, 0x69, 0x6E, 0x67, 0x00,
+    0x44, 0x44, 0x09, 0x48, 0x18, 0x52, 0x64, 0x58, 0x46, 0x17, 0x16, 0x18, 0x12, 0x87, 0x74, 0x73,
+    0x74, 0x61, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x00, 0x43, 0x46, 0x07, 0x53, 0x15, 0x56, 0x21, 0x11,
+    0x04, 0x15, 0x17, 0x86, 0x73, 0x63, 0x65, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x00, 0x11, 0x0C, 0x87,
+    0x6D, 0x70, 0x65, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x00, 0x11, 0x04, 0x15, 0x17, 0x85, 0x63, 0x65,
+    0x6E, 0x64, 0x69, 0x6E, 0x67, 0x00, 0x12, 0x15, 0x15, 0x12, 0x16, 0x89, 0x75, 0x72, 0x72, 0x6F,
+    0x75, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x00, 0x12, 0x06, 0x04, 0x85, 0x63, 0x6F, 0x72, 0x64, 0x69,
+    0x6E, 0x67, 0x00, 0x12, 0x13, 0x08, 0x15, 0x15, 0x12, 0x06, 0x86, 0x73, 0x70, 0x6F, 0x6E, 0x64,
+    0x69, 0x6E, 0x67, 0x00, 0x43, 0x46, 0x07, 0x52, 0x20, 0x57, 0x2B, 0x42, 0x4F, 0x05, 0x51, 0x10,
+    0x11, 0x0C, 0x86, 0x63, 0x6C, 0x75, 0x64, 0x69, 0x6E, 0x67, 0x00, 0x0C, 0x84, 0x6C, 0x75, 0x64,
+    0x69, 0x6E, 0x67, 0x00, 0x15, 0x15, 0x18, 0x16, 0x83, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x00, 0x16,
+    0x02, 0x12, 0x03, 0x4B, 0x46, 0x17, 0x48, 0x3B, 0x4A, 0x29, 0x4C, 0x34, 0x50, 0x38, 0x51, 0x3F,
+    0x55, 0x44, 0x56, 0x56, 0x57, 0x5C, 0x58, 0x61, 0x59, 0x71, 0x42, 0x4C, 0x05, 0x55, 0x0B, 0x17,
+    0x12, 0x11, 0x02, 0x86, 0x05, 0x12, 0x09, 0x11, 0x08, 0x02, 0x7F, 0x05, 0x07, 0x08, 0x0F, 0x1A,
+    0x12, 0x11, 0x0E, 0x06, 0x02, 0x10, 0x01, 0x0F, 0x02, 0x2E, 0x06, 0x12, 0x06, 0x08, 0x05, 0x02,
+    0x69, 0x05, 0x0C, 0x0B, 0x02, 0xAF, 0x02, 0x43, 0x84, 0x62, 0x01, 0x88, 0x0A, 0x00, 0x8A, 0x11,
+    0x00, 0x09, 0x15, 0x08, 0x17, 0x11, 0x01, 0x1A, 0x04, 0x82, 0x65, 0x69, 0x6E, 0x67, 0x00, 0x04,
+    0x0E, 0x02, 0x92, 0x02, 0x42, 0x51, 0x05, 0x56, 0x0B, 0x0C, 0x17, 0x11, 0x02, 0x3C, 0x01, 0x16,
+    0x0C, 0x02, 0x37, 0x05, 0x04, 0x42, 0x8B, 0x33, 0x05, 0x96, 0x33, 0x05, 0x0C, 0x15, 0x15, 0x12,
+    0x0B, 0x02, 0x91, 0x02, 0x43, 0x4C, 0x07, 0x51, 0x13, 0x52, 0x3C, 0x08, 0x16, 0x08, 0x05, 0x85,
+    0x69, 0x65, 0x67, 0x69, 0x6E, 0x67, 0x00, 0x42, 0x48, 0x05, 0x4C, 0x20, 0x42, 0x4F, 0x05, 0x56,
+    0x11, 0x04, 0x0B, 0x06, 0x85, 0x6C, 0x65, 0x6E, 0x67, 0x69, 0x6E, 0x67, 0x00, 0x16, 0x08, 0x10,
+    0x85, 0x61, 0x67, 0x69, 0x6E, 0x67, 0x00, 0x11, 0x0C, 0x15, 0x85, 0x67, 0x69, 0x6E, 0x67, 0x00,
+    0x84, 0x67, 0x6F, 0x69, 0x6E, 0x67, 0x00, 0x42, 0x46, 0x05, 0x57, 0x19, 0x42, 0x44, 0x05, 0x51,
+    0x09, 0x1C, 0x02, 0x1A, 0x05, 0x04, 0x0B, 0x06, 0x1B, 0x08, 0x84, 0x67, 0x69, 0x6E, 0x67, 0x00,
+    0x42, 0x8C, 0x79, 0x47, 0x95, 0x07, 0x00, 0x08, 0x19, 0x08, 0x84, 0x79, 0x74, 0x68, 0x69, 0x6E,
+    0x67, 0x00, 0x43, 0x44, 0x07, 0x50, 0x11, 0x52, 0x1A, 0x0F, 0x17, 0x85, 0x61, 0x6C, 0x6B, 0x69,
+    0x6E, 0x67, 0x00, 0x04, 0x85, 0x6D, 0x61, 0x6B, 0x69, 0x6E, 0x67, 0x00, 0x15, 0x1A, 0x85, 0x6F,
+    0x72, 0x6B, 0x69, 0x6E, 0x67, 0x00, 0x44, 0x45, 0x09, 0x4A, 0x18, 0x4F, 0x26, 0x52, 0x40, 0x10,
+    0x08, 0x16, 0x16, 0x08, 0x15, 0x87, 0x65, 0x6D, 0x62, 0x6C, 0x69, 0x6E, 0x67, 0x00, 0x0A, 0x18,
+    0x17, 0x16, 0x86, 0x72, 0x75, 0x67, 0x67, 0x6C, 0x69, 0x6E, 0x67, 0x00, 0x42, 0x44, 0x05, 0x48,
+    0x0C, 0x08, 0x13, 0x13, 0x04, 0x02, 0x63, 0x04, 0x17, 0x15, 0x12, 0x09, 0x86, 0x65, 0x74, 0x65,
+    0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x00, 0x15, 0x17, 0x82, 0x6C, 0x69, 0x6E, 0x67, 0x00, 0x46, 0x44,
+    0x0D, 0x48, 0x19, 0x4C, 0x26, 0x4F, 0x3B, 0x50, 0x4A, 0x58, 0x4F, 0x0F, 0x06, 0x12, 0x15, 0x13,
+    0x83, 0x69, 0x6D, 0x69, 0x6E, 0x67, 0x00, 0x07, 0x08, 0x08, 0x15, 0x86, 0x64, 0x65, 0x65, 0x6D,
+    0x69, 0x6E, 0x67, 0x00, 0x42, 0x4F, 0x05, 0x5A, 0x12, 0x08, 0x0B, 0x1A, 0x15, 0x08, 0x19, 0x12,
+    0x84, 0x6D, 0x69, 0x6E, 0x67, 0x00, 0x16, 0x01, 0x18, 0x08, 0x1A, 0x15, 0x08, 0x19, 0x12, 0x85,
+    0x68, 0x65, 0x6C, 0x6D, 0x69, 0x6E, 0x67, 0x00, 0x12, 0x06, 0x02, 0xFE, 0x03, 0x15, 0x07, 0x82,
+    0x6D, 0x69, 0x6E, 0x67, 0x00, 0x45, 0x44, 0x0B, 0x4C, 0x16, 0x51, 0x75, 0x57, 0x8E, 0x58, 0x9A,
+    0x0F, 0x13, 0x1B, 0x08, 0x83, 0x69, 0x6E, 0x69, 0x6E, 0x67, 0x00, 0x44, 0x44, 0x09, 0x4A, 0x1D,
+    0x4F, 0x41, 0x51, 0x51, 0x17, 0x15, 0x08, 0x17, 0x11, 0x0C, 0x8B, 0x65, 0x6E, 0x74, 0x65, 0x72,
+    0x74, 0x61, 0x69, 0x6E, 0x69, 0x6E, 0x67, 0x00, 0x42, 0x48, 0x05, 0x4C, 0x08, 0x05, 0x01, 0x62,
+    0x43, 0x45, 0x07, 0x48, 0x11, 0x56, 0x14, 0x86, 0x65, 0x67, 0x69, 0x6E, 0x6E, 0x69, 0x6E, 0x67,
+    0x00, 0x15, 0x01, 0x04, 0x08, 0x07, 0x84, 0x6E, 0x69, 0x6E, 0x67, 0x00, 0x10, 0x08, 0x08, 0x15,
+    0x17, 0x16, 0x87, 0x61, 0x6D, 0x6C, 0x69, 0x6E, 0x69, 0x6E, 0x67, 0x00, 0x0C, 0x42, 0x49, 0x08,
+    0x50, 0x05, 0x15, 0x08, 0x17, 0x08, 0x07, 0x82, 0x67, 0x00, 0x42, 0x4C, 0x05, 0x52, 0x12, 0x0A,
+    0x0C, 0x05, 0x87, 0x65, 0x67, 0x69, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x00, 0x0C, 0x17, 0x06, 0x11,
+    0x04, 0x01, 0xB2, 0x04, 0x08, 0x15, 0x0B, 0x17, 0x83, 0x65, 0x6E, 0x69, 0x6E, 0x67, 0x00, 0x15,
+    0x82, 0x6E, 0x69, 0x6E, 0x67, 0x00, 0x1A, 0x0F, 0x0F, 0x12, 0x09, 0x84, 0x6F, 0x77, 0x69, 0x6E,
+    0x67, 0x00, 0x0C, 0x0B, 0x16, 0x82, 0x70, 0x69, 0x6E, 0x67, 0x00, 0x48, 0x44, 0x11, 0x48, 0x1F,
+    0x4C, 0x4B, 0x4E, 0x6E, 0x52, 0x77, 0x55, 0x80, 0x58, 0xA0, 0x59, 0xE4, 0x42, 0x48, 0x05, 0x59,
+    0x96, 0x0B, 0x07, 0x04, 0x84, 0x72, 0x69, 0x6E, 0x67, 0x00, 0x42, 0x47, 0x05, 0x49, 0x15, 0x11,
+    0x18, 0x15, 0x15, 0x18, 0x16, 0x87, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x69, 0x6E, 0x67, 0x00, 0x43,
+    0x48, 0x8C, 0x49, 0x07, 0x56, 0x11, 0x08, 0x15, 0x85, 0x65, 0x72, 0x72, 0x69, 0x6E, 0x67, 0x00,
+    0x11, 0x04, 0x15, 0x17, 0x01, 0x78, 0x42, 0x57, 0x05, 0x58, 0x08, 0x16, 0x01, 0x70, 0x14, 0x42,
+    0x44, 0x05, 0x47, 0x0F, 0x86, 0x63, 0x71, 0x75, 0x69, 0x72, 0x69, 0x6E, 0x67, 0x00, 0x04, 0x87,
+    0x63, 0x71, 0x75, 0x69, 0x72, 0x69, 0x6E, 0x67, 0x00, 0x12, 0x1A, 0x84, 0x72, 0x6B, 0x69, 0x6E,
+    0x67, 0x00, 0x06, 0x06, 0x04, 0x82, 0x64, 0x69, 0x6E, 0x67, 0x00, 0x42, 0x48, 0x05, 0x58, 0x0C,
+    0x09, 0x09, 0x18, 0x16, 0x02, 0xB4, 0x02, 0x42, 0x86, 0x07, 0x00, 0x87, 0xB1, 0x02, 0x06, 0x04,
+    0x08, 0x15, 0x88, 0x63, 0x75, 0x72, 0x72, 0x69, 0x6E, 0x67, 0x00, 0x43, 0x45, 0x07, 0x46, 0x0D,
+    0x57, 0x27, 0x82, 0x79, 0x69, 0x6E, 0x67, 0x00, 0x42, 0x46, 0x05, 0x48, 0x13, 0x42, 0x48, 0x05,
+    0x52, 0x0F, 0x15, 0x85, 0x75, 0x72, 0x72, 0x69, 0x6E, 0x67, 0x00, 0x15, 0x82, 0x72, 0x69, 0x6E,
+    0x67, 0x00, 0x42, 0x44, 0x05, 0x58, 0x13, 0x09, 0x18, 0x11, 0x04, 0x10, 0x85, 0x63, 0x74, 0x75,
+    0x72, 0x69, 0x6E, 0x67, 0x00, 0x11, 0x85, 0x72, 0x74, 0x75, 0x72, 0x69, 0x6E, 0x67, 0x00, 0x18,
+    0x12, 0x08, 0x11, 0x04, 0x10, 0x87, 0x6F, 0x65, 0x75, 0x76, 0x72, 0x69, 0x6E, 0x67, 0x00, 0x44,
+    0x44, 0x09, 0x48, 0x17, 0x4C, 0x21, 0x52, 0x4F, 0x0B, 0x06, 0x18, 0x13, 0x86, 0x72, 0x63, 0x68,
+    0x61, 0x73, 0x69, 0x6E, 0x67, 0x00, 0x15, 0x07, 0x07, 0x04, 0x82, 0x73, 0x69, 0x6E, 0x67, 0x00,
+    0x44, 0x46, 0x09, 0x4F, 0x15, 0x55, 0x1C, 0x56, 0x21, 0x08, 0x1B, 0x08, 0x85, 0x72, 0x63, 0x69,
+    0x73, 0x69, 0x6E, 0x67, 0x00, 0x05, 0x04, 0x17, 0x16, 0x02, 0x5C, 0x02, 0x13, 0x18, 0x02, 0xFB,
+    0x02, 0x0C, 0x17, 0x0C, 0x15, 0x06, 0x85, 0x63, 0x69, 0x73, 0x69, 0x6E, 0x67, 0x00, 0x42, 0x52,
+    0x05, 0x53, 0x0C, 0x0F, 0x84, 0x73, 0x69, 0x6E, 0x67, 0x00, 0x18, 0x16, 0x84, 0x70, 0x6F, 0x73,
+    0x69, 0x6E, 0x67, 0x00, 0x4B, 0x84, 0x22, 0x00, 0x86, 0xE8, 0x00, 0x8C, 0x17, 0x01, 0x8F, 0x3F,
+    0x01, 0x91, 0x4A, 0x01, 0x93, 0x83, 0x01, 0x95, 0xA2, 0x01, 0x96, 0xAC, 0x01, 0x97, 0xC9, 0x01,
+    0x98, 0x02, 0x02, 0x9C, 0x2E, 0x02, 0x46, 0x47, 0x0D, 0x4C, 0x21, 0x51, 0x2B, 0x55, 0x4C, 0x57,
+    0x8E, 0x59, 0xB8, 0x42, 0x44, 0x05, 0x52, 0x05, 0x10, 0x12, 0x06, 0x06, 0x04, 0x86, 0x6D, 0x6F,
+    0x64, 0x61, 0x74, 0x69, 0x6E, 0x67, 0x00, 0x15, 0x12, 0x0C, 0x15, 0x08, 0x17, 0x08, 0x07, 0x01,
+    0x88, 0x0C, 0x10, 0x42, 0x48, 0x05, 0x4C, 0x12, 0x0F, 0x08, 0x88, 0x69, 0x6D, 0x69, 0x6E, 0x61,
+    0x74, 0x69, 0x6E, 0x67, 0x00, 0x0F, 0x18, 0x06, 0x88, 0x6D, 0x69, 0x6E, 0x61, 0x74, 0x69, 0x6E,
+    0x67, 0x00, 0x44, 0x48, 0x09, 0x4A, 0x15, 0x52, 0x23, 0x55, 0x33, 0x13, 0x08, 0x16, 0x86, 0x61,
+    0x72, 0x61, 0x74, 0x69, 0x6E, 0x67, 0x00, 0x08, 0x11, 0x08, 0x07, 0x87, 0x69, 0x67, 0x72, 0x61,
+    0x74, 0x69, 0x6E, 0x67, 0x00, 0x10, 0x10, 0x08, 0x10, 0x10, 0x12, 0x06, 0x87, 0x6F, 0x72, 0x61,
+    0x74, 0x69, 0x6E, 0x67, 0x00, 0x08, 0x0A, 0x04, 0x1B, 0x08, 0x87, 0x67, 0x65, 0x72, 0x61, 0x74,
+    0x69, 0x6E, 0x67, 0x00, 0x43, 0x48, 0x07, 0x4C, 0x13, 0x51, 0x1F, 0x19, 0x08, 0x0F, 0x86, 0x69,
+    0x74, 0x61, 0x74, 0x69, 0x6E, 0x67, 0x00, 0x10, 0x10, 0x0C, 0x87, 0x69, 0x74, 0x61, 0x74, 0x69,
+    0x6E, 0x67, 0x00, 0x08, 0x0C, 0x0F, 0x04, 0x85, 0x61, 0x74, 0x69, 0x6E, 0x67, 0x00, 0x12, 0x11,
+    0x11, 0x08, 0x15, 0x87, 0x6F, 0x76, 0x61, 0x74, 0x69, 0x6E, 0x67, 0x00, 0x42, 0x48, 0x05, 0x4C,
+    0x25, 0x15, 0x18, 0x16, 0x42, 0x48, 0x05, 0x56, 0x0F, 0x15, 0x85, 0x72, 0x65, 0x63, 0x74, 0x69,
+    0x6E, 0x67, 0x00, 0x16, 0x08, 0x15, 0x89, 0x75, 0x72, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6E, 0x67,
+    0x00, 0x1B, 0x08, 0x85, 0x63, 0x69, 0x74, 0x69, 0x6E, 0x67, 0x00, 0x42, 0x50, 0x05, 0x58, 0x1C,
+    0x43, 0x88, 0x0C, 0x01, 0x90, 0x0A, 0x00, 0x92, 0x0C, 0x01, 0x42, 0x48, 0x05, 0x52, 0x05, 0x85,
+    0x69, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x00, 0x06, 0x08, 0x15, 0x85, 0x72, 0x75, 0x69, 0x74, 0x69,
+    0x6E, 0x67, 0x00, 0x04, 0x08, 0x10, 0x16, 0x85, 0x6C, 0x74, 0x69, 0x6E, 0x67, 0x00, 0x42, 0x48,
+    0x05, 0x4C, 0x29, 0x10, 0x42, 0x44, 0x05, 0x48, 0x13, 0x0F, 0x13, 0x10, 0x0C, 0x87, 0x65, 0x6D,
+    0x65, 0x6E, 0x74, 0x69, 0x6E, 0x67, 0x00, 0x0C, 0x0F, 0x13, 0x13, 0x18, 0x16, 0x88, 0x65, 0x6D,
+    0x65, 0x6E, 0x74, 0x69, 0x6E, 0x67, 0x00, 0x12, 0x13, 0x04, 0x16, 0x0C, 0x07, 0x86, 0x70, 0x6F,
+    0x69, 0x6E, 0x74, 0x69, 0x6E, 0x67, 0x00, 0x42, 0x4C, 0x05, 0x50, 0x12, 0x15, 0x06, 0x16, 0x11,
+    0x04, 0x15, 0x17, 0x84, 0x62, 0x69, 0x6E, 0x67, 0x00, 0x08, 0x17, 0x04, 0x86, 0x74, 0x65, 0x6D,
+    0x70, 0x74, 0x69, 0x6E, 0x67, 0x00, 0x0C, 0x1A, 0x85, 0x72, 0x69, 0x74, 0x69, 0x6E, 0x67, 0x00,
+    0x42, 0x44, 0x05, 0x4C, 0x15, 0x06, 0x04, 0x07, 0x04, 0x12, 0x15, 0x05, 0x87, 0x63, 0x61, 0x73,
+    0x74, 0x69, 0x6E, 0x67, 0x00, 0x19, 0x83, 0x69, 0x74, 0x69, 0x6E, 0x67, 0x00, 0x43, 0x44, 0x07,
+    0x48, 0x0E, 0x4C, 0x20, 0x15, 0x08, 0x11, 0x08, 0x0A, 0x01, 0x0F, 0x42, 0x4A, 0x05, 0x4E, 0x0A,
+    0x15, 0x04, 0x17, 0x01, 0x05, 0x15, 0x04, 0x10, 0x83, 0x69, 0x6E, 0x67, 0x00, 0x10, 0x42, 0x50,
+    0x05, 0x52, 0x0E, 0x08, 0x86, 0x69, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x00, 0x06, 0x85, 0x6D, 0x69,
+    0x74, 0x74, 0x69, 0x6E, 0x67, 0x00, 0x44, 0x46, 0x09, 0x47, 0x16, 0x4F, 0x1C, 0x53, 0x26, 0x08,
+    0x06, 0x1B, 0x08, 0x87, 0x65, 0x63, 0x75, 0x74, 0x69, 0x6E, 0x67, 0x00, 0x83, 0x72, 0x69, 0x6E,
+    0x67, 0x00, 0x12, 0x13, 0x84, 0x6C, 0x75, 0x74, 0x69, 0x6E, 0x67, 0x00, 0x82, 0x74, 0x69, 0x6E,
+    0x67, 0x00, 0x15, 0x08, 0x19, 0x08, 0x82, 0x68, 0x69, 0x6E, 0x67, 0x00, 0x16, 0x15, 0x08, 0x13,
+    0x86, 0x75, 0x72, 0x73, 0x75, 0x69, 0x6E, 0x67, 0x00, 0x43, 0x48, 0x07, 0x4C, 0x20, 0x52, 0x34,
+    0x42, 0x46, 0x05, 0x4C, 0x0E, 0x08, 0x15, 0x83, 0x69, 0x76, 0x69, 0x6E, 0x67, 0x00, 0x06, 0x08,
+    0x15, 0x85, 0x65, 0x69, 0x76, 0x69, 0x6E, 0x67, 0x00, 0x08, 0x42, 0x4B, 0x05, 0x4F, 0x09, 0x06,
+    0x04, 0x01, 0x04, 0x08, 0x05, 0x85, 0x69, 0x65, 0x76, 0x69, 0x6E, 0x67, 0x00, 0x15, 0x13, 0x11,
+    0x0C, 0x87, 0x6D, 0x70, 0x72, 0x6F, 0x76, 0x69, 0x6E, 0x67, 0x00, 0x12, 0x0F, 0x42, 0x44, 0x06,
+    0x52, 0x05, 0x09, 0x84, 0x6C, 0x6F, 0x77, 0x69, 0x6E, 0x67, 0x00, 0x42, 0x4C, 0x05, 0x57, 0x11,
+    0x09, 0x0C, 0x06, 0x08, 0x13, 0x16, 0x84, 0x79, 0x69, 0x6E, 0x67, 0x00, 0x1C, 0x11, 0x04, 0x83,
+    0x68, 0x69, 0x6E, 0x67, 0x00, 0x43, 0x48, 0x07, 0x4C, 0x11, 0x5C, 0x3A, 0x0C, 0x16, 0x85, 0x65,
+    0x69, 0x7A, 0x69, 0x6E, 0x67, 0x00, 0x42, 0x55, 0x05, 0x57, 0x1E, 0x13, 0x42, 0x55, 0x05, 0x58,
+    0x0D, 0x18, 0x16, 0x83, 0x73, 0x69, 0x6E, 0x67, 0x00, 0x16, 0x86, 0x72, 0x70, 0x72, 0x69, 0x73,
+    0x69, 0x6E, 0x67, 0x00, 0x0C, 0x15, 0x06, 0x83, 0x63, 0x69, 0x7A, 0x69, 0x6E, 0x67, 0x00, 0x17,
+    0x08, 0x0F, 0x08, 0x16, 0x12, 0x15, 0x13, 0x86, 0x79, 0x74, 0x69, 0x7A, 0x69, 0x6E, 0x67, 0x00,
+    0x0C, 0x11, 0x04, 0x08, 0x10, 0x81, 0x67, 0x00, 0x42, 0x4B, 0x05, 0x57, 0x11, 0x17, 0x13, 0x0C,
+    0x07, 0x84, 0x68, 0x74, 0x68, 0x6F, 0x6E, 0x67, 0x00, 0x42, 0x4B, 0x05, 0x56, 0x0E, 0x13, 0x0C,
+    0x07, 0x82, 0x68, 0x6F, 0x6E, 0x67, 0x00, 0x82, 0x72, 0x6F, 0x6E, 0x67, 0x00, 0x43, 0x50, 0x07,
+    0x51, 0x0D, 0x52, 0x13, 0x04, 0x82, 0x6F, 0x6E, 0x67, 0x00, 0x11, 0x18, 0x15, 0x02, 0x2A, 0x67,
+    0x10, 0x04, 0x82, 0x6E, 0x67, 0x00, 0x16, 0x0A, 0x11, 0x0C, 0x16, 0x80, 0x6E, 0x67, 0x00, 0x18,
+    0x42, 0x45, 0x05, 0x52, 0x10, 0x0F, 0x08, 0x07, 0x0C, 0x08, 0x0B, 0x82, 0x65, 0x72, 0x67, 0x00,
+    0x05, 0x16, 0x05, 0x04, 0x0B, 0x83, 0x75, 0x72, 0x67, 0x00, 0x48, 0x84, 0x19, 0x00, 0x86, 0x2E,
+    0x00, 0x88, 0x9C, 0x00, 0x8A, 0xA5, 0x00, 0x8C, 0xEC, 0x00, 0x93, 0xF4, 0x00, 0x96, 0x12, 0x01,
+    0x97, 0x60, 0x01, 0x42, 0x47, 0x05, 0x52, 0x0C, 0x07, 0x18, 0x05, 0x81, 0x68, 0x61, 0x00, 0x15,
+    0x04, 0x0B, 0x13, 0x82, 0x61, 0x6F, 0x68, 0x00, 0x47, 0x44, 0x0F, 0x48, 0x28, 0x4C, 0x31, 0x4F,
+    0xBF, 0x55, 0x3C, 0x57, 0x60, 0x58, 0x67, 0x08, 0x42, 0x53, 0x05, 0x56, 0x59, 0x42, 0x51, 0x05,
+    0x56, 0x0E, 0x0C, 0x85, 0x6D, 0x70, 0x65, 0x61, 0x63, 0x68, 0x00, 0x82, 0x65, 0x63, 0x68, 0x00,
+    0x15, 0x13, 0x16, 0x83, 0x65, 0x65, 0x63, 0x68, 0x00, 0x0B, 0x1A, 0x07, 0x11, 0x04, 0x16, 0x83,
+    0x69, 0x63, 0x68, 0x00, 0x42, 0x44, 0x05, 0x58, 0x12, 0x08, 0x16, 0x04, 0x08, 0x15, 0x86, 0x73,
+    0x65, 0x61, 0x72, 0x63, 0x68, 0x00, 0x42, 0x46, 0x05, 0x52, 0x0C, 0x83, 0x68, 0x75, 0x72, 0x63,
+    0x68, 0x00, 0x17, 0x83, 0x72, 0x63, 0x68, 0x00, 0x04, 0x1C, 0x82, 0x63, 0x68, 0x74, 0x00, 0x0B,
+    0x06, 0x81, 0x72, 0x63, 0x68, 0x00, 0x13, 0x16, 0x12, 0x0D, 0x82, 0x65, 0x70, 0x68, 0x00, 0x18,
+    0x12, 0x43, 0x4B, 0x07, 0x55, 0x30, 0x57, 0x3C, 0x17, 0x43, 0x4E, 0x07, 0x4F, 0x12, 0x51, 0x1C,
+    0x04, 0x08, 0x15, 0x05, 0x83, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x00, 0x0F, 0x04, 0x86, 0x74, 0x68,
+    0x6F, 0x75, 0x67, 0x68, 0x00, 0x08, 0x19, 0x08, 0x85, 0x20, 0x74, 0x68, 0x6F, 0x75, 0x67, 0x68,
+    0x00, 0x12, 0x15, 0x0B, 0x17, 0x86, 0x6F, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x00, 0x0F, 0x04, 0x83,
+    0x68, 0x6F, 0x75, 0x67, 0x68, 0x00, 0x06, 0x0B, 0x1A, 0x82, 0x69, 0x63, 0x68, 0x00, 0x42, 0x44,
+    0x05, 0x4F, 0x13, 0x15, 0x0A, 0x11, 0x12, 0x0B, 0x13, 0x84, 0x6F, 0x67, 0x72, 0x61, 0x70, 0x68,
+    0x00, 0x0A, 0x12, 0x15, 0x08, 0x0C, 0x0B, 0x81, 0x79, 0x70, 0x68, 0x00, 0x0C, 0x46, 0x4A, 0x0D,
+    0x4F, 0x19, 0x50, 0x28, 0x51, 0x2E, 0x55, 0x38, 0x57, 0x44, 0x11, 0x0C, 0x17, 0x16, 0x0C, 0x07,
+    0x82, 0x75, 0x69, 0x73, 0x68, 0x00, 0x13, 0x10, 0x12, 0x06, 0x04, 0x86, 0x63, 0x6F, 0x6D, 0x70,
+    0x6C, 0x69, 0x73, 0x68, 0x00, 0x10, 0x08, 0x0F, 0x09, 0x01, 0x1C, 0x0C, 0x04, 0x13, 0x16, 0x84,
+    0x6E, 0x69, 0x73, 0x68, 0x00, 0x12, 0x18, 0x0F, 0x09, 0x85, 0x6F, 0x75, 0x72, 0x69, 0x73, 0x68,
+    0x00, 0x17, 0x0C, 0x15, 0x05, 0x83, 0x69, 0x73, 0x68, 0x00, 0x49, 0x44, 0x13, 0x48, 0x20, 0x4A,
+    0x35, 0x4C, 0x51, 0x4F, 0x63, 0x51, 0x6B, 0x53, 0x85, 0x55, 0x8B, 0x58, 0x91, 0x08, 0x1A, 0x11,
+    0x12, 0x10, 0x10, 0x12, 0x06, 0x81, 0x6C, 0x74, 0x68, 0x00, 0x42, 0x51, 0x05, 0x55, 0x0A, 0x0C,
+    0x11, 0x02, 0x14, 0x68, 0x08, 0x1D, 0x04, 0x11, 0x84, 0x61, 0x72, 0x65, 0x74, 0x68, 0x00, 0x43,
+    0x48, 0x07, 0x4C, 0x10, 0x58, 0x16, 0x15, 0x17, 0x16, 0x82, 0x6E, 0x67, 0x74, 0x68, 0x00, 0x08,
+    0x81, 0x68, 0x74, 0x68, 0x00, 0x12, 0x09, 0x81, 0x68, 0x74, 0x00, 0x42, 0x4B, 0x05, 0x5A, 0x09,
+    0x1A, 0x02, 0x6A, 0x65, 0x07, 0x11, 0x04, 0x05, 0x81, 0x64, 0x74, 0x68, 0x00, 0x08, 0x1A, 0x17,
+    0x81, 0x66, 0x74, 0x68, 0x00, 0x42, 0x48, 0x05, 0x58, 0x13, 0x08, 0x17, 0x11, 0x0C, 0x11, 0x85,
+    0x65, 0x74, 0x65, 0x65, 0x6E, 0x74, 0x68, 0x00, 0x12, 0x10, 0x83, 0x6E, 0x74, 0x68, 0x00, 0x08,
+    0x1A, 0x16, 0x02, 0x1C, 0x4C, 0x18, 0x12, 0x16, 0x02, 0xAD, 0x67, 0x12, 0x09, 0x81, 0x72, 0x74,
+    0x68, 0x00, 0x45, 0x47, 0x0B, 0x48, 0x16, 0x53, 0x1D, 0x55, 0x3D, 0x57, 0x62, 0x11, 0x04, 0x0B,
+    0x0A, 0x84, 0x61, 0x6E, 0x64, 0x68, 0x69, 0x00, 0x19, 0x12, 0x10, 0x81, 0x69, 0x65, 0x00, 0x42,
+    0x4C, 0x05, 0x53, 0x12, 0x16, 0x0C, 0x16, 0x16, 0x0C, 0x10, 0x82, 0x73, 0x69, 0x70, 0x70, 0x69,
+    0x00, 0x0C, 0x16, 0x0C, 0x16, 0x16, 0x0C, 0x10, 0x83, 0x73, 0x69, 0x70, 0x70, 0x69, 0x00, 0x43,
+    0x48, 0x07, 0x4C, 0x0D, 0x58, 0x1A, 0x0B, 0x17, 0x81, 0x69, 0x72, 0x00, 0x18, 0x14, 0x06, 0x04,
+    0x07, 0x85, 0x69, 0x71, 0x75, 0x69, 0x72, 0x69, 0x00, 0x12, 0x16, 0x0C, 0x10, 0x83, 0x73, 0x6F,
+    0x75, 0x72, 0x69, 0x00, 0x17, 0x42, 0x44, 0x05, 0x4C, 0x1D, 0x11, 0x42, 0x4C, 0x05, 0x51, 0x0F,
+    0x06, 0x11, 0x0C, 0x06, 0x83, 0x6E, 0x61, 0x74, 0x69, 0x00, 0x0C, 0x06, 0x11, 0x0C, 0x06, 0x81,
+    0x69, 0x00, 0x09, 0x04, 0x15, 0x0A, 0x83, 0x66, 0x69, 0x74, 0x69, 0x00, 0x45, 0x44, 0x0B, 0x46,
+    0x14, 0x4C, 0x31, 0x51, 0x39, 0x52, 0x53, 0x08, 0x15, 0x0B, 0x16, 0x82, 0x69, 0x65, 0x6B, 0x00,
+    0x04, 0x42, 0x45, 0x05, 0x55, 0x0F, 0x10, 0x12, 0x06, 0x83, 0x65, 0x62, 0x61, 0x63, 0x6B, 0x00,
+    0x17, 0x11, 0x18, 0x12, 0x16, 0x84, 0x64, 0x74, 0x72, 0x61, 0x63, 0x6B, 0x00, 0x11, 0x15, 0x07,
+    0x82, 0x69, 0x6E, 0x6B, 0x00, 0x43, 0x4C, 0x07, 0x55, 0x0B, 0x58, 0x13, 0x17, 0x02, 0x72, 0x10,
+    0x18, 0x17, 0x83, 0x72, 0x75, 0x6E, 0x6B, 0x00, 0x0C, 0x0B, 0x17, 0x82, 0x6E, 0x6B, 0x00, 0x12,
+    0x12, 0x05, 0x81, 0x6B, 0x00, 0x49, 0x84, 0x1C, 0x00, 0x87, 0x41, 0x07, 0x88, 0x5B, 0x07, 0x8C,
+    0xB2, 0x07, 0x8F, 0xE3, 0x07, 0x92, 0xB8, 0x08, 0x98, 0xDD, 0x08, 0x9A, 0x2F, 0x09, 0x9C, 0x36,
+    0x09, 0x4E, 0x86, 0x2B, 0x00, 0x87, 0xE1, 0x01, 0x88, 0x04, 0x02, 0x8A, 0x2A, 0x02, 0x8B, 0x35,
+    0x02, 0x8C, 0x4A, 0x02, 0x90, 0x40, 0x04, 0x91, 0x47, 0x04, 0x93, 0x81, 0x05, 0x95, 0x9C, 0x05,
+    0x96, 0x0E, 0x06, 0x97, 0x32, 0x06, 0x98, 0xA7, 0x06, 0x99, 0xFE, 0x06, 0x43, 0x84, 0x0A, 0x00,
+    0x8C, 0x11, 0x00, 0x92, 0xB0, 0x01, 0x17, 0x16, 0x05, 0x12, 0x02, 0x50, 0x07, 0x4B, 0x84, 0x22,
+    0x00, 0x86, 0x28, 0x00, 0x87, 0x35, 0x00, 0x89, 0x3A, 0x00, 0x8A, 0x53, 0x00, 0x8B, 0x99, 0x00,
+    0x8F, 0xE0, 0x00, 0x91, 0x01, 0x01, 0x95, 0x2E, 0x01, 0x96, 0x59, 0x01, 0x97, 0x6D, 0x01, 0x15,
+    0x05, 0x08, 0x0A, 0x01, 0xD1, 0x15, 0x04, 0x15, 0x08, 0x0C, 0x0B, 0x83, 0x68, 0x69, 0x63, 0x61,
+    0x6C, 0x00, 0x18, 0x0D, 0x02, 0x18, 0x06, 0x42, 0x49, 0x05, 0x4C, 0x09, 0x12, 0x02, 0x0F, 0x06,
+    0x42, 0x55, 0x05, 0x57, 0x0B, 0x06, 0x04, 0x16, 0x02, 0x04, 0x06, 0x15, 0x04, 0x02, 0xFF, 0x05,
+    0x12, 0x0F, 0x43, 0x48, 0x07, 0x4C, 0x16, 0x52, 0x1F, 0x04, 0x0B, 0x06, 0x15, 0x04, 0x86, 0x6F,
+    0x6C, 0x6F, 0x67, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x85, 0x6C, 0x6F, 0x67, 0x69, 0x63, 0x61, 0x6C,
+    0x00, 0x42, 0x48, 0x05, 0x53, 0x12, 0x11, 0x08, 0x0A, 0x87, 0x61, 0x6C, 0x6F, 0x67, 0x69, 0x63,
+    0x61, 0x6C, 0x00, 0x12, 0x15, 0x17, 0x11, 0x04, 0x8A, 0x68, 0x72, 0x6F, 0x70, 0x6F, 0x6C, 0x6F,
+    0x67, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x42, 0x46, 0x05, 0x53, 0x13, 0x04, 0x15, 0x08, 0x0C, 0x0B,
+    0x85, 0x72, 0x63, 0x68, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x42, 0x44, 0x05, 0x52, 0x0E, 0x15, 0x0A,
+    0x12, 0x10, 0x08, 0x07, 0x02, 0x79, 0x65, 0x16, 0x42, 0x4C, 0x05, 0x52, 0x14, 0x0F, 0x0C, 0x0B,
+    0x13, 0x88, 0x6F, 0x73, 0x6F, 0x70, 0x68, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x0F, 0x1C, 0x0B, 0x13,
+    0x8A, 0x69, 0x6C, 0x6F, 0x73, 0x6F, 0x70, 0x68, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x42, 0x45, 0x05,
+    0x52, 0x10, 0x04, 0x0C, 0x07, 0x84, 0x6F, 0x6C, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x42, 0x4B, 0x05,
+    0x53, 0x0A, 0x12, 0x06, 0x0F, 0x01, 0xA3, 0x82, 0x74, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x42, 0x51,
+    0x05, 0x52, 0x21, 0x42, 0x44, 0x05, 0x4C, 0x10, 0x17, 0x0C, 0x15, 0x18, 0x13, 0x84, 0x69, 0x63,
+    0x61, 0x6C, 0x00, 0x05, 0x04, 0x15, 0x86, 0x62, 0x69, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x11,
+    0x11, 0x04, 0x06, 0x86, 0x6F, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x42, 0x48, 0x05, 0x57, 0x1D,
+    0x42, 0x50, 0x05, 0x53, 0x0E, 0x10, 0x12, 0x06, 0x83, 0x63, 0x69, 0x61, 0x6C, 0x00, 0x10, 0x08,
+    0x85, 0x69, 0x72, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x08, 0x10, 0x1C, 0x16, 0x86, 0x6D, 0x65, 0x74,
+    0x72, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x1C, 0x0B, 0x13, 0x04, 0x17, 0x04, 0x10, 0x8A, 0x65, 0x74,
+    0x61, 0x70, 0x68, 0x79, 0x73, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x44, 0x4F, 0x09, 0x51, 0x0D, 0x55,
+    0x1B, 0x56, 0x2A, 0x12, 0x13, 0x01, 0x17, 0x08, 0x07, 0x11, 0x0C, 0x88, 0x64, 0x65, 0x6E, 0x74,
+    0x69, 0x63, 0x61, 0x6C, 0x00, 0x42, 0x84, 0xC5, 0x05, 0x86, 0x07, 0x00, 0x84, 0x69, 0x74, 0x69,
+    0x63, 0x61, 0x6C, 0x00, 0x0C, 0x08, 0x0B, 0x17, 0x04, 0x02, 0x94, 0x64, 0x17, 0x12, 0x15, 0x13,
+    0x01, 0x5E, 0x43, 0x4C, 0x07, 0x52, 0x10, 0x55, 0x1B, 0x15, 0x12, 0x06, 0x83, 0x64, 0x69, 0x61,
+    0x6C, 0x00, 0x0C, 0x15, 0x12, 0x17, 0x84, 0x6F, 0x69, 0x64, 0x61, 0x6C, 0x00, 0x12, 0x10, 0x0C,
+    0x15, 0x13, 0x02, 0x8A, 0x04, 0x15, 0x42, 0x48, 0x05, 0x57, 0x1A, 0x42, 0x47, 0x05, 0x59, 0x10,
+    0x08, 0x16, 0x86, 0x69, 0x64, 0x65, 0x72, 0x65, 0x61, 0x6C, 0x00, 0x08, 0x16, 0x02, 0xA5, 0x04,
+    0x04, 0x0F, 0x0C, 0x11, 0x18, 0x83, 0x65, 0x72, 0x61, 0x6C, 0x00, 0x08, 0x0C, 0x0F, 0x0F, 0x0C,
+    0x84, 0x65, 0x67, 0x61, 0x6C, 0x00, 0x42, 0x52, 0x05, 0x57, 0x0C, 0x06, 0x0F, 0x04, 0x81, 0x6F,
+    0x6C, 0x00, 0x04, 0x08, 0x0F, 0x84, 0x74, 0x68, 0x61, 0x6C, 0x00, 0x48, 0x86, 0x19, 0x00, 0x87,
+    0xEA, 0x00, 0x90, 0xF6, 0x00, 0x91, 0x00, 0x01, 0x93, 0x20, 0x01, 0x95, 0x29, 0x01, 0x97, 0x5F,
+    0x01, 0x99, 0xE8, 0x01, 0x48, 0x44, 0x11, 0x4C, 0x16, 0x50, 0x7B, 0x51, 0x7F, 0x53, 0xA3, 0x55,
+    0xA7, 0x56, 0xBF, 0x58, 0xC7, 0x11, 0x0C, 0x09, 0x01, 0x60, 0x46, 0x49, 0x0D, 0x4B, 0x2D, 0x51,
+    0x37, 0x55, 0x3E, 0x57, 0x54, 0x59, 0x5B, 0x42, 0x49, 0x05, 0x4C, 0x14, 0x12, 0x11, 0x0C, 0x89,
+    0x75, 0x6E, 0x6F, 0x66, 0x66, 0x69, 0x63, 0x69, 0x61, 0x6C, 0x00, 0x11, 0x08, 0x05, 0x86, 0x65,
+    0x66, 0x69, 0x63, 0x69, 0x61, 0x6C, 0x00, 0x13, 0x04, 0x15, 0x0A, 0x12, 0x08, 0x0A, 0x02, 0x14,
+    0x04, 0x0C, 0x19, 0x12, 0x15, 0x13, 0x01, 0x0B, 0x42, 0x48, 0x05, 0x52, 0x0F, 0x10, 0x10, 0x12,
+    0x06, 0x84, 0x63, 0x69, 0x61, 0x6C, 0x00, 0x0B, 0x13, 0x04, 0x17, 0x08, 0x01, 0xB3, 0x11, 0x08,
+    0x07, 0x0C, 0x02, 0xF0, 0x03, 0x12, 0x15, 0x13, 0x83, 0x6E, 0x63, 0x69, 0x61, 0x6C, 0x00, 0x08,
+    0x0B, 0x01, 0x23, 0x43, 0x44, 0x07, 0x48, 0x0F, 0x4C, 0x20, 0x17, 0x16, 0x05, 0x18, 0x16, 0x02,
+    0x79, 0x03, 0x42, 0x56, 0x05, 0x58, 0x0A, 0x16, 0x08, 0x02, 0x6F, 0x03, 0x0F, 0x09, 0x11, 0x0C,
+    0x02, 0x68, 0x03, 0x0F, 0x06, 0x01, 0x20, 0x1C, 0x17, 0x01, 0x1C, 0x08, 0x19, 0x42, 0x84, 0x07,
+    0x00, 0x92, 0x10, 0x01, 0x15, 0x17, 0x11, 0x12, 0x06, 0x87, 0x6F, 0x76, 0x65, 0x72, 0x73, 0x69,
+    0x61, 0x6C, 0x00, 0x18, 0x10, 0x83, 0x69, 0x63, 0x61, 0x6C, 0x00, 0x07, 0x18, 0x0D, 0x84, 0x69,
+    0x63, 0x69, 0x61, 0x6C, 0x00, 0x0C, 0x06, 0x18, 0x16, 0x85, 0x69, 0x63, 0x69, 0x64, 0x61, 0x6C,
+    0x00, 0x12, 0x11, 0x12, 0x15, 0x13, 0x81, 0x6E, 0x61, 0x6C, 0x00, 0x42, 0x48, 0x05, 0x52, 0x12,
+    0x17, 0x11, 0x08, 0x17, 0x11, 0x08, 0x06, 0x85, 0x6E, 0x69, 0x61, 0x6C, 0x00, 0x10, 0x0C, 0x15,
+    0x08, 0x06, 0x86, 0x65, 0x6D, 0x6F, 0x6E, 0x69, 0x61, 0x6C, 0x00, 0x0C, 0x06, 0x11, 0x0C, 0x15,
+    0x13, 0x02, 0x51, 0x03, 0x44, 0x48, 0x09, 0x4C, 0x0F, 0x52, 0x13, 0x57, 0x21, 0x11, 0x0C, 0x10,
+    0x02, 0x42, 0x03, 0x13, 0x10, 0x01, 0x17, 0x17, 0x0C, 0x18, 0x14, 0x08, 0x86, 0x61, 0x74, 0x6F,
+    0x72, 0x69, 0x61, 0x6C, 0x00, 0x42, 0x46, 0x05, 0x58, 0x0A, 0x08, 0x0F, 0x08, 0x01, 0x9F, 0x07,
+    0x11, 0x0C, 0x84, 0x73, 0x74, 0x72, 0x69, 0x61, 0x6C, 0x00, 0x46, 0x44, 0x0D, 0x46, 0x19, 0x51,
+    0x1E, 0x53, 0x68, 0x55, 0x70, 0x56, 0x7E, 0x17, 0x16, 0x05, 0x18, 0x16, 0x83, 0x6E, 0x74, 0x69,
+    0x61, 0x6C, 0x00, 0x04, 0x15, 0x13, 0x01, 0x76, 0x42, 0x48, 0x05, 0x4C, 0x43, 0x43, 0x47, 0x07,
+    0x56, 0x16, 0x59, 0x35, 0x08, 0x16, 0x08, 0x15, 0x13, 0x87, 0x69, 0x64, 0x65, 0x6E, 0x74, 0x69,
+    0x61, 0x6C, 0x00, 0x42, 0x48, 0x05, 0x56, 0x0E, 0x85, 0x73, 0x65, 0x6E, 0x74, 0x69, 0x61, 0x6C,
+    0x00, 0x08, 0x11, 0x0C, 0x18, 0x14, 0x88, 0x74, 0x65, 0x73, 0x73, 0x65, 0x6E, 0x74, 0x69, 0x61,
+    0x6C, 0x00, 0x11, 0x12, 0x06, 0x81, 0x6F, 0x6E, 0x61, 0x6C, 0x00, 0x83, 0x69, 0x74, 0x69, 0x61,
+    0x6C, 0x00, 0x04, 0x06, 0x83, 0x69, 0x74, 0x61, 0x6C, 0x00, 0x08, 0x19, 0x12, 0x15, 0x17, 0x11,
+    0x12, 0x06, 0x83, 0x73, 0x69, 0x61, 0x6C, 0x00, 0x08, 0x15, 0x15, 0x08, 0x17, 0x82, 0x72, 0x69,
+    0x61, 0x6C, 0x00, 0x42, 0x88, 0xD6, 0x02, 0x95, 0x07, 0x00, 0x08, 0x06, 0x81, 0x63, 0x61, 0x6C,
+    0x00, 0x04, 0x10, 0x81, 0x6D, 0x61, 0x6C, 0x00, 0x45, 0x8C, 0x10, 0x00, 0x91, 0x18, 0x00, 0x92,
+    0x23, 0x00, 0x95, 0x22, 0x01, 0x98, 0x30, 0x01, 0x10, 0x12, 0x11, 0x0C, 0x05, 0x02, 0x65, 0x02,
+    0x12, 0x0C, 0x17, 0x0C, 0x07, 0x04, 0x15, 0x17, 0x02, 0x5A, 0x02, 0x46, 0x47, 0x0D, 0x4C, 0x1A,
+    0x51, 0xD9, 0x55, 0xE4, 0x56, 0xED, 0x57, 0xF4, 0x18, 0x17, 0x0C, 0x0A, 0x11, 0x12, 0x0F, 0x83,
+    0x69, 0x6E, 0x61, 0x6C, 0x00, 0x45, 0x47, 0x0B, 0x4A, 0x15, 0x51, 0x1D, 0x56, 0x2B, 0x57, 0x39,
+    0x07, 0x04, 0x83, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x00, 0x0C, 0x15, 0x12, 0x83, 0x6E, 0x61,
+    0x6C, 0x00, 0x16, 0x08, 0x10, 0x0C, 0x07, 0x86, 0x6E, 0x73, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x00,
+    0x08, 0x15, 0x0A, 0x11, 0x12, 0x06, 0x84, 0x73, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x00, 0x43, 0x44,
+    0x07, 0x55, 0x60, 0x58, 0x71, 0x43, 0x51, 0x07, 0x55, 0x16, 0x57, 0x4B, 0x08, 0x17, 0x11, 0x0C,
+    0x87, 0x72, 0x6E, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x00, 0x42, 0x46, 0x05, 0x48, 0x11,
+    0x08, 0x15, 0x86, 0x65, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x00, 0x42, 0x53, 0x05, 0x57,
+    0x18, 0x12, 0x11, 0x18, 0x8C, 0x6E, 0x6F, 0x6E, 0x6F, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6F,
+    0x6E, 0x61, 0x6C, 0x00, 0x11, 0x0C, 0x86, 0x6E, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x00,
+    0x11, 0x08, 0x07, 0x11, 0x08, 0x06, 0x16, 0x11, 0x04, 0x15, 0x17, 0x85, 0x6C, 0x00, 0x12, 0x13,
+    0x12, 0x13, 0x89, 0x72, 0x6F, 0x70, 0x6F, 0x72, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x00, 0x17,
+    0x0C, 0x17, 0x11, 0x12, 0x06, 0x11, 0x18, 0x89, 0x73, 0x74, 0x69, 0x74, 0x75, 0x74, 0x69, 0x6F,
+    0x6E, 0x61, 0x6C, 0x00, 0x08, 0x10, 0x12, 0x11, 0x08, 0x0B, 0x13, 0x83, 0x61, 0x6C, 0x00, 0x08,
+    0x13, 0x83, 0x73, 0x6F, 0x6E, 0x61, 0x6C, 0x00, 0x0C, 0x19, 0x12, 0x15, 0x13, 0x01, 0x06, 0x0C,
+    0x07, 0x07, 0x04, 0x83, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x00, 0x08, 0x17, 0x15, 0x08, 0x1B, 0x08,
+    0x87, 0x74, 0x65, 0x72, 0x6E, 0x61, 0x6C, 0x00, 0x15, 0x12, 0x0D, 0x84, 0x75, 0x72, 0x6E, 0x61,
+    0x6C, 0x00, 0x0C, 0x06, 0x0C, 0x42, 0x51, 0x05, 0x55, 0x0F, 0x0C, 0x15, 0x13, 0x85, 0x63, 0x69,
+    0x70, 0x61, 0x6C, 0x00, 0x13, 0x84, 0x6E, 0x63, 0x69, 0x70, 0x61, 0x6C, 0x00, 0x44, 0x44, 0x09,
+    0x48, 0x0D, 0x57, 0x53, 0x58, 0x5C, 0x17, 0x17, 0x01, 0x31, 0x45, 0x47, 0x0B, 0x49, 0x12, 0x4E,
+    0x17, 0x57, 0x1E, 0x59, 0x37, 0x0C, 0x16, 0x81, 0x65, 0x61, 0x6C, 0x00, 0x08, 0x15, 0x02, 0x30,
+    0x01, 0x06, 0x04, 0x10, 0x81, 0x65, 0x6C, 0x00, 0x42, 0x44, 0x05, 0x57, 0x11, 0x0F, 0x12, 0x06,
+    0x85, 0x6C, 0x61, 0x74, 0x65, 0x72, 0x61, 0x6C, 0x00, 0x18, 0x0A, 0x83, 0x75, 0x72, 0x61, 0x6C,
+    0x00, 0x42, 0x48, 0x05, 0x4C, 0x08, 0x15, 0x01, 0x04, 0x11, 0x18, 0x81, 0x73, 0x61, 0x6C, 0x00,
+    0x08, 0x10, 0x10, 0x1C, 0x16, 0x81, 0x69, 0x63, 0x00, 0x42, 0x52, 0x05, 0x57, 0x0D, 0x10, 0x18,
+    0x0B, 0x83, 0x72, 0x61, 0x6C, 0x00, 0x16, 0x04, 0x13, 0x83, 0x6F, 0x72, 0x61, 0x6C, 0x00, 0x42,
+    0x52, 0x05, 0x55, 0x10, 0x0F, 0x0F, 0x12, 0x06, 0x84, 0x6F, 0x73, 0x73, 0x61, 0x6C, 0x00, 0x08,
+    0x42, 0x4B, 0x05, 0x59, 0x0E, 0x08, 0x15, 0x83, 0x61, 0x72, 0x73, 0x61, 0x6C, 0x00, 0x12, 0x15,
+    0x17, 0x01, 0x54, 0x44, 0x48, 0x09, 0x4C, 0x25, 0x51, 0x46, 0x58, 0x6C, 0x42, 0x50, 0x05, 0x51,
+    0x0C, 0x04, 0x07, 0x11, 0x18, 0x09, 0x01, 0x0C, 0x0C, 0x17, 0x11, 0x12, 0x06, 0x15, 0x08, 0x17,
+    0x11, 0x0C, 0x82, 0x6E, 0x74, 0x61, 0x6C, 0x00, 0x42, 0x51, 0x05, 0x56, 0x16, 0x42, 0x48, 0x05,
+    0x4C, 0x2F, 0x07, 0x0C, 0x16, 0x08, 0x15, 0x13, 0x83, 0x74, 0x69, 0x61, 0x6C, 0x00, 0x08, 0x16,
+    0x16, 0x08, 0x84, 0x6E, 0x74, 0x69, 0x61, 0x6C, 0x00, 0x08, 0x42, 0x47, 0x05, 0x50, 0x17, 0x0C,
+    0x42, 0x49, 0x05, 0x56, 0x0A, 0x11, 0x12, 0x06, 0x01, 0x04, 0x08, 0x15, 0x81, 0x69, 0x61, 0x6C,
+    0x00, 0x08, 0x15, 0x17, 0x08, 0x07, 0x86, 0x69, 0x6D, 0x65, 0x6E, 0x74, 0x61, 0x6C, 0x00, 0x15,
+    0x0C, 0x19, 0x83, 0x74, 0x75, 0x61, 0x6C, 0x00, 0x44, 0x47, 0x09, 0x51, 0x0F, 0x55, 0x16, 0x57,
+    0x1E, 0x08, 0x0B, 0x06, 0x16, 0x01, 0xD5, 0x04, 0x82, 0x6E, 0x75, 0x61, 0x6C, 0x00, 0x18, 0x17,
+    0x04, 0x11, 0x82, 0x61, 0x6C, 0x00, 0x43, 0x46, 0x07, 0x4C, 0x2D, 0x51, 0xF0, 0x42, 0x48, 0x05,
+    0x58, 0x1E, 0x42, 0x4F, 0x05, 0x57, 0x12, 0x08, 0x17, 0x11, 0x0C, 0x85, 0x6C, 0x65, 0x63, 0x74,
+    0x75, 0x61, 0x6C, 0x00, 0x0C, 0x0B, 0x06, 0x15, 0x04, 0x01, 0x05, 0x15, 0x17, 0x16, 0x81, 0x72,
+    0x61, 0x6C, 0x00, 0x15, 0x13, 0x16, 0x85, 0x69, 0x72, 0x69, 0x74, 0x75, 0x61, 0x6C, 0x00, 0x42,
+    0x4C, 0x05, 0x52, 0x1C, 0x42, 0x48, 0x05, 0x55, 0x0F, 0x07, 0x08, 0x10, 0x84, 0x69, 0x65, 0x76,
+    0x61, 0x6C, 0x00, 0x04, 0x83, 0x72, 0x69, 0x76, 0x61, 0x6C, 0x00, 0x15, 0x13, 0x04, 0x84, 0x70,
+    0x72, 0x6F, 0x76, 0x61, 0x6C, 0x00, 0x18, 0x42, 0x52, 0x05, 0x5A, 0x11, 0x43, 0x46, 0x08, 0x4B,
+    0x07, 0x5A, 0x08, 0x16, 0x81, 0x6C, 0x64, 0x00, 0x12, 0x84, 0x77, 0x6F, 0x75, 0x6C, 0x64, 0x00,
+    0x46, 0x4C, 0x0D, 0x4F, 0x12, 0x51, 0x38, 0x53, 0x42, 0x57, 0x47, 0x59, 0x4E, 0x15, 0x08, 0x04,
+    0x01, 0x43, 0x42, 0x44, 0x05, 0x4F, 0x1A, 0x15, 0x42, 0x44, 0x05, 0x55, 0x0B, 0x13, 0x81, 0x6C,
+    0x65, 0x6C, 0x00, 0x04, 0x13, 0x84, 0x61, 0x6C, 0x6C, 0x65, 0x6C, 0x00, 0x04, 0x15, 0x15, 0x04,
+    0x13, 0x85, 0x61, 0x6C, 0x6C, 0x65, 0x6C, 0x00, 0x12, 0x16, 0x15, 0x08, 0x13, 0x81, 0x6E, 0x65,
+    0x6C, 0x00, 0x12, 0x08, 0x13, 0x01, 0x05, 0x17, 0x0C, 0x0F, 0x81, 0x6C, 0x65, 0x00, 0x08, 0x0C,
+    0x07, 0x08, 0x10, 0x81, 0x61, 0x6C, 0x00, 0x42, 0x44, 0x05, 0x46, 0x28, 0x42, 0x56, 0x05, 0x57,
+    0x0C, 0x05, 0x04, 0x82, 0x65, 0x69, 0x6C, 0x00, 0x42, 0x46, 0x05, 0x51, 0x0E, 0x12, 0x06, 0x83,
+    0x6B, 0x74, 0x61, 0x69, 0x6C, 0x00, 0x08, 0x16, 0x16, 0x08, 0x82, 0x69, 0x61, 0x6C, 0x00, 0x18,
+    0x12, 0x06, 0x82, 0x6E, 0x63, 0x69, 0x6C, 0x00, 0x46, 0x44, 0x0D, 0x46, 0x36, 0x48, 0x3F, 0x4C,
+    0x6F, 0x52, 0x8F, 0x58, 0x97, 0x42, 0x45, 0x05, 0x56, 0x22, 0x42, 0x57, 0x05, 0x5C, 0x10, 0x12,
+    0x12, 0x12, 0x09, 0x85, 0x74, 0x62, 0x61, 0x6C, 0x6C, 0x00, 0x08, 0x0F, 0x12, 0x19, 0x85, 0x6C,
+    0x65, 0x79, 0x62, 0x61, 0x6C, 0x6C, 0x00, 0x04, 0x19, 0x82, 0x73, 0x61, 0x6C, 0x00, 0x04, 0x08,
+    0x15, 0x83, 0x63, 0x61, 0x6C, 0x6C, 0x00, 0x44, 0x45, 0x09, 0x51, 0x0D, 0x53, 0x15, 0x5A, 0x27,
+    0x0C, 0x02, 0xB1, 0x1C, 0x11, 0x12, 0x16, 0x15, 0x08, 0x02, 0x12, 0x2E, 0x42, 0x56, 0x05, 0x5B,
+    0x0E, 0x0C, 0x10, 0x83, 0x73, 0x70, 0x65, 0x6C, 0x6C, 0x00, 0x08, 0x02, 0xE3, 0x42, 0x16, 0x04,
+    0x83, 0x20, 0x77, 0x65, 0x6C, 0x6C, 0x00, 0x42, 0x49, 0x05, 0x57, 0x1B, 0x42, 0x4F, 0x05, 0x58,
+    0x0E, 0x0F, 0x18, 0x09, 0x84, 0x66, 0x69, 0x6C, 0x6C, 0x00, 0x09, 0x83, 0x6C, 0x66, 0x69, 0x6C,
+    0x6C, 0x00, 0x11, 0x18, 0x02, 0xBA, 0x42, 0x06, 0x16, 0x82, 0x72, 0x6F, 0x6C, 0x6C, 0x00, 0x42,
+    0x49, 0x05, 0x4C, 0x39, 0x44, 0x48, 0x09, 0x53, 0x18, 0x55, 0x1C, 0x5C, 0x29, 0x42, 0x46, 0x05,
+    0x55, 0x0B, 0x04, 0x15, 0x0A, 0x02, 0x99, 0x42, 0x04, 0x02, 0x27, 0x1D, 0x0F, 0x02, 0xEF, 0x33,
+    0x08, 0x42, 0x87, 0x07, 0x00, 0x9A, 0xA9, 0x2D, 0x11, 0x12, 0x02, 0xAF, 0x35, 0x17, 0x18, 0x04,
+    0x08, 0x05, 0x84, 0x69, 0x66, 0x75, 0x6C, 0x00, 0x1A, 0x82, 0x6C, 0x6C, 0x00, 0x0B, 0x42, 0x46,
+    0x05, 0x52, 0x1A, 0x42, 0x4F, 0x05, 0x52, 0x0C, 0x04, 0x82, 0x6F, 0x68, 0x6F, 0x6C, 0x00, 0x0F,
+    0x04, 0x84, 0x63, 0x6F, 0x68, 0x6F, 0x6C, 0x00, 0x0B, 0x06, 0x0F, 0x04, 0x84, 0x6F, 0x68, 0x6F,
+    0x6C, 0x00, 0x09, 0x45, 0x48, 0x0B, 0x4C, 0x14, 0x55, 0x20, 0x56, 0x2C, 0x57, 0x45, 0x1A, 0x12,
+    0x13, 0x82, 0x72, 0x66, 0x75, 0x6C, 0x00, 0x17, 0x04, 0x08, 0x05, 0x84, 0x75, 0x74, 0x69, 0x66,
+    0x75, 0x6C, 0x00, 0x08, 0x19, 0x12, 0x13, 0x85, 0x77, 0x65, 0x72, 0x66, 0x75, 0x6C, 0x00, 0x08,
+    0x06, 0x42, 0x46, 0x05, 0x58, 0x0D, 0x18, 0x16, 0x82, 0x73, 0x66, 0x75, 0x6C, 0x00, 0x16, 0x84,
+    0x63, 0x65, 0x73, 0x73, 0x66, 0x75, 0x6C, 0x00, 0x04, 0x08, 0x15, 0x0A, 0x85, 0x61, 0x74, 0x65,
+    0x66, 0x75, 0x6C, 0x00, 0x08, 0x11, 0x08, 0x15, 0x02, 0xFB, 0x5B, 0x0F, 0x08, 0x17, 0x08, 0x0F,
+    0x13, 0x10, 0x12, 0x02, 0x7D, 0x1C, 0x4C, 0x84, 0x25, 0x00, 0x86, 0x42, 0x00, 0x88, 0x51, 0x00,
+    0x8B, 0x7A, 0x00, 0x8C, 0x84, 0x00, 0x8F, 0xC0, 0x00, 0x92, 0xCA, 0x00, 0x95, 0xF2, 0x00, 0x96,
+    0x1D, 0x01, 0x97, 0xDD, 0x01, 0x98, 0xF5, 0x01, 0x9A, 0xA3, 0x02, 0x42, 0x47, 0x05, 0x55, 0x10,
+    0x17, 0x16, 0x12, 0x13, 0x84, 0x74, 0x73, 0x64, 0x61, 0x6D, 0x00, 0x0A, 0x0C, 0x0F, 0x0C, 0x10,
+    0x84, 0x6C, 0x69, 0x67, 0x72, 0x61, 0x6D, 0x00, 0x0C, 0x15, 0x17, 0x11, 0x08, 0x06, 0x12, 0x11,
+    0x0B, 0x17, 0x08, 0x81, 0x73, 0x6D, 0x00, 0x44, 0x47, 0x09, 0x4B, 0x13, 0x4F, 0x16, 0x57, 0x21,
+    0x11, 0x04, 0x17, 0x18, 0x13, 0x16, 0x0C, 0x07, 0x01, 0x0C, 0x17, 0x01, 0x39, 0x18, 0x06, 0x0C,
+    0x15, 0x15, 0x18, 0x06, 0x81, 0x75, 0x6D, 0x00, 0x1C, 0x16, 0x82, 0x73, 0x74, 0x65, 0x6D, 0x00,
+    0x17, 0x1C, 0x15, 0x83, 0x68, 0x79, 0x74, 0x68, 0x6D, 0x00, 0x44, 0x44, 0x09, 0x4B, 0x0F, 0x51,
+    0x2B, 0x55, 0x33, 0x0F, 0x05, 0x81, 0x6D, 0x65, 0x00, 0x42, 0x46, 0x05, 0x57, 0x0B, 0x15, 0x04,
+    0x11, 0x04, 0x01, 0x17, 0x1C, 0x42, 0x4B, 0x05, 0x55, 0x09, 0x15, 0x02, 0x4D, 0x01, 0x84, 0x68,
+    0x79, 0x74, 0x68, 0x6D, 0x00, 0x04, 0x0A, 0x15, 0x12, 0x80, 0x73, 0x6D, 0x00, 0x15, 0x08, 0x17,
+    0x11, 0x0C, 0x82, 0x69, 0x6D, 0x00, 0x08, 0x05, 0x12, 0x15, 0x13, 0x82, 0x6C, 0x65, 0x6D, 0x00,
+    0x43, 0x51, 0x07, 0x55, 0x11, 0x57, 0x1C, 0x08, 0x10, 0x12, 0x11, 0x08, 0x0B, 0x13, 0x02, 0xCE,
+    0x01, 0x0A, 0x12, 0x15, 0x13, 0x85, 0x6F, 0x67, 0x72, 0x6F, 0x6D, 0x00, 0x16, 0x18, 0x06, 0x04,
+    0x84, 0x63, 0x75, 0x73, 0x74, 0x6F, 0x6D, 0x00, 0x43, 0x44, 0x07, 0x48, 0x0C, 0x52, 0x13, 0x08,
+    0x1C, 0x02, 0xED, 0x40, 0x17, 0x11, 0x0C, 0x80, 0x69, 0x6D, 0x00, 0x09, 0x42, 0x51, 0x05, 0x52,
+    0x0F, 0x04, 0x15, 0x17, 0x83, 0x73, 0x66, 0x6F, 0x72, 0x6D, 0x00, 0x06, 0x83, 0x6E, 0x66, 0x6F,
+    0x72, 0x6D, 0x00, 0x43, 0x44, 0x07, 0x48, 0x0E, 0x4C, 0x18, 0x08, 0x15, 0x07, 0x81, 0x6D, 0x73,
+    0x00, 0x0C, 0x0B, 0x17, 0x04, 0x83, 0x65, 0x69, 0x73, 0x6D, 0x00, 0x48, 0x44, 0x11, 0x46, 0x1C,
+    0x47, 0x2A, 0x4F, 0x34, 0x50, 0x6A, 0x55, 0x75, 0x56, 0x82, 0x57, 0x8D, 0x07, 0x04, 0x18, 0x0D,
+    0x85, 0x64, 0x61, 0x69, 0x73, 0x6D, 0x00, 0x12, 0x0F, 0x12, 0x0B, 0x17, 0x04, 0x06, 0x84, 0x69,
+    0x63, 0x69, 0x73, 0x6D, 0x00, 0x04, 0x18, 0x0D, 0x84, 0x64, 0x61, 0x69, 0x73, 0x6D, 0x00, 0x04,
+    0x43, 0x46, 0x07, 0x55, 0x11, 0x58, 0x23, 0x12, 0x16, 0x84, 0x69, 0x61, 0x6C, 0x69, 0x73, 0x6D,
+    0x00, 0x17, 0x0F, 0x18, 0x06, 0x0C, 0x17, 0x0F, 0x18, 0x10, 0x85, 0x75, 0x72, 0x61, 0x6C, 0x69,
+    0x73, 0x6D, 0x00, 0x0A, 0x11, 0x0C, 0x0F, 0x0F, 0x0C, 0x05, 0x89, 0x69, 0x6E, 0x67, 0x75, 0x61,
+    0x6C, 0x69, 0x73, 0x6D, 0x00, 0x12, 0x17, 0x13, 0x12, 0x84, 0x69, 0x6D, 0x69, 0x73, 0x6D, 0x00,
+    0x04, 0x0A, 0x04, 0x0F, 0x13, 0x84, 0x69, 0x61, 0x72, 0x69, 0x73, 0x6D, 0x00, 0x0C, 0x17, 0x0C,
+    0x15, 0x06, 0x83, 0x63, 0x69, 0x73, 0x6D, 0x00, 0x04, 0x42, 0x51, 0x05, 0x55, 0x0D, 0x04, 0x09,
+    0x81, 0x63, 0x69, 0x73, 0x6D, 0x00, 0x08, 0x13, 0x08, 0x16, 0x86, 0x61, 0x72, 0x61, 0x74, 0x69,
+    0x73, 0x6D, 0x00, 0x42, 0x4C, 0x05, 0x56, 0x0E, 0x15, 0x12, 0x0A, 0x0F, 0x04, 0x80, 0x68, 0x6D,
+    0x00, 0x0C, 0x0B, 0x06, 0x15, 0x04, 0x11, 0x04, 0x81, 0x6D, 0x00, 0x48, 0x46, 0x11, 0x47, 0x19,
+    0x4A, 0x28, 0x4C, 0x43, 0x4F, 0x7E, 0x50, 0x8F, 0x55, 0x99, 0x57, 0xA5, 0x06, 0x04, 0x19, 0x82,
+    0x75, 0x75, 0x6D, 0x00, 0x11, 0x08, 0x07, 0x08, 0x09, 0x08, 0x15, 0x85, 0x72, 0x65, 0x6E, 0x64,
+    0x75, 0x6D, 0x00, 0x42, 0x4C, 0x05, 0x58, 0x0E, 0x0F, 0x08, 0x05, 0x83, 0x67, 0x69, 0x75, 0x6D,
+    0x00, 0x15, 0x15, 0x08, 0x17, 0x11, 0x0C, 0x83, 0x65, 0x67, 0x6E, 0x75, 0x6D, 0x00, 0x43, 0x45,
+    0x07, 0x46, 0x13, 0x51, 0x1F, 0x0C, 0x0F, 0x0C, 0x18, 0x14, 0x08, 0x82, 0x72, 0x69, 0x75, 0x6D,
+    0x00, 0x15, 0x12, 0x16, 0x11, 0x12, 0x06, 0x83, 0x74, 0x69, 0x75, 0x6D, 0x00, 0x42, 0x48, 0x05,
+    0x51, 0x0F, 0x0F, 0x0F, 0x0C, 0x10, 0x82, 0x6E, 0x69, 0x75, 0x6D, 0x00, 0x08, 0x0F, 0x0C, 0x10,
+    0x85, 0x6C, 0x65, 0x6E, 0x6E, 0x69, 0x75, 0x6D, 0x00, 0x18, 0x06, 0x0C, 0x15, 0x0C, 0x06, 0x87,
+    0x75, 0x72, 0x72, 0x69, 0x63, 0x75, 0x6C, 0x75, 0x6D, 0x00, 0x18, 0x11, 0x0C, 0x10, 0x83, 0x69,
+    0x6D, 0x75, 0x6D, 0x00, 0x05, 0x0C, 0x0F, 0x0C, 0x18, 0x14, 0x08, 0x81, 0x69, 0x75, 0x6D, 0x00,
+    0x06, 0x08, 0x13, 0x16, 0x81, 0x72, 0x75, 0x6D, 0x00, 0x12, 0x15, 0x06, 0x80, 0x6E, 0x00, 0x4D,
+    0x84, 0x28, 0x00, 0x87, 0x6B, 0x02, 0x88, 0x76, 0x02, 0x8A, 0x9C, 0x03, 0x8C, 0xDA, 0x03, 0x8E,
+    0x59, 0x04, 0x92, 0x78, 0x04, 0x95, 0xB2, 0x0F, 0x96, 0xED, 0x0F, 0x97, 0x1D, 0x10, 0x98, 0x26,
+    0x10, 0x9A, 0x2F, 0x10, 0x9C, 0x46, 0x10, 0x49, 0x85, 0x1C, 0x00, 0x86, 0x28, 0x00, 0x87, 0x5F,
+    0x00, 0x88, 0x6C, 0x00, 0x8A, 0xCF, 0x00, 0x8B, 0xB8, 0x04, 0x8C, 0xDA, 0x00, 0x90, 0xF5, 0x01,
+    0x92, 0x37, 0x02, 0x15, 0x18, 0x05, 0x15, 0x18, 0x05, 0x18, 0x16, 0x84, 0x61, 0x6E, 0x00, 0x43,
+    0x46, 0x07, 0x4C, 0x13, 0x56, 0x29, 0x12, 0x15, 0x15, 0x12, 0x10, 0x85, 0x6F, 0x63, 0x63, 0x61,
+    0x6E, 0x00, 0x17, 0x42, 0x44, 0x05, 0x4C, 0x0D, 0x10, 0x08, 0x0B, 0x17, 0x04, 0x10, 0x01, 0x05,
+    0x0F, 0x12, 0x13, 0x81, 0x69, 0x61, 0x6E, 0x00, 0x0C, 0x16, 0x11, 0x04, 0x15, 0x09, 0x85, 0x63,
+    0x69, 0x73, 0x63, 0x61, 0x6E, 0x00, 0x04, 0x10, 0x10, 0x04, 0x0B, 0x18, 0x10, 0x87, 0x73, 0x6C,
+    0x69, 0x6D, 0x00, 0x44, 0x45, 0x09, 0x4F, 0x27, 0x51, 0x2E, 0x5A, 0x5B, 0x42, 0x45, 0x05, 0x4C,
+    0x12, 0x0C, 0x15, 0x15, 0x04, 0x06, 0x86, 0x69, 0x62, 0x62, 0x65, 0x61, 0x6E, 0x00, 0x15, 0x15,
+    0x04, 0x06, 0x85, 0x69, 0x62, 0x62, 0x65, 0x61, 0x6E, 0x00, 0x12, 0x13, 0x04, 0x11, 0x02, 0x96,
+    0x03, 0x43, 0x44, 0x07, 0x48, 0x16, 0x51, 0x1C, 0x15, 0x08, 0x17, 0x0C, 0x07, 0x08, 0x10, 0x84,
+    0x72, 0x61, 0x6E, 0x65, 0x61, 0x6E, 0x00, 0x0B, 0x17, 0x04, 0x02, 0x1E, 0x03, 0x0C, 0x04, 0x15,
+    0x08, 0x17, 0x0C, 0x07, 0x08, 0x10, 0x86, 0x72, 0x61, 0x6E, 0x65, 0x61, 0x6E, 0x00, 0x12, 0x0F,
+    0x0F, 0x04, 0x0B, 0x02, 0x2F, 0x58, 0x04, 0x0B, 0x06, 0x0C, 0x10, 0x83, 0x69, 0x67, 0x61, 0x6E,
+    0x00, 0x48, 0x46, 0x11, 0x47, 0x59, 0x4A, 0x7A, 0x4F, 0x7E, 0x51, 0x92, 0x55, 0xB8, 0x56, 0xE1,
+    0x57, 0xF4, 0x42, 0x4C, 0x05, 0x51, 0x3E, 0x44, 0x46, 0x09, 0x4B, 0x13, 0x55, 0x1E, 0x57, 0x28,
+    0x16, 0x18, 0x10, 0x85, 0x69, 0x63, 0x69, 0x61, 0x6E, 0x00, 0x06, 0x08, 0x17, 0x84, 0x6E, 0x69,
+    0x63, 0x69, 0x61, 0x6E, 0x00, 0x17, 0x08, 0x10, 0x12, 0x08, 0x0A, 0x85, 0x65, 0x72, 0x00, 0x04,
+    0x10, 0x0B, 0x17, 0x04, 0x10, 0x87, 0x65, 0x6D, 0x61, 0x74, 0x69, 0x63, 0x69, 0x61, 0x6E, 0x00,
+    0x0C, 0x0A, 0x04, 0x10, 0x84, 0x63, 0x69, 0x61, 0x6E, 0x00, 0x43, 0x44, 0x07, 0x48, 0x12, 0x55,
+    0x1A, 0x19, 0x04, 0x15, 0x07, 0x84, 0x69, 0x64, 0x69, 0x61, 0x6E, 0x00, 0x10, 0x0C, 0x0B, 0x06,
+    0x15, 0x04, 0x01, 0x39, 0x12, 0x06, 0x06, 0x04, 0x02, 0xDC, 0x02, 0x04, 0x02, 0xB3, 0x57, 0x0F,
+    0x0C, 0x42, 0x96, 0x07, 0x00, 0x99, 0xAE, 0x57, 0x04, 0x15, 0x05, 0x86, 0x7A, 0x69, 0x6C, 0x69,
+    0x61, 0x6E, 0x00, 0x42, 0x44, 0x05, 0x52, 0x1D, 0x15, 0x42, 0x4E, 0x05, 0x55, 0x0D, 0x18, 0x83,
+    0x69, 0x6E, 0x69, 0x61, 0x6E, 0x00, 0x08, 0x17, 0x05, 0x18, 0x16, 0x82, 0x65, 0x61, 0x6E, 0x00,
+    0x08, 0x0F, 0x12, 0x13, 0x04, 0x11, 0x81, 0x63, 0x00, 0x04, 0x17, 0x42, 0x44, 0x05, 0x51, 0x11,
+    0x0A, 0x08, 0x19, 0x86, 0x65, 0x74, 0x61, 0x72, 0x69, 0x61, 0x6E, 0x00, 0x08, 0x10, 0x04, 0x0C,
+    0x0F, 0x04, 0x13, 0x8B, 0x72, 0x6C, 0x69, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x61, 0x72, 0x69, 0x61,
+    0x6E, 0x00, 0x42, 0x48, 0x05, 0x4C, 0x0C, 0x17, 0x0F, 0x04, 0x10, 0x02, 0xD7, 0x55, 0x04, 0x84,
+    0x73, 0x69, 0x61, 0x6E, 0x00, 0x43, 0x44, 0x07, 0x4C, 0x0F, 0x55, 0x22, 0x0B, 0x83, 0x69, 0x74,
+    0x69, 0x61, 0x6E, 0x00, 0x42, 0x51, 0x05, 0x55, 0x0F, 0x0B, 0x06, 0x08, 0x17, 0x83, 0x63, 0x69,
+    0x61, 0x6E, 0x00, 0x05, 0x02, 0x1B, 0x57, 0x08, 0x06, 0x02, 0x16, 0x57, 0x44, 0x48, 0x09, 0x4C,
+    0x0F, 0x57, 0x24, 0x5C, 0x30, 0x17, 0x04, 0x17, 0x16, 0x01, 0x1D, 0x42, 0x46, 0x05, 0x55, 0x0B,
+    0x08, 0x13, 0x16, 0x02, 0xEF, 0x56, 0x04, 0x0B, 0x06, 0x84, 0x69, 0x72, 0x6D, 0x61, 0x6E, 0x00,
+    0x0B, 0x0A, 0x18, 0x04, 0x15, 0x07, 0x82, 0x73, 0x6D, 0x61, 0x6E, 0x00, 0x15, 0x17, 0x11, 0x04,
+    0x15, 0x09, 0x11, 0x0C, 0x88, 0x61, 0x6E, 0x74, 0x72, 0x79, 0x6D, 0x61, 0x6E, 0x00, 0x1D, 0x12,
+    0x17, 0x04, 0x10, 0x15, 0x08, 0x13, 0x16, 0x02, 0xED, 0x01, 0x18, 0x12, 0x42, 0x49, 0x05, 0x56,
+    0x05, 0x81, 0x6E, 0x64, 0x00, 0x4A, 0x87, 0x1F, 0x00, 0x88, 0x41, 0x00, 0x8A, 0x8E, 0x00, 0x8B,
+    0xB6, 0x00, 0x90, 0xD8, 0x00, 0x93, 0xDE, 0x00, 0x95, 0xF3, 0x00, 0x96, 0xFE, 0x00, 0x97, 0x07,
+    0x01, 0x9A, 0x1F, 0x01, 0x43, 0x4C, 0x07, 0x4F, 0x10, 0x55, 0x15, 0x05, 0x15, 0x12, 0x09, 0x81,
+    0x64, 0x65, 0x6E, 0x00, 0x0C, 0x0B, 0x06, 0x01, 0x9B, 0x04, 0x0A, 0x15, 0x08, 0x07, 0x11, 0x0C,
+    0x0E, 0x82, 0x74, 0x65, 0x6E, 0x00, 0x43, 0x45, 0x07, 0x57, 0x11, 0x5A, 0x26, 0x07, 0x04, 0x0B,
+    0x83, 0x20, 0x62, 0x65, 0x65, 0x6E, 0x00, 0x42, 0x48, 0x05, 0x5A, 0x0C, 0x05, 0x82, 0x77, 0x65,
+    0x65, 0x6E, 0x00, 0x08, 0x05, 0x84, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x00, 0x42, 0x48, 0x05, 0x57,
+    0x0D, 0x05, 0x83, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x00, 0x08, 0x42, 0x45, 0x05, 0x59, 0x10, 0x11,
+    0x0C, 0x88, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x00, 0x86, 0x62, 0x65, 0x74, 0x77, 0x65,
+    0x65, 0x6E, 0x00, 0x43, 0x4C, 0x07, 0x51, 0x0F, 0x52, 0x1E, 0x1B, 0x12, 0x83, 0x79, 0x67, 0x65,
+    0x6E, 0x00, 0x0C, 0x15, 0x04, 0x0B, 0x17, 0x12, 0x0F, 0x86, 0x72, 0x69, 0x6E, 0x67, 0x65, 0x6E,
+    0x00, 0x07, 0x1C, 0x0B, 0x83, 0x72, 0x6F, 0x67, 0x65, 0x6E, 0x00, 0x42, 0x4A, 0x05, 0x57, 0x10,
+    0x11, 0x08, 0x15, 0x17, 0x16, 0x82, 0x74, 0x68, 0x65, 0x6E, 0x00, 0x42, 0x48, 0x05, 0x55, 0x0C,
+    0x15, 0x05, 0x81, 0x72, 0x65, 0x6E, 0x00, 0x12, 0x11, 0x80, 0x72, 0x6E, 0x00, 0x04, 0x0B, 0x16,
+    0x02, 0x7D, 0x05, 0x42, 0x44, 0x05, 0x53, 0x0B, 0x0B, 0x81, 0x70, 0x65, 0x6E, 0x00, 0x0B, 0x04,
+    0x85, 0x68, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x00, 0x08, 0x0B, 0x17, 0x08, 0x15, 0x05, 0x83, 0x72,
+    0x65, 0x6E, 0x00, 0x12, 0x12, 0x0B, 0x06, 0x83, 0x73, 0x65, 0x6E, 0x00, 0x42, 0x4C, 0x05, 0x57,
+    0x0C, 0x15, 0x1A, 0x81, 0x74, 0x65, 0x6E, 0x00, 0x0C, 0x1A, 0x08, 0x15, 0x84, 0x72, 0x69, 0x74,
+    0x74, 0x65, 0x6E, 0x00, 0x17, 0x08, 0x05, 0x80, 0x65, 0x6E, 0x00, 0x42, 0x48, 0x05, 0x4C, 0x0F,
+    0x0C, 0x15, 0x12, 0x09, 0x83, 0x65, 0x69, 0x67, 0x6E, 0x00, 0x45, 0x4B, 0x0B, 0x4F, 0x0E, 0x52,
+    0x15, 0x55, 0x1E, 0x56, 0x28, 0x17, 0x01, 0x0E, 0x0F, 0x04, 0x83, 0x69, 0x67, 0x6E, 0x00, 0x42,
+    0x47, 0x05, 0x4A, 0x05, 0x81, 0x6E, 0x67, 0x00, 0x08, 0x19, 0x12, 0x16, 0x82, 0x65, 0x69, 0x67,
+    0x6E, 0x00, 0x04, 0x82, 0x73, 0x69, 0x67, 0x6E, 0x00, 0x45, 0x44, 0x0B, 0x4A, 0x2B, 0x4E, 0x4E,
+    0x4F, 0x57, 0x56, 0x6C, 0x43, 0x53, 0x07, 0x55, 0x0E, 0x57, 0x19, 0x10, 0x04, 0x06, 0x80, 0x67,
+    0x6E, 0x00, 0x17, 0x16, 0x08, 0x07, 0x08, 0x13, 0x82, 0x69, 0x61, 0x6E, 0x00, 0x04, 0x82, 0x74,
+    0x61, 0x69, 0x6E, 0x00, 0x44, 0x44, 0x09, 0x4A, 0x12, 0x52, 0x18, 0x55, 0x1C, 0x13, 0x10, 0x04,
+    0x06, 0x82, 0x69, 0x67, 0x6E, 0x00, 0x08, 0x05, 0x82, 0x69, 0x6E, 0x00, 0x0A, 0x02, 0x1A, 0x54,
+    0x12, 0x82, 0x69, 0x67, 0x69, 0x6E, 0x00, 0x10, 0x18, 0x13, 0x82, 0x70, 0x6B, 0x69, 0x6E, 0x00,
+    0x42, 0x44, 0x05, 0x4F, 0x0E, 0x13, 0x1B, 0x08, 0x83, 0x6C, 0x61, 0x69, 0x6E, 0x00, 0x0C, 0x19,
+    0x81, 0x61, 0x69, 0x6E, 0x00, 0x42, 0x44, 0x05, 0x4C, 0x0D, 0x16, 0x16, 0x04, 0x81, 0x73, 0x69,
+    0x6E, 0x00, 0x12, 0x13, 0x81, 0x6F, 0x6E, 0x00, 0x42, 0x4B, 0x05, 0x4C, 0x0D, 0x0C, 0x17, 0x83,
+    0x68, 0x69, 0x6E, 0x6B, 0x00, 0x42, 0x4B, 0x05, 0x57, 0x0A, 0x17, 0x81, 0x6E, 0x6B, 0x00, 0x0B,
+    0x84, 0x74, 0x68, 0x69, 0x6E, 0x6B, 0x00, 0x4B, 0x86, 0x22, 0x00, 0x87, 0x2B, 0x00, 0x88, 0x45,
+    0x00, 0x8B, 0x68, 0x00, 0x8C, 0x6F, 0x00, 0x8F, 0x4F, 0x0A, 0x91, 0x54, 0x0A, 0x92, 0x73, 0x0A,
+    0x95, 0x89, 0x0A, 0x96, 0xA9, 0x0A, 0x97, 0xDB, 0x0A, 0x16, 0x18, 0x17, 0x83, 0x63, 0x73, 0x6F,
+    0x6E, 0x00, 0x11, 0x42, 0x44, 0x05, 0x52, 0x10, 0x05, 0x07, 0x04, 0x86, 0x62, 0x61, 0x6E, 0x64,
+    0x6F, 0x6E, 0x00, 0x05, 0x04, 0x84, 0x61, 0x6E, 0x64, 0x6F, 0x6E, 0x00, 0x43, 0x47, 0x07, 0x52,
+    0x0E, 0x55, 0x19, 0x15, 0x12, 0x06, 0x06, 0x04, 0x01, 0x12, 0x0F, 0x13, 0x04, 0x11, 0x84, 0x6F,
+    0x6C, 0x65, 0x6F, 0x6E, 0x00, 0x08, 0x17, 0x0C, 0x15, 0x06, 0x82, 0x69, 0x6F, 0x6E, 0x00, 0x16,
+    0x15, 0x12, 0x13, 0x02, 0xB9, 0x0A, 0x48, 0x84, 0x19, 0x00, 0x86, 0x29, 0x00, 0x8C, 0x39, 0x00,
+    0x8F, 0x4A, 0x00, 0x91, 0x5C, 0x00, 0x96, 0x67, 0x00, 0x97, 0xEC, 0x01, 0x98, 0xD3, 0x09, 0x42,
+    0x4F, 0x05, 0x57, 0x0C, 0x18, 0x0A, 0x08, 0x15, 0x02, 0xB8, 0x09, 0x16, 0x02, 0xB4, 0x09, 0x0C,
+    0x16, 0x10, 0x18, 0x06, 0x15, 0x0C, 0x06, 0x85, 0x63, 0x69, 0x73, 0x69, 0x6F, 0x6E, 0x00, 0x17,
+    0x42, 0x4C, 0x05, 0x53, 0x09, 0x17, 0x08, 0x01, 0xBE, 0x1C, 0x15, 0x06, 0x11, 0x08, 0x01, 0xBB,
+    0x0F, 0x0C, 0x42, 0x50, 0x05, 0x59, 0x0B, 0x15, 0x08, 0x19, 0x02, 0x1A, 0x01, 0x04, 0x13, 0x02,
+    0x15, 0x01, 0x0C, 0x13, 0x13, 0x12, 0x85, 0x69, 0x6E, 0x69, 0x6F, 0x6E, 0x00, 0x49, 0x84, 0x1C,
+    0x00, 0x85, 0x20, 0x00, 0x88, 0x24, 0x00, 0x8C, 0x56, 0x00, 0x91, 0xBD, 0x00, 0x92, 0xE4, 0x00,
+    0x96, 0xF9, 0x00, 0x98, 0x68, 0x01, 0x99, 0x7A, 0x01, 0x0C, 0x0F, 0x01, 0xCB, 0x15, 0x02, 0x26,
+    0x06, 0x43, 0x46, 0x07, 0x49, 0x1A, 0x56, 0x2D, 0x42, 0x46, 0x05, 0x58, 0x09, 0x18, 0x16, 0x01,
+    0x4A, 0x16, 0x84, 0x63, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x00, 0x42, 0x49, 0x05, 0x52, 0x10,
+    0x12, 0x15, 0x13, 0x85, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x00, 0x15, 0x01, 0x04, 0x16, 0x12,
+    0x13, 0x01, 0x28, 0x46, 0x46, 0x0D, 0x4F, 0x18, 0x50, 0x1F, 0x51, 0x39, 0x55, 0x41, 0x59, 0x4A,
+    0x16, 0x08, 0x07, 0x86, 0x63, 0x69, 0x73, 0x69, 0x6F, 0x6E, 0x00, 0x12, 0x10, 0x08, 0x07, 0x02,
+    0xDD, 0x09, 0x43, 0x48, 0x07, 0x50, 0x0D, 0x52, 0x07, 0x82, 0x73, 0x69, 0x6F, 0x6E, 0x00, 0x42,
+    0x48, 0x05, 0x52, 0x05, 0x85, 0x69, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x00, 0x04, 0x0A, 0x15, 0x12,
+    0x08, 0x15, 0x01, 0x21, 0x04, 0x13, 0x10, 0x12, 0x06, 0x82, 0x6F, 0x6E, 0x00, 0x42, 0x48, 0x05,
+    0x52, 0x12, 0x0F, 0x08, 0x0F, 0x08, 0x17, 0x87, 0x76, 0x69, 0x73, 0x69, 0x6F, 0x6E, 0x00, 0x15,
+    0x13, 0x10, 0x0C, 0x82, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x42, 0x44, 0x05, 0x48, 0x12, 0x13,
+    0x04, 0x1B, 0x08, 0x87, 0x70, 0x61, 0x6E, 0x73, 0x69, 0x6F, 0x6E, 0x00, 0x42, 0x46, 0x05, 0x57,
+    0x11, 0x06, 0x04, 0x87, 0x73, 0x63, 0x65, 0x6E, 0x73, 0x69, 0x6F, 0x6E, 0x00, 0x17, 0x02, 0x6D,
+    0x09, 0x42, 0x53, 0x05, 0x55, 0x0B, 0x83, 0x69, 0x73, 0x6F, 0x6E, 0x00, 0x12, 0x06, 0x84, 0x72,
+    0x6F, 0x73, 0x69, 0x6F, 0x6E, 0x00, 0x43, 0x44, 0x07, 0x48, 0x1B, 0x4C, 0x45, 0x06, 0x42, 0x46,
+    0x05, 0x52, 0x0B, 0x12, 0x83, 0x69, 0x6F, 0x6E, 0x00, 0x85, 0x63, 0x61, 0x73, 0x69, 0x6F, 0x6E,
+    0x00, 0x42, 0x45, 0x05, 0x55, 0x0F, 0x12, 0x85, 0x73, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x00,
+    0x42, 0x4A, 0x05, 0x53, 0x10, 0x04, 0x86, 0x67, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x00,
+    0x12, 0x86, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x00, 0x10, 0x43, 0x47, 0x07, 0x48,
+    0x12, 0x52, 0x1F, 0x07, 0x04, 0x87, 0x6D, 0x69, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x00, 0x15, 0x13,
+    0x88, 0x65, 0x72, 0x6D, 0x69, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x00, 0x06, 0x85, 0x6D, 0x69, 0x73,
+    0x73, 0x69, 0x6F, 0x6E, 0x00, 0x42, 0x45, 0x05, 0x4F, 0x09, 0x10, 0x02, 0x03, 0x08, 0x04, 0x84,
+    0x6C, 0x75, 0x73, 0x69, 0x6F, 0x6E, 0x00, 0x08, 0x0F, 0x08, 0x17, 0x83, 0x69, 0x73, 0x69, 0x6F,
+    0x6E, 0x00, 0x4D, 0x84, 0x28, 0x00, 0x85, 0xB7, 0x04, 0x86, 0xCD, 0x04, 0x87, 0xE3, 0x05, 0x88,
+    0xF1, 0x05, 0x8C, 0x30, 0x06, 0x90, 0xDA, 0x06, 0x91, 0xE2, 0x06, 0x92, 0x35, 0x07, 0x95, 0x42,
+    0x07, 0x96, 0x54, 0x07, 0x98, 0x7E, 0x07, 0x9D, 0xDA, 0x07, 0x4F, 0x85, 0x2E, 0x00, 0x86, 0x4F,
+    0x00, 0x87, 0xBF, 0x00, 0x8A, 0xE3, 0x00, 0x8C, 0x02, 0x01, 0x8F, 0x72, 0x01, 0x90, 0xAE, 0x01,
+    0x91, 0xF4, 0x01, 0x93, 0x50, 0x02, 0x95, 0x60, 0x02, 0x96, 0x75, 0x03, 0x97, 0x9B, 0x03, 0x99,
+    0x15, 0x04, 0x9B, 0x27, 0x04, 0x9D, 0x34, 0x04, 0x42, 0x55, 0x05, 0x58, 0x14, 0x08, 0x17, 0x16,
+    0x04, 0x10, 0x87, 0x75, 0x72, 0x62, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x17, 0x15, 0x08, 0x13,
+    0x85, 0x72, 0x62, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x42, 0x4C, 0x05, 0x52, 0x6C, 0x44, 0x49,
+    0x09, 0x4F, 0x2A, 0x51, 0x47, 0x56, 0x57, 0x42, 0x4C, 0x05, 0x55, 0x14, 0x0F, 0x0F, 0x0C, 0x19,
+    0x89, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x08, 0x19, 0x87, 0x69, 0x66,
+    0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x42, 0x53, 0x05, 0x58, 0x11, 0x04, 0x87, 0x70,
+    0x6C, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x13, 0x87, 0x62, 0x6C, 0x69, 0x63, 0x61,
+    0x74, 0x69, 0x6F, 0x6E, 0x00, 0x0C, 0x10, 0x10, 0x12, 0x06, 0x88, 0x75, 0x6E, 0x69, 0x63, 0x61,
+    0x74, 0x69, 0x6F, 0x6E, 0x00, 0x12, 0x16, 0x16, 0x04, 0x88, 0x61, 0x73, 0x73, 0x69, 0x6E, 0x61,
+    0x74, 0x69, 0x6F, 0x6E, 0x00, 0x16, 0x02, 0x6E, 0x03, 0x43, 0x44, 0x07, 0x4C, 0x16, 0x52, 0x07,
+    0x10, 0x12, 0x06, 0x06, 0x04, 0x86, 0x6D, 0x6F, 0x64, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x07,
+    0x08, 0x15, 0x06, 0x06, 0x04, 0x85, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x42, 0x47, 0x05,
+    0x52, 0x12, 0x18, 0x0D, 0x05, 0x18, 0x16, 0x86, 0x67, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x13,
+    0x12, 0x15, 0x13, 0x86, 0x61, 0x67, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x45, 0x46, 0x0B, 0x47,
+    0x3D, 0x51, 0x45, 0x53, 0x52, 0x59, 0x60, 0x42, 0x51, 0x05, 0x52, 0x26, 0x18, 0x42, 0x50, 0x05,
+    0x52, 0x11, 0x10, 0x12, 0x06, 0x86, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x11, 0x12,
+    0x15, 0x13, 0x89, 0x75, 0x6E, 0x63, 0x69, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x0A, 0x08, 0x11,
+    0x86, 0x74, 0x69, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x08, 0x15, 0x06, 0x06, 0x04, 0x02, 0xD4,
+    0x01, 0x18, 0x10, 0x10, 0x12, 0x06, 0x84, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x12, 0x15,
+    0x13, 0x1B, 0x08, 0x85, 0x72, 0x69, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x08, 0x15, 0x05, 0x04,
+    0x88, 0x62, 0x72, 0x65, 0x76, 0x69, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x43, 0x48, 0x07, 0x4C,
+    0x13, 0x58, 0x2F, 0x06, 0x11, 0x04, 0x06, 0x84, 0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x42,
+    0x46, 0x05, 0x4B, 0x0D, 0x11, 0x12, 0x06, 0x08, 0x15, 0x02, 0x9D, 0x02, 0x0C, 0x11, 0x04, 0x88,
+    0x6E, 0x69, 0x68, 0x69, 0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x12, 0x13, 0x12, 0x13, 0x87,
+    0x75, 0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x44, 0x44, 0x09, 0x4C, 0x15, 0x4F, 0x23, 0x52,
+    0x29, 0x0F, 0x09, 0x11, 0x0C, 0x84, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x04, 0x0F, 0x06,
+    0x12, 0x15, 0x13, 0x86, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x04, 0x07, 0x81, 0x61, 0x6E,
+    0x00, 0x42, 0x49, 0x05, 0x4F, 0x10, 0x11, 0x0C, 0x85, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E,
+    0x00, 0x06, 0x12, 0x15, 0x13, 0x86, 0x61, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x43, 0x4C,
+    0x07, 0x50, 0x28, 0x55, 0x39, 0x42, 0x44, 0x05, 0x50, 0x11, 0x0F, 0x13, 0x1B, 0x08, 0x86, 0x6E,
+    0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x08, 0x16, 0x0C, 0x07, 0x88, 0x73, 0x65, 0x6D, 0x69, 0x6E,
+    0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x08, 0x07, 0x10, 0x12, 0x06, 0x89, 0x6E, 0x64, 0x65, 0x6D,
+    0x6E, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x04, 0x42, 0x46, 0x05, 0x57, 0x14, 0x0C, 0x08, 0x15,
+    0x88, 0x6E, 0x63, 0x61, 0x72, 0x6E, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x16, 0x11, 0x12, 0x06,
+    0x87, 0x65, 0x72, 0x6E, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x18, 0x06, 0x12, 0x08, 0x15, 0x13,
+    0x86, 0x63, 0x75, 0x70, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x46, 0x48, 0x0D, 0x4A, 0x6F, 0x4C,
+    0xA5, 0x52, 0xB2, 0x57, 0xC0, 0x58, 0xF5, 0x44, 0x45, 0x09, 0x49, 0x12, 0x4F, 0x24, 0x53, 0x32,
+    0x04, 0x84, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x0C, 0x0F, 0x08, 0x15, 0x13, 0x8A, 0x6F,
+    0x6C, 0x69, 0x66, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x0F, 0x08, 0x06, 0x06, 0x04,
+    0x87, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x42, 0x48, 0x05, 0x55, 0x14, 0x42, 0x55,
+    0x05, 0x56, 0x06, 0x13, 0x86, 0x61, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x12, 0x42, 0x46,
+    0x05, 0x52, 0x10, 0x11, 0x0C, 0x86, 0x6F, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x06, 0x88,
+    0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x43, 0x48, 0x07, 0x4C, 0x1C, 0x55, 0x29,
+    0x17, 0x11, 0x0C, 0x16, 0x08, 0x07, 0x8C, 0x69, 0x73, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x72, 0x61,
+    0x74, 0x69, 0x6F, 0x6E, 0x00, 0x10, 0x0C, 0x87, 0x6D, 0x69, 0x67, 0x72, 0x61, 0x74, 0x69, 0x6F,
+    0x6E, 0x00, 0x08, 0x17, 0x11, 0x0C, 0x87, 0x67, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x13,
+    0x16, 0x08, 0x07, 0x86, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x13, 0x16, 0x11, 0x04,
+    0x15, 0x17, 0x84, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x42, 0x4C, 0x05, 0x56, 0x13, 0x0F,
+    0x0C, 0x09, 0x11, 0x0C, 0x87, 0x74, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x42, 0x51, 0x05,
+    0x52, 0x14, 0x0C, 0x10, 0x07, 0x04, 0x87, 0x69, 0x73, 0x74, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E,
+    0x00, 0x10, 0x08, 0x07, 0x87, 0x6E, 0x73, 0x74, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x42,
+    0x44, 0x05, 0x4A, 0x12, 0x17, 0x16, 0x08, 0x15, 0x87, 0x6F, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E,
+    0x00, 0x04, 0x11, 0x0C, 0x87, 0x75, 0x67, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x0C,
+    0x0F, 0x04, 0x42, 0x56, 0x05, 0x57, 0x15, 0x11, 0x04, 0x8B, 0x6E, 0x61, 0x73, 0x61, 0x6C, 0x69,
+    0x73, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x16, 0x1C, 0x15, 0x06, 0x86, 0x6C, 0x69, 0x73, 0x61,
+    0x74, 0x69, 0x6F, 0x6E, 0x00, 0x45, 0x48, 0x0B, 0x4C, 0x1D, 0x51, 0x2B, 0x52, 0x4D, 0x55, 0x73,
+    0x15, 0x13, 0x08, 0x17, 0x11, 0x0C, 0x88, 0x72, 0x70, 0x72, 0x65, 0x74, 0x61, 0x74, 0x69, 0x6F,
+    0x6E, 0x00, 0x42, 0x4F, 0x05, 0x51, 0x0B, 0x04, 0x17, 0x08, 0x15, 0x01, 0x20, 0x0C, 0x01, 0x68,
+    0x42, 0x48, 0x05, 0x4C, 0x15, 0x10, 0x08, 0x0A, 0x08, 0x16, 0x89, 0x6D, 0x65, 0x6E, 0x74, 0x61,
+    0x74, 0x69, 0x6F, 0x6E, 0x00, 0x16, 0x16, 0x04, 0x16, 0x16, 0x04, 0x85, 0x61, 0x74, 0x69, 0x6F,
+    0x6E, 0x00, 0x43, 0x4A, 0x07, 0x4F, 0x0B, 0x51, 0x17, 0x08, 0x11, 0x01, 0x3B, 0x13, 0x1B, 0x08,
+    0x85, 0x69, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x11, 0x04, 0x06, 0x89, 0x6F, 0x6E, 0x6E,
+    0x6F, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x08, 0x16, 0x16, 0x04, 0x02, 0xEA, 0x01, 0x42,
+    0x44, 0x17, 0x52, 0x05, 0x11, 0x11, 0x08, 0x15, 0x87, 0x6F, 0x76, 0x61, 0x74, 0x69, 0x6F, 0x6E,
+    0x00, 0x1C, 0x0B, 0x13, 0x16, 0x04, 0x84, 0x69, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x0C, 0x44,
+    0x4B, 0x09, 0x4F, 0x23, 0x51, 0x35, 0x57, 0x48, 0x13, 0x15, 0x12, 0x10, 0x12, 0x15, 0x0B, 0x17,
+    0x11, 0x04, 0x8B, 0x70, 0x6F, 0x6D, 0x6F, 0x72, 0x70, 0x68, 0x69, 0x7A, 0x61, 0x74, 0x69, 0x6F,
+    0x6E, 0x00, 0x04, 0x16, 0x11, 0x04, 0x8B, 0x6E, 0x61, 0x73, 0x61, 0x6C, 0x69, 0x7A, 0x61, 0x74,
+    0x69, 0x6F, 0x6E, 0x00, 0x12, 0x15, 0x06, 0x11, 0x1C, 0x16, 0x89, 0x68, 0x72, 0x6F, 0x6E, 0x69,
+    0x7A, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x0C, 0x10, 0x0C, 0x0F, 0x06, 0x06, 0x04, 0x88, 0x61,
+    0x74, 0x69, 0x7A, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x42, 0x4C, 0x05, 0x55, 0x0B, 0x0B, 0x1B,
+    0x08, 0x02, 0xAC, 0x02, 0x12, 0x16, 0x05, 0x04, 0x84, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x46,
+    0x44, 0x0D, 0x48, 0x23, 0x4C, 0x5D, 0x4F, 0x89, 0x51, 0x92, 0x58, 0xA2, 0x09, 0x16, 0x0C, 0x17,
+    0x04, 0x16, 0x0C, 0x07, 0x8A, 0x73, 0x61, 0x74, 0x69, 0x73, 0x66, 0x61, 0x63, 0x74, 0x69, 0x6F,
+    0x6E, 0x00, 0x44, 0x51, 0x09, 0x55, 0x14, 0x57, 0x25, 0x5B, 0x32, 0x12, 0x06, 0x85, 0x6E, 0x65,
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x15, 0x18, 0x16, 0x16, 0x08, 0x15, 0x89, 0x75, 0x72, 0x72,
+    0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x08, 0x15, 0x13, 0x87, 0x6F, 0x74, 0x65, 0x63, 0x74,
+    0x69, 0x6F, 0x6E, 0x00, 0x08, 0x83, 0x75, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x43, 0x47, 0x07, 0x49,
+    0x0F, 0x57, 0x1A, 0x04, 0x15, 0x17, 0x1B, 0x08, 0x02, 0x2E, 0x02, 0x0C, 0x06, 0x18, 0x15, 0x06,
+    0x84, 0x78, 0x69, 0x6F, 0x6E, 0x00, 0x16, 0x0C, 0x42, 0x47, 0x33, 0x55, 0x05, 0x18, 0x0D, 0x86,
+    0x64, 0x69, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x08, 0x84, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+    0x00, 0x0C, 0x17, 0x06, 0x16, 0x0C, 0x07, 0x88, 0x74, 0x69, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+    0x00, 0x43, 0x4D, 0x07, 0x55, 0x12, 0x57, 0x63, 0x11, 0x12, 0x06, 0x84, 0x6E, 0x63, 0x74, 0x69,
+    0x6F, 0x6E, 0x00, 0x17, 0x44, 0x46, 0x09, 0x51, 0x16, 0x56, 0x23, 0x57, 0x43, 0x16, 0x08, 0x07,
+    0x88, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x12, 0x06, 0x87, 0x73, 0x74, 0x72,
+    0x75, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x42, 0x4C, 0x05, 0x57, 0x12, 0x07, 0x89, 0x65, 0x73,
+    0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x11, 0x12, 0x06, 0x89, 0x73, 0x74, 0x72,
+    0x75, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x16, 0x11, 0x12, 0x06, 0x87, 0x72, 0x75, 0x63, 0x74,
+    0x69, 0x6F, 0x6E, 0x00, 0x16, 0x11, 0x42, 0x4C, 0x06, 0x52, 0x05, 0x06, 0x85, 0x72, 0x75, 0x63,
+    0x74, 0x69, 0x6F, 0x6E, 0x00, 0x42, 0x47, 0x05, 0x4C, 0x09, 0x04, 0x02, 0x82, 0x01, 0x07, 0x11,
+    0x02, 0x15, 0x01, 0x43, 0x53, 0x07, 0x55, 0x17, 0x57, 0x29, 0x42, 0x48, 0x05, 0x50, 0x08, 0x15,
+    0x01, 0x04, 0x12, 0x06, 0x81, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x12, 0x10, 0x08, 0x10, 0x12, 0x06,
+    0x88, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x08, 0x42, 0x4F, 0x05,
+    0x53, 0x0E, 0x13, 0x10, 0x12, 0x06, 0x84, 0x69, 0x6F, 0x6E, 0x00, 0x84, 0x69, 0x74, 0x69, 0x6F,
+    0x6E, 0x00, 0x45, 0x45, 0x0B, 0x50, 0x29, 0x51, 0x38, 0x56, 0x4F, 0x57, 0x7A, 0x42, 0x44, 0x05,
+    0x4C, 0x12, 0x0B, 0x12, 0x15, 0x13, 0x86, 0x69, 0x62, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x1B,
+    0x08, 0x86, 0x68, 0x69, 0x62, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x42, 0x47, 0x05, 0x48, 0x08,
+    0x04, 0x08, 0x15, 0x83, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x00, 0x42, 0x4C, 0x05, 0x58, 0x0B, 0x19,
+    0x0C, 0x07, 0x02, 0x07, 0x01, 0x10, 0x04, 0x86, 0x6D, 0x75, 0x6E, 0x69, 0x74, 0x69, 0x6F, 0x6E,
+    0x00, 0x43, 0x4C, 0x07, 0x52, 0x16, 0x56, 0x22, 0x18, 0x14, 0x04, 0x88, 0x63, 0x71, 0x75, 0x69,
+    0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x13, 0x12, 0x86, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69,
+    0x6F, 0x6E, 0x00, 0x12, 0x13, 0x85, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x43, 0x44, 0x07, 0x4C,
+    0x13, 0x53, 0x25, 0x13, 0x08, 0x15, 0x86, 0x65, 0x74, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x42,
+    0x47, 0x05, 0x56, 0x0A, 0x04, 0x15, 0x17, 0x01, 0x06, 0x12, 0x13, 0x13, 0x12, 0x83, 0x6F, 0x6E,
+    0x00, 0x08, 0x15, 0x85, 0x65, 0x74, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x15, 0x12, 0x09, 0x11,
+    0x0C, 0x02, 0x01, 0x01, 0x45, 0x44, 0x0B, 0x46, 0x25, 0x48, 0x2F, 0x4C, 0x46, 0x58, 0x4B, 0x42,
+    0x4C, 0x05, 0x56, 0x12, 0x07, 0x15, 0x12, 0x12, 0x06, 0x85, 0x6E, 0x61, 0x74, 0x69, 0x6F, 0x6E,
+    0x00, 0x11, 0x08, 0x13, 0x10, 0x12, 0x06, 0x01, 0x5F, 0x18, 0x09, 0x85, 0x6E, 0x63, 0x74, 0x69,
+    0x6F, 0x6E, 0x00, 0x43, 0x50, 0x07, 0x53, 0x0C, 0x57, 0x12, 0x0C, 0x07, 0x02, 0x5D, 0x01, 0x16,
+    0x18, 0x16, 0x02, 0x57, 0x01, 0x1B, 0x08, 0x02, 0x52, 0x01, 0x09, 0x08, 0x07, 0x01, 0x40, 0x09,
+    0x83, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x10, 0x12, 0x13, 0x86, 0x72, 0x6F, 0x6D, 0x6F, 0x74,
+    0x69, 0x6F, 0x6E, 0x00, 0x42, 0x44, 0x05, 0x48, 0x0B, 0x13, 0x08, 0x15, 0x13, 0x01, 0x95, 0x19,
+    0x11, 0x12, 0x06, 0x02, 0x26, 0x01, 0x43, 0x4C, 0x07, 0x52, 0x16, 0x57, 0x1E, 0x42, 0x51, 0x81,
+    0x56, 0x05, 0x11, 0x04, 0x15, 0x17, 0x84, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x13, 0x83, 0x69, 0x74,
+    0x69, 0x6F, 0x6E, 0x00, 0x16, 0x0E, 0x15, 0x12, 0x1A, 0x84, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00,
+    0x44, 0x45, 0x09, 0x46, 0x18, 0x4F, 0x25, 0x57, 0x36, 0x18, 0x15, 0x17, 0x16, 0x0C, 0x07, 0x86,
+    0x69, 0x62, 0x75, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x08, 0x06, 0x1B, 0x08, 0x87, 0x65, 0x63, 0x75,
+    0x74, 0x69, 0x6F, 0x6E, 0x00, 0x42, 0x4F, 0x05, 0x52, 0x08, 0x0C, 0x01, 0xCE, 0x13, 0x84, 0x6C,
+    0x75, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x0C, 0x42, 0x56, 0x05, 0x57, 0x16, 0x11, 0x42, 0x4C, 0x06,
+    0x52, 0x05, 0x06, 0x86, 0x74, 0x69, 0x74, 0x75, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x16, 0x12, 0x06,
+    0x88, 0x6E, 0x73, 0x74, 0x69, 0x74, 0x75, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x0C, 0x11, 0x04, 0x0A,
+    0x15, 0x12, 0x83, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x17, 0x0C, 0x17, 0x16, 0x11, 0x12, 0x06,
+    0x82, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x0F, 0x0C, 0x10, 0x01, 0xE3, 0x42, 0x48, 0x05, 0x52, 0x13,
+    0x11, 0x12, 0x10, 0x12, 0x11, 0x08, 0x0B, 0x13, 0x85, 0x65, 0x6E, 0x6F, 0x6E, 0x00, 0x10, 0x12,
+    0x11, 0x08, 0x0B, 0x13, 0x83, 0x65, 0x6E, 0x6F, 0x6E, 0x00, 0x42, 0x4F, 0x05, 0x57, 0x0D, 0x04,
+    0x05, 0x82, 0x6C, 0x6F, 0x6F, 0x6E, 0x00, 0x16, 0x15, 0x08, 0x07, 0x11, 0x18, 0x02, 0xF6, 0x49,
+    0x42, 0x47, 0x05, 0x52, 0x14, 0x08, 0x0B, 0x12, 0x17, 0x06, 0x12, 0x86, 0x61, 0x68, 0x65, 0x64,
+    0x72, 0x6F, 0x6E, 0x00, 0x10, 0x0C, 0x1B, 0x12, 0x85, 0x79, 0x6D, 0x6F, 0x72, 0x6F, 0x6E, 0x00,
+    0x42, 0x44, 0x05, 0x4C, 0x0D, 0x0C, 0x0F, 0x82, 0x69, 0x73, 0x6F, 0x6E, 0x00, 0x45, 0x44, 0x0B,
+    0x46, 0x7D, 0x51, 0x10, 0x55, 0x1A, 0x59, 0x22, 0x06, 0x06, 0x12, 0x01, 0x0E, 0x15, 0x04, 0x0A,
+    0x84, 0x72, 0x69, 0x73, 0x6F, 0x6E, 0x00, 0x08, 0x19, 0x83, 0x73, 0x69, 0x6F, 0x6E, 0x00, 0x0C,
+    0x01, 0x5B, 0x44, 0x44, 0x09, 0x46, 0x34, 0x4C, 0x3F, 0x53, 0x54, 0x43, 0x4F, 0x07, 0x50, 0x1C,
+    0x51, 0x26, 0x42, 0x48, 0x05, 0x58, 0x10, 0x0E, 0x16, 0x12, 0x1B, 0x08, 0x83, 0x65, 0x74, 0x6F,
+    0x6E, 0x00, 0x06, 0x15, 0x0C, 0x01, 0x19, 0x15, 0x12, 0x09, 0x16, 0x11, 0x04, 0x15, 0x17, 0x01,
+    0x2D, 0x0C, 0x10, 0x12, 0x01, 0x27, 0x08, 0x0F, 0x42, 0x48, 0x24, 0x4F, 0x05, 0x12, 0x06, 0x01,
+    0x1D, 0x42, 0x44, 0x05, 0x56, 0x11, 0x06, 0x0C, 0x0F, 0x13, 0x13, 0x04, 0x83, 0x74, 0x69, 0x6F,
+    0x6E, 0x00, 0x12, 0x13, 0x01, 0x08, 0x0C, 0x15, 0x06, 0x16, 0x08, 0x07, 0x81, 0x69, 0x6F, 0x6E,
+    0x00, 0x08, 0x43, 0x4B, 0x07, 0x56, 0x1F, 0x57, 0x28, 0x42, 0x55, 0x05, 0x57, 0x0E, 0x12, 0x11,
+    0x83, 0x74, 0x68, 0x65, 0x72, 0x6E, 0x00, 0x12, 0x11, 0x84, 0x72, 0x74, 0x68, 0x65, 0x72, 0x6E,
+    0x00, 0x11, 0x12, 0x06, 0x83, 0x63, 0x65, 0x72, 0x6E, 0x00, 0x16, 0x04, 0x08, 0x15, 0x08, 0x0B,
+    0x17, 0x15, 0x12, 0x11, 0x87, 0x61, 0x73, 0x74, 0x65, 0x72, 0x6E, 0x00, 0x43, 0x4A, 0x07, 0x4C,
+    0x0F, 0x52, 0x26, 0x0C, 0x0B, 0x17, 0x82, 0x6E, 0x67, 0x73, 0x00, 0x11, 0x04, 0x0C, 0x15, 0x04,
+    0x17, 0x0C, 0x05, 0x0C, 0x0F, 0x89, 0x65, 0x72, 0x74, 0x61, 0x72, 0x69, 0x61, 0x6E, 0x69, 0x73,
+    0x6D, 0x00, 0x0C, 0x16, 0x0C, 0x19, 0x12, 0x15, 0x13, 0x81, 0x6E, 0x00, 0x04, 0x17, 0x16, 0x11,
+    0x12, 0x06, 0x02, 0xEE, 0x22, 0x15, 0x17, 0x08, 0x15, 0x82, 0x75, 0x72, 0x6E, 0x00, 0x12, 0x42,
+    0x4E, 0x05, 0x51, 0x0D, 0x11, 0x18, 0x82, 0x6E, 0x6F, 0x77, 0x6E, 0x00, 0x0E, 0x08, 0x15, 0x84,
+    0x6E, 0x6F, 0x77, 0x6E, 0x00, 0x11, 0x12, 0x07, 0x18, 0x08, 0x16, 0x13, 0x80, 0x6D, 0x00, 0x47,
+    0x46, 0x0F, 0x47, 0x4D, 0x4C, 0x7A, 0x4F, 0x89, 0x52, 0x93, 0x56, 0x9B, 0x57, 0xA4, 0x43, 0x44,
+    0x07, 0x46, 0x11, 0x52, 0x34, 0x05, 0x05, 0x12, 0x17, 0x83, 0x61, 0x63, 0x63, 0x6F, 0x00, 0x42,
+    0x44, 0x05, 0x52, 0x10, 0x05, 0x04, 0x17, 0x85, 0x6F, 0x62, 0x61, 0x63, 0x63, 0x6F, 0x00, 0x42,
+    0x46, 0x05, 0x55, 0x0A, 0x12, 0x15, 0x81, 0x6F, 0x00, 0x15, 0x12, 0x10, 0x84, 0x6F, 0x63, 0x63,
+    0x6F, 0x00, 0x15, 0x15, 0x12, 0x10, 0x83, 0x6F, 0x63, 0x63, 0x6F, 0x00, 0x43, 0x44, 0x07, 0x48,
+    0x19, 0x51, 0x22, 0x11, 0x12, 0x0C, 0x06, 0x0C, 0x09, 0x09, 0x04, 0x88, 0x69, 0x63, 0x69, 0x6F,
+    0x6E, 0x61, 0x64, 0x6F, 0x00, 0x18, 0x16, 0x13, 0x83, 0x65, 0x75, 0x64, 0x6F, 0x00, 0x04, 0x10,
+    0x12, 0x06, 0x83, 0x6D, 0x61, 0x6E, 0x64, 0x6F, 0x00, 0x15, 0x04, 0x16, 0x16, 0x08, 0x15, 0x13,
+    0x10, 0x0C, 0x84, 0x61, 0x72, 0x69, 0x6F, 0x00, 0x08, 0x10, 0x08, 0x15, 0x17, 0x82, 0x6F, 0x6C,
+    0x6F, 0x00, 0x17, 0x04, 0x17, 0x81, 0x74, 0x6F, 0x6F, 0x00, 0x08, 0x15, 0x12, 0x10, 0x81, 0x20,
+    0x73, 0x6F, 0x00, 0x11, 0x08, 0x10, 0x12, 0x10, 0x85, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x6F, 0x00,
+    0x44, 0x44, 0x09, 0x4C, 0x0F, 0x52, 0x59, 0x56, 0x6B, 0x15, 0x1C, 0x16, 0x02, 0x28, 0x2E, 0x0B,
+    0x42, 0x55, 0x05, 0x56, 0x11, 0x04, 0x0F, 0x12, 0x0B, 0x06, 0x16, 0x82, 0x73, 0x68, 0x69, 0x70,
+    0x00, 0x43, 0x48, 0x07, 0x51, 0x18, 0x55, 0x27, 0x0F, 0x17, 0x17, 0x04, 0x06, 0x89, 0x62, 0x61,
+    0x74, 0x74, 0x6C, 0x65, 0x73, 0x68, 0x69, 0x70, 0x00, 0x13, 0x12, 0x0C, 0x17, 0x04, 0x0F, 0x08,
+    0x15, 0x85, 0x6E, 0x73, 0x68, 0x69, 0x70, 0x00, 0x08, 0x19, 0x0C, 0x06, 0x08, 0x15, 0x87, 0x65,
+    0x69, 0x76, 0x65, 0x72, 0x73, 0x68, 0x69, 0x70, 0x00, 0x42, 0x4C, 0x05, 0x4F, 0x0A, 0x17, 0x0E,
+    0x16, 0x01, 0x05, 0x0F, 0x08, 0x19, 0x08, 0x07, 0x02, 0x32, 0x48, 0x04, 0x0B, 0x15, 0x08, 0x13,
+    0x81, 0x70, 0x73, 0x00, 0x4C, 0x84, 0x25, 0x00, 0x88, 0x49, 0x01, 0x8B, 0xDC, 0x05, 0x8C, 0xE4,
+    0x05, 0x8F, 0x16, 0x06, 0x91, 0x23, 0x06, 0x92, 0x2A, 0x06, 0x95, 0x5F, 0x07, 0x96, 0x67, 0x07,
+    0x97, 0x7C, 0x07, 0x98, 0x82, 0x07, 0x9C, 0xE0, 0x07, 0x45, 0x88, 0x10, 0x00, 0x8C, 0x4B, 0x00,
+    0x8F, 0x60, 0x00, 0x96, 0x16, 0x01, 0x98, 0x1A, 0x01, 0x43, 0x4F, 0x07, 0x53, 0x11, 0x5C, 0x2F,
+    0x18, 0x06, 0x18, 0x11, 0x84, 0x6C, 0x65, 0x61, 0x72, 0x00, 0x42, 0x44, 0x05, 0x53, 0x11, 0x16,
+    0x16, 0x0C, 0x07, 0x85, 0x61, 0x70, 0x70, 0x65, 0x61, 0x72, 0x00, 0x04, 0x16, 0x16, 0x0C, 0x07,
+    0x86, 0x61, 0x70, 0x70, 0x65, 0x61, 0x72, 0x00, 0x17, 0x0B, 0x0A, 0x0C, 0x0F, 0x83, 0x20, 0x79,
+    0x65, 0x61, 0x72, 0x00, 0x0F, 0x42, 0x4C, 0x05, 0x4F, 0x0B, 0x10, 0x0C, 0x16, 0x02, 0x2B, 0x45,
+    0x0C, 0x10, 0x04, 0x09, 0x83, 0x69, 0x61, 0x72, 0x00, 0x44, 0x46, 0x09, 0x4C, 0x28, 0x4F, 0x50,
+    0x58, 0x77, 0x18, 0x42, 0x44, 0x05, 0x57, 0x11, 0x17, 0x06, 0x08, 0x13, 0x16, 0x84, 0x63, 0x75,
+    0x6C, 0x61, 0x72, 0x00, 0x0C, 0x15, 0x04, 0x13, 0x86, 0x74, 0x69, 0x63, 0x75, 0x6C, 0x61, 0x72,
+    0x00, 0x42, 0x50, 0x05, 0x53, 0x0E, 0x10, 0x0C, 0x16, 0x84, 0x69, 0x6C, 0x61, 0x72, 0x00, 0x15,
+    0x08, 0x17, 0x42, 0x44, 0x05, 0x57, 0x0B, 0x06, 0x81, 0x6C, 0x61, 0x72, 0x00, 0x04, 0x06, 0x87,
+    0x65, 0x72, 0x70, 0x69, 0x6C, 0x6C, 0x61, 0x72, 0x00, 0x0C, 0x13, 0x43, 0x84, 0xD0, 0x02, 0x88,
+    0x0A, 0x00, 0x95, 0x16, 0x00, 0x17, 0x04, 0x06, 0x85, 0x72, 0x70, 0x69, 0x6C, 0x6C, 0x61, 0x72,
+    0x00, 0x08, 0x17, 0x17, 0x04, 0x06, 0x88, 0x65, 0x72, 0x70, 0x69, 0x6C, 0x6C, 0x61, 0x72, 0x00,
+    0x42, 0x46, 0x05, 0x4F, 0x33, 0x42, 0x4C, 0x05, 0x58, 0x27, 0x42, 0x47, 0x05, 0x57, 0x16, 0x11,
+    0x0C, 0x13, 0x15, 0x08, 0x13, 0x88, 0x65, 0x6E, 0x64, 0x69, 0x63, 0x75, 0x6C, 0x61, 0x72, 0x00,
+    0x04, 0x13, 0x86, 0x72, 0x74, 0x69, 0x63, 0x75, 0x6C, 0x61, 0x72, 0x00, 0x11, 0x83, 0x6C, 0x65,
+    0x61, 0x72, 0x00, 0x06, 0x0C, 0x17, 0x16, 0x08, 0x17, 0x84, 0x75, 0x6C, 0x61, 0x72, 0x00, 0x04,
+    0x02, 0x2F, 0x03, 0x0F, 0x0A, 0x08, 0x15, 0x83, 0x75, 0x6C, 0x61, 0x72, 0x00, 0x52, 0x84, 0x37,
+    0x00, 0x85, 0x45, 0x00, 0x87, 0x65, 0x00, 0x88, 0xD8, 0x00, 0x8A, 0x1C, 0x01, 0x8B, 0x3D, 0x01,
+    0x8C, 0x01, 0x02, 0x8F, 0x3F, 0x02, 0x90, 0x76, 0x02, 0x91, 0x86, 0x02, 0x92, 0xE0, 0x02, 0x93,
+    0xF1, 0x02, 0x95, 0xF9, 0x02, 0x96, 0x19, 0x03, 0x97, 0x3D, 0x03, 0x98, 0x30, 0x04, 0x99, 0x39,
+    0x04, 0x9C, 0x8A, 0x04, 0x42, 0x4F, 0x05, 0x5A, 0x08, 0x06, 0x01, 0x03, 0x16, 0x82, 0x65, 0x61,
+    0x72, 0x00, 0x42, 0x44, 0x05, 0x48, 0x0E, 0x0F, 0x04, 0x06, 0x83, 0x69, 0x62, 0x65, 0x72, 0x00,
+    0x10, 0x08, 0x42, 0x50, 0x05, 0x55, 0x0A, 0x83, 0x62, 0x65, 0x72, 0x00, 0x82, 0x6D, 0x62, 0x65,
+    0x72, 0x00, 0x45, 0x4C, 0x0B, 0x4F, 0x24, 0x51, 0x35, 0x55, 0x5F, 0x58, 0x6C, 0x42, 0x46, 0x05,
+    0x47, 0x0F, 0x11, 0x12, 0x06, 0x84, 0x73, 0x69, 0x64, 0x65, 0x72, 0x00, 0x16, 0x11, 0x12, 0x06,
+    0x84, 0x69, 0x64, 0x65, 0x72, 0x00, 0x0C, 0x18, 0x05, 0x07, 0x1C, 0x07, 0x12, 0x05, 0x87, 0x62,
+    0x75, 0x69, 0x6C, 0x64, 0x65, 0x72, 0x00, 0x42, 0x44, 0x05, 0x4C, 0x10, 0x10, 0x12, 0x06, 0x84,
+    0x6D, 0x61, 0x6E, 0x64, 0x65, 0x72, 0x00, 0x0F, 0x42, 0x46, 0x05, 0x4C, 0x0F, 0x1C, 0x06, 0x86,
+    0x6C, 0x69, 0x6E, 0x64, 0x65, 0x72, 0x00, 0x06, 0x86, 0x79, 0x6C, 0x69, 0x6E, 0x64, 0x65, 0x72,
+    0x00, 0x12, 0x16, 0x08, 0x07, 0x86, 0x69, 0x73, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x00, 0x10, 0x82,
+    0x72, 0x64, 0x65, 0x72, 0x00, 0x43, 0x51, 0x07, 0x55, 0x1F, 0x57, 0x27, 0x08, 0x42, 0x4A, 0x05,
+    0x4C, 0x0E, 0x11, 0x08, 0x84, 0x69, 0x6E, 0x65, 0x65, 0x72, 0x00, 0x0A, 0x11, 0x08, 0x84, 0x6E,
+    0x65, 0x65, 0x72, 0x00, 0x15, 0x04, 0x06, 0x83, 0x65, 0x65, 0x72, 0x00, 0x11, 0x42, 0x52, 0x05,
+    0x58, 0x10, 0x0F, 0x12, 0x19, 0x85, 0x75, 0x6E, 0x74, 0x65, 0x65, 0x72, 0x00, 0x12, 0x0F, 0x12,
+    0x19, 0x86, 0x75, 0x6E, 0x74, 0x65, 0x65, 0x72, 0x00, 0x43, 0x47, 0x07, 0x4C, 0x11, 0x51, 0x15,
+    0x08, 0x06, 0x12, 0x15, 0x13, 0x82, 0x75, 0x72, 0x65, 0x00, 0x0B, 0x02, 0xA4, 0x02, 0x04, 0x16,
+    0x16, 0x08, 0x10, 0x84, 0x65, 0x6E, 0x67, 0x65, 0x72, 0x00, 0x44, 0x4A, 0x09, 0x53, 0x1C, 0x56,
+    0x50, 0x57, 0x5F, 0x42, 0x4C, 0x05, 0x58, 0x0E, 0x08, 0x0B, 0x85, 0x69, 0x67, 0x68, 0x65, 0x72,
+    0x00, 0x04, 0x07, 0x02, 0xB0, 0x01, 0x43, 0x44, 0x07, 0x52, 0x19, 0x56, 0x28, 0x15, 0x0A, 0x12,
+    0x0B, 0x17, 0x15, 0x04, 0x06, 0x88, 0x6F, 0x67, 0x72, 0x61, 0x70, 0x68, 0x65, 0x72, 0x00, 0x16,
+    0x0C, 0x0F, 0x0C, 0x0B, 0x13, 0x86, 0x6F, 0x73, 0x6F, 0x70, 0x68, 0x65, 0x72, 0x00, 0x12, 0x0F,
+    0x0C, 0x0B, 0x13, 0x83, 0x6F, 0x70, 0x68, 0x65, 0x72, 0x00, 0x0C, 0x0F, 0x05, 0x0C, 0x13, 0x87,
+    0x75, 0x62, 0x6C, 0x69, 0x73, 0x68, 0x65, 0x72, 0x00, 0x45, 0x44, 0x0B, 0x48, 0x1B, 0x4B, 0x39,
+    0x52, 0x41, 0x58, 0x4C, 0x08, 0x42, 0x4B, 0x05, 0x5A, 0x09, 0x17, 0x02, 0x47, 0x01, 0x0F, 0x0F,
+    0x08, 0x05, 0x01, 0x46, 0x42, 0x4A, 0x05, 0x4B, 0x14, 0x12, 0x17, 0x0F, 0x0F, 0x04, 0x88, 0x74,
+    0x6F, 0x67, 0x65, 0x74, 0x68, 0x65, 0x72, 0x00, 0x0A, 0x12, 0x17, 0x85, 0x65, 0x74, 0x68, 0x65,
+    0x72, 0x00, 0x1A, 0x83, 0x65, 0x74, 0x68, 0x65, 0x72, 0x00, 0x1C, 0x11, 0x04, 0x84, 0x20, 0x6F,
+    0x74, 0x68, 0x65, 0x72, 0x00, 0x43, 0x84, 0xA7, 0x02, 0x89, 0x0A, 0x00, 0x95, 0x11, 0x00, 0x83,
+    0x72, 0x74, 0x68, 0x65, 0x72, 0x00, 0x18, 0x09, 0x84, 0x74, 0x68, 0x65, 0x72, 0x00, 0x44, 0x4B,
+    0x09, 0x4F, 0x0F, 0x51, 0x2C, 0x55, 0x34, 0x17, 0x82, 0x65, 0x69, 0x72, 0x00, 0x42, 0x44, 0x05,
+    0x53, 0x0D, 0x08, 0x83, 0x72, 0x6C, 0x69, 0x65, 0x72, 0x00, 0x10, 0x42, 0x4C, 0x05, 0x52, 0x08,
+    0x16, 0x01, 0xD1, 0x06, 0x83, 0x69, 0x6C, 0x65, 0x72, 0x00, 0x08, 0x19, 0x18, 0x12, 0x16, 0x81,
+    0x72, 0x00, 0x18, 0x15, 0x18, 0x12, 0x06, 0x84, 0x69, 0x65, 0x72, 0x00, 0x42, 0x4F, 0x05, 0x58,
+    0x32, 0x42, 0x48, 0x05, 0x4C, 0x14, 0x09, 0x15, 0x08, 0x0E, 0x06, 0x12, 0x15, 0x86, 0x66, 0x65,
+    0x6C, 0x6C, 0x65, 0x72, 0x00, 0x13, 0x42, 0x44, 0x05, 0x55, 0x12, 0x17, 0x04, 0x06, 0x86, 0x65,
+    0x72, 0x70, 0x69, 0x6C, 0x6C, 0x61, 0x72, 0x00, 0x08, 0x17, 0x04, 0x06, 0x01, 0x0F, 0x13, 0x12,
+    0x13, 0x01, 0x0A, 0x42, 0x50, 0x05, 0x58, 0x0C, 0x04, 0x15, 0x0A, 0x81, 0x61, 0x72, 0x00, 0x0B,
+    0x02, 0x0C, 0x02, 0x45, 0x44, 0x0B, 0x48, 0x1A, 0x51, 0x26, 0x52, 0x33, 0x55, 0x53, 0x1D, 0x0C,
+    0x13, 0x13, 0x0C, 0x0F, 0x86, 0x69, 0x7A, 0x7A, 0x61, 0x6E, 0x65, 0x72, 0x00, 0x19, 0x18, 0x12,
+    0x0A, 0x85, 0x76, 0x65, 0x72, 0x6E, 0x6F, 0x72, 0x00, 0x18, 0x15, 0x12, 0x09, 0x84, 0x65, 0x72,
+    0x75, 0x6E, 0x6E, 0x65, 0x72, 0x00, 0x0C, 0x42, 0x46, 0x05, 0x57, 0x13, 0x0C, 0x17, 0x06, 0x04,
+    0x15, 0x13, 0x85, 0x74, 0x69, 0x6F, 0x6E, 0x65, 0x72, 0x00, 0x06, 0x04, 0x15, 0x13, 0x83, 0x74,
+    0x69, 0x6F, 0x6E, 0x65, 0x72, 0x00, 0x08, 0x19, 0x12, 0x0A, 0x02, 0xB2, 0x01, 0x42, 0x49, 0x05,
+    0x5A, 0x0A, 0x08, 0x05, 0x02, 0xCC, 0x01, 0x13, 0x83, 0x6F, 0x77, 0x65, 0x72, 0x00, 0x13, 0x12,
+    0x15, 0x13, 0x82, 0x65, 0x72, 0x00, 0x43, 0x44, 0x07, 0x48, 0x12, 0x52, 0x17, 0x18, 0x14, 0x07,
+    0x04, 0x08, 0x0B, 0x81, 0x74, 0x65, 0x72, 0x00, 0x18, 0x14, 0x02, 0x06, 0x01, 0x13, 0x10, 0x08,
+    0x83, 0x65, 0x72, 0x6F, 0x72, 0x00, 0x44, 0x44, 0x09, 0x51, 0x12, 0x55, 0x17, 0x56, 0x1C, 0x08,
+    0x06, 0x84, 0x61, 0x65, 0x73, 0x61, 0x72, 0x00, 0x12, 0x13, 0x02, 0x61, 0x01, 0x18, 0x06, 0x08,
+    0x01, 0x05, 0x08, 0x09, 0x12, 0x15, 0x13, 0x02, 0x55, 0x01, 0x48, 0x44, 0x11, 0x46, 0x41, 0x49,
+    0x4E, 0x4B, 0x5B, 0x4C, 0x90, 0x51, 0xA3, 0x56, 0xA9, 0x58, 0xCE, 0x42, 0x4F, 0x05, 0x58, 0x25,
+    0x42, 0x56, 0x05, 0x58, 0x0C, 0x11, 0x04, 0x15, 0x17, 0x02, 0x33, 0x01, 0x06, 0x42, 0x44, 0x05,
+    0x4F, 0x10, 0x06, 0x86, 0x6C, 0x63, 0x75, 0x6C, 0x61, 0x74, 0x6F, 0x72, 0x00, 0x04, 0x01, 0xA4,
+    0x14, 0x07, 0x04, 0x08, 0x0B, 0x82, 0x72, 0x74, 0x65, 0x72, 0x00, 0x04, 0x15, 0x0B, 0x06, 0x85,
+    0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x00, 0x04, 0x15, 0x08, 0x0B, 0x17, 0x84, 0x65, 0x61,
+    0x66, 0x74, 0x65, 0x72, 0x00, 0x43, 0x46, 0x07, 0x4A, 0x1F, 0x52, 0x2D, 0x04, 0x15, 0x04, 0x42,
+    0x46, 0x05, 0x4B, 0x0F, 0x87, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x00, 0x06, 0x83,
+    0x74, 0x65, 0x72, 0x00, 0x0C, 0x15, 0x1A, 0x11, 0x08, 0x08, 0x15, 0x06, 0x16, 0x84, 0x74, 0x65,
+    0x72, 0x00, 0x11, 0x04, 0x83, 0x74, 0x68, 0x65, 0x72, 0x00, 0x42, 0x48, 0x05, 0x51, 0x0A, 0x81,
+    0x68, 0x65, 0x72, 0x00, 0x12, 0x15, 0x09, 0x83, 0x74, 0x69, 0x65, 0x72, 0x00, 0x08, 0x19, 0x11,
+    0x0C, 0x01, 0xAB, 0x43, 0x44, 0x07, 0x4C, 0x11, 0x51, 0x1C, 0x0C, 0x07, 0x84, 0x73, 0x61, 0x73,
+    0x74, 0x65, 0x72, 0x00, 0x11, 0x11, 0x04, 0x06, 0x85, 0x69, 0x73, 0x74, 0x65, 0x72, 0x00, 0x04,
+    0x0A, 0x83, 0x67, 0x73, 0x74, 0x65, 0x72, 0x00, 0x42, 0x45, 0x05, 0x53, 0x0D, 0x0C, 0x15, 0x17,
+    0x11, 0x12, 0x06, 0x01, 0x79, 0x12, 0x42, 0x46, 0x05, 0x50, 0x0D, 0x84, 0x6D, 0x70, 0x75, 0x74,
+    0x65, 0x72, 0x00, 0x06, 0x86, 0x6F, 0x6D, 0x70, 0x75, 0x74, 0x65, 0x72, 0x00, 0x17, 0x04, 0x10,
+    0x04, 0x82, 0x65, 0x75, 0x72, 0x00, 0x45, 0x48, 0x0B, 0x4C, 0x52, 0x52, 0x19, 0x58, 0x31, 0x5A,
+    0x49, 0x42, 0x48, 0x05, 0x58, 0x34, 0x15, 0x08, 0x0B, 0x1A, 0x83, 0x76, 0x65, 0x72, 0x00, 0x42,
+    0x46, 0x05, 0x56, 0x0F, 0x0C, 0x07, 0x84, 0x73, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x00, 0x0C, 0x07,
+    0x83, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x00, 0x42, 0x51, 0x05, 0x52, 0x0E, 0x04, 0x10, 0x83, 0x65,
+    0x75, 0x76, 0x65, 0x72, 0x00, 0x11, 0x04, 0x10, 0x84, 0x65, 0x75, 0x76, 0x65, 0x72, 0x00, 0x12,
+    0x0B, 0x82, 0x65, 0x76, 0x65, 0x72, 0x00, 0x08, 0x19, 0x15, 0x18, 0x16, 0x81, 0x6F, 0x72, 0x00,
+    0x08, 0x17, 0x12, 0x82, 0x68, 0x65, 0x72, 0x00, 0x42, 0x44, 0x05, 0x52, 0x26, 0x42, 0x49, 0x05,
+    0x53, 0x0C, 0x04, 0x82, 0x66, 0x61, 0x69, 0x72, 0x00, 0x42, 0x48, 0x05, 0x56, 0x0B, 0x15, 0x13,
+    0x81, 0x72, 0x65, 0x00, 0x0C, 0x07, 0x85, 0x65, 0x73, 0x70, 0x61, 0x69, 0x72, 0x00, 0x19, 0x08,
+    0x16, 0x08, 0x15, 0x83, 0x72, 0x76, 0x6F, 0x69, 0x72, 0x00, 0x04, 0x18, 0x06, 0x0C, 0x17, 0x15,
+    0x04, 0x13, 0x82, 0x6C, 0x61, 0x72, 0x00, 0x04, 0x08, 0x0F, 0x81, 0x72, 0x6E, 0x00, 0x49, 0x47,
+    0x13, 0x4B, 0x1B, 0x4C, 0x28, 0x4F, 0x33, 0x51, 0x41, 0x53, 0x77, 0x55, 0x7F, 0x56, 0x86, 0x57,
+    0xC2, 0x11, 0x08, 0x17, 0x11, 0x12, 0x02, 0x12, 0x01, 0x13, 0x04, 0x0B, 0x17, 0x08, 0x10, 0x85,
+    0x61, 0x70, 0x68, 0x6F, 0x72, 0x00, 0x11, 0x18, 0x0C, 0x85, 0x6A, 0x75, 0x6E, 0x69, 0x6F, 0x72,
+    0x00, 0x0F, 0x08, 0x06, 0x11, 0x18, 0x12, 0x06, 0x84, 0x69, 0x6C, 0x6C, 0x6F, 0x72, 0x00, 0x43,
+    0x44, 0x07, 0x48, 0x17, 0x4C, 0x2E, 0x08, 0x10, 0x04, 0x07, 0x16, 0x0C, 0x10, 0x86, 0x65, 0x6D,
+    0x65, 0x61, 0x6E, 0x6F, 0x72, 0x00, 0x10, 0x42, 0x44, 0x05, 0x48, 0x0F, 0x07, 0x85, 0x65, 0x6D,
+    0x65, 0x61, 0x6E, 0x6F, 0x72, 0x00, 0x07, 0x82, 0x61, 0x6E, 0x6F, 0x72, 0x00, 0x08, 0x16, 0x83,
+    0x6E, 0x69, 0x6F, 0x72, 0x00, 0x12, 0x0F, 0x08, 0x19, 0x08, 0x07, 0x01, 0xAE, 0x08, 0x06, 0x15,
+    0x12, 0x16, 0x01, 0xA7, 0x42, 0x48, 0x05, 0x56, 0x1C, 0x09, 0x42, 0x49, 0x05, 0x52, 0x0F, 0x12,
+    0x15, 0x13, 0x84, 0x65, 0x73, 0x73, 0x6F, 0x72, 0x00, 0x15, 0x13, 0x81, 0x73, 0x6F, 0x72, 0x00,
+    0x08, 0x42, 0x47, 0x05, 0x55, 0x14, 0x08, 0x06, 0x08, 0x15, 0x13, 0x87, 0x64, 0x65, 0x63, 0x65,
+    0x73, 0x73, 0x6F, 0x72, 0x00, 0x0A, 0x04, 0x85, 0x67, 0x72, 0x65, 0x73, 0x73, 0x6F, 0x72, 0x00,
+    0x43, 0x44, 0x07, 0x46, 0x64, 0x58, 0x6D, 0x44, 0x4C, 0x09, 0x51, 0x16, 0x55, 0x23, 0x57, 0x51,
+    0x15, 0x0C, 0x13, 0x16, 0x11, 0x12, 0x06, 0x84, 0x61, 0x74, 0x6F, 0x72, 0x00, 0x0C, 0x0F, 0x12,
+    0x13, 0x85, 0x6C, 0x69, 0x6E, 0x61, 0x74, 0x6F, 0x72, 0x00, 0x42, 0x48, 0x05, 0x57, 0x1E, 0x42,
+    0x51, 0x05, 0x53, 0x0F, 0x08, 0x13, 0x84, 0x74, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x00, 0x08, 0x16,
+    0x85, 0x61, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x00, 0x16, 0x11, 0x0C, 0x10, 0x07, 0x04, 0x86, 0x69,
+    0x73, 0x74, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x00, 0x0C, 0x10, 0x10, 0x0C, 0x86, 0x69, 0x74, 0x61,
+    0x74, 0x6F, 0x72, 0x00, 0x04, 0x15, 0x04, 0x0B, 0x06, 0x81, 0x65, 0x72, 0x00, 0x04, 0x81, 0x68,
+    0x6F, 0x72, 0x00, 0x18, 0x06, 0x12, 0x82, 0x63, 0x75, 0x72, 0x00, 0x42, 0x44, 0x05, 0x58, 0x0F,
+    0x42, 0x88, 0x07, 0x00, 0x9C, 0x17, 0x0E, 0x1C, 0x01, 0x04, 0x12, 0x0B, 0x81, 0x72, 0x73, 0x00,
+    0x16, 0x04, 0x0F, 0x02, 0x4B, 0x26, 0x42, 0x48, 0x05, 0x52, 0x15, 0x11, 0x08, 0x13, 0x08, 0x15,
+    0x17, 0x11, 0x08, 0x84, 0x72, 0x65, 0x6E, 0x65, 0x75, 0x72, 0x00, 0x45, 0x45, 0x0B, 0x46, 0x16,
+    0x47, 0x1C, 0x51, 0x29, 0x59, 0x32, 0x0A, 0x0C, 0x08, 0x11, 0x83, 0x68, 0x62, 0x6F, 0x75, 0x72,
+    0x00, 0x06, 0x12, 0x82, 0x75, 0x72, 0x00, 0x11, 0x08, 0x13, 0x16, 0x85, 0x6C, 0x65, 0x6E, 0x64,
+    0x6F, 0x75, 0x72, 0x00, 0x18, 0x12, 0x0B, 0x84, 0x6E, 0x6F, 0x75, 0x72, 0x00, 0x42, 0x44, 0x05,
+    0x48, 0x0D, 0x0B, 0x08, 0x05, 0x82, 0x69, 0x6F, 0x72, 0x00, 0x07, 0x11, 0x08, 0x83, 0x61, 0x76,
+    0x6F, 0x75, 0x72, 0x00, 0x43, 0x48, 0x07, 0x52, 0x0C, 0x57, 0x11, 0x19, 0x08, 0x02, 0x40, 0x3D,
+    0x17, 0x16, 0x02, 0x3B, 0x3D, 0x12, 0x16, 0x02, 0xFC, 0x38, 0x55, 0x84, 0x40, 0x00, 0x86, 0x94,
+    0x00, 0x87, 0x25, 0x01, 0x88, 0x7E, 0x01, 0x89, 0x60, 0x09, 0x8A, 0x6C, 0x09, 0x8B, 0x7A, 0x09,
+    0x8C, 0x96, 0x09, 0x8E, 0xED, 0x09, 0x8F, 0xF6, 0x09, 0x90, 0x56, 0x0A, 0x91, 0x8F, 0x0A, 0x92,
+    0xDA, 0x0C, 0x93, 0x42, 0x0D, 0x95, 0x59, 0x0D, 0x96, 0x6E, 0x0F, 0x97, 0x14, 0x11, 0x98, 0xC4,
+    0x12, 0x9A, 0xD7, 0x16, 0x9C, 0xE0, 0x16, 0x9D, 0x30, 0x17, 0x46, 0x46, 0x0D, 0x4B, 0x17, 0x4C,
+    0x21, 0x53, 0x2A, 0x55, 0x33, 0x5C, 0x4C, 0x0C, 0x17, 0x04, 0x10, 0x08, 0x0B, 0x17, 0x02, 0x4A,
+    0x06, 0x13, 0x15, 0x08, 0x13, 0x83, 0x68, 0x61, 0x70, 0x73, 0x00, 0x15, 0x08, 0x17, 0x0C, 0x15,
+    0x06, 0x02, 0x6D, 0x25, 0x0B, 0x15, 0x08, 0x13, 0x82, 0x61, 0x70, 0x73, 0x00, 0x42, 0x48, 0x05,
+    0x55, 0x12, 0x42, 0x8B, 0x07, 0x00, 0x9C, 0x77, 0x0D, 0x1A, 0x81, 0x65, 0x61, 0x73, 0x00, 0x04,
+    0x0B, 0x82, 0x61, 0x73, 0x73, 0x00, 0x1A, 0x0F, 0x04, 0x82, 0x61, 0x79, 0x73, 0x00, 0x43, 0x4C,
+    0x07, 0x51, 0x81, 0x58, 0x8A, 0x44, 0x4B, 0x09, 0x50, 0x20, 0x51, 0x35, 0x57, 0x43, 0x13, 0x1C,
+    0x0F, 0x0A, 0x12, 0x15, 0x0C, 0x08, 0x0B, 0x8B, 0x69, 0x65, 0x72, 0x6F, 0x67, 0x6C, 0x79, 0x70,
+    0x68, 0x69, 0x63, 0x73, 0x00, 0x04, 0x11, 0x1C, 0x07, 0x12, 0x08, 0x15, 0x04, 0x8A, 0x65, 0x72,
+    0x6F, 0x64, 0x79, 0x6E, 0x61, 0x6D, 0x69, 0x63, 0x73, 0x00, 0x04, 0x0B, 0x06, 0x10, 0x86, 0x65,
+    0x63, 0x68, 0x61, 0x6E, 0x69, 0x63, 0x73, 0x00, 0x43, 0x44, 0x07, 0x48, 0x16, 0x56, 0x25, 0x10,
+    0x04, 0x0B, 0x17, 0x04, 0x10, 0x86, 0x65, 0x6D, 0x61, 0x74, 0x69, 0x63, 0x73, 0x00, 0x0A, 0x08,
+    0x0F, 0x12, 0x13, 0x04, 0x86, 0x6F, 0x67, 0x65, 0x74, 0x69, 0x63, 0x73, 0x00, 0x0C, 0x15, 0x04,
+    0x0B, 0x06, 0x85, 0x61, 0x63, 0x74, 0x65, 0x72, 0x69, 0x73, 0x74, 0x69, 0x63, 0x73, 0x00, 0x08,
+    0x15, 0x08, 0x09, 0x08, 0x15, 0x02, 0x1C, 0x0C, 0x12, 0x09, 0x82, 0x63, 0x75, 0x73, 0x00, 0x46,
+    0x44, 0x0D, 0x48, 0x1A, 0x4C, 0x23, 0x51, 0x29, 0x52, 0x44, 0x55, 0x4F, 0x12, 0x0F, 0x1A, 0x12,
+    0x07, 0x84, 0x6E, 0x6C, 0x6F, 0x61, 0x64, 0x73, 0x00, 0x06, 0x06, 0x18, 0x16, 0x81, 0x65, 0x64,
+    0x73, 0x00, 0x09, 0x11, 0x12, 0x02, 0x47, 0x08, 0x42, 0x44, 0x05, 0x48, 0x10, 0x07, 0x11, 0x08,
+    0x06, 0x16, 0x08, 0x07, 0x81, 0x74, 0x73, 0x00, 0x15, 0x0C, 0x09, 0x85, 0x72, 0x69, 0x65, 0x6E,
+    0x64, 0x73, 0x00, 0x0C, 0x15, 0x08, 0x17, 0x16, 0x83, 0x6F, 0x69, 0x64, 0x73, 0x00, 0x12, 0x1A,
+    0x12, 0x17, 0x83, 0x61, 0x72, 0x64, 0x73, 0x00, 0x55, 0x84, 0x40, 0x00, 0x85, 0x56, 0x00, 0x86,
+    0x6F, 0x00, 0x87, 0x91, 0x00, 0x88, 0xB4, 0x00, 0x89, 0xBE, 0x00, 0x8A, 0xCF, 0x00, 0x8B, 0xE6,
+    0x00, 0x8C, 0x10, 0x01, 0x8E, 0x1F, 0x05, 0x8F, 0x25, 0x05, 0x90, 0xA8, 0x05, 0x91, 0xD3, 0x05,
+    0x92, 0x29, 0x06, 0x93, 0x3E, 0x06, 0x95, 0x4E, 0x06, 0x96, 0x8F, 0x06, 0x97, 0xEC, 0x06, 0x98,
+    0x8D, 0x07, 0x99, 0xAC, 0x07, 0x9D, 0xDA, 0x07, 0x42, 0x47, 0x05, 0x4E, 0x0B, 0x0C, 0x82, 0x65,
+    0x61, 0x73, 0x00, 0x42, 0x50, 0x05, 0x57, 0x05, 0x83, 0x61, 0x6B, 0x65, 0x73, 0x00, 0x42, 0x4C,
+    0x05, 0x50, 0x10, 0x0C, 0x15, 0x06, 0x16, 0x08, 0x07, 0x83, 0x62, 0x65, 0x73, 0x00, 0x08, 0x16,
+    0x08, 0x15, 0x81, 0x6C, 0x65, 0x73, 0x00, 0x42, 0x48, 0x05, 0x51, 0x14, 0x16, 0x08, 0x18, 0x14,
+    0x08, 0x16, 0x11, 0x12, 0x06, 0x84, 0x6E, 0x63, 0x65, 0x73, 0x00, 0x04, 0x17, 0x05, 0x18, 0x16,
+    0x85, 0x73, 0x74, 0x61, 0x6E, 0x63, 0x65, 0x73, 0x00, 0x43, 0x52, 0x07, 0x55, 0x13, 0x58, 0x18,
+    0x16, 0x07, 0x0C, 0x13, 0x08, 0x85, 0x73, 0x6F, 0x64, 0x65, 0x73, 0x00, 0x04, 0x0A, 0x02, 0x21,
+    0x0D, 0x0F, 0x1B, 0x08, 0x84, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x73, 0x00, 0x0F, 0x11, 0x0C, 0x04,
+    0x17, 0x16, 0x81, 0x73, 0x73, 0x00, 0x0C, 0x42, 0x51, 0x05, 0x5A, 0x08, 0x0E, 0x01, 0x05, 0x07,
+    0x0C, 0x10, 0x82, 0x76, 0x65, 0x73, 0x00, 0x42, 0x47, 0x05, 0x48, 0x08, 0x08, 0x01, 0x03, 0x0F,
+    0x0F, 0x08, 0x19, 0x0C, 0x15, 0x13, 0x86, 0x69, 0x6C, 0x65, 0x67, 0x65, 0x73, 0x00, 0x43, 0x46,
+    0x07, 0x56, 0x13, 0x57, 0x21, 0x08, 0x13, 0x13, 0x16, 0x85, 0x65, 0x65, 0x63, 0x68, 0x65, 0x73,
+    0x00, 0x0C, 0x05, 0x04, 0x17, 0x16, 0x08, 0x84, 0x6C, 0x69, 0x73, 0x68, 0x65, 0x73, 0x00, 0x0C,
+    0x0F, 0x12, 0x07, 0x11, 0x08, 0x02, 0x23, 0x10, 0x4B, 0x86, 0x22, 0x00, 0x89, 0x7E, 0x00, 0x8A,
+    0x89, 0x00, 0x8B, 0xDB, 0x00, 0x8F, 0xFB, 0x00, 0x91, 0x17, 0x01, 0x95, 0x59, 0x01, 0x96, 0x73,
+    0x02, 0x97, 0x7C, 0x02, 0x98, 0xF7, 0x03, 0x9B, 0x03, 0x04, 0x43, 0x44, 0x07, 0x48, 0x12, 0x51,
+    0x1F, 0x07, 0x11, 0x18, 0x05, 0x04, 0x83, 0x6E, 0x63, 0x65, 0x73, 0x00, 0x13, 0x05, 0x18, 0x16,
+    0x85, 0x73, 0x70, 0x65, 0x63, 0x69, 0x65, 0x73, 0x00, 0x42, 0x44, 0x05, 0x48, 0x2A, 0x42, 0x47,
+    0x05, 0x4A, 0x19, 0x11, 0x42, 0x48, 0x05, 0x58, 0x0E, 0x17, 0x85, 0x65, 0x6E, 0x63, 0x69, 0x65,
+    0x73, 0x00, 0x05, 0x04, 0x02, 0x35, 0x14, 0x08, 0x15, 0x13, 0x85, 0x6E, 0x61, 0x6E, 0x63, 0x69,
+    0x65, 0x73, 0x00, 0x18, 0x17, 0x0C, 0x16, 0x11, 0x12, 0x06, 0x88, 0x74, 0x69, 0x74, 0x75, 0x65,
+    0x6E, 0x63, 0x69, 0x65, 0x73, 0x00, 0x11, 0x0A, 0x0C, 0x16, 0x83, 0x69, 0x66, 0x69, 0x65, 0x73,
+    0x00, 0x42, 0x48, 0x05, 0x52, 0x24, 0x42, 0x47, 0x05, 0x57, 0x11, 0x04, 0x15, 0x17, 0x16, 0x85,
+    0x74, 0x65, 0x67, 0x69, 0x65, 0x73, 0x00, 0x15, 0x04, 0x17, 0x16, 0x87, 0x72, 0x61, 0x74, 0x65,
+    0x67, 0x69, 0x65, 0x73, 0x00, 0x0F, 0x42, 0x44, 0x05, 0x52, 0x11, 0x08, 0x07, 0x0C, 0x86, 0x6F,
+    0x6C, 0x6F, 0x67, 0x69, 0x65, 0x73, 0x00, 0x42, 0x48, 0x05, 0x53, 0x11, 0x11, 0x08, 0x0A, 0x86,
+    0x61, 0x6C, 0x6F, 0x67, 0x69, 0x65, 0x73, 0x00, 0x13, 0x04, 0x87, 0x6F, 0x6C, 0x6F, 0x67, 0x69,
+    0x65, 0x73, 0x00, 0x42, 0x46, 0x05, 0x53, 0x12, 0x04, 0x15, 0x08, 0x0C, 0x0B, 0x84, 0x72, 0x63,
+    0x68, 0x69, 0x65, 0x73, 0x00, 0x16, 0x12, 0x0F, 0x0C, 0x0B, 0x13, 0x84, 0x6F, 0x70, 0x68, 0x69,
+    0x65, 0x73, 0x00, 0x42, 0x4C, 0x05, 0x52, 0x11, 0x10, 0x0C, 0x09, 0x86, 0x61, 0x6D, 0x69, 0x6C,
+    0x69, 0x65, 0x73, 0x00, 0x10, 0x12, 0x11, 0x04, 0x84, 0x61, 0x6C, 0x69, 0x65, 0x73, 0x00, 0x43,
+    0x44, 0x07, 0x52, 0x1E, 0x55, 0x3A, 0x15, 0x42, 0x55, 0x05, 0x5C, 0x0F, 0x1C, 0x17, 0x85, 0x61,
+    0x6E, 0x6E, 0x69, 0x65, 0x73, 0x00, 0x17, 0x82, 0x6E, 0x69, 0x65, 0x73, 0x00, 0x42, 0x4F, 0x05,
+    0x50, 0x0F, 0x0F, 0x12, 0x06, 0x85, 0x6F, 0x6E, 0x69, 0x65, 0x73, 0x00, 0x0C, 0x15, 0x08, 0x06,
+    0x86, 0x65, 0x6D, 0x6F, 0x6E, 0x69, 0x65, 0x73, 0x00, 0x18, 0x12, 0x0D, 0x82, 0x65, 0x79, 0x73,
+    0x00, 0x46, 0x44, 0x0D, 0x48, 0x99, 0x51, 0xA6, 0x52, 0xB0, 0x55, 0xEB, 0x57, 0xFB, 0x47, 0x47,
+    0x0F, 0x4C, 0x19, 0x4F, 0x27, 0x55, 0x34, 0x56, 0x48, 0x57, 0x56, 0x58, 0x73, 0x11, 0x18, 0x12,
+    0x09, 0x84, 0x72, 0x69, 0x65, 0x73, 0x00, 0x0F, 0x0F, 0x0C, 0x1B, 0x18, 0x04, 0x86, 0x69, 0x61,
+    0x72, 0x69, 0x65, 0x73, 0x00, 0x0F, 0x0C, 0x1B, 0x18, 0x04, 0x85, 0x69, 0x61, 0x72, 0x69, 0x65,
+    0x73, 0x00, 0x12, 0x13, 0x10, 0x04, 0x17, 0x11, 0x12, 0x06, 0x89, 0x65, 0x6D, 0x70, 0x6F, 0x72,
+    0x61, 0x72, 0x69, 0x65, 0x73, 0x00, 0x0C, 0x10, 0x10, 0x08, 0x87, 0x69, 0x73, 0x73, 0x61, 0x72,
+    0x69, 0x65, 0x73, 0x00, 0x42, 0x48, 0x05, 0x56, 0x0F, 0x10, 0x08, 0x06, 0x84, 0x65, 0x72, 0x69,
+    0x65, 0x73, 0x00, 0x08, 0x11, 0x12, 0x10, 0x87, 0x61, 0x73, 0x74, 0x65, 0x72, 0x69, 0x65, 0x73,
+    0x00, 0x42, 0x4A, 0x05, 0x54, 0x0E, 0x04, 0x19, 0x85, 0x61, 0x72, 0x69, 0x65, 0x73, 0x00, 0x0C,
+    0x17, 0x11, 0x04, 0x84, 0x69, 0x74, 0x69, 0x65, 0x73, 0x00, 0x19, 0x12, 0x15, 0x17, 0x11, 0x12,
+    0x06, 0x82, 0x73, 0x69, 0x65, 0x73, 0x00, 0x18, 0x12, 0x06, 0x83, 0x74, 0x72, 0x69, 0x65, 0x73,
+    0x00, 0x43, 0x4A, 0x07, 0x4C, 0x14, 0x57, 0x20, 0x04, 0x17, 0x04, 0x06, 0x86, 0x65, 0x67, 0x6F,
+    0x72, 0x69, 0x65, 0x73, 0x00, 0x15, 0x15, 0x08, 0x17, 0x84, 0x74, 0x6F, 0x72, 0x69, 0x65, 0x73,
+    0x00, 0x0C, 0x42, 0x51, 0x05, 0x59, 0x11, 0x0A, 0x0C, 0x16, 0x86, 0x61, 0x74, 0x6F, 0x72, 0x69,
+    0x65, 0x73, 0x00, 0x85, 0x63, 0x74, 0x6F, 0x72, 0x69, 0x65, 0x73, 0x00, 0x04, 0x16, 0x0C, 0x10,
+    0x10, 0x08, 0x88, 0x69, 0x73, 0x73, 0x61, 0x72, 0x69, 0x65, 0x73, 0x00, 0x42, 0x51, 0x05, 0x56,
+    0x13, 0x18, 0x06, 0x12, 0x88, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x72, 0x69, 0x65, 0x73, 0x00, 0x11,
+    0x0C, 0x10, 0x85, 0x69, 0x73, 0x74, 0x72, 0x69, 0x65, 0x73, 0x00, 0x18, 0x15, 0x06, 0x83, 0x69,
+    0x73, 0x65, 0x73, 0x00, 0x48, 0x84, 0x19, 0x00, 0x88, 0x26, 0x00, 0x8C, 0x3E, 0x00, 0x8F, 0x35,
+    0x01, 0x91, 0x53, 0x01, 0x95, 0x5C, 0x01, 0x96, 0x66, 0x01, 0x98, 0x75, 0x01, 0x0F, 0x18, 0x16,
+    0x04, 0x06, 0x85, 0x61, 0x6C, 0x74, 0x69, 0x65, 0x73, 0x00, 0x0C, 0x42, 0x44, 0x05, 0x47, 0x0F,
+    0x19, 0x85, 0x72, 0x69, 0x65, 0x74, 0x69, 0x65, 0x73, 0x00, 0x85, 0x65, 0x69, 0x74, 0x69, 0x65,
+    0x73, 0x00, 0x44, 0x46, 0x09, 0x4F, 0x1E, 0x55, 0xC0, 0x56, 0xD6, 0x12, 0x42, 0x95, 0x07, 0x00,
+    0x96, 0x0D, 0x01, 0x17, 0x17, 0x04, 0x88, 0x72, 0x6F, 0x63, 0x69, 0x74, 0x69, 0x65, 0x73, 0x00,
+    0x43, 0x44, 0x07, 0x45, 0x3F, 0x4C, 0x70, 0x43, 0x53, 0x07, 0x56, 0x19, 0x58, 0x26, 0x0C, 0x06,
+    0x11, 0x18, 0x10, 0x89, 0x69, 0x63, 0x69, 0x70, 0x61, 0x6C, 0x69, 0x74, 0x69, 0x65, 0x73, 0x00,
+    0x18, 0x04, 0x06, 0x88, 0x73, 0x75, 0x61, 0x6C, 0x74, 0x69, 0x65, 0x73, 0x00, 0x14, 0x08, 0x11,
+    0x18, 0x8B, 0x69, 0x6E, 0x65, 0x71, 0x75, 0x61, 0x6C, 0x69, 0x74, 0x69, 0x65, 0x73, 0x00, 0x42,
+    0x44, 0x05, 0x4C, 0x0E, 0x17, 0x04, 0x13, 0x10, 0x12, 0x06, 0x02, 0x2E, 0x03, 0x42, 0x56, 0x05,
+    0x57, 0x15, 0x42, 0x51, 0x05, 0x56, 0x0C, 0x12, 0x13, 0x16, 0x08, 0x15, 0x01, 0x0B, 0x12, 0x13,
+    0x01, 0x07, 0x04, 0x13, 0x10, 0x12, 0x06, 0x85, 0x69, 0x6C, 0x69, 0x74, 0x69, 0x65, 0x73, 0x00,
+    0x05, 0x42, 0x44, 0x05, 0x4C, 0x1F, 0x42, 0x56, 0x05, 0x57, 0x0A, 0x16, 0x12, 0x13, 0x01, 0x07,
+    0x04, 0x13, 0x10, 0x12, 0x06, 0x88, 0x69, 0x62, 0x69, 0x6C, 0x69, 0x74, 0x69, 0x65, 0x73, 0x00,
+    0x11, 0x12, 0x13, 0x16, 0x08, 0x15, 0x88, 0x73, 0x69, 0x62, 0x69, 0x6C, 0x69, 0x74, 0x69, 0x65,
+    0x73, 0x00, 0x42, 0x44, 0x05, 0x52, 0x08, 0x19, 0x01, 0x51, 0x15, 0x0B, 0x17, 0x18, 0x04, 0x87,
+    0x6F, 0x72, 0x69, 0x74, 0x69, 0x65, 0x73, 0x00, 0x42, 0x48, 0x05, 0x56, 0x12, 0x19, 0x0C, 0x11,
+    0x18, 0x85, 0x72, 0x73, 0x69, 0x74, 0x69, 0x65, 0x73, 0x00, 0x08, 0x06, 0x06, 0x08, 0x11, 0x88,
+    0x65, 0x73, 0x73, 0x69, 0x74, 0x69, 0x65, 0x73, 0x00, 0x42, 0x4C, 0x05, 0x58, 0x0E, 0x05, 0x04,
+    0x83, 0x69, 0x74, 0x69, 0x65, 0x73, 0x00, 0x06, 0x0C, 0x09, 0x0C, 0x07, 0x87, 0x66, 0x69, 0x63,
+    0x75, 0x6C, 0x74, 0x69, 0x65, 0x73, 0x00, 0x0C, 0x11, 0x83, 0x65, 0x74, 0x69, 0x65, 0x73, 0x00,
+    0x18, 0x12, 0x09, 0x85, 0x72, 0x74, 0x69, 0x65, 0x73, 0x00, 0x0C, 0x15, 0x08, 0x19, 0x0C, 0x11,
+    0x18, 0x85, 0x73, 0x69, 0x74, 0x69, 0x65, 0x73, 0x00, 0x17, 0x11, 0x08, 0x02, 0x68, 0x01, 0x15,
+    0x17, 0x11, 0x08, 0x06, 0x84, 0x75, 0x72, 0x69, 0x65, 0x73, 0x00, 0x04, 0x0F, 0x0F, 0x04, 0x0A,
+    0x85, 0x61, 0x78, 0x69, 0x65, 0x73, 0x00, 0x15, 0x04, 0x10, 0x02, 0x0E, 0x0C, 0x47, 0x45, 0x0F,
+    0x46, 0x2D, 0x47, 0x39, 0x4A, 0x42, 0x4C, 0x52, 0x4F, 0x67, 0x53, 0x77, 0x42, 0x44, 0x05, 0x58,
+    0x13, 0x17, 0x15, 0x08, 0x19, 0x11, 0x12, 0x06, 0x84, 0x69, 0x62, 0x6C, 0x65, 0x73, 0x00, 0x12,
+    0x17, 0x85, 0x72, 0x6F, 0x75, 0x62, 0x6C, 0x65, 0x73, 0x00, 0x11, 0x04, 0x17, 0x16, 0x05, 0x12,
+    0x84, 0x63, 0x6C, 0x65, 0x73, 0x00, 0x0C, 0x15, 0x0A, 0x82, 0x64, 0x6C, 0x65, 0x73, 0x00, 0x11,
+    0x0C, 0x16, 0x17, 0x0C, 0x0B, 0x86, 0x20, 0x73, 0x69, 0x6E, 0x67, 0x6C, 0x65, 0x73, 0x00, 0x42,
+    0x87, 0x07, 0x00, 0x90, 0xFE, 0x01, 0x12, 0x0E, 0x06, 0x12, 0x15, 0x06, 0x86, 0x6F, 0x64, 0x69,
+    0x6C, 0x65, 0x73, 0x00, 0x08, 0x11, 0x08, 0x07, 0x15, 0x04, 0x07, 0x86, 0x61, 0x6E, 0x65, 0x6C,
+    0x6C, 0x65, 0x73, 0x00, 0x12, 0x08, 0x12, 0x13, 0x86, 0x65, 0x6F, 0x70, 0x6C, 0x65, 0x73, 0x00,
+    0x43, 0x44, 0x07, 0x4C, 0x10, 0x55, 0x23, 0x06, 0x08, 0x05, 0x83, 0x6F, 0x6D, 0x65, 0x73, 0x00,
+    0x42, 0x44, 0x05, 0x57, 0x08, 0x0F, 0x01, 0x75, 0x10, 0x12, 0x16, 0x84, 0x65, 0x74, 0x69, 0x6D,
+    0x65, 0x73, 0x00, 0x12, 0x09, 0x15, 0x08, 0x13, 0x02, 0x60, 0x0B, 0x43, 0x44, 0x07, 0x4C, 0x0D,
+    0x58, 0x46, 0x0A, 0x82, 0x6D, 0x65, 0x73, 0x00, 0x45, 0x44, 0x0B, 0x51, 0x0F, 0x55, 0x19, 0x57,
+    0x24, 0x59, 0x2E, 0x17, 0x11, 0x01, 0x45, 0x08, 0x13, 0x04, 0x83, 0x6E, 0x69, 0x6E, 0x65, 0x73,
+    0x00, 0x06, 0x12, 0x07, 0x84, 0x74, 0x72, 0x69, 0x6E, 0x65, 0x73, 0x00, 0x06, 0x12, 0x07, 0x83,
+    0x72, 0x69, 0x6E, 0x65, 0x73, 0x00, 0x15, 0x08, 0x17, 0x11, 0x0C, 0x83, 0x65, 0x6E, 0x65, 0x73,
+    0x00, 0x17, 0x15, 0x18, 0x12, 0x09, 0x16, 0x0C, 0x10, 0x86, 0x72, 0x74, 0x75, 0x6E, 0x65, 0x73,
+    0x00, 0x42, 0x47, 0x05, 0x52, 0x0E, 0x11, 0x04, 0x10, 0x10, 0x12, 0x06, 0x02, 0xFC, 0x0A, 0x17,
+    0x17, 0x04, 0x17, 0x02, 0xF5, 0x0A, 0x1C, 0x17, 0x12, 0x15, 0x08, 0x17, 0x16, 0x85, 0x65, 0x6F,
+    0x74, 0x79, 0x70, 0x65, 0x73, 0x00, 0x44, 0x47, 0x09, 0x48, 0x11, 0x4C, 0x1A, 0x58, 0x25, 0x04,
+    0x82, 0x64, 0x72, 0x65, 0x73, 0x73, 0x00, 0x07, 0x0C, 0x16, 0x11, 0x12, 0x06, 0x02, 0xA6, 0x37,
+    0x17, 0x11, 0x18, 0x12, 0x06, 0x83, 0x72, 0x69, 0x65, 0x73, 0x00, 0x42, 0x4A, 0x05, 0x57, 0x0F,
+    0x18, 0x04, 0x11, 0x0C, 0x81, 0x61, 0x74, 0x65, 0x73, 0x00, 0x13, 0x18, 0x06, 0x16, 0x85, 0x6C,
+    0x70, 0x74, 0x75, 0x72, 0x65, 0x73, 0x00, 0x44, 0x44, 0x09, 0x48, 0x1B, 0x56, 0x24, 0x58, 0x31,
+    0x42, 0x4F, 0x05, 0x55, 0x0B, 0x0A, 0x11, 0x18, 0x16, 0x01, 0x04, 0x04, 0x0B, 0x81, 0x73, 0x65,
+    0x73, 0x00, 0x0F, 0x08, 0x15, 0x82, 0x61, 0x73, 0x65, 0x73, 0x00, 0x08, 0x06, 0x06, 0x06, 0x18,
+    0x16, 0x85, 0x65, 0x73, 0x73, 0x65, 0x73, 0x00, 0x43, 0x46, 0x07, 0x4A, 0x11, 0x52, 0x17, 0x04,
+    0x06, 0x84, 0x75, 0x63, 0x75, 0x73, 0x65, 0x73, 0x00, 0x11, 0x18, 0x09, 0x83, 0x69, 0x00, 0x0B,
+    0x15, 0x08, 0x17, 0x0A, 0x18, 0x04, 0x0F, 0x16, 0x88, 0x68, 0x74, 0x65, 0x72, 0x68, 0x6F, 0x75,
+    0x73, 0x65, 0x73, 0x00, 0x42, 0x44, 0x05, 0x4C, 0x5C, 0x43, 0x4A, 0x07, 0x55, 0x13, 0x59, 0x48,
+    0x04, 0x0F, 0x08, 0x07, 0x85, 0x65, 0x67, 0x61, 0x74, 0x65, 0x73, 0x00, 0x43, 0x45, 0x07, 0x52,
+    0x17, 0x53, 0x28, 0x0C, 0x17, 0x15, 0x08, 0x19, 0x11, 0x0C, 0x86, 0x65, 0x62, 0x72, 0x61, 0x74,
+    0x65, 0x73, 0x00, 0x10, 0x10, 0x08, 0x10, 0x12, 0x06, 0x88, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x61,
+    0x74, 0x65, 0x73, 0x00, 0x15, 0x12, 0x06, 0x11, 0x0C, 0x84, 0x6F, 0x72, 0x61, 0x74, 0x65, 0x73,
+    0x00, 0x04, 0x15, 0x04, 0x0A, 0x0A, 0x04, 0x87, 0x72, 0x61, 0x76, 0x61, 0x74, 0x65, 0x73, 0x00,
+    0x44, 0x4F, 0x09, 0x51, 0x32, 0x55, 0x38, 0x59, 0x3E, 0x0C, 0x42, 0x45, 0x05, 0x46, 0x23, 0x42,
+    0x44, 0x05, 0x4C, 0x14, 0x16, 0x16, 0x12, 0x13, 0x87, 0x69, 0x62, 0x69, 0x6C, 0x69, 0x74, 0x69,
+    0x65, 0x73, 0x00, 0x16, 0x11, 0x12, 0x13, 0x16, 0x08, 0x15, 0x02, 0x3B, 0x0E, 0x04, 0x09, 0x02,
+    0x36, 0x0E, 0x18, 0x10, 0x10, 0x02, 0x0C, 0x0E, 0x12, 0x0B, 0x17, 0x18, 0x01, 0x05, 0x0C, 0x17,
+    0x06, 0x04, 0x02, 0x23, 0x0E, 0x42, 0x4F, 0x05, 0x54, 0x10, 0x06, 0x08, 0x0F, 0x12, 0x10, 0x83,
+    0x75, 0x6C, 0x65, 0x73, 0x00, 0x0C, 0x11, 0x0C, 0x0B, 0x06, 0x08, 0x17, 0x86, 0x6E, 0x69, 0x71,
+    0x75, 0x65, 0x73, 0x00, 0x42, 0x4C, 0x05, 0x4F, 0x22, 0x42, 0x48, 0x05, 0x57, 0x0E, 0x0B, 0x17,
+    0x84, 0x69, 0x65, 0x76, 0x65, 0x73, 0x00, 0x0C, 0x11, 0x15, 0x08, 0x17, 0x0F, 0x04, 0x85, 0x61,
+    0x74, 0x69, 0x76, 0x65, 0x73, 0x00, 0x16, 0x10, 0x08, 0x0B, 0x17, 0x83, 0x65, 0x6C, 0x76, 0x65,
+    0x73, 0x00, 0x0C, 0x18, 0x14, 0x81, 0x7A, 0x65, 0x73, 0x00, 0x0F, 0x08, 0x16, 0x10, 0x08, 0x0B,
+    0x17, 0x81, 0x76, 0x65, 0x73, 0x00, 0x11, 0x0C, 0x08, 0x15, 0x08, 0x09, 0x09, 0x12, 0x84, 0x69,
+    0x6E, 0x67, 0x73, 0x00, 0x06, 0x43, 0x44, 0x07, 0x51, 0x0F, 0x55, 0x15, 0x12, 0x15, 0x13, 0x13,
+    0x04, 0x02, 0xB0, 0x03, 0x18, 0x04, 0x0F, 0x02, 0xAA, 0x03, 0x18, 0x0B, 0x06, 0x02, 0xA4, 0x03,
+    0x44, 0x48, 0x09, 0x4F, 0x12, 0x51, 0x1E, 0x56, 0x27, 0x15, 0x12, 0x17, 0x16, 0x82, 0x69, 0x65,
+    0x73, 0x00, 0x0F, 0x1C, 0x0B, 0x13, 0x1C, 0x16, 0x84, 0x69, 0x6C, 0x69, 0x73, 0x00, 0x08, 0x12,
+    0x13, 0x84, 0x65, 0x6E, 0x69, 0x73, 0x00, 0x43, 0x48, 0x07, 0x4B, 0x18, 0x5C, 0x21, 0x0B, 0x17,
+    0x11, 0x04, 0x15, 0x04, 0x13, 0x87, 0x65, 0x6E, 0x74, 0x68, 0x65, 0x73, 0x69, 0x73, 0x00, 0x13,
+    0x10, 0x08, 0x82, 0x61, 0x73, 0x69, 0x73, 0x00, 0x0B, 0x13, 0x15, 0x12, 0x10, 0x04, 0x17, 0x08,
+    0x10, 0x83, 0x6F, 0x73, 0x69, 0x73, 0x00, 0x08, 0x08, 0x11, 0x16, 0x82, 0x61, 0x6B, 0x73, 0x00,
+    0x45, 0x44, 0x0B, 0x48, 0x30, 0x4F, 0x4A, 0x55, 0x53, 0x58, 0x58, 0x18, 0x42, 0x47, 0x05, 0x5B,
+    0x14, 0x0C, 0x19, 0x07, 0x11, 0x0C, 0x86, 0x69, 0x76, 0x69, 0x64, 0x75, 0x61, 0x6C, 0x73, 0x00,
+    0x16, 0x08, 0x16, 0x11, 0x04, 0x15, 0x17, 0x86, 0x73, 0x65, 0x78, 0x75, 0x61, 0x6C, 0x73, 0x00,
+    0x42, 0x46, 0x05, 0x4F, 0x0D, 0x16, 0x18, 0x10, 0x82, 0x6C, 0x65, 0x73, 0x00, 0x0F, 0x08, 0x15,
+    0x04, 0x13, 0x85, 0x61, 0x6C, 0x6C, 0x65, 0x6C, 0x73, 0x00, 0x18, 0x09, 0x11, 0x12, 0x12, 0x13,
+    0x02, 0x05, 0x05, 0x12, 0x1A, 0x02, 0x3E, 0x35, 0x06, 0x0F, 0x04, 0x06, 0x80, 0x75, 0x73, 0x00,
+    0x43, 0x52, 0x07, 0x57, 0x1F, 0x5C, 0x2D, 0x42, 0x48, 0x05, 0x57, 0x0C, 0x13, 0x83, 0x6F, 0x65,
+    0x6D, 0x73, 0x00, 0x10, 0x13, 0x1C, 0x16, 0x85, 0x6D, 0x70, 0x74, 0x6F, 0x6D, 0x73, 0x00, 0x0C,
+    0x0B, 0x15, 0x12, 0x0A, 0x0F, 0x04, 0x84, 0x69, 0x74, 0x68, 0x6D, 0x73, 0x00, 0x0B, 0x17, 0x1C,
+    0x15, 0x85, 0x68, 0x79, 0x74, 0x68, 0x6D, 0x73, 0x00, 0x45, 0x44, 0x0B, 0x48, 0x5F, 0x4C, 0x64,
+    0x50, 0x90, 0x52, 0x98, 0x43, 0x4C, 0x07, 0x56, 0x3C, 0x57, 0x4A, 0x42, 0x46, 0x05, 0x55, 0x25,
+    0x0C, 0x42, 0x55, 0x05, 0x57, 0x0F, 0x12, 0x17, 0x16, 0x0C, 0x0B, 0x84, 0x61, 0x6E, 0x73, 0x00,
+    0x08, 0x0B, 0x17, 0x04, 0x10, 0x86, 0x6D, 0x61, 0x74, 0x69, 0x63, 0x69, 0x61, 0x6E, 0x73, 0x00,
+    0x12, 0x17, 0x0C, 0x16, 0x0B, 0x88, 0x69, 0x73, 0x74, 0x6F, 0x72, 0x69, 0x61, 0x6E, 0x73, 0x00,
+    0x16, 0x04, 0x16, 0x16, 0x16, 0x04, 0x86, 0x61, 0x73, 0x73, 0x69, 0x6E, 0x73, 0x00, 0x0C, 0x05,
+    0x04, 0x0B, 0x11, 0x0C, 0x80, 0x74, 0x73, 0x00, 0x12, 0x07, 0x02, 0xBE, 0x07, 0x42, 0x44, 0x05,
+    0x57, 0x20, 0x17, 0x11, 0x42, 0x52, 0x05, 0x58, 0x0F, 0x10, 0x85, 0x75, 0x6E, 0x74, 0x61, 0x69,
+    0x6E, 0x73, 0x00, 0x12, 0x06, 0x86, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x73, 0x00, 0x04, 0x11, 0x0C,
+    0x05, 0x10, 0x12, 0x06, 0x81, 0x6F, 0x6E, 0x73, 0x00, 0x1C, 0x11, 0x12, 0x11, 0x1C, 0x02, 0x27,
+    0x04, 0x43, 0x8C, 0x0A, 0x00, 0x90, 0xA0, 0x01, 0x97, 0xA5, 0x01, 0x43, 0x4F, 0x07, 0x51, 0x14,
+    0x57, 0x1F, 0x0F, 0x05, 0x08, 0x15, 0x85, 0x65, 0x6C, 0x6C, 0x69, 0x6F, 0x6E, 0x73, 0x00, 0x08,
+    0x10, 0x0C, 0x07, 0x83, 0x73, 0x69, 0x6F, 0x6E, 0x73, 0x00, 0x45, 0x84, 0x10, 0x00, 0x8C, 0x1F,
+    0x01, 0x8F, 0x3F, 0x01, 0x92, 0x4B, 0x01, 0x98, 0x57, 0x01, 0x48, 0x46, 0x11, 0x47, 0x37, 0x4C,
+    0x48, 0x4F, 0x59, 0x51, 0x86, 0x55, 0xA7, 0x57, 0xD8, 0x5D, 0xFE, 0x0C, 0x42, 0x51, 0x05, 0x58,
+    0x16, 0x0C, 0x18, 0x10, 0x10, 0x12, 0x06, 0x89, 0x6E, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E,
+    0x73, 0x00, 0x10, 0x10, 0x12, 0x06, 0x87, 0x6E, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73,
+    0x00, 0x08, 0x10, 0x10, 0x12, 0x06, 0x08, 0x15, 0x86, 0x6E, 0x64, 0x61, 0x74, 0x69, 0x6F, 0x6E,
+    0x73, 0x00, 0x17, 0x04, 0x0C, 0x17, 0x11, 0x08, 0x15, 0x08, 0x09, 0x09, 0x0C, 0x07, 0x85, 0x6F,
+    0x6E, 0x73, 0x00, 0x42, 0x44, 0x05, 0x58, 0x0B, 0x0A, 0x82, 0x61, 0x6E, 0x73, 0x00, 0x42, 0x47,
+    0x05, 0x52, 0x16, 0x04, 0x15, 0x0A, 0x11, 0x12, 0x06, 0x88, 0x74, 0x75, 0x6C, 0x61, 0x74, 0x69,
+    0x6F, 0x6E, 0x73, 0x00, 0x13, 0x87, 0x70, 0x75, 0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x00,
+    0x42, 0x44, 0x05, 0x4C, 0x13, 0x05, 0x10, 0x12, 0x06, 0x87, 0x69, 0x6E, 0x61, 0x74, 0x69, 0x6F,
+    0x6E, 0x73, 0x00, 0x16, 0x08, 0x07, 0x87, 0x74, 0x69, 0x6E, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73,
+    0x00, 0x43, 0x44, 0x07, 0x48, 0x11, 0x52, 0x1F, 0x19, 0x85, 0x69, 0x61, 0x74, 0x69, 0x6F, 0x6E,
+    0x73, 0x00, 0x13, 0x15, 0x12, 0x06, 0x87, 0x6F, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x00,
+    0x05, 0x04, 0x0F, 0x12, 0x06, 0x89, 0x6C, 0x61, 0x62, 0x6F, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E,
+    0x73, 0x00, 0x42, 0x52, 0x05, 0x56, 0x13, 0x11, 0x12, 0x06, 0x87, 0x6E, 0x6F, 0x74, 0x61, 0x74,
+    0x69, 0x6F, 0x6E, 0x73, 0x00, 0x08, 0x09, 0x16, 0x0C, 0x11, 0x04, 0x10, 0x8A, 0x66, 0x65, 0x73,
+    0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x00, 0x0C, 0x10, 0x17, 0x13, 0x12, 0x88, 0x69, 0x6D,
+    0x69, 0x7A, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x00, 0x42, 0x47, 0x05, 0x48, 0x13, 0x0C, 0x13,
+    0x1B, 0x08, 0x87, 0x65, 0x64, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x00, 0x13, 0x10, 0x12, 0x06,
+    0x85, 0x74, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x00, 0x04, 0x08, 0x15, 0x86, 0x6C, 0x61, 0x74,
+    0x69, 0x6F, 0x6E, 0x73, 0x00, 0x13, 0x12, 0x15, 0x13, 0x84, 0x72, 0x74, 0x69, 0x6F, 0x6E, 0x73,
+    0x00, 0x17, 0x42, 0x4C, 0x05, 0x56, 0x13, 0x15, 0x17, 0x11, 0x12, 0x06, 0x86, 0x62, 0x75, 0x74,
+    0x69, 0x6F, 0x6E, 0x73, 0x00, 0x11, 0x0C, 0x87, 0x74, 0x75, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x73,
+    0x00, 0x04, 0x0C, 0x07, 0x01, 0xB0, 0x0C, 0x06, 0x0C, 0x07, 0x08, 0x15, 0x13, 0x84, 0x74, 0x69,
+    0x6F, 0x6E, 0x73, 0x00, 0x46, 0x47, 0x0D, 0x4A, 0x37, 0x4C, 0x3E, 0x55, 0x4D, 0x57, 0x51, 0x5A,
+    0x61, 0x42, 0x44, 0x05, 0x48, 0x26, 0x42, 0x48, 0x05, 0x51, 0x0F, 0x13, 0x15, 0x12, 0x17, 0x83,
+    0x64, 0x6F, 0x65, 0x73, 0x00, 0x04, 0x0C, 0x06, 0x0C, 0x09, 0x09, 0x04, 0x89, 0x69, 0x63, 0x69,
+    0x6F, 0x6E, 0x61, 0x64, 0x6F, 0x73, 0x00, 0x13, 0x15, 0x01, 0x22, 0x15, 0x04, 0x05, 0x10, 0x08,
+    0x01, 0x21, 0x15, 0x04, 0x11, 0x08, 0x16, 0x86, 0x63, 0x65, 0x6E, 0x61, 0x72, 0x69, 0x6F, 0x73,
+    0x00, 0x08, 0x0B, 0x01, 0x0E, 0x04, 0x42, 0x50, 0x05, 0x57, 0x09, 0x12, 0x17, 0x01, 0x04, 0x12,
+    0x13, 0x80, 0x65, 0x73, 0x00, 0x11, 0x0E, 0x82, 0x6F, 0x77, 0x73, 0x00, 0x42, 0x44, 0x05, 0x58,
+    0x0F, 0x08, 0x0B, 0x15, 0x08, 0x13, 0x83, 0x61, 0x70, 0x73, 0x00, 0x12, 0x15, 0x17, 0x82, 0x6F,
+    0x70, 0x73, 0x00, 0x47, 0x84, 0x16, 0x00, 0x88, 0x3C, 0x00, 0x92, 0x5A, 0x01, 0x93, 0xD8, 0x01,
+    0x95, 0xE6, 0x01, 0x97, 0xF6, 0x01, 0x98, 0x03, 0x02, 0x43, 0x47, 0x07, 0x4F, 0x0F, 0x5C, 0x1E,
+    0x11, 0x04, 0x17, 0x16, 0x80, 0x64, 0x73, 0x00, 0x18, 0x04, 0x17, 0x06, 0x08, 0x13, 0x16, 0x84,
+    0x63, 0x75, 0x6C, 0x61, 0x72, 0x73, 0x00, 0x08, 0x84, 0x79, 0x65, 0x61, 0x72, 0x73, 0x00, 0x4E,
+    0x44, 0x1D, 0x45, 0x24, 0x46, 0x30, 0x47, 0x3A, 0x49, 0x5F, 0x4A, 0x67, 0x4C, 0x75, 0x4E, 0x7F,
+    0x4F, 0x8A, 0x50, 0x96, 0x51, 0xA2, 0x53, 0xAD, 0x55, 0xBB, 0x57, 0xCF, 0x1C, 0x83, 0x65, 0x61,
+    0x72, 0x73, 0x00, 0x11, 0x18, 0x10, 0x86, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x73, 0x00, 0x09,
+    0x09, 0x12, 0x83, 0x69, 0x63, 0x65, 0x72, 0x73, 0x00, 0x43, 0x4C, 0x07, 0x4F, 0x11, 0x51, 0x1C,
+    0x0F, 0x12, 0x16, 0x84, 0x64, 0x69, 0x65, 0x72, 0x73, 0x00, 0x0C, 0x12, 0x16, 0x85, 0x6C, 0x64,
+    0x69, 0x65, 0x72, 0x73, 0x00, 0x08, 0x0F, 0x04, 0x06, 0x82, 0x61, 0x72, 0x73, 0x00, 0x0C, 0x17,
+    0x11, 0x08, 0x07, 0x0C, 0x01, 0x2B, 0x11, 0x08, 0x16, 0x04, 0x13, 0x85, 0x73, 0x65, 0x6E, 0x67,
+    0x65, 0x72, 0x73, 0x00, 0x17, 0x0C, 0x15, 0x12, 0x0B, 0x17, 0x18, 0x02, 0x9C, 0x04, 0x06, 0x0C,
+    0x11, 0x12, 0x10, 0x84, 0x6B, 0x65, 0x72, 0x73, 0x00, 0x13, 0x0C, 0x17, 0x0F, 0x18, 0x10, 0x82,
+    0x69, 0x65, 0x72, 0x73, 0x00, 0x12, 0x09, 0x15, 0x08, 0x13, 0x83, 0x72, 0x6D, 0x65, 0x72, 0x73,
+    0x00, 0x17, 0x16, 0x0C, 0x0F, 0x83, 0x65, 0x6E, 0x65, 0x72, 0x73, 0x00, 0x08, 0x08, 0x08, 0x0E,
+    0x13, 0x12, 0x0B, 0x16, 0x84, 0x70, 0x65, 0x72, 0x73, 0x00, 0x42, 0x49, 0x05, 0x55, 0x0C, 0x08,
+    0x15, 0x83, 0x65, 0x72, 0x73, 0x00, 0x04, 0x06, 0x83, 0x65, 0x65, 0x72, 0x73, 0x00, 0x45, 0x46,
+    0x0B, 0x51, 0x25, 0x53, 0x2C, 0x56, 0x37, 0x57, 0x40, 0x42, 0x44, 0x05, 0x48, 0x14, 0x15, 0x0B,
+    0x04, 0x06, 0x88, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 0x00, 0x15, 0x15, 0x12,
+    0x06, 0x01, 0x0F, 0x08, 0x10, 0x15, 0x12, 0x17, 0x01, 0x08, 0x0C, 0x15, 0x06, 0x16, 0x08, 0x07,
+    0x82, 0x6F, 0x72, 0x73, 0x00, 0x08, 0x15, 0x1A, 0x82, 0x6C, 0x65, 0x72, 0x73, 0x00, 0x08, 0x0F,
+    0x1A, 0x08, 0x11, 0x86, 0x73, 0x6C, 0x65, 0x74, 0x74, 0x65, 0x72, 0x73, 0x00, 0x45, 0x4C, 0x0B,
+    0x52, 0x16, 0x56, 0x20, 0x57, 0x2D, 0x59, 0x73, 0x15, 0x15, 0x15, 0x04, 0x1A, 0x84, 0x69, 0x6F,
+    0x72, 0x73, 0x00, 0x07, 0x0C, 0x15, 0x15, 0x12, 0x06, 0x82, 0x72, 0x73, 0x00, 0x08, 0x06, 0x08,
+    0x07, 0x08, 0x15, 0x13, 0x82, 0x73, 0x6F, 0x72, 0x73, 0x00, 0x44, 0x44, 0x09, 0x4C, 0x15, 0x51,
+    0x26, 0x56, 0x2D, 0x1D, 0x0C, 0x11, 0x12, 0x0F, 0x12, 0x06, 0x84, 0x65, 0x72, 0x73, 0x00, 0x17,
+    0x08, 0x10, 0x13, 0x12, 0x06, 0x88, 0x6D, 0x70, 0x65, 0x74, 0x69, 0x74, 0x6F, 0x72, 0x73, 0x00,
+    0x08, 0x15, 0x82, 0x65, 0x72, 0x73, 0x00, 0x42, 0x48, 0x05, 0x4C, 0x11, 0x16, 0x11, 0x04, 0x86,
+    0x63, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x73, 0x00, 0x19, 0x83, 0x69, 0x74, 0x6F, 0x72, 0x73, 0x00,
+    0x08, 0x07, 0x11, 0x08, 0x83, 0x61, 0x76, 0x6F, 0x72, 0x73, 0x00, 0x12, 0x08, 0x0F, 0x08, 0x19,
+    0x08, 0x07, 0x84, 0x6F, 0x70, 0x65, 0x72, 0x73, 0x00, 0x42, 0x48, 0x05, 0x4C, 0x0B, 0x09, 0x08,
+    0x15, 0x02, 0x67, 0x03, 0x17, 0x16, 0x02, 0x62, 0x03, 0x12, 0x04, 0x0F, 0x18, 0x0A, 0x08, 0x15,
+    0x83, 0x74, 0x6F, 0x72, 0x73, 0x00, 0x08, 0x17, 0x11, 0x04, 0x15, 0x18, 0x04, 0x17, 0x16, 0x08,
+    0x15, 0x85, 0x74, 0x65, 0x75, 0x72, 0x73, 0x00, 0x44, 0x84, 0x0D, 0x00, 0x88, 0x18, 0x00, 0x92,
+    0x90, 0x01, 0x98, 0x9A, 0x01, 0x15, 0x04, 0x05, 0x10, 0x08, 0x82, 0x72, 0x61, 0x73, 0x73, 0x00,
+    0x47, 0x86, 0x16, 0x00, 0x87, 0x28, 0x00, 0x8F, 0x30, 0x00, 0x91, 0x85, 0x00, 0x95, 0x26, 0x01,
+    0x96, 0x48, 0x01, 0x9A, 0x6F, 0x01, 0x42, 0x46, 0x05, 0x58, 0x0B, 0x12, 0x15, 0x13, 0x02, 0x34,
+    0x01, 0x16, 0x82, 0x63, 0x65, 0x73, 0x73, 0x00, 0x12, 0x0A, 0x82, 0x64, 0x65, 0x73, 0x73, 0x00,
+    0x46, 0x47, 0x0D, 0x48, 0x20, 0x4A, 0x2F, 0x4B, 0x3B, 0x4F, 0x48, 0x50, 0x4B, 0x15, 0x04, 0x0A,
+    0x08, 0x15, 0x15, 0x0C, 0x8B, 0x72, 0x65, 0x67, 0x61, 0x72, 0x64, 0x6C, 0x65, 0x73, 0x73, 0x00,
+    0x0B, 0x17, 0x11, 0x12, 0x11, 0x86, 0x65, 0x74, 0x68, 0x65, 0x6C, 0x65, 0x73, 0x73, 0x00, 0x11,
+    0x0C, 0x0F, 0x0F, 0x0C, 0x1A, 0x83, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x17, 0x15, 0x08, 0x19, 0x08,
+    0x11, 0x83, 0x65, 0x6C, 0x65, 0x73, 0x73, 0x00, 0x0C, 0x01, 0x38, 0x10, 0x18, 0x15, 0x07, 0x84,
+    0x6C, 0x65, 0x73, 0x73, 0x00, 0x47, 0x48, 0x0F, 0x4C, 0x13, 0x4F, 0x1E, 0x55, 0x26, 0x56, 0x32,
+    0x58, 0x73, 0x5C, 0x81, 0x13, 0x12, 0x01, 0x1B, 0x16, 0x16, 0x18, 0x05, 0x85, 0x69, 0x6E, 0x65,
+    0x73, 0x73, 0x00, 0x0C, 0x83, 0x6C, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x12, 0x05, 0x05, 0x18, 0x17,
+    0x16, 0x82, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x42, 0x4C, 0x05, 0x58, 0x0F, 0x18, 0x05, 0x85, 0x73,
+    0x69, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x42, 0x45, 0x05, 0x52, 0x0C, 0x83, 0x69, 0x6E, 0x65, 0x73,
+    0x73, 0x00, 0x42, 0x46, 0x05, 0x4C, 0x15, 0x0C, 0x16, 0x11, 0x12, 0x06, 0x88, 0x63, 0x69, 0x6F,
+    0x75, 0x73, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x06, 0x0C, 0x16, 0x11, 0x12, 0x06, 0x89, 0x63, 0x69,
+    0x6F, 0x75, 0x73, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x12, 0x0C, 0x06, 0x16, 0x11, 0x12, 0x06, 0x83,
+    0x73, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x43, 0x4B, 0x07, 0x4F, 0x12, 0x5D, 0x17, 0x17, 0x15, 0x12,
+    0x1A, 0x17, 0x16, 0x18, 0x15, 0x17, 0x01, 0x09, 0x08, 0x11, 0x12, 0x01, 0x03, 0x04, 0x0F, 0x84,
+    0x69, 0x6E, 0x65, 0x73, 0x73, 0x00, 0x42, 0x46, 0x05, 0x53, 0x0B, 0x08, 0x07, 0x81, 0x65, 0x73,
+    0x00, 0x42, 0x55, 0x05, 0x58, 0x0F, 0x18, 0x16, 0x85, 0x70, 0x70, 0x72, 0x65, 0x73, 0x73, 0x00,
+    0x16, 0x83, 0x70, 0x72, 0x65, 0x73, 0x73, 0x00, 0x43, 0x46, 0x07, 0x52, 0x0F, 0x56, 0x16, 0x06,
+    0x18, 0x16, 0x83, 0x65, 0x73, 0x73, 0x00, 0x13, 0x82, 0x73, 0x65, 0x73, 0x73, 0x00, 0x08, 0x42,
+    0x55, 0x05, 0x56, 0x0A, 0x07, 0x07, 0x02, 0xEF, 0x11, 0x16, 0x12, 0x13, 0x02, 0xE2, 0x14, 0x04,
+    0x0F, 0x09, 0x82, 0x6C, 0x65, 0x73, 0x73, 0x00, 0x15, 0x06, 0x06, 0x04, 0x84, 0x72, 0x6F, 0x73,
+    0x73, 0x00, 0x06, 0x16, 0x08, 0x07, 0x85, 0x69, 0x73, 0x63, 0x75, 0x73, 0x73, 0x00, 0x4B, 0x84,
+    0x22, 0x00, 0x86, 0x27, 0x00, 0x88, 0x49, 0x00, 0x89, 0x6B, 0x00, 0x8C, 0x73, 0x00, 0x90, 0x89,
+    0x00, 0x91, 0x95, 0x00, 0x95, 0x4D, 0x01, 0x96, 0x53, 0x01, 0x97, 0x83, 0x01, 0x98, 0x9D, 0x01,
+    0x11, 0x1A, 0x02, 0x10, 0x01, 0x42, 0x48, 0x05, 0x4C, 0x16, 0x11, 0x11, 0x12, 0x06, 0x0C, 0x07,
+    0x87, 0x73, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x73, 0x00, 0x15, 0x16, 0x0C, 0x07, 0x84,
+    0x74, 0x72, 0x69, 0x63, 0x74, 0x73, 0x00, 0x42, 0x48, 0x05, 0x56, 0x13, 0x0E, 0x04, 0x15, 0x15,
+    0x04, 0x13, 0x86, 0x61, 0x6B, 0x65, 0x65, 0x74, 0x73, 0x00, 0x16, 0x18, 0x0B, 0x06, 0x04, 0x16,
+    0x16, 0x04, 0x10, 0x83, 0x65, 0x74, 0x74, 0x73, 0x00, 0x04, 0x15, 0x06, 0x15, 0x0C, 0x02, 0x57,
+    0x11, 0x42, 0x48, 0x05, 0x50, 0x0E, 0x19, 0x12, 0x16, 0x83, 0x69, 0x65, 0x74, 0x73, 0x00, 0x0F,
+    0x83, 0x69, 0x6D, 0x69, 0x74, 0x73, 0x00, 0x08, 0x10, 0x08, 0x17, 0x04, 0x17, 0x16, 0x82, 0x6E,
+    0x74, 0x73, 0x00, 0x44, 0x44, 0x09, 0x48, 0x19, 0x4C, 0xA5, 0x52, 0xB3, 0x0C, 0x07, 0x08, 0x08,
+    0x15, 0x0A, 0x11, 0x0C, 0x86, 0x64, 0x69, 0x65, 0x6E, 0x74, 0x73, 0x00, 0x43, 0x50, 0x07, 0x53,
+    0x71, 0x57, 0x7E, 0x45, 0x48, 0x0B, 0x4C, 0x32, 0x51, 0x3F, 0x58, 0x50, 0x59, 0x5D, 0x42, 0x46,
+    0x05, 0x4F, 0x17, 0x11, 0x18, 0x12, 0x15, 0x13, 0x88, 0x6E, 0x6F, 0x75, 0x6E, 0x63, 0x65, 0x6D,
+    0x65, 0x6E, 0x74, 0x73, 0x00, 0x0A, 0x04, 0x17, 0x11, 0x08, 0x87, 0x6E, 0x67, 0x6C, 0x65, 0x6D,
+    0x65, 0x6E, 0x74, 0x73, 0x00, 0x08, 0x13, 0x1B, 0x08, 0x85, 0x72, 0x69, 0x6D, 0x65, 0x6E, 0x74,
+    0x73, 0x00, 0x12, 0x0C, 0x15, 0x19, 0x11, 0x08, 0x88, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E,
+    0x74, 0x73, 0x00, 0x17, 0x16, 0x11, 0x0C, 0x85, 0x72, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x00,
+    0x12, 0x15, 0x13, 0x10, 0x0C, 0x84, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x00, 0x08, 0x0C, 0x06,
+    0x08, 0x15, 0x85, 0x70, 0x69, 0x65, 0x6E, 0x74, 0x73, 0x00, 0x04, 0x05, 0x10, 0x12, 0x06, 0x11,
+    0x12, 0x11, 0x83, 0x61, 0x6E, 0x74, 0x73, 0x00, 0x04, 0x17, 0x16, 0x11, 0x12, 0x06, 0x84, 0x72,
+    0x61, 0x69, 0x6E, 0x74, 0x73, 0x00, 0x10, 0x80, 0x68, 0x73, 0x00, 0x0C, 0x09, 0x81, 0x73, 0x74,
+    0x00, 0x0C, 0x43, 0x46, 0x07, 0x4A, 0x0F, 0x4F, 0x21, 0x0C, 0x17, 0x0C, 0x15, 0x06, 0x83, 0x73,
+    0x00, 0x12, 0x0F, 0x08, 0x04, 0x0B, 0x06, 0x15, 0x04, 0x86, 0x6F, 0x6C, 0x6F, 0x67, 0x69, 0x73,
+    0x74, 0x73, 0x00, 0x04, 0x15, 0x08, 0x17, 0x04, 0x10, 0x85, 0x69, 0x61, 0x6C, 0x69, 0x73, 0x74,
+    0x00, 0x42, 0x48, 0x05, 0x58, 0x15, 0x16, 0x16, 0x18, 0x0B, 0x06, 0x04, 0x16, 0x16, 0x04, 0x10,
+    0x84, 0x65, 0x74, 0x74, 0x73, 0x00, 0x05, 0x04, 0x81, 0x73, 0x00, 0x12, 0x05, 0x04, 0x08, 0x15,
+    0x08, 0x1A, 0x88, 0x68, 0x65, 0x72, 0x65, 0x61, 0x62, 0x6F, 0x75, 0x74, 0x73, 0x00, 0x48, 0x84,
+    0x19, 0x00, 0x86, 0x23, 0x00, 0x88, 0x3B, 0x00, 0x8C, 0x5C, 0x00, 0x8F, 0x73, 0x00, 0x90, 0x7C,
+    0x00, 0x92, 0x8F, 0x00, 0x96, 0x05, 0x04, 0x06, 0x04, 0x15, 0x83, 0x75, 0x63, 0x6F, 0x75, 0x73,
+    0x00, 0x11, 0x08, 0x42, 0x46, 0x05, 0x56, 0x0A, 0x82, 0x73, 0x75, 0x73, 0x00, 0x08, 0x11, 0x12,
+    0x06, 0x86, 0x73, 0x65, 0x6E, 0x73, 0x75, 0x73, 0x00, 0x43, 0x44, 0x07, 0x45, 0x0F, 0x51, 0x15,
+    0x05, 0x04, 0x0B, 0x83, 0x65, 0x61, 0x73, 0x00, 0x04, 0x0B, 0x81, 0x61, 0x73, 0x00, 0x04, 0x15,
+    0x12, 0x13, 0x10, 0x08, 0x17, 0x11, 0x12, 0x06, 0x01, 0x14, 0x42, 0x46, 0x05, 0x51, 0x0E, 0x0F,
+    0x08, 0x06, 0x83, 0x73, 0x69, 0x75, 0x73, 0x00, 0x08, 0x0A, 0x11, 0x0C, 0x81, 0x6F, 0x75, 0x73,
+    0x00, 0x0C, 0x17, 0x16, 0x83, 0x79, 0x6C, 0x75, 0x73, 0x00, 0x04, 0x17, 0x12, 0x13, 0x12, 0x13,
+    0x0C, 0x0B, 0x87, 0x70, 0x6F, 0x70, 0x6F, 0x74, 0x61, 0x6D, 0x75, 0x73, 0x00, 0x4B, 0x86, 0x22,
+    0x00, 0x88, 0x2B, 0x00, 0x8A, 0x6D, 0x00, 0x8C, 0x85, 0x00, 0x8F, 0xAE, 0x01, 0x90, 0xCE, 0x01,
+    0x91, 0x34, 0x02, 0x95, 0xB5, 0x02, 0x98, 0x2D, 0x03, 0x99, 0x41, 0x03, 0x9D, 0x6B, 0x03, 0x16,
+    0x0C, 0x10, 0x12, 0x15, 0x13, 0x02, 0x66, 0x02, 0x42, 0x4A, 0x05, 0x51, 0x22, 0x42, 0x4C, 0x05,
+    0x52, 0x16, 0x42, 0x4F, 0x05, 0x57, 0x0A, 0x08, 0x15, 0x02, 0xFF, 0x02, 0x16, 0x08, 0x15, 0x13,
+    0x02, 0xF8, 0x02, 0x0F, 0x04, 0x11, 0x04, 0x02, 0x1C, 0x03, 0x42, 0x44, 0x05, 0x4C, 0x14, 0x0F,
+    0x08, 0x06, 0x16, 0x0C, 0x10, 0x85, 0x6C, 0x61, 0x6E, 0x65, 0x6F, 0x75, 0x73, 0x00, 0x0A, 0x0C,
+    0x07, 0x11, 0x0C, 0x85, 0x65, 0x6E, 0x6F, 0x75, 0x73, 0x00, 0x42, 0x44, 0x05, 0x4C, 0x10, 0x0F,
+    0x04, 0x11, 0x04, 0x84, 0x6F, 0x67, 0x6F, 0x75, 0x73, 0x00, 0x17, 0x16, 0x08, 0x15, 0x13, 0x02,
+    0x57, 0x02, 0x48, 0x86, 0x19, 0x00, 0x87, 0x33, 0x00, 0x8A, 0x41, 0x00, 0x91, 0x75, 0x00, 0x95,
+    0x96, 0x00, 0x96, 0xD3, 0x00, 0x97, 0xDD, 0x00, 0x99, 0x1A, 0x01, 0x42, 0x4C, 0x05, 0x51, 0x10,
+    0x17, 0x06, 0x0C, 0x09, 0x84, 0x74, 0x69, 0x6F, 0x75, 0x73, 0x00, 0x12, 0x06, 0x84, 0x73, 0x63,
+    0x69, 0x6F, 0x75, 0x73, 0x00, 0x0C, 0x06, 0x08, 0x87, 0x64, 0x65, 0x63, 0x69, 0x64, 0x75, 0x6F,
+    0x75, 0x73, 0x00, 0x43, 0x48, 0x07, 0x4C, 0x16, 0x57, 0x26, 0x15, 0x0A, 0x0A, 0x04, 0x89, 0x65,
+    0x67, 0x72, 0x65, 0x67, 0x69, 0x6F, 0x75, 0x73, 0x00, 0x0F, 0x08, 0x15, 0x06, 0x04, 0x16, 0x87,
+    0x69, 0x6C, 0x65, 0x67, 0x69, 0x6F, 0x75, 0x73, 0x00, 0x0C, 0x16, 0x08, 0x15, 0x13, 0x86, 0x74,
+    0x69, 0x67, 0x69, 0x6F, 0x75, 0x73, 0x00, 0x42, 0x44, 0x05, 0x52, 0x12, 0x0F, 0x0F, 0x08, 0x06,
+    0x16, 0x0C, 0x10, 0x83, 0x65, 0x6F, 0x75, 0x73, 0x00, 0x10, 0x0C, 0x15, 0x08, 0x06, 0x87, 0x65,
+    0x6D, 0x6F, 0x6E, 0x69, 0x6F, 0x75, 0x73, 0x00, 0x42, 0x44, 0x05, 0x48, 0x20, 0x0F, 0x42, 0x44,
+    0x05, 0x4F, 0x10, 0x0B, 0x87, 0x69, 0x6C, 0x61, 0x72, 0x69, 0x6F, 0x75, 0x73, 0x00, 0x0C, 0x0B,
+    0x86, 0x61, 0x72, 0x69, 0x6F, 0x75, 0x73, 0x00, 0x42, 0x4F, 0x05, 0x57, 0x0F, 0x08, 0x07, 0x85,
+    0x69, 0x72, 0x69, 0x6F, 0x75, 0x73, 0x00, 0x16, 0x0C, 0x10, 0x88, 0x79, 0x73, 0x74, 0x65, 0x72,
+    0x69, 0x6F, 0x75, 0x73, 0x00, 0x11, 0x12, 0x06, 0x83, 0x63, 0x69, 0x6F, 0x75, 0x73, 0x00, 0x43,
+    0x46, 0x07, 0x4C, 0x0B, 0x53, 0x31, 0x0C, 0x09, 0x01, 0x2D, 0x42, 0x57, 0x05, 0x58, 0x15, 0x08,
+    0x13, 0x08, 0x15, 0x15, 0x18, 0x16, 0x87, 0x74, 0x69, 0x74, 0x69, 0x6F, 0x75, 0x73, 0x00, 0x42,
+    0x54, 0x05, 0x57, 0x0B, 0x0C, 0x05, 0x18, 0x02, 0xDC, 0x01, 0x04, 0x15, 0x0A, 0x02, 0xD6, 0x01,
+    0x08, 0x15, 0x15, 0x18, 0x16, 0x82, 0x74, 0x69, 0x6F, 0x75, 0x73, 0x00, 0x08, 0x42, 0x8B, 0xB7,
+    0x01, 0x8C, 0x07, 0x00, 0x0B, 0x06, 0x16, 0x0C, 0x02, 0x88, 0x01, 0x42, 0x52, 0x05, 0x58, 0x10,
+    0x10, 0x12, 0x11, 0x04, 0x84, 0x61, 0x6C, 0x6F, 0x75, 0x73, 0x00, 0x06, 0x0C, 0x07, 0x08, 0x15,
+    0x88, 0x69, 0x64, 0x69, 0x63, 0x75, 0x6C, 0x6F, 0x75, 0x73, 0x00, 0x44, 0x48, 0x09, 0x52, 0x13,
+    0x55, 0x3E, 0x5C, 0x49, 0x11, 0x08, 0x19, 0x84, 0x6F, 0x6D, 0x6F, 0x75, 0x73, 0x00, 0x42, 0x4B,
+    0x05, 0x51, 0x10, 0x17, 0x16, 0x12, 0x13, 0x84, 0x75, 0x6D, 0x6F, 0x75, 0x73, 0x00, 0x12, 0x42,
+    0x50, 0x05, 0x51, 0x11, 0x12, 0x17, 0x18, 0x04, 0x87, 0x6E, 0x6F, 0x6D, 0x6F, 0x75, 0x73, 0x00,
+    0x1C, 0x16, 0x84, 0x79, 0x6D, 0x6F, 0x75, 0x73, 0x00, 0x18, 0x12, 0x11, 0x08, 0x85, 0x72, 0x6D,
+    0x6F, 0x75, 0x73, 0x00, 0x11, 0x42, 0x44, 0x05, 0x52, 0x0E, 0x11, 0x18, 0x84, 0x69, 0x6D, 0x6F,
+    0x75, 0x73, 0x00, 0x11, 0x12, 0x07, 0x18, 0x08, 0x16, 0x13, 0x86, 0x79, 0x6D, 0x6F, 0x75, 0x73,
+    0x00, 0x44, 0x44, 0x09, 0x48, 0x34, 0x4C, 0x56, 0x52, 0x60, 0x42, 0x4F, 0x05, 0x57, 0x0D, 0x0F,
+    0x08, 0x06, 0x16, 0x0C, 0x10, 0x01, 0x38, 0x42, 0x4F, 0x05, 0x51, 0x0A, 0x18, 0x10, 0x0C, 0x01,
+    0x13, 0x12, 0x42, 0x50, 0x05, 0x53, 0x10, 0x86, 0x75, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x6F, 0x75,
+    0x73, 0x00, 0x16, 0x01, 0x1A, 0x42, 0x4A, 0x05, 0x55, 0x1E, 0x12, 0x15, 0x42, 0x47, 0x05, 0x48,
+    0x0E, 0x11, 0x04, 0x84, 0x79, 0x6E, 0x6F, 0x75, 0x73, 0x00, 0x17, 0x08, 0x0B, 0x82, 0x65, 0x6F,
+    0x75, 0x73, 0x00, 0x17, 0x16, 0x01, 0x06, 0x17, 0x11, 0x12, 0x06, 0x82, 0x75, 0x6F, 0x75, 0x73,
+    0x00, 0x17, 0x42, 0x46, 0x05, 0x4B, 0x13, 0x12, 0x17, 0x18, 0x04, 0x85, 0x68, 0x74, 0x68, 0x6F,
+    0x6E, 0x6F, 0x75, 0x73, 0x00, 0x06, 0x12, 0x17, 0x18, 0x04, 0x84, 0x68, 0x6F, 0x6E, 0x6F, 0x75,
+    0x73, 0x00, 0x43, 0x48, 0x07, 0x57, 0x3B, 0x58, 0x56, 0x43, 0x45, 0x07, 0x57, 0x11, 0x59, 0x23,
+    0x10, 0x18, 0x11, 0x85, 0x65, 0x72, 0x6F, 0x75, 0x73, 0x00, 0x16, 0x42, 0x44, 0x05, 0x5C, 0x0A,
+    0x16, 0x0C, 0x07, 0x01, 0x51, 0x10, 0x82, 0x69, 0x6F, 0x75, 0x73, 0x00, 0x0C, 0x42, 0x51, 0x05,
+    0x57, 0x09, 0x10, 0x12, 0x01, 0x2B, 0x06, 0x08, 0x16, 0x11, 0x0C, 0x01, 0x24, 0x42, 0x44, 0x05,
+    0x51, 0x10, 0x16, 0x0C, 0x07, 0x84, 0x73, 0x74, 0x72, 0x6F, 0x75, 0x73, 0x00, 0x08, 0x19, 0x07,
+    0x04, 0x83, 0x75, 0x72, 0x6F, 0x75, 0x73, 0x00, 0x42, 0x50, 0x05, 0x52, 0x0E, 0x18, 0x0B, 0x84,
+    0x6F, 0x72, 0x6F, 0x75, 0x73, 0x00, 0x42, 0x4A, 0x05, 0x50, 0x0B, 0x0C, 0x42, 0x55, 0x08, 0x59,
+    0x08, 0x04, 0x0F, 0x0A, 0x84, 0x72, 0x6F, 0x75, 0x73, 0x00, 0x42, 0x46, 0x05, 0x57, 0x09, 0x18,
+    0x10, 0x01, 0x32, 0x06, 0x08, 0x09, 0x11, 0x0C, 0x83, 0x69, 0x6F, 0x75, 0x73, 0x00, 0x42, 0x48,
+    0x05, 0x4C, 0x10, 0x07, 0x11, 0x08, 0x15, 0x83, 0x7A, 0x76, 0x6F, 0x75, 0x73, 0x00, 0x42, 0x48,
+    0x05, 0x59, 0x12, 0x0B, 0x06, 0x16, 0x0C, 0x10, 0x85, 0x69, 0x65, 0x76, 0x6F, 0x75, 0x73, 0x00,
+    0x08, 0x15, 0x13, 0x83, 0x6F, 0x75, 0x73, 0x00, 0x08, 0x07, 0x11, 0x08, 0x15, 0x82, 0x76, 0x6F,
+    0x75, 0x73, 0x00, 0x11, 0x08, 0x06, 0x11, 0x12, 0x06, 0x85, 0x73, 0x65, 0x6E, 0x73, 0x75, 0x73,
+    0x00, 0x11, 0x12, 0x0E, 0x83, 0x6E, 0x6F, 0x77, 0x73, 0x00, 0x45, 0x44, 0x0B, 0x45, 0x16, 0x46,
+    0x21, 0x52, 0x2B, 0x55, 0x43, 0x07, 0x1A, 0x12, 0x11, 0x83, 0x61, 0x64, 0x61, 0x79, 0x73, 0x00,
+    0x15, 0x08, 0x16, 0x16, 0x04, 0x13, 0x82, 0x73, 0x62, 0x79, 0x00, 0x04, 0x15, 0x0C, 0x13, 0x16,
+    0x11, 0x12, 0x06, 0x01, 0x22, 0x42, 0x4F, 0x05, 0x58, 0x11, 0x13, 0x10, 0x0C, 0x86, 0x65, 0x6D,
+    0x70, 0x6C, 0x6F, 0x79, 0x73, 0x00, 0x0A, 0x08, 0x16, 0x82, 0x65, 0x73, 0x00, 0x04, 0x11, 0x12,
+    0x0C, 0x17, 0x06, 0x0C, 0x07, 0x81, 0x69, 0x65, 0x73, 0x00, 0x17, 0x15, 0x08, 0x0B, 0x02, 0xA0,
+    0x0E, 0x4F, 0x84, 0x2E, 0x00, 0x86, 0x49, 0x00, 0x88, 0xCA, 0x00, 0x89, 0x32, 0x01, 0x8B, 0x5A,
+    0x01, 0x8C, 0xCC, 0x01, 0x8F, 0x59, 0x02, 0x90, 0x64, 0x02, 0x91, 0x7A, 0x02, 0x92, 0x86, 0x0B,
+    0x93, 0xAF, 0x0B, 0x95, 0x0C, 0x0C, 0x96, 0x3B, 0x0C, 0x98, 0x18, 0x0E, 0xB4, 0x52, 0x0E, 0x44,
+    0x4A, 0x09, 0x4B, 0x0E, 0x55, 0x13, 0x5C, 0x09, 0x0B, 0x17, 0x02, 0x49, 0x26, 0x1C, 0x17, 0x02,
+    0xEF, 0x29, 0x0E, 0x15, 0x08, 0x08, 0x10, 0x02, 0x3C, 0x26, 0x45, 0x44, 0x0B, 0x48, 0x23, 0x4C,
+    0x61, 0x51, 0x6B, 0x58, 0x75, 0x42, 0x46, 0x05, 0x55, 0x0C, 0x1B, 0x08, 0x83, 0x61, 0x63, 0x74,
+    0x00, 0x17, 0x16, 0x05, 0x18, 0x16, 0x85, 0x74, 0x72, 0x61, 0x63, 0x74, 0x00, 0x43, 0x49, 0x07,
+    0x55, 0x0F, 0x57, 0x1C, 0x08, 0x15, 0x82, 0x6C, 0x65, 0x63, 0x74, 0x00, 0x18, 0x16, 0x16, 0x08,
+    0x15, 0x85, 0x75, 0x72, 0x72, 0x65, 0x63, 0x74, 0x00, 0x42, 0x46, 0x05, 0x48, 0x17, 0x42, 0x48,
+    0x05, 0x4C, 0x08, 0x07, 0x01, 0x06, 0x0B, 0x06, 0x15, 0x04, 0x84, 0x74, 0x65, 0x63, 0x74, 0x00,
+    0x0B, 0x06, 0x15, 0x04, 0x84, 0x69, 0x74, 0x65, 0x63, 0x74, 0x00, 0x13, 0x16, 0x08, 0x07, 0x84,
+    0x70, 0x69, 0x63, 0x74, 0x00, 0x0C, 0x1B, 0x08, 0x83, 0x74, 0x69, 0x6E, 0x63, 0x74, 0x00, 0x07,
+    0x04, 0x18, 0x14, 0x04, 0x84, 0x65, 0x64, 0x75, 0x63, 0x74, 0x00, 0x47, 0x44, 0x0F, 0x47, 0x16,
+    0x4C, 0x23, 0x4F, 0x36, 0x51, 0x4E, 0x52, 0x58, 0x53, 0x5E, 0x15, 0x0A, 0x82, 0x65, 0x61, 0x74,
+    0x00, 0x11, 0x08, 0x07, 0x11, 0x08, 0x13, 0x08, 0x07, 0x11, 0x0C, 0x82, 0x74, 0x00, 0x43, 0x45,
+    0x07, 0x49, 0x0B, 0x55, 0x36, 0x0F, 0x04, 0x01, 0x05, 0x15, 0x12, 0x09, 0x82, 0x65, 0x69, 0x74,
+    0x00, 0x42, 0x49, 0x05, 0x53, 0x0F, 0x10, 0x04, 0x13, 0x83, 0x70, 0x68, 0x6C, 0x65, 0x74, 0x00,
+    0x10, 0x04, 0x13, 0x82, 0x68, 0x6C, 0x65, 0x74, 0x00, 0x10, 0x11, 0x15, 0x08, 0x19, 0x12, 0x0A,
+    0x02, 0xC7, 0x03, 0x15, 0x1A, 0x81, 0x74, 0x65, 0x00, 0x15, 0x08, 0x17, 0x11, 0x0C, 0x81, 0x72,
+    0x65, 0x74, 0x00, 0x04, 0x42, 0x46, 0x05, 0x55, 0x0E, 0x15, 0x0C, 0x04, 0x82, 0x72, 0x61, 0x66,
+    0x74, 0x00, 0x06, 0x42, 0x4C, 0x05, 0x55, 0x0E, 0x04, 0x84, 0x72, 0x63, 0x72, 0x61, 0x66, 0x74,
+    0x00, 0x15, 0x0C, 0x04, 0x85, 0x63, 0x72, 0x61, 0x66, 0x74, 0x00, 0x44, 0x46, 0x09, 0x4A, 0x13,
+    0x4C, 0x63, 0x57, 0x6D, 0x08, 0x17, 0x0C, 0x0B, 0x06, 0x15, 0x04, 0x02, 0x03, 0x0B, 0x44, 0x48,
+    0x09, 0x4C, 0x12, 0x51, 0x2C, 0x58, 0x39, 0x0C, 0x0B, 0x84, 0x65, 0x69, 0x67, 0x68, 0x74, 0x00,
+    0x42, 0x4F, 0x05, 0x55, 0x0E, 0x0A, 0x85, 0x66, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x00, 0x1C, 0x04,
+    0x0F, 0x13, 0x84, 0x77, 0x72, 0x69, 0x67, 0x68, 0x74, 0x00, 0x08, 0x42, 0x8F, 0x26, 0x26, 0x95,
+    0x07, 0x00, 0x17, 0x16, 0x02, 0x1D, 0x26, 0x42, 0x44, 0x05, 0x52, 0x11, 0x42, 0x49, 0x05, 0x56,
+    0x05, 0x84, 0x6F, 0x75, 0x67, 0x68, 0x74, 0x00, 0x15, 0x0B, 0x17, 0x02, 0xE3, 0x0C, 0x0A, 0x11,
+    0x12, 0x17, 0x83, 0x69, 0x67, 0x68, 0x74, 0x00, 0x0C, 0x1A, 0x02, 0xD4, 0x0C, 0x46, 0x44, 0x0D,
+    0x48, 0x26, 0x49, 0x36, 0x55, 0x40, 0x56, 0x4A, 0x58, 0x5D, 0x42, 0x55, 0x05, 0x57, 0x10, 0x17,
+    0x12, 0x13, 0x84, 0x72, 0x74, 0x72, 0x61, 0x69, 0x74, 0x00, 0x15, 0x12, 0x13, 0x82, 0x72, 0x61,
+    0x69, 0x74, 0x00, 0x0B, 0x11, 0x08, 0x15, 0x04, 0x09, 0x86, 0x68, 0x72, 0x65, 0x6E, 0x68, 0x65,
+    0x69, 0x74, 0x00, 0x0C, 0x11, 0x08, 0x05, 0x83, 0x65, 0x66, 0x69, 0x74, 0x00, 0x0C, 0x15, 0x13,
+    0x16, 0x84, 0x69, 0x72, 0x69, 0x74, 0x00, 0x42, 0x52, 0x05, 0x56, 0x0E, 0x13, 0x10, 0x12, 0x06,
+    0x08, 0x07, 0x81, 0x65, 0x00, 0x04, 0x80, 0x73, 0x74, 0x00, 0x43, 0x46, 0x07, 0x54, 0x1F, 0x56,
+    0x25, 0x42, 0x4C, 0x05, 0x55, 0x0E, 0x15, 0x0C, 0x06, 0x84, 0x63, 0x75, 0x69, 0x74, 0x00, 0x18,
+    0x06, 0x85, 0x69, 0x72, 0x63, 0x75, 0x69, 0x74, 0x00, 0x08, 0x07, 0x04, 0x02, 0x48, 0x09, 0x15,
+    0x08, 0x13, 0x85, 0x75, 0x72, 0x73, 0x75, 0x69, 0x74, 0x00, 0x04, 0x18, 0x16, 0x16, 0x04, 0x83,
+    0x61, 0x75, 0x6C, 0x74, 0x00, 0x42, 0x44, 0x05, 0x48, 0x0F, 0x17, 0x15, 0x12, 0x13, 0x10, 0x0C,
+    0x81, 0x6E, 0x74, 0x00, 0x17, 0x17, 0x04, 0x80, 0x70, 0x74, 0x00, 0x49, 0x84, 0x1C, 0x00, 0x87,
+    0x89, 0x02, 0x88, 0x91, 0x02, 0x8C, 0x6D, 0x08, 0x90, 0x81, 0x08, 0x92, 0x92, 0x08, 0x95, 0x9B,
+    0x08, 0x96, 0xAE, 0x08, 0x98, 0xC6, 0x08, 0x4E, 0x86, 0x2B, 0x00, 0x87, 0x5D, 0x00, 0x88, 0x8F,
+    0x00, 0x8A, 0xAA, 0x00, 0x8B, 0xCB, 0x00, 0x8C, 0xDC, 0x00, 0x8F, 0x12, 0x01, 0x90, 0x3F, 0x01,
+    0x91, 0x4D, 0x01, 0x95, 0xA5, 0x01, 0x96, 0x00, 0x02, 0x97, 0x0A, 0x02, 0x98, 0x49, 0x02, 0x9C,
+    0x55, 0x02, 0x0C, 0x09, 0x42, 0x4C, 0x05, 0x51, 0x24, 0x42, 0x51, 0x05, 0x57, 0x13, 0x0C, 0x0A,
+    0x0C, 0x16, 0x88, 0x6E, 0x69, 0x66, 0x69, 0x63, 0x61, 0x6E, 0x74, 0x00, 0x15, 0x12, 0x05, 0x04,
+    0x84, 0x61, 0x63, 0x69, 0x65, 0x6E, 0x74, 0x00, 0x0A, 0x0C, 0x16, 0x85, 0x69, 0x66, 0x69, 0x63,
+    0x61, 0x6E, 0x74, 0x00, 0x11, 0x42, 0x48, 0x05, 0x52, 0x29, 0x43, 0x46, 0x07, 0x53, 0x15, 0x57,
+    0x1A, 0x42, 0x88, 0xC8, 0x02, 0x96, 0x07, 0x00, 0x11, 0x04, 0x15, 0x17, 0x02, 0xDB, 0x01, 0x08,
+    0x07, 0x02, 0xB0, 0x01, 0x11, 0x0C, 0x15, 0x08, 0x13, 0x18, 0x16, 0x02, 0xCC, 0x01, 0x13, 0x16,
+    0x08, 0x15, 0x15, 0x02, 0xC2, 0x01, 0x0A, 0x42, 0x44, 0x05, 0x55, 0x0F, 0x08, 0x13, 0x86, 0x61,
+    0x67, 0x65, 0x61, 0x6E, 0x74, 0x00, 0x04, 0x16, 0x86, 0x65, 0x72, 0x67, 0x65, 0x61, 0x6E, 0x74,
+    0x00, 0x43, 0x8C, 0x0A, 0x00, 0x92, 0xFC, 0x02, 0x95, 0x16, 0x00, 0x09, 0x0C, 0x11, 0x0A, 0x0C,
+    0x16, 0x83, 0x63, 0x61, 0x6E, 0x74, 0x00, 0x04, 0x16, 0x85, 0x65, 0x72, 0x67, 0x65, 0x61, 0x6E,
+    0x74, 0x00, 0x42, 0x93, 0x07, 0x00, 0x9A, 0xB5, 0x26, 0x0F, 0x08, 0x84, 0x65, 0x70, 0x68, 0x61,
+    0x6E, 0x74, 0x00, 0x45, 0x46, 0x0B, 0x47, 0x1A, 0x4F, 0x1E, 0x51, 0x28, 0x53, 0x2F, 0x0C, 0x09,
+    0x11, 0x0A, 0x0C, 0x16, 0x86, 0x69, 0x66, 0x69, 0x63, 0x61, 0x6E, 0x74, 0x00, 0x08, 0x05, 0x01,
+    0xAA, 0x0C, 0x15, 0x05, 0x83, 0x6C, 0x69, 0x61, 0x6E, 0x74, 0x00, 0x0C, 0x10, 0x12, 0x07, 0x02,
+    0x78, 0x26, 0x0C, 0x06, 0x08, 0x15, 0x02, 0x41, 0x01, 0x44, 0x88, 0x0D, 0x00, 0x8C, 0x3F, 0x03,
+    0x8F, 0x1A, 0x00, 0x98, 0x23, 0x00, 0x19, 0x42, 0x88, 0x07, 0x00, 0x8C, 0x33, 0x03, 0x15, 0x13,
+    0x02, 0x2D, 0x03, 0x0C, 0x15, 0x05, 0x82, 0x69, 0x61, 0x6E, 0x74, 0x00, 0x16, 0x11, 0x12, 0x06,
+    0x82, 0x74, 0x61, 0x6E, 0x74, 0x00, 0x42, 0x44, 0x05, 0x47, 0x09, 0x10, 0x15, 0x01, 0x6E, 0x11,
+    0x08, 0x10, 0x01, 0x69, 0x44, 0x44, 0x09, 0x48, 0x0D, 0x4C, 0x4A, 0x52, 0x4F, 0x10, 0x15, 0x01,
+    0xEA, 0x44, 0x50, 0x09, 0x57, 0x19, 0x58, 0x27, 0x59, 0x32, 0x42, 0x88, 0x09, 0x06, 0x95, 0x07,
+    0x00, 0x08, 0x13, 0x84, 0x61, 0x6E, 0x65, 0x6E, 0x74, 0x00, 0x18, 0x08, 0x0F, 0x87, 0x69, 0x65,
+    0x75, 0x74, 0x65, 0x6E, 0x61, 0x6E, 0x74, 0x00, 0x08, 0x0C, 0x0F, 0x84, 0x74, 0x65, 0x6E, 0x61,
+    0x6E, 0x74, 0x00, 0x11, 0x12, 0x06, 0x86, 0x76, 0x65, 0x6E, 0x61, 0x6E, 0x74, 0x00, 0x10, 0x12,
+    0x15, 0x01, 0xA9, 0x13, 0x42, 0x50, 0xB1, 0x53, 0x05, 0x12, 0x01, 0xAD, 0x44, 0x44, 0x09, 0x48,
+    0x1C, 0x4A, 0x24, 0x58, 0x3F, 0x42, 0x53, 0x05, 0x57, 0x09, 0x13, 0x04, 0x01, 0x9B, 0x16, 0x08,
+    0x15, 0x83, 0x75, 0x72, 0x61, 0x6E, 0x74, 0x00, 0x0A, 0x0C, 0x0F, 0x0F, 0x08, 0x05, 0x01, 0x89,
+    0x0C, 0x10, 0x42, 0x4C, 0x05, 0x51, 0x0E, 0x85, 0x6D, 0x69, 0x67, 0x72, 0x61, 0x6E, 0x74, 0x00,
+    0x0C, 0x87, 0x6D, 0x6D, 0x69, 0x67, 0x72, 0x61, 0x6E, 0x74, 0x00, 0x42, 0x44, 0x05, 0x57, 0x11,
+    0x16, 0x08, 0x15, 0x85, 0x74, 0x61, 0x75, 0x72, 0x61, 0x6E, 0x74, 0x00, 0x16, 0x08, 0x15, 0x84,
+    0x61, 0x75, 0x72, 0x61, 0x6E, 0x74, 0x00, 0x08, 0x0F, 0x13, 0x83, 0x61, 0x73, 0x61, 0x6E, 0x74,
+    0x00, 0x44, 0x48, 0x09, 0x4C, 0x11, 0x55, 0x1C, 0x56, 0x24, 0x13, 0x42, 0x88, 0xE0, 0x05, 0x90,
+    0x3A, 0x00, 0x0F, 0x0F, 0x0C, 0x10, 0x85, 0x69, 0x74, 0x61, 0x6E, 0x74, 0x00, 0x08, 0x19, 0x07,
+    0x04, 0x11, 0x0C, 0x01, 0x24, 0x0C, 0x42, 0x56, 0x05, 0x5B, 0x17, 0x43, 0x48, 0x07, 0x51, 0x1A,
+    0x55, 0x0E, 0x0B, 0x84, 0x74, 0x61, 0x6E, 0x74, 0x00, 0x08, 0x13, 0x01, 0x0C, 0x08, 0x01, 0x09,
+    0x17, 0x0C, 0x17, 0x16, 0x11, 0x12, 0x06, 0x82, 0x65, 0x6E, 0x74, 0x00, 0x42, 0x52, 0x05, 0x58,
+    0x0E, 0x05, 0x84, 0x75, 0x6F, 0x79, 0x61, 0x6E, 0x74, 0x00, 0x12, 0x05, 0x85, 0x75, 0x6F, 0x79,
+    0x61, 0x6E, 0x74, 0x00, 0x0F, 0x18, 0x12, 0x0B, 0x16, 0x02, 0x2C, 0x06, 0x4D, 0x86, 0x28, 0x00,
+    0x87, 0xA9, 0x00, 0x8A, 0x04, 0x01, 0x8C, 0x42, 0x01, 0x8F, 0x9E, 0x01, 0x90, 0xF4, 0x01, 0x91,
+    0xCC, 0x04, 0x95, 0x2E, 0x05, 0x96, 0x6A, 0x05, 0x97, 0x70, 0x05, 0x98, 0xC2, 0x05, 0x99, 0xCF,
+    0x05, 0x9D, 0xD5, 0x05, 0x43, 0x48, 0x07, 0x4C, 0x12, 0x56, 0x37, 0x0F, 0x12, 0x07, 0x04, 0x83,
+    0x73, 0x63, 0x65, 0x6E, 0x74, 0x00, 0x43, 0x49, 0x07, 0x51, 0x14, 0x56, 0x22, 0x09, 0x42, 0x48,
+    0x06, 0x58, 0x05, 0x16, 0x82, 0x69, 0x65, 0x6E, 0x74, 0x00, 0x08, 0x10, 0x08, 0x15, 0x86, 0x69,
+    0x6E, 0x69, 0x73, 0x63, 0x65, 0x6E, 0x74, 0x00, 0x11, 0x01, 0x0C, 0x42, 0x48, 0x05, 0x51, 0x36,
+    0x42, 0x51, 0x05, 0x55, 0x11, 0x0C, 0x10, 0x08, 0x15, 0x85, 0x69, 0x73, 0x63, 0x65, 0x6E, 0x74,
+    0x00, 0x42, 0x52, 0x05, 0x58, 0x12, 0x0F, 0x09, 0x87, 0x75, 0x6F, 0x72, 0x65, 0x73, 0x63, 0x65,
+    0x6E, 0x74, 0x00, 0x12, 0x0F, 0x09, 0x88, 0x75, 0x6F, 0x72, 0x65, 0x73, 0x63, 0x65, 0x6E, 0x74,
+    0x00, 0x42, 0x4C, 0x05, 0x52, 0x10, 0x10, 0x08, 0x15, 0x84, 0x69, 0x73, 0x63, 0x65, 0x6E, 0x74,
+    0x00, 0x06, 0x02, 0x02, 0x05, 0x42, 0x51, 0x05, 0x58, 0x52, 0x08, 0x44, 0x46, 0x09, 0x49, 0x26,
+    0x53, 0x2A, 0x57, 0x48, 0x42, 0x48, 0x05, 0x51, 0x10, 0x07, 0x86, 0x73, 0x63, 0x65, 0x6E, 0x64,
+    0x61, 0x6E, 0x74, 0x00, 0x04, 0x15, 0x17, 0x86, 0x73, 0x63, 0x65, 0x6E, 0x64, 0x65, 0x6E, 0x74,
+    0x00, 0x08, 0x02, 0x38, 0x04, 0x42, 0x47, 0x05, 0x4C, 0x11, 0x11, 0x0C, 0x86, 0x65, 0x70, 0x65,
+    0x6E, 0x64, 0x65, 0x6E, 0x74, 0x00, 0x07, 0x11, 0x0C, 0x87, 0x65, 0x70, 0x65, 0x6E, 0x64, 0x65,
+    0x6E, 0x74, 0x00, 0x17, 0x02, 0x74, 0x05, 0x16, 0x84, 0x74, 0x75, 0x64, 0x65, 0x6E, 0x74, 0x00,
+    0x45, 0x44, 0x0B, 0x4C, 0x14, 0x51, 0x21, 0x52, 0x2D, 0x55, 0x37, 0x19, 0x04, 0x15, 0x17, 0x1B,
+    0x08, 0x02, 0x58, 0x05, 0x0F, 0x08, 0x17, 0x11, 0x0C, 0x84, 0x6C, 0x69, 0x67, 0x65, 0x6E, 0x74,
+    0x00, 0x0C, 0x17, 0x16, 0x85, 0x72, 0x69, 0x6E, 0x67, 0x65, 0x6E, 0x74, 0x00, 0x15, 0x04, 0x84,
+    0x72, 0x6F, 0x67, 0x61, 0x6E, 0x74, 0x00, 0x08, 0x16, 0x81, 0x61, 0x6E, 0x74, 0x00, 0x46, 0x86,
+    0x13, 0x00, 0x87, 0x2C, 0x00, 0x8F, 0x8F, 0x04, 0x91, 0x3D, 0x00, 0x93, 0x4B, 0x00, 0x95, 0x57,
+    0x00, 0x42, 0x48, 0x05, 0x4C, 0x10, 0x09, 0x09, 0x08, 0x85, 0x69, 0x63, 0x69, 0x65, 0x6E, 0x74,
+    0x00, 0x09, 0x0C, 0x11, 0x0A, 0x04, 0x10, 0x02, 0x3D, 0x04, 0x08, 0x05, 0x12, 0x16, 0x16, 0x0C,
+    0x07, 0x88, 0x6F, 0x62, 0x65, 0x64, 0x69, 0x65, 0x6E, 0x74, 0x00, 0x08, 0x0C, 0x19, 0x11, 0x12,
+    0x06, 0x86, 0x65, 0x6E, 0x69, 0x65, 0x6E, 0x74, 0x00, 0x08, 0x06, 0x08, 0x15, 0x85, 0x69, 0x70,
+    0x69, 0x65, 0x6E, 0x74, 0x00, 0x04, 0x19, 0x02, 0xD2, 0x04, 0x44, 0x44, 0x09, 0x48, 0x25, 0x4C,
+    0x3E, 0x4F, 0x4A, 0x42, 0x4C, 0x05, 0x4F, 0x10, 0x18, 0x14, 0x08, 0x84, 0x76, 0x61, 0x6C, 0x65,
+    0x6E, 0x74, 0x00, 0x19, 0x0C, 0x18, 0x14, 0x08, 0x85, 0x61, 0x6C, 0x65, 0x6E, 0x74, 0x00, 0x43,
+    0x46, 0x07, 0x59, 0x1A, 0x5B, 0x0F, 0x1B, 0x08, 0x82, 0x6C, 0x65, 0x6E, 0x74, 0x00, 0x08, 0x84,
+    0x63, 0x65, 0x6C, 0x6C, 0x65, 0x6E, 0x74, 0x00, 0x19, 0x0C, 0x18, 0x14, 0x08, 0x84, 0x61, 0x6C,
+    0x65, 0x6E, 0x74, 0x00, 0x08, 0x1B, 0x08, 0x85, 0x63, 0x65, 0x6C, 0x6C, 0x65, 0x6E, 0x74, 0x00,
+    0x4F, 0x84, 0x2E, 0x00, 0x87, 0x39, 0x00, 0x88, 0x48, 0x00, 0x8A, 0x1A, 0x01, 0x8B, 0x37, 0x01,
+    0x8C, 0x48, 0x01, 0x8F, 0x5B, 0x01, 0x91, 0x69, 0x01, 0x92, 0xBE, 0x01, 0x93, 0xC5, 0x01, 0x95,
+    0xEE, 0x01, 0x96, 0x5B, 0x02, 0x97, 0x71, 0x02, 0x98, 0x91, 0x02, 0x99, 0xAD, 0x02, 0x0C, 0x0F,
+    0x0C, 0x09, 0x85, 0x61, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x11, 0x08, 0x10, 0x07, 0x04, 0x88, 0x6D,
+    0x65, 0x6E, 0x64, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x4A, 0x46, 0x15, 0x47, 0x4C, 0x48, 0x55, 0x4A,
+    0x7D, 0x4F, 0x9D, 0x51, 0xAA, 0x56, 0xB2, 0x57, 0xBA, 0x58, 0xC2, 0x59, 0xC8, 0x42, 0x44, 0x05,
+    0x51, 0x14, 0x13, 0x0F, 0x08, 0x15, 0x88, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x6D, 0x65, 0x6E, 0x74,
+    0x00, 0x42, 0x44, 0x05, 0x58, 0x14, 0x0B, 0x06, 0x11, 0x08, 0x89, 0x68, 0x61, 0x6E, 0x63, 0x65,
+    0x6D, 0x65, 0x6E, 0x74, 0x00, 0x12, 0x11, 0x04, 0x88, 0x6E, 0x6F, 0x75, 0x6E, 0x63, 0x65, 0x6D,
+    0x65, 0x6E, 0x74, 0x00, 0x15, 0x04, 0x05, 0x10, 0x12, 0x05, 0x02, 0xF1, 0x01, 0x42, 0x48, 0x05,
+    0x55, 0x09, 0x15, 0x0A, 0x01, 0x68, 0x0A, 0x42, 0x44, 0x05, 0x4A, 0x14, 0x16, 0x16, 0x0C, 0x07,
+    0x89, 0x61, 0x67, 0x72, 0x65, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x04, 0x87, 0x72, 0x65, 0x65,
+    0x6D, 0x65, 0x6E, 0x74, 0x00, 0x42, 0x4C, 0x05, 0x51, 0x12, 0x15, 0x09, 0x11, 0x0C, 0x85, 0x6E,
+    0x67, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x04, 0x15, 0x04, 0x87, 0x72, 0x61, 0x6E, 0x67, 0x65,
+    0x6D, 0x65, 0x6E, 0x74, 0x00, 0x08, 0x17, 0x17, 0x08, 0x16, 0x86, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
+    0x74, 0x00, 0x0A, 0x0C, 0x16, 0x08, 0x15, 0x02, 0x94, 0x01, 0x16, 0x04, 0x15, 0x04, 0x0B, 0x02,
+    0x8C, 0x01, 0x06, 0x0C, 0x07, 0x11, 0x0C, 0x02, 0x84, 0x01, 0x0A, 0x15, 0x04, 0x02, 0x7E, 0x01,
+    0x12, 0x0A, 0x83, 0x72, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x43, 0x44, 0x07, 0x51, 0x10, 0x55,
+    0x16, 0x42, 0x4A, 0x11, 0x51, 0x05, 0x04, 0x02, 0xA9, 0x01, 0x04, 0x15, 0x15, 0x02, 0x8C, 0x01,
+    0x04, 0x0F, 0x11, 0x08, 0x02, 0x9D, 0x01, 0x16, 0x18, 0x14, 0x11, 0x0C, 0x0F, 0x08, 0x15, 0x85,
+    0x69, 0x73, 0x68, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x0F, 0x42, 0x53, 0x05, 0x55, 0x0E, 0x10, 0x0C,
+    0x84, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x04, 0x13, 0x01, 0xC4, 0x42, 0x48, 0x05, 0x57, 0x09,
+    0x0B, 0x02, 0x0D, 0x04, 0x17, 0x08, 0x02, 0x13, 0x01, 0x44, 0x48, 0x09, 0x4C, 0x14, 0x52, 0x25,
+    0x55, 0x38, 0x19, 0x12, 0x0A, 0x84, 0x72, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x17, 0x04, 0x15,
+    0x08, 0x17, 0x11, 0x08, 0x87, 0x74, 0x61, 0x69, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x16, 0x0C,
+    0x15, 0x13, 0x11, 0x0C, 0x8A, 0x6D, 0x70, 0x72, 0x69, 0x73, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74,
+    0x00, 0x12, 0x42, 0x4C, 0x05, 0x59, 0x11, 0x19, 0x11, 0x08, 0x86, 0x72, 0x6F, 0x6E, 0x6D, 0x65,
+    0x6E, 0x74, 0x00, 0x12, 0x0A, 0x86, 0x65, 0x72, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x15, 0x0C,
+    0x19, 0x11, 0x08, 0x01, 0x63, 0x43, 0x4F, 0x07, 0x52, 0x13, 0x53, 0x23, 0x08, 0x19, 0x08, 0x07,
+    0x84, 0x6F, 0x70, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x19, 0x08, 0x0F, 0x08, 0x07, 0x88, 0x76, 0x65,
+    0x6C, 0x6F, 0x70, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x0C, 0x18, 0x14, 0x08, 0x01, 0x9F, 0x45, 0x44,
+    0x0B, 0x48, 0x27, 0x4C, 0x3F, 0x51, 0x45, 0x52, 0x51, 0x42, 0x45, 0x05, 0x53, 0x0F, 0x10, 0x12,
+    0x05, 0x83, 0x64, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x42, 0x44, 0x06, 0x48, 0x05, 0x07, 0x83, 0x74,
+    0x6D, 0x65, 0x6E, 0x74, 0x00, 0x42, 0x53, 0x05, 0x59, 0x0F, 0x10, 0x08, 0x17, 0x83, 0x61, 0x6D,
+    0x65, 0x6E, 0x74, 0x00, 0x12, 0x0A, 0x83, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x18, 0x14, 0x08,
+    0x15, 0x01, 0xA0, 0x08, 0x19, 0x12, 0x0A, 0x85, 0x72, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x42,
+    0x4C, 0x05, 0x59, 0x11, 0x19, 0x11, 0x08, 0x85, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x00,
+    0x12, 0x0A, 0x85, 0x65, 0x72, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x42, 0x44, 0x05, 0x4C, 0x0F,
+    0x15, 0x04, 0x0B, 0x83, 0x73, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x17, 0x15, 0x08, 0x19, 0x07, 0x01,
+    0x4A, 0x43, 0x44, 0x07, 0x51, 0x0B, 0x57, 0x15, 0x17, 0x16, 0x01, 0x57, 0x08, 0x17, 0x11, 0x12,
+    0x06, 0x16, 0x0C, 0x07, 0x83, 0x00, 0x0C, 0x10, 0x10, 0x12, 0x06, 0x84, 0x6D, 0x65, 0x6E, 0x74,
+    0x00, 0x42, 0x46, 0x05, 0x55, 0x0F, 0x06, 0x12, 0x07, 0x85, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x00,
+    0x17, 0x11, 0x0C, 0x86, 0x73, 0x74, 0x72, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x44, 0x48, 0x09,
+    0x4C, 0x0F, 0x4F, 0x1D, 0x52, 0x23, 0x0C, 0x0B, 0x06, 0x04, 0x01, 0x17, 0x08, 0x0B, 0x06, 0x04,
+    0x86, 0x69, 0x65, 0x76, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x12, 0x19, 0x11, 0x0C, 0x01, 0x03,
+    0x10, 0x83, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x43, 0x44, 0x07, 0x4C, 0x12, 0x52, 0x46, 0x10,
+    0x0C, 0x86, 0x65, 0x6D, 0x69, 0x6E, 0x65, 0x6E, 0x74, 0x00, 0x42, 0x48, 0x05, 0x50, 0x10, 0x19,
+    0x11, 0x12, 0x06, 0x84, 0x6E, 0x69, 0x65, 0x6E, 0x74, 0x00, 0x44, 0x48, 0x09, 0x4C, 0x10, 0x50,
+    0x18, 0x52, 0x20, 0x15, 0x84, 0x6E, 0x61, 0x6E, 0x74, 0x00, 0x84, 0x6D, 0x69, 0x6E, 0x65, 0x6E,
+    0x74, 0x00, 0x08, 0x85, 0x69, 0x6E, 0x65, 0x6E, 0x74, 0x00, 0x07, 0x02, 0x5E, 0x01, 0x43, 0x51,
+    0x07, 0x53, 0x10, 0x56, 0x19, 0x12, 0x13, 0x13, 0x12, 0x84, 0x65, 0x6E, 0x74, 0x00, 0x12, 0x84,
+    0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x00, 0x11, 0x01, 0xAC, 0x44, 0x44, 0x09, 0x48, 0x13, 0x49,
+    0x1E, 0x55, 0x28, 0x13, 0x04, 0x84, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x00, 0x09, 0x0C, 0x07,
+    0x84, 0x66, 0x65, 0x72, 0x65, 0x6E, 0x74, 0x00, 0x09, 0x0C, 0x07, 0x83, 0x65, 0x72, 0x65, 0x6E,
+    0x74, 0x00, 0x42, 0x44, 0x05, 0x48, 0x09, 0x1A, 0x02, 0x11, 0x01, 0x09, 0x0C, 0x07, 0x85, 0x66,
+    0x65, 0x72, 0x65, 0x6E, 0x74, 0x00, 0x04, 0x08, 0x0F, 0x13, 0x01, 0xFF, 0x44, 0x48, 0x09, 0x4C,
+    0x26, 0x51, 0x3D, 0x56, 0x41, 0x42, 0x53, 0x05, 0x57, 0x10, 0x08, 0x15, 0x11, 0x18, 0x83, 0x6E,
+    0x74, 0x61, 0x6E, 0x74, 0x00, 0x13, 0x10, 0x12, 0x06, 0x11, 0x0C, 0x85, 0x65, 0x74, 0x65, 0x6E,
+    0x74, 0x00, 0x42, 0x53, 0x05, 0x55, 0x0F, 0x10, 0x12, 0x06, 0x84, 0x65, 0x74, 0x65, 0x6E, 0x74,
+    0x00, 0x17, 0x18, 0x11, 0x83, 0x65, 0x6E, 0x74, 0x00, 0x08, 0x13, 0x01, 0x22, 0x0C, 0x42, 0x55,
+    0x05, 0x56, 0x1F, 0x08, 0x13, 0x85, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x74, 0x00, 0x14, 0x16,
+    0x05, 0x18, 0x16, 0x84, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x74, 0x00, 0x08, 0x0F, 0x08, 0x15, 0x01,
+    0x9A, 0x0C, 0x11, 0x0A, 0x12, 0x06, 0x01, 0x93, 0x42, 0x52, 0x05, 0x57, 0x0E, 0x11, 0x11, 0x04,
+    0x84, 0x6F, 0x69, 0x6E, 0x74, 0x00, 0x1B, 0x08, 0x80, 0x63, 0x74, 0x00, 0x08, 0x42, 0x48, 0x05,
+    0x56, 0x0A, 0x15, 0x0A, 0x04, 0x01, 0x1F, 0x18, 0x10, 0x08, 0x05, 0x01, 0x19, 0x10, 0x04, 0x0A,
+    0x15, 0x08, 0x05, 0x02, 0x5B, 0x01, 0x42, 0x44, 0x05, 0x48, 0x0A, 0x08, 0x80, 0x65, 0x64, 0x00,
+    0x09, 0x09, 0x0C, 0x07, 0x81, 0x65, 0x6E, 0x74, 0x00, 0x43, 0x44, 0x07, 0x48, 0x0A, 0x4C, 0x10,
+    0x1A, 0x01, 0x04, 0x12, 0x07, 0x80, 0x27, 0x74, 0x00, 0x04, 0x0A, 0x04, 0x82, 0x6E, 0x73, 0x74,
+    0x00, 0x43, 0x44, 0x07, 0x47, 0x34, 0x52, 0x3D, 0x15, 0x43, 0x44, 0x07, 0x48, 0x12, 0x58, 0x15,
+    0x17, 0x16, 0x08, 0x15, 0x84, 0x75, 0x72, 0x61, 0x6E, 0x74, 0x00, 0x17, 0x01, 0x0E, 0x42, 0x44,
+    0x05, 0x57, 0x0C, 0x17, 0x16, 0x08, 0x15, 0x02, 0x56, 0x1D, 0x16, 0x08, 0x15, 0x85, 0x61, 0x75,
+    0x72, 0x61, 0x6E, 0x74, 0x00, 0x11, 0x18, 0x05, 0x04, 0x82, 0x61, 0x6E, 0x74, 0x00, 0x10, 0x10,
+    0x04, 0x84, 0x6F, 0x75, 0x6E, 0x74, 0x00, 0x43, 0x4C, 0x07, 0x51, 0x12, 0x56, 0x19, 0x15, 0x17,
+    0x04, 0x13, 0x1B, 0x08, 0x81, 0x61, 0x74, 0x65, 0x00, 0x11, 0x11, 0x04, 0x06, 0x02, 0x68, 0x1D,
+    0x42, 0x4F, 0x05, 0x50, 0x09, 0x04, 0x02, 0xF8, 0x02, 0x0F, 0x04, 0x82, 0x6F, 0x73, 0x74, 0x00,
+    0x45, 0x48, 0x0B, 0x50, 0x2B, 0x52, 0x34, 0x55, 0x3C, 0x58, 0x52, 0x43, 0x4C, 0x07, 0x56, 0x10,
+    0x5B, 0x19, 0x06, 0x08, 0x15, 0x83, 0x65, 0x69, 0x70, 0x74, 0x00, 0x11, 0x12, 0x06, 0x83, 0x63,
+    0x65, 0x70, 0x74, 0x00, 0x08, 0x82, 0x63, 0x65, 0x70, 0x74, 0x00, 0x04, 0x1B, 0x08, 0x83, 0x65,
+    0x6D, 0x70, 0x74, 0x00, 0x07, 0x07, 0x04, 0x83, 0x6F, 0x70, 0x74, 0x00, 0x42, 0x48, 0x05, 0x4C,
+    0x0E, 0x1B, 0x08, 0x83, 0x63, 0x65, 0x72, 0x70, 0x74, 0x00, 0x06, 0x16, 0x83, 0x72, 0x69, 0x70,
+    0x74, 0x00, 0x15, 0x08, 0x17, 0x11, 0x0C, 0x82, 0x72, 0x75, 0x70, 0x74, 0x00, 0x42, 0x44, 0x05,
+    0x52, 0x0D, 0x13, 0x13, 0x04, 0x83, 0x61, 0x72, 0x74, 0x00, 0x42, 0x49, 0x05, 0x53, 0x0A, 0x09,
+    0x04, 0x02, 0x32, 0x1C, 0x42, 0x4C, 0x05, 0x53, 0x0D, 0x04, 0x83, 0x72, 0x70, 0x6F, 0x72, 0x74,
+    0x00, 0x18, 0x1A, 0x86, 0x73, 0x75, 0x70, 0x70, 0x6F, 0x72, 0x74, 0x00, 0x4A, 0x84, 0x1F, 0x00,
+    0x88, 0x35, 0x00, 0x8A, 0x66, 0x00, 0x8C, 0x80, 0x00, 0x90, 0x8A, 0x01, 0x91, 0x93, 0x01, 0x92,
+    0xA9, 0x01, 0x98, 0xBF, 0x01, 0x9A, 0xC5, 0x01, 0x9C, 0xD1, 0x01, 0x42, 0x46, 0x05, 0x4B, 0x12,
+    0x07, 0x04, 0x15, 0x05, 0x85, 0x6F, 0x61, 0x64, 0x63, 0x61, 0x73, 0x74, 0x00, 0x17, 0x81, 0x74,
+    0x00, 0x43, 0x4A, 0x07, 0x4C, 0x0F, 0x55, 0x27, 0x0C, 0x0B, 0x82, 0x68, 0x65, 0x73, 0x74, 0x00,
+    0x42, 0x4B, 0x05, 0x59, 0x0D, 0x17, 0x04, 0x83, 0x65, 0x69, 0x73, 0x74, 0x00, 0x04, 0x0B, 0x85,
+    0x65, 0x61, 0x76, 0x69, 0x65, 0x73, 0x74, 0x00, 0x17, 0x11, 0x0C, 0x83, 0x65, 0x72, 0x65, 0x73,
+    0x74, 0x00, 0x42, 0x48, 0x05, 0x55, 0x13, 0x11, 0x15, 0x12, 0x17, 0x16, 0x86, 0x72, 0x6F, 0x6E,
+    0x67, 0x65, 0x73, 0x74, 0x00, 0x04, 0x0F, 0x81, 0x65, 0x73, 0x74, 0x00, 0x48, 0x46, 0x11, 0x47,
+    0x1A, 0x4A, 0x23, 0x50, 0x8B, 0x51, 0xA8, 0x52, 0xD6, 0x55, 0xE0, 0x57, 0xEE, 0x04, 0x09, 0x83,
+    0x73, 0x63, 0x69, 0x73, 0x74, 0x00, 0x07, 0x18, 0x05, 0x82, 0x68, 0x69, 0x73, 0x74, 0x00, 0x42,
+    0x4F, 0x05, 0x52, 0x14, 0x12, 0x13, 0x12, 0x15, 0x0B, 0x17, 0x11, 0x04, 0x83, 0x6F, 0x67, 0x69,
+    0x73, 0x74, 0x00, 0x0F, 0x12, 0x43, 0x44, 0x07, 0x50, 0x17, 0x55, 0x43, 0x08, 0x0B, 0x06, 0x15,
+    0x04, 0x88, 0x61, 0x65, 0x6F, 0x6C, 0x6F, 0x67, 0x69, 0x73, 0x74, 0x00, 0x42, 0x44, 0x05, 0x4F,
+    0x18, 0x0B, 0x17, 0x13, 0x12, 0x8A, 0x68, 0x74, 0x68, 0x61, 0x6C, 0x6D, 0x6F, 0x6C, 0x6F, 0x67,
+    0x69, 0x73, 0x74, 0x00, 0x04, 0x0B, 0x17, 0x13, 0x12, 0x8B, 0x68, 0x74, 0x68, 0x61, 0x6C, 0x6D,
+    0x6F, 0x6C, 0x6F, 0x67, 0x69, 0x73, 0x74, 0x00, 0x08, 0x17, 0x08, 0x10, 0x87, 0x6F, 0x72, 0x6F,
+    0x6C, 0x6F, 0x67, 0x69, 0x73, 0x74, 0x00, 0x42, 0x52, 0x05, 0x55, 0x11, 0x15, 0x09, 0x08, 0x15,
+    0x85, 0x6F, 0x72, 0x6D, 0x69, 0x73, 0x74, 0x00, 0x08, 0x17, 0x1B, 0x08, 0x85, 0x72, 0x65, 0x6D,
+    0x69, 0x73, 0x74, 0x00, 0x42, 0x44, 0x05, 0x5C, 0x1E, 0x0A, 0x42, 0x44, 0x05, 0x52, 0x0B, 0x83,
+    0x69, 0x6E, 0x73, 0x74, 0x00, 0x17, 0x12, 0x15, 0x13, 0x86, 0x61, 0x67, 0x6F, 0x6E, 0x69, 0x73,
+    0x74, 0x00, 0x0A, 0x12, 0x16, 0x1C, 0x10, 0x88, 0x69, 0x73, 0x6F, 0x67, 0x79, 0x6E, 0x69, 0x73,
+    0x74, 0x00, 0x15, 0x15, 0x08, 0x17, 0x82, 0x72, 0x69, 0x73, 0x74, 0x00, 0x12, 0x17, 0x0C, 0x15,
+    0x15, 0x08, 0x17, 0x86, 0x6F, 0x72, 0x69, 0x73, 0x74, 0x00, 0x42, 0x44, 0x05, 0x46, 0x13, 0x15,
+    0x08, 0x13, 0x08, 0x16, 0x86, 0x61, 0x72, 0x61, 0x74, 0x69, 0x73, 0x74, 0x00, 0x0C, 0x15, 0x17,
+    0x16, 0x82, 0x65, 0x73, 0x74, 0x00, 0x12, 0x0F, 0x04, 0x83, 0x6D, 0x6F, 0x73, 0x74, 0x00, 0x42,
+    0x4C, 0x05, 0x51, 0x0E, 0x0A, 0x04, 0x83, 0x61, 0x69, 0x6E, 0x73, 0x74, 0x00, 0x0C, 0x04, 0x0A,
+    0x04, 0x82, 0x73, 0x74, 0x00, 0x42, 0x44, 0x05, 0x50, 0x0C, 0x06, 0x83, 0x6F, 0x61, 0x73, 0x74,
+    0x00, 0x15, 0x12, 0x09, 0x83, 0x65, 0x6D, 0x6F, 0x73, 0x74, 0x00, 0x12, 0x10, 0x04, 0x09, 0x01,
+    0x9F, 0x12, 0x11, 0x0E, 0x08, 0x05, 0x11, 0x18, 0x81, 0x6E, 0x73, 0x74, 0x00, 0x0B, 0x17, 0x15,
+    0x04, 0x06, 0x06, 0x10, 0x81, 0x69, 0x73, 0x74, 0x00, 0x43, 0x44, 0x07, 0x46, 0x0A, 0x52, 0x11,
+    0x12, 0x01, 0x10, 0x15, 0x0C, 0x06, 0x80, 0x69, 0x74, 0x00, 0x43, 0x44, 0x07, 0x4A, 0x0F, 0x4B,
+    0x1A, 0x05, 0x84, 0x61, 0x62, 0x6F, 0x75, 0x74, 0x00, 0x18, 0x12, 0x15, 0x0B, 0x17, 0x82, 0x68,
+    0x6F, 0x75, 0x74, 0x00, 0x0A, 0x18, 0x12, 0x0B, 0x17, 0x86, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x6F,
+    0x75, 0x74, 0x00, 0x11, 0x08, 0x16, 0x12, 0x07, 0x84, 0x65, 0x73, 0x6E, 0x27, 0x74, 0x00, 0x44,
+    0x44, 0x09, 0x48, 0x1F, 0x53, 0x32, 0x5C, 0x39, 0x08, 0x42, 0x4F, 0x05, 0x59, 0x0C, 0x0C, 0x10,
+    0x82, 0x69, 0x65, 0x75, 0x00, 0x12, 0x11, 0x83, 0x75, 0x76, 0x65, 0x61, 0x75, 0x00, 0x42, 0x4F,
+    0x05, 0x57, 0x0C, 0x0C, 0x10, 0x81, 0x69, 0x65, 0x75, 0x00, 0x04, 0x0F, 0x13, 0x80, 0x61, 0x75,
+    0x00, 0x12, 0x15, 0x0A, 0x81, 0x75, 0x70, 0x00, 0x0F, 0x0E, 0x06, 0x0C, 0x18, 0x14, 0x80, 0x00,
+    0x42, 0x4F, 0x05, 0x52, 0x0D, 0x08, 0x16, 0x10, 0x0C, 0x0B, 0x02, 0xE6, 0x18, 0x11, 0x18, 0x12,
+    0x07, 0x12, 0x0A, 0x84, 0x75, 0x6E, 0x6F, 0x76, 0x00, 0x43, 0x44, 0x07, 0x4C, 0x11, 0x52, 0x1A,
+    0x16, 0x15, 0x12, 0x09, 0x82, 0x65, 0x73, 0x61, 0x77, 0x00, 0x08, 0x19, 0x08, 0x15, 0x82, 0x69,
+    0x65, 0x77, 0x00, 0x42, 0x47, 0x05, 0x55, 0x0C, 0x07, 0x04, 0x0B, 0x16, 0x02, 0x42, 0x1A, 0x42,
+    0x52, 0x05, 0x55, 0x10, 0x10, 0x10, 0x12, 0x17, 0x84, 0x6F, 0x72, 0x72, 0x6F, 0x77, 0x00, 0x12,
+    0x10, 0x10, 0x12, 0x17, 0x85, 0x6F, 0x72, 0x72, 0x6F, 0x77, 0x00, 0x42, 0x48, 0x05, 0x58, 0x0F,
+    0x11, 0x08, 0x0F, 0x0E, 0x82, 0x65, 0x6E, 0x65, 0x78, 0x00, 0x08, 0x0C, 0x0F, 0x08, 0x10, 0x85,
+    0x69, 0x6C, 0x69, 0x65, 0x75, 0x78, 0x00, 0x53, 0x84, 0x3A, 0x00, 0x85, 0x97, 0x00, 0x86, 0xAE,
+    0x00, 0x87, 0xCF, 0x01, 0x88, 0x1C, 0x02, 0x89, 0xC5, 0x02, 0x8A, 0xE5, 0x02, 0x8B, 0xC6, 0x03,
+    0x8C, 0x48, 0x04, 0x8F, 0x5F, 0x04, 0x90, 0x7B, 0x0D, 0x91, 0xC0, 0x0D, 0x92, 0x6A, 0x0E, 0x93,
+    0x73, 0x0E, 0x95, 0x98, 0x0E, 0x96, 0xD8, 0x12, 0x97, 0x02, 0x13, 0x98, 0xEA, 0x16, 0x9A, 0xF7,
+    0x16, 0x45, 0x47, 0x0B, 0x55, 0x27, 0x56, 0x3E, 0x57, 0x4B, 0x5A, 0x54, 0x43, 0x4C, 0x07, 0x55,
+    0x11, 0x56, 0x34, 0x0F, 0x0F, 0x12, 0x0B, 0x84, 0x69, 0x64, 0x61, 0x79, 0x00, 0x08, 0x17, 0x04,
+    0x16, 0x84, 0x75, 0x72, 0x64, 0x61, 0x79, 0x00, 0x42, 0x55, 0x05, 0x58, 0x11, 0x04, 0x16, 0x16,
+    0x0C, 0x07, 0x85, 0x61, 0x72, 0x72, 0x61, 0x79, 0x00, 0x11, 0x04, 0x0D, 0x02, 0x88, 0x11, 0x07,
+    0x11, 0x08, 0x1A, 0x84, 0x64, 0x6E, 0x65, 0x73, 0x64, 0x61, 0x79, 0x00, 0x11, 0x08, 0x10, 0x08,
+    0x0F, 0x08, 0x02, 0x22, 0x13, 0x0A, 0x0C, 0x0B, 0x82, 0x68, 0x77, 0x61, 0x79, 0x00, 0x42, 0x52,
+    0x05, 0x55, 0x0F, 0x0B, 0x13, 0x12, 0x11, 0x08, 0x1B, 0x80, 0x69, 0x61, 0x00, 0x08, 0x0B, 0x17,
+    0x81, 0x65, 0x62, 0x79, 0x00, 0x46, 0x84, 0x13, 0x00, 0x8C, 0x7C, 0x00, 0x91, 0x84, 0x00, 0x93,
+    0xEF, 0x00, 0x95, 0xFA, 0x00, 0x97, 0x12, 0x01, 0x44, 0x47, 0x09, 0x4B, 0x12, 0x50, 0x1B, 0x55,
+    0x29, 0x11, 0x08, 0x17, 0x82, 0x65, 0x6E, 0x63, 0x79, 0x00, 0x13, 0x12, 0x15, 0x13, 0x82, 0x65,
+    0x63, 0x79, 0x00, 0x0C, 0x0A, 0x08, 0x0F, 0x0F, 0x0C, 0x83, 0x74, 0x69, 0x6D, 0x61, 0x63, 0x79,
+    0x00, 0x42, 0x46, 0x05, 0x58, 0x36, 0x43, 0x51, 0x07, 0x52, 0x0F, 0x55, 0x26, 0x1C, 0x16, 0x12,
+    0x0C, 0x07, 0x0C, 0x01, 0xC0, 0x42, 0x93, 0xE7, 0x11, 0x95, 0x07, 0x00, 0x18, 0x04, 0x08, 0x05,
+    0x89, 0x75, 0x72, 0x65, 0x61, 0x75, 0x63, 0x72, 0x61, 0x63, 0x79, 0x00, 0x12, 0x10, 0x08, 0x07,
+    0x85, 0x63, 0x72, 0x61, 0x63, 0x79, 0x00, 0x06, 0x04, 0x84, 0x63, 0x75, 0x72, 0x61, 0x63, 0x79,
+    0x00, 0x15, 0x06, 0x12, 0x13, 0x1C, 0x0B, 0x01, 0x8C, 0x42, 0x44, 0x05, 0x48, 0x3B, 0x44, 0x47,
+    0x09, 0x50, 0x18, 0x52, 0x21, 0x5C, 0x2A, 0x11, 0x08, 0x42, 0x53, 0x05, 0x57, 0x07, 0x08, 0x07,
+    0x83, 0x65, 0x6E, 0x63, 0x79, 0x00, 0x12, 0x0F, 0x13, 0x0C, 0x07, 0x82, 0x63, 0x79, 0x00, 0x18,
+    0x05, 0x83, 0x79, 0x61, 0x6E, 0x63, 0x79, 0x00, 0x18, 0x12, 0x05, 0x86, 0x75, 0x6F, 0x79, 0x61,
+    0x6E, 0x63, 0x79, 0x00, 0x43, 0x46, 0x07, 0x4C, 0x12, 0x58, 0x20, 0x0C, 0x09, 0x09, 0x08, 0x83,
+    0x69, 0x65, 0x6E, 0x63, 0x79, 0x00, 0x06, 0x08, 0x09, 0x09, 0x08, 0x86, 0x69, 0x63, 0x69, 0x65,
+    0x6E, 0x63, 0x79, 0x00, 0x17, 0x0C, 0x16, 0x11, 0x12, 0x06, 0x86, 0x74, 0x69, 0x74, 0x75, 0x65,
+    0x6E, 0x63, 0x79, 0x00, 0x18, 0x15, 0x0E, 0x11, 0x04, 0x05, 0x81, 0x74, 0x63, 0x79, 0x00, 0x42,
+    0x44, 0x05, 0x48, 0x0D, 0x15, 0x08, 0x0C, 0x0B, 0x80, 0x68, 0x79, 0x00, 0x19, 0x12, 0x15, 0x17,
+    0x11, 0x12, 0x06, 0x81, 0x73, 0x79, 0x00, 0x13, 0x18, 0x15, 0x11, 0x04, 0x05, 0x85, 0x6B, 0x72,
+    0x75, 0x70, 0x74, 0x63, 0x79, 0x00, 0x45, 0x44, 0x0B, 0x47, 0x2B, 0x48, 0x2F, 0x4C, 0x36, 0x55,
+    0x40, 0x42, 0x48, 0x05, 0x52, 0x1C, 0x15, 0x42, 0x44, 0x05, 0x4F, 0x0D, 0x84, 0x6C, 0x72, 0x65,
+    0x61, 0x64, 0x79, 0x00, 0x0F, 0x04, 0x85, 0x72, 0x65, 0x61, 0x64, 0x79, 0x00, 0x15, 0x02, 0xEC,
+    0x02, 0x18, 0x17, 0x01, 0x62, 0x0A, 0x08, 0x0F, 0x0F, 0x02, 0xA8, 0x03, 0x0A, 0x12, 0x15, 0x13,
+    0x83, 0x64, 0x69, 0x67, 0x79, 0x00, 0x04, 0x13, 0x04, 0x08, 0x0D, 0x85, 0x6F, 0x70, 0x61, 0x72,
+    0x64, 0x79, 0x00, 0x47, 0x4C, 0x0F, 0x4E, 0x16, 0x4F, 0x1C, 0x51, 0x75, 0x55, 0x8D, 0x56, 0x96,
+    0x57, 0xA1, 0x15, 0x04, 0x19, 0x80, 0x74, 0x79, 0x00, 0x0C, 0x0F, 0x11, 0x02, 0x17, 0x0B, 0x47,
+    0x45, 0x0F, 0x51, 0x16, 0x52, 0x19, 0x53, 0x24, 0x55, 0x2A, 0x57, 0x3C, 0x59, 0x52, 0x04, 0x17,
+    0x12, 0x11, 0x02, 0x11, 0x10, 0x12, 0x01, 0x3C, 0x42, 0x8B, 0x07, 0x00, 0x96, 0xA9, 0x14, 0x1A,
+    0x02, 0xD3, 0x13, 0x10, 0x0C, 0x16, 0x02, 0xFD, 0x0F, 0x42, 0x48, 0x05, 0x58, 0x0F, 0x42, 0x46,
+    0x05, 0x59, 0x09, 0x11, 0x0C, 0x01, 0x03, 0x08, 0x16, 0x01, 0x1A, 0x04, 0x42, 0x4C, 0x05, 0x51,
+    0x0C, 0x07, 0x08, 0x10, 0x10, 0x0C, 0x01, 0x0D, 0x18, 0x17, 0x15, 0x12, 0x09, 0x11, 0x18, 0x01,
+    0x04, 0x0C, 0x0F, 0x82, 0x65, 0x6C, 0x79, 0x00, 0x42, 0x55, 0x05, 0x58, 0x10, 0x12, 0x17, 0x04,
+    0x84, 0x74, 0x6F, 0x72, 0x6E, 0x65, 0x79, 0x00, 0x12, 0x0D, 0x82, 0x72, 0x6E, 0x65, 0x79, 0x00,
+    0x04, 0x17, 0x08, 0x10, 0x08, 0x06, 0x02, 0x35, 0x19, 0x15, 0x08, 0x19, 0x12, 0x15, 0x17, 0x11,
+    0x12, 0x02, 0xA1, 0x0F, 0x09, 0x04, 0x16, 0x82, 0x65, 0x74, 0x79, 0x00, 0x0C, 0x43, 0x47, 0x07,
+    0x4F, 0x0F, 0x58, 0x17, 0x04, 0x15, 0x83, 0x74, 0x69, 0x66, 0x79, 0x00, 0x0F, 0x0C, 0x19, 0x83,
+    0x69, 0x66, 0x79, 0x00, 0x14, 0x0C, 0x0F, 0x82, 0x65, 0x66, 0x79, 0x00, 0x44, 0x48, 0x09, 0x4F,
+    0x24, 0x52, 0x3B, 0x55, 0xD4, 0x42, 0x47, 0x05, 0x57, 0x0F, 0x04, 0x15, 0x17, 0x16, 0x83, 0x74,
+    0x65, 0x67, 0x79, 0x00, 0x15, 0x04, 0x17, 0x16, 0x85, 0x72, 0x61, 0x74, 0x65, 0x67, 0x79, 0x00,
+    0x12, 0x42, 0x51, 0x05, 0x53, 0x0B, 0x0B, 0x06, 0x08, 0x17, 0x01, 0x08, 0x12, 0x15, 0x0B, 0x17,
+    0x11, 0x04, 0x81, 0x6F, 0x67, 0x79, 0x00, 0x0F, 0x43, 0x44, 0x07, 0x48, 0x11, 0x52, 0x2E, 0x08,
+    0x07, 0x0C, 0x84, 0x6F, 0x6C, 0x6F, 0x67, 0x79, 0x00, 0x42, 0x44, 0x05, 0x52, 0x10, 0x0B, 0x06,
+    0x15, 0x04, 0x83, 0x6F, 0x6C, 0x6F, 0x67, 0x79, 0x00, 0x04, 0x0B, 0x06, 0x15, 0x04, 0x85, 0x65,
+    0x6F, 0x6C, 0x6F, 0x67, 0x79, 0x00, 0x48, 0x44, 0x11, 0x46, 0x1D, 0x48, 0x28, 0x4C, 0x32, 0x50,
+    0x3A, 0x51, 0x4D, 0x53, 0x54, 0x55, 0x5D, 0x0B, 0x06, 0x15, 0x04, 0x84, 0x65, 0x6F, 0x6C, 0x6F,
+    0x67, 0x79, 0x00, 0x1C, 0x16, 0x13, 0x84, 0x68, 0x6F, 0x6C, 0x6F, 0x67, 0x79, 0x00, 0x11, 0x08,
+    0x0A, 0x84, 0x61, 0x6C, 0x6F, 0x67, 0x79, 0x00, 0x15, 0x17, 0x84, 0x6C, 0x6F, 0x67, 0x79, 0x00,
+    0x0F, 0x04, 0x0B, 0x17, 0x13, 0x12, 0x89, 0x68, 0x74, 0x68, 0x61, 0x6C, 0x6D, 0x6F, 0x6C, 0x6F,
+    0x67, 0x79, 0x00, 0x11, 0x0B, 0x06, 0x08, 0x17, 0x01, 0x04, 0x13, 0x04, 0x85, 0x6F, 0x6C, 0x6F,
+    0x67, 0x79, 0x00, 0x08, 0x17, 0x08, 0x10, 0x85, 0x6F, 0x72, 0x6F, 0x6C, 0x6F, 0x67, 0x79, 0x00,
+    0x18, 0x0F, 0x04, 0x17, 0x08, 0x10, 0x83, 0x6C, 0x75, 0x72, 0x67, 0x79, 0x00, 0x43, 0x46, 0x07,
+    0x53, 0x25, 0x57, 0x6C, 0x42, 0x44, 0x05, 0x55, 0x0F, 0x15, 0x08, 0x0C, 0x0B, 0x82, 0x72, 0x63,
+    0x68, 0x79, 0x00, 0x04, 0x15, 0x0C, 0x08, 0x0B, 0x87, 0x69, 0x65, 0x72, 0x61, 0x72, 0x63, 0x68,
+    0x79, 0x00, 0x43, 0x44, 0x07, 0x52, 0x2E, 0x56, 0x3C, 0x15, 0x0A, 0x42, 0x4C, 0x05, 0x52, 0x12,
+    0x0F, 0x04, 0x06, 0x86, 0x6C, 0x69, 0x67, 0x72, 0x61, 0x70, 0x68, 0x79, 0x00, 0x0C, 0x05, 0x12,
+    0x0B, 0x17, 0x18, 0x04, 0x8A, 0x6F, 0x62, 0x69, 0x6F, 0x67, 0x72, 0x61, 0x70, 0x68, 0x79, 0x00,
+    0x16, 0x0C, 0x0F, 0x0C, 0x0B, 0x13, 0x85, 0x6F, 0x73, 0x6F, 0x70, 0x68, 0x79, 0x00, 0x12, 0x0F,
+    0x0C, 0x0B, 0x13, 0x82, 0x6F, 0x70, 0x68, 0x79, 0x00, 0x42, 0x44, 0x05, 0x4C, 0x0D, 0x08, 0x0B,
+    0x82, 0x6C, 0x74, 0x68, 0x79, 0x00, 0x15, 0x12, 0x0B, 0x17, 0x18, 0x04, 0x02, 0x17, 0x0E, 0x17,
+    0x42, 0x4C, 0x05, 0x56, 0x0D, 0x17, 0x11, 0x04, 0x18, 0x14, 0x02, 0x09, 0x0E, 0x15, 0x08, 0x19,
+    0x0C, 0x11, 0x18, 0x02, 0x65, 0x12, 0x52, 0x84, 0x37, 0x00, 0x85, 0x5A, 0x01, 0x86, 0x15, 0x02,
+    0x87, 0x4B, 0x02, 0x88, 0x90, 0x02, 0x8A, 0xF5, 0x03, 0x8B, 0x3C, 0x04, 0x8C, 0x54, 0x04, 0x8F,
+    0x29, 0x05, 0x90, 0x2C, 0x07, 0x91, 0x4B, 0x07, 0x92, 0x85, 0x07, 0x93, 0x96, 0x07, 0x95, 0x9F,
+    0x07, 0x96, 0xE1, 0x07, 0x97, 0xFD, 0x07, 0x98, 0xEA, 0x08, 0x99, 0xF1, 0x08, 0x4B, 0x45, 0x17,
+    0x46, 0x1F, 0x48, 0x65, 0x4C, 0x69, 0x4F, 0x8D, 0x50, 0x92, 0x51, 0x98, 0x53, 0xBE, 0x55, 0xC7,
+    0x57, 0xEE, 0x58, 0xF6, 0x12, 0x15, 0x13, 0x81, 0x62, 0x6C, 0x79, 0x00, 0x0C, 0x47, 0x4F, 0x0F,
+    0x50, 0x13, 0x51, 0x17, 0x53, 0x1D, 0x55, 0x20, 0x56, 0x28, 0x57, 0x35, 0x05, 0x02, 0x10, 0x02,
+    0x08, 0x0B, 0x01, 0x04, 0x0C, 0x0F, 0x06, 0x02, 0x2A, 0x12, 0x1C, 0x01, 0x7C, 0x17, 0x08, 0x10,
+    0x10, 0x1C, 0x02, 0x1E, 0x12, 0x42, 0x44, 0x05, 0x5C, 0x09, 0x05, 0x02, 0x16, 0x12, 0x0B, 0x02,
+    0x77, 0x0A, 0x42, 0x44, 0x05, 0x46, 0x0B, 0x10, 0x10, 0x04, 0x15, 0x01, 0x74, 0x04, 0x15, 0x02,
+    0x67, 0x0A, 0x15, 0x02, 0xFE, 0x11, 0x42, 0x46, 0x05, 0x57, 0x18, 0x43, 0x48, 0x07, 0x4C, 0x0A,
+    0x51, 0x0E, 0x13, 0x01, 0x14, 0x09, 0x09, 0x01, 0x32, 0x04, 0x11, 0x0C, 0x01, 0x15, 0x42, 0x91,
+    0x07, 0x00, 0x95, 0x47, 0x0A, 0x08, 0x16, 0x16, 0x01, 0x8F, 0x08, 0x15, 0x02, 0xB9, 0x06, 0x15,
+    0x12, 0x09, 0x02, 0xCF, 0x11, 0x43, 0x44, 0x07, 0x4C, 0x0B, 0x52, 0x18, 0x0A, 0x02, 0x57, 0x05,
+    0x42, 0x89, 0xC1, 0x11, 0x8A, 0x07, 0x00, 0x0C, 0x15, 0x12, 0x02, 0xB7, 0x11, 0x0C, 0x17, 0x0C,
+    0x07, 0x42, 0x44, 0x05, 0x47, 0x60, 0x15, 0x17, 0x02, 0xA9, 0x11, 0x0C, 0x06, 0x11, 0x0C, 0x15,
+    0x13, 0x02, 0x29, 0x04, 0x42, 0x48, 0x05, 0x58, 0x21, 0x42, 0x51, 0x05, 0x57, 0x0A, 0x08, 0x0A,
+    0x02, 0x91, 0x11, 0x42, 0x44, 0x05, 0x4C, 0x0E, 0x0F, 0x0C, 0x42, 0x85, 0x87, 0x11, 0x91, 0xD9,
+    0x07, 0x0F, 0x02, 0x7F, 0x11, 0x17, 0x04, 0x11, 0x02, 0x79, 0x11, 0x11, 0x08, 0x07, 0x0C, 0x06,
+    0x06, 0x01, 0x20, 0x44, 0x87, 0x0D, 0x00, 0x91, 0x14, 0x00, 0x96, 0xC0, 0x07, 0x97, 0x17, 0x00,
+    0x0C, 0x19, 0x0C, 0x07, 0x02, 0x11, 0x11, 0x11, 0x01, 0x09, 0x43, 0x46, 0x07, 0x51, 0x0B, 0x55,
+    0x11, 0x04, 0x02, 0x4F, 0x11, 0x08, 0x19, 0x08, 0x02, 0x49, 0x11, 0x0C, 0x19, 0x02, 0x44, 0x11,
+    0x44, 0x44, 0x09, 0x45, 0x77, 0x4C, 0x84, 0x58, 0xB2, 0x46, 0x46, 0x0D, 0x48, 0x13, 0x4A, 0x25,
+    0x55, 0x35, 0x56, 0x41, 0x57, 0x4D, 0x0C, 0x17, 0x12, 0x11, 0x01, 0x1D, 0x42, 0x4E, 0x05, 0x57,
+    0x0E, 0x04, 0x17, 0x16, 0x0C, 0x10, 0x11, 0x18, 0x01, 0x1C, 0x12, 0x11, 0x01, 0x18, 0x11, 0x04,
+    0x0B, 0x06, 0x15, 0x08, 0x17, 0x11, 0x0C, 0x83, 0x65, 0x61, 0x62, 0x6C, 0x79, 0x00, 0x15, 0x08,
+    0x09, 0x08, 0x15, 0x13, 0x84, 0x61, 0x62, 0x6C, 0x79, 0x00, 0x42, 0x4C, 0x05, 0x56, 0x08, 0x19,
+    0x01, 0x21, 0x12, 0x13, 0x01, 0x1D, 0x42, 0x4C, 0x05, 0x56, 0x11, 0x17, 0x0C, 0x19, 0x08, 0x11,
+    0x0C, 0x85, 0x61, 0x62, 0x6C, 0x79, 0x00, 0x0C, 0x16, 0x08, 0x15, 0x42, 0x4C, 0x2F, 0x55, 0x05,
+    0x0C, 0x83, 0x69, 0x62, 0x6C, 0x79, 0x00, 0x04, 0x06, 0x08, 0x13, 0x10, 0x0C, 0x84, 0x63, 0x61,
+    0x62, 0x6C, 0x79, 0x00, 0x42, 0x50, 0x05, 0x57, 0x0C, 0x18, 0x16, 0x08, 0x15, 0x13, 0x01, 0x1E,
+    0x42, 0x56, 0x05, 0x58, 0x16, 0x0C, 0x16, 0x08, 0x15, 0x0C, 0x88, 0x72, 0x65, 0x73, 0x69, 0x73,
+    0x74, 0x69, 0x62, 0x6C, 0x79, 0x00, 0x13, 0x16, 0x0C, 0x07, 0x11, 0x0C, 0x83, 0x61, 0x62, 0x6C,
+    0x79, 0x00, 0x0A, 0x15, 0x04, 0x82, 0x61, 0x62, 0x6C, 0x79, 0x00, 0x42, 0x4C, 0x05, 0x55, 0x30,
+    0x44, 0x51, 0x09, 0x55, 0x0E, 0x56, 0x16, 0x57, 0x1B, 0x12, 0x15, 0x02, 0xA7, 0x06, 0x17, 0x06,
+    0x08, 0x0F, 0x08, 0x02, 0xA0, 0x06, 0x04, 0x05, 0x02, 0x9B, 0x06, 0x42, 0x44, 0x05, 0x46, 0x0C,
+    0x10, 0x12, 0x17, 0x18, 0x02, 0x8B, 0x06, 0x04, 0x02, 0x58, 0x05, 0x08, 0x0C, 0x09, 0x02, 0xCF,
+    0x06, 0x43, 0x44, 0x07, 0x48, 0x24, 0x4F, 0x3D, 0x42, 0x48, 0x05, 0x57, 0x12, 0x17, 0x08, 0x13,
+    0x08, 0x15, 0x85, 0x61, 0x74, 0x65, 0x64, 0x6C, 0x79, 0x00, 0x15, 0x12, 0x13, 0x08, 0x15, 0x83,
+    0x65, 0x64, 0x6C, 0x79, 0x00, 0x42, 0x56, 0x05, 0x57, 0x0C, 0x12, 0x13, 0x15, 0x18, 0x02, 0x01,
+    0x02, 0x12, 0x13, 0x15, 0x18, 0x13, 0x84, 0x72, 0x74, 0x65, 0x64, 0x6C, 0x79, 0x00, 0x08, 0x0C,
+    0x1A, 0x11, 0x18, 0x02, 0x70, 0x0B, 0x4A, 0x85, 0x1F, 0x00, 0x87, 0x28, 0x00, 0x8A, 0x3A, 0x00,
+    0x8E, 0x40, 0x00, 0x8F, 0x4B, 0x00, 0x90, 0x50, 0x00, 0x95, 0x6A, 0x00, 0x97, 0x74, 0x00, 0x98,
+    0x15, 0x01, 0x99, 0x1A, 0x01, 0x04, 0x10, 0x18, 0x16, 0x08, 0x15, 0x02, 0xC4, 0x01, 0x42, 0x48,
+    0x05, 0x4C, 0x0D, 0x0A, 0x08, 0x0F, 0x0F, 0x04, 0x02, 0xE9, 0x11, 0x06, 0x08, 0x07, 0x01, 0xC9,
+    0x08, 0x0F, 0x0F, 0x04, 0x01, 0xC3, 0x0C, 0x15, 0x17, 0x16, 0x82, 0x69, 0x6E, 0x67, 0x6C, 0x79,
+    0x00, 0x0F, 0x04, 0x02, 0x21, 0x08, 0x42, 0x48, 0x05, 0x4C, 0x10, 0x17, 0x1B, 0x08, 0x84, 0x72,
+    0x65, 0x6D, 0x65, 0x6C, 0x79, 0x00, 0x17, 0x0F, 0x18, 0x82, 0x61, 0x74, 0x65, 0x6C, 0x79, 0x00,
+    0x18, 0x17, 0x04, 0x11, 0x82, 0x61, 0x6C, 0x6C, 0x79, 0x00, 0x43, 0x44, 0x07, 0x45, 0x88, 0x4C,
+    0x92, 0x44, 0x47, 0x09, 0x4C, 0x17, 0x50, 0x4B, 0x51, 0x5B, 0x0C, 0x10, 0x10, 0x0C, 0x86, 0x65,
+    0x64, 0x69, 0x61, 0x74, 0x65, 0x6C, 0x79, 0x00, 0x42, 0x47, 0x05, 0x5B, 0x27, 0x42, 0x48, 0x05,
+    0x4C, 0x15, 0x10, 0x10, 0x08, 0x8A, 0x69, 0x6D, 0x6D, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x6C,
+    0x79, 0x00, 0x10, 0x10, 0x0C, 0x87, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x6C, 0x79, 0x00, 0x12,
+    0x15, 0x13, 0x13, 0x04, 0x84, 0x6D, 0x61, 0x74, 0x65, 0x6C, 0x79, 0x00, 0x04, 0x1B, 0x12, 0x15,
+    0x13, 0x13, 0x04, 0x86, 0x69, 0x6D, 0x61, 0x74, 0x65, 0x6C, 0x79, 0x00, 0x18, 0x17, 0x42, 0x48,
+    0x05, 0x55, 0x14, 0x15, 0x12, 0x09, 0x11, 0x18, 0x88, 0x74, 0x75, 0x6E, 0x61, 0x74, 0x65, 0x6C,
+    0x79, 0x00, 0x18, 0x12, 0x09, 0x11, 0x18, 0x89, 0x72, 0x74, 0x75, 0x6E, 0x61, 0x74, 0x65, 0x6C,
+    0x79, 0x00, 0x18, 0x12, 0x07, 0x11, 0x18, 0x81, 0x64, 0x6C, 0x79, 0x00, 0x10, 0x0C, 0x1B, 0x12,
+    0x15, 0x13, 0x13, 0x04, 0x84, 0x61, 0x74, 0x65, 0x6C, 0x79, 0x00, 0x15, 0x17, 0x02, 0x04, 0x11,
+    0x43, 0x44, 0x07, 0x4C, 0x15, 0x57, 0x3C, 0x17, 0x0C, 0x0F, 0x08, 0x15, 0x86, 0x61, 0x74, 0x69,
+    0x76, 0x65, 0x6C, 0x79, 0x00, 0x42, 0x56, 0x05, 0x57, 0x15, 0x11, 0x08, 0x09, 0x09, 0x08, 0x07,
+    0x88, 0x65, 0x6E, 0x73, 0x69, 0x76, 0x65, 0x6C, 0x79, 0x00, 0x06, 0x08, 0x16, 0x13, 0x08, 0x15,
+    0x89, 0x73, 0x70, 0x65, 0x63, 0x74, 0x69, 0x76, 0x65, 0x6C, 0x79, 0x00, 0x0C, 0x0F, 0x04, 0x08,
+    0x15, 0x87, 0x6C, 0x61, 0x74, 0x69, 0x76, 0x65, 0x6C, 0x79, 0x00, 0x42, 0x51, 0x05, 0x58, 0x40,
+    0x42, 0x4C, 0x05, 0x52, 0x34, 0x43, 0x47, 0x07, 0x55, 0x16, 0x56, 0x24, 0x08, 0x08, 0x1B, 0x08,
+    0x87, 0x63, 0x65, 0x65, 0x64, 0x69, 0x6E, 0x67, 0x6C, 0x79, 0x00, 0x04, 0x13, 0x16, 0x0C, 0x07,
+    0x84, 0x61, 0x67, 0x69, 0x6E, 0x67, 0x6C, 0x79, 0x00, 0x12, 0x13, 0x13, 0x18, 0x16, 0x84, 0x65,
+    0x64, 0x6C, 0x79, 0x00, 0x10, 0x10, 0x12, 0x06, 0x02, 0x79, 0x10, 0x12, 0x15, 0x81, 0x68, 0x6C,
+    0x79, 0x00, 0x0A, 0x42, 0x4C, 0x05, 0x58, 0x09, 0x0F, 0x02, 0x98, 0x03, 0x12, 0x15, 0x0B, 0x17,
+    0x86, 0x6F, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x6C, 0x79, 0x00, 0x42, 0x55, 0x05, 0x57, 0xC0, 0x04,
+    0x45, 0x4F, 0x0B, 0x51, 0x28, 0x55, 0x4D, 0x56, 0x6E, 0x57, 0xAE, 0x42, 0x4C, 0x05, 0x58, 0x0B,
+    0x10, 0x0C, 0x16, 0x02, 0x3E, 0x10, 0x42, 0x46, 0x05, 0x4A, 0x0D, 0x0C, 0x17, 0x15, 0x04, 0x13,
+    0x02, 0x31, 0x10, 0x08, 0x15, 0x02, 0x2C, 0x10, 0x0C, 0x07, 0x42, 0x4C, 0x05, 0x55, 0x11, 0x15,
+    0x12, 0x88, 0x64, 0x69, 0x6E, 0x61, 0x72, 0x69, 0x6C, 0x79, 0x00, 0x12, 0x15, 0x17, 0x1B, 0x08,
+    0x89, 0x61, 0x6F, 0x72, 0x64, 0x69, 0x6E, 0x61, 0x72, 0x69, 0x6C, 0x79, 0x00, 0x42, 0x48, 0x05,
+    0x52, 0x12, 0x13, 0x10, 0x08, 0x17, 0x86, 0x6F, 0x72, 0x61, 0x72, 0x69, 0x6C, 0x79, 0x00, 0x10,
+    0x13, 0x08, 0x17, 0x88, 0x6D, 0x70, 0x6F, 0x72, 0x61, 0x72, 0x69, 0x6C, 0x79, 0x00, 0x43, 0x44,
+    0x07, 0x48, 0x16, 0x56, 0x31, 0x16, 0x16, 0x08, 0x11, 0x88, 0x63, 0x65, 0x73, 0x73, 0x61, 0x72,
+    0x69, 0x6C, 0x79, 0x00, 0x06, 0x42, 0x46, 0x05, 0x48, 0x11, 0x08, 0x11, 0x87, 0x65, 0x73, 0x73,
+    0x61, 0x72, 0x69, 0x6C, 0x79, 0x00, 0x11, 0x84, 0x73, 0x61, 0x72, 0x69, 0x6C, 0x79, 0x00, 0x08,
+    0x06, 0x06, 0x08, 0x11, 0x88, 0x65, 0x73, 0x73, 0x61, 0x72, 0x69, 0x6C, 0x79, 0x00, 0x0C, 0x05,
+    0x15, 0x04, 0x84, 0x72, 0x61, 0x72, 0x69, 0x6C, 0x79, 0x00, 0x42, 0x51, 0x05, 0x55, 0x0E, 0x08,
+    0x18, 0x14, 0x08, 0x15, 0x09, 0x02, 0x8C, 0x0F, 0x08, 0x09, 0x80, 0x69, 0x74, 0x79, 0x00, 0x45,
+    0x84, 0x10, 0x00, 0x85, 0xCE, 0x01, 0x88, 0xD6, 0x01, 0x91, 0xEB, 0x01, 0x98, 0xF5, 0x01, 0x47,
+    0x86, 0x16, 0x00, 0x88, 0x78, 0x00, 0x8C, 0x84, 0x00, 0x91, 0xEC, 0x00, 0x96, 0x4B, 0x01, 0x97,
+    0x4E, 0x01, 0x98, 0x8A, 0x01, 0x0C, 0x43, 0x4A, 0x07, 0x4B, 0x17, 0x57, 0x2D, 0x04, 0x17, 0x04,
+    0x15, 0x17, 0x16, 0x87, 0x65, 0x67, 0x69, 0x63, 0x61, 0x6C, 0x6C, 0x79, 0x00, 0x13, 0x12, 0x16,
+    0x12, 0x0F, 0x0F, 0x0C, 0x0B, 0x13, 0x8B, 0x6F, 0x73, 0x6F, 0x70, 0x68, 0x69, 0x63, 0x61, 0x6C,
+    0x6C, 0x79, 0x00, 0x04, 0x10, 0x43, 0x44, 0x07, 0x4B, 0x14, 0x56, 0x23, 0x15, 0x0A, 0x87, 0x6D,
+    0x61, 0x74, 0x69, 0x63, 0x61, 0x6C, 0x6C, 0x79, 0x00, 0x17, 0x04, 0x10, 0x88, 0x65, 0x6D, 0x61,
+    0x74, 0x69, 0x63, 0x61, 0x6C, 0x6C, 0x79, 0x00, 0x1C, 0x16, 0x88, 0x74, 0x65, 0x6D, 0x61, 0x74,
+    0x69, 0x63, 0x61, 0x6C, 0x6C, 0x79, 0x00, 0x15, 0x07, 0x08, 0x09, 0x85, 0x65, 0x72, 0x61, 0x6C,
+    0x6C, 0x79, 0x00, 0x43, 0x46, 0x07, 0x51, 0x36, 0x57, 0x53, 0x42, 0x48, 0x05, 0x49, 0x24, 0x13,
+    0x42, 0x56, 0x05, 0x5B, 0x12, 0x06, 0x08, 0x89, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6C, 0x6C,
+    0x79, 0x00, 0x08, 0x88, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6C, 0x6C, 0x79, 0x00, 0x09, 0x12,
+    0x85, 0x69, 0x63, 0x69, 0x61, 0x6C, 0x6C, 0x79, 0x00, 0x43, 0x48, 0x07, 0x4A, 0x12, 0x4C, 0x54,
+    0x15, 0x08, 0x13, 0x84, 0x6E, 0x69, 0x61, 0x6C, 0x6C, 0x79, 0x00, 0x0C, 0x15, 0x12, 0x85, 0x69,
+    0x6E, 0x61, 0x6C, 0x6C, 0x79, 0x00, 0x11, 0x08, 0x42, 0x47, 0x05, 0x59, 0x0B, 0x0C, 0x06, 0x11,
+    0x0C, 0x01, 0x30, 0x08, 0x84, 0x75, 0x61, 0x6C, 0x6C, 0x79, 0x00, 0x44, 0x4A, 0x09, 0x4C, 0x14,
+    0x51, 0x21, 0x52, 0x2C, 0x0C, 0x15, 0x12, 0x84, 0x69, 0x6E, 0x61, 0x6C, 0x6C, 0x79, 0x00, 0x17,
+    0x0C, 0x07, 0x07, 0x04, 0x84, 0x6F, 0x6E, 0x61, 0x6C, 0x6C, 0x79, 0x00, 0x0C, 0x0A, 0x0C, 0x15,
+    0x12, 0x84, 0x61, 0x6C, 0x6C, 0x79, 0x00, 0x0C, 0x42, 0x47, 0x05, 0x57, 0x12, 0x04, 0x15, 0x17,
+    0x85, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x6C, 0x79, 0x00, 0x42, 0x44, 0x05, 0x47, 0x12, 0x06,
+    0x06, 0x12, 0x87, 0x73, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x6C, 0x79, 0x00, 0x04, 0x15, 0x17, 0x87,
+    0x69, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x6C, 0x79, 0x00, 0x18, 0x01, 0x37, 0x11, 0x08, 0x43,
+    0x47, 0x07, 0x50, 0x22, 0x59, 0x32, 0x42, 0x48, 0x05, 0x4C, 0x15, 0x06, 0x11, 0x0C, 0x12, 0x06,
+    0x88, 0x69, 0x64, 0x65, 0x6E, 0x74, 0x61, 0x6C, 0x6C, 0x79, 0x00, 0x19, 0x08, 0x83, 0x6C, 0x79,
+    0x00, 0x04, 0x15, 0x06, 0x11, 0x0C, 0x88, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x61, 0x6C, 0x6C, 0x79,
+    0x00, 0x08, 0x83, 0x75, 0x61, 0x6C, 0x6C, 0x79, 0x00, 0x43, 0x46, 0xF5, 0x51, 0x07, 0x57, 0x17,
+    0x0C, 0x17, 0x16, 0x11, 0x12, 0x06, 0x88, 0x74, 0x69, 0x6E, 0x75, 0x61, 0x6C, 0x6C, 0x79, 0x00,
+    0x42, 0x4B, 0x05, 0x51, 0x11, 0x11, 0x08, 0x19, 0x08, 0x86, 0x74, 0x75, 0x61, 0x6C, 0x6C, 0x79,
+    0x00, 0x08, 0x18, 0x14, 0x08, 0x16, 0x11, 0x12, 0x06, 0x84, 0x6C, 0x79, 0x00, 0x04, 0x05, 0x12,
+    0x15, 0x13, 0x02, 0x01, 0x07, 0x42, 0x44, 0x05, 0x50, 0x0D, 0x15, 0x84, 0x65, 0x61, 0x6C, 0x6C,
+    0x79, 0x00, 0x15, 0x12, 0x09, 0x82, 0x72, 0x6C, 0x79, 0x00, 0x04, 0x0C, 0x09, 0x84, 0x6E, 0x61,
+    0x6C, 0x6C, 0x79, 0x00, 0x16, 0x16, 0x08, 0x06, 0x06, 0x18, 0x16, 0x83, 0x66, 0x75, 0x6C, 0x6C,
+    0x79, 0x00, 0x42, 0x48, 0x05, 0x52, 0x18, 0x42, 0x50, 0x05, 0x55, 0x0D, 0x08, 0x15, 0x17, 0x1B,
+    0x08, 0x02, 0x70, 0x0D, 0x17, 0x1B, 0x08, 0x02, 0xD6, 0x01, 0x07, 0x0F, 0x08, 0x16, 0x02, 0x3F,
+    0x0F, 0x43, 0x44, 0x07, 0x48, 0x0D, 0x52, 0x26, 0x17, 0x16, 0x11, 0x12, 0x01, 0x13, 0x43, 0x53,
+    0x07, 0x55, 0x0F, 0x57, 0x14, 0x13, 0x12, 0x84, 0x65, 0x6E, 0x6C, 0x79, 0x00, 0x15, 0x18, 0x06,
+    0x01, 0x72, 0x09, 0x12, 0x02, 0x19, 0x0F, 0x42, 0x8F, 0xA6, 0x01, 0x91, 0x07, 0x00, 0x08, 0x10,
+    0x12, 0x11, 0x08, 0x0B, 0x13, 0x83, 0x61, 0x6C, 0x6C, 0x79, 0x00, 0x42, 0x4B, 0x05, 0x50, 0x09,
+    0x1A, 0x02, 0x10, 0x0B, 0x12, 0x11, 0x04, 0x82, 0x61, 0x6C, 0x79, 0x00, 0x0C, 0x06, 0x11, 0x0C,
+    0x15, 0x13, 0x02, 0x31, 0x01, 0x43, 0x44, 0x07, 0x48, 0x29, 0x52, 0x3B, 0x42, 0x50, 0x05, 0x58,
+    0x0D, 0x0C, 0x15, 0x13, 0x81, 0x69, 0x6C, 0x79, 0x00, 0x42, 0x46, 0x05, 0x4A, 0x0C, 0x0C, 0x17,
+    0x15, 0x04, 0x13, 0x01, 0x04, 0x08, 0x15, 0x83, 0x6C, 0x61, 0x72, 0x6C, 0x79, 0x00, 0x42, 0x44,
+    0x05, 0x59, 0x0D, 0x1C, 0x84, 0x65, 0x61, 0x72, 0x6C, 0x79, 0x00, 0x08, 0x16, 0x02, 0x40, 0x01,
+    0x0B, 0x16, 0x81, 0x74, 0x6C, 0x79, 0x00, 0x43, 0x4C, 0x07, 0x51, 0x5D, 0x58, 0x0E, 0x06, 0x08,
+    0x15, 0x13, 0x02, 0x2B, 0x01, 0x12, 0x0A, 0x0C, 0x0F, 0x08, 0x15, 0x84, 0x69, 0x6F, 0x75, 0x73,
+    0x6C, 0x79, 0x00, 0x45, 0x44, 0x0B, 0x46, 0x45, 0x48, 0x60, 0x51, 0x6C, 0x58, 0xE6, 0x43, 0x4C,
+    0x07, 0x51, 0x1D, 0x55, 0x32, 0x07, 0x08, 0x10, 0x42, 0x4C, 0x05, 0x50, 0x10, 0x86, 0x6D, 0x65,
+    0x64, 0x69, 0x61, 0x74, 0x65, 0x6C, 0x79, 0x00, 0x0C, 0x01, 0xF4, 0x43, 0x48, 0x07, 0x4C, 0x3A,
+    0x58, 0x0D, 0x13, 0x82, 0x6C, 0x74, 0x79, 0x00, 0x17, 0x15, 0x12, 0x09, 0x11, 0x18, 0x01, 0xDF,
+    0x08, 0x05, 0x0C, 0x0F, 0x08, 0x07, 0x01, 0xD7, 0x42, 0x48, 0x05, 0x4C, 0x11, 0x0C, 0x15, 0x07,
+    0x86, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6C, 0x79, 0x00, 0x0F, 0x13, 0x1B, 0x08, 0x82, 0x69, 0x74,
+    0x6C, 0x79, 0x00, 0x11, 0x0C, 0x09, 0x08, 0x07, 0x83, 0x69, 0x74, 0x65, 0x6C, 0x79, 0x00, 0x42,
+    0x44, 0x05, 0x48, 0x44, 0x44, 0x47, 0x09, 0x49, 0x18, 0x4C, 0x26, 0x55, 0x34, 0x08, 0x13, 0x08,
+    0x07, 0x11, 0x0C, 0x85, 0x6E, 0x64, 0x65, 0x6E, 0x74, 0x6C, 0x79, 0x00, 0x0C, 0x11, 0x0A, 0x0C,
+    0x16, 0x84, 0x69, 0x63, 0x61, 0x6E, 0x74, 0x6C, 0x79, 0x00, 0x10, 0x12, 0x07, 0x08, 0x15, 0x13,
+    0x84, 0x6E, 0x61, 0x74, 0x65, 0x6C, 0x79, 0x00, 0x08, 0x0B, 0x11, 0x0C, 0x84, 0x65, 0x6E, 0x74,
+    0x6C, 0x79, 0x00, 0x43, 0x46, 0x07, 0x47, 0x15, 0x58, 0x26, 0x0C, 0x09, 0x0C, 0x11, 0x0A, 0x0C,
+    0x16, 0x84, 0x61, 0x6E, 0x74, 0x6C, 0x79, 0x00, 0x0C, 0x06, 0x42, 0x46, 0x05, 0x51, 0x08, 0x04,
+    0x01, 0x03, 0x0C, 0x81, 0x61, 0x6C, 0x6C, 0x79, 0x00, 0x14, 0x11, 0x08, 0x16, 0x11, 0x12, 0x06,
+    0x87, 0x71, 0x75, 0x65, 0x6E, 0x74, 0x6C, 0x79, 0x00, 0x0F, 0x12, 0x16, 0x05, 0x04, 0x01, 0x2F,
+    0x09, 0x08, 0x16, 0x18, 0x02, 0xAD, 0x09, 0x0C, 0x42, 0x56, 0x05, 0x57, 0x14, 0x0F, 0x18, 0x06,
+    0x1B, 0x08, 0x86, 0x6C, 0x75, 0x73, 0x69, 0x76, 0x65, 0x6C, 0x79, 0x00, 0x42, 0x44, 0x05, 0x46,
+    0x08, 0x0F, 0x01, 0x09, 0x42, 0x44, 0x09, 0x48, 0x05, 0x13, 0x16, 0x08, 0x15, 0x81, 0x65, 0x6C,
+    0x79, 0x00, 0x43, 0x44, 0x07, 0x48, 0x10, 0x52, 0x1C, 0x07, 0x04, 0x06, 0x04, 0x82, 0x65, 0x6D,
+    0x79, 0x00, 0x07, 0x04, 0x06, 0x06, 0x04, 0x85, 0x61, 0x64, 0x65, 0x6D, 0x79, 0x00, 0x42, 0x51,
+    0x05, 0x57, 0x1E, 0x42, 0x44, 0x05, 0x52, 0x0F, 0x1B, 0x04, 0x17, 0x84, 0x6F, 0x6E, 0x6F, 0x6D,
+    0x79, 0x00, 0x08, 0x06, 0x08, 0x85, 0x6F, 0x6E, 0x6F, 0x6D, 0x79, 0x00, 0x0B, 0x06, 0x0C, 0x07,
+    0x83, 0x6F, 0x74, 0x6F, 0x6D, 0x79, 0x00, 0x45, 0x44, 0x0B, 0x48, 0x36, 0x4F, 0x4B, 0x52, 0x53,
+    0x5C, 0x9C, 0x43, 0x50, 0x07, 0x53, 0x0F, 0x55, 0x19, 0x12, 0x06, 0x82, 0x70, 0x61, 0x6E, 0x79,
+    0x00, 0x04, 0x10, 0x12, 0x06, 0x84, 0x70, 0x61, 0x6E, 0x79, 0x00, 0x42, 0x55, 0x05, 0x5C, 0x0D,
+    0x1C, 0x17, 0x83, 0x61, 0x6E, 0x6E, 0x79, 0x00, 0x17, 0x80, 0x6E, 0x79, 0x00, 0x42, 0x4A, 0x05,
+    0x52, 0x0F, 0x12, 0x15, 0x07, 0x11, 0x04, 0x82, 0x79, 0x6E, 0x79, 0x00, 0x10, 0x82, 0x6E, 0x65,
+    0x79, 0x00, 0x0C, 0x04, 0x10, 0x82, 0x6E, 0x6C, 0x79, 0x00, 0x43, 0x4B, 0x07, 0x4F, 0x21, 0x50,
+    0x29, 0x13, 0x42, 0x4F, 0x05, 0x51, 0x0F, 0x08, 0x17, 0x84, 0x65, 0x70, 0x68, 0x6F, 0x6E, 0x79,
+    0x00, 0x1C, 0x16, 0x85, 0x6D, 0x70, 0x68, 0x6F, 0x6E, 0x79, 0x00, 0x0F, 0x12, 0x06, 0x83, 0x6F,
+    0x6E, 0x79, 0x00, 0x42, 0x4C, 0x05, 0x52, 0x08, 0x15, 0x01, 0x07, 0x42, 0x55, 0x05, 0x57, 0x0E,
+    0x08, 0x06, 0x84, 0x65, 0x6D, 0x6F, 0x6E, 0x79, 0x00, 0x16, 0x08, 0x17, 0x84, 0x69, 0x6D, 0x6F,
+    0x6E, 0x79, 0x00, 0x0A, 0x12, 0x16, 0x1C, 0x10, 0x86, 0x69, 0x73, 0x6F, 0x67, 0x79, 0x6E, 0x79,
+    0x00, 0x17, 0x0C, 0x15, 0x15, 0x08, 0x17, 0x02, 0x3D, 0x05, 0x42, 0x52, 0x05, 0x53, 0x14, 0x06,
+    0x16, 0x12, 0x06, 0x0C, 0x10, 0x85, 0x72, 0x6F, 0x73, 0x63, 0x6F, 0x70, 0x79, 0x00, 0x42, 0x8B,
+    0x07, 0x00, 0x98, 0x72, 0x08, 0x04, 0x11, 0x18, 0x84, 0x68, 0x61, 0x70, 0x70, 0x79, 0x00, 0x48,
+    0x84, 0x19, 0x00, 0x87, 0x96, 0x02, 0x88, 0x9F, 0x02, 0x8C, 0xF5, 0x02, 0x92, 0xFC, 0x02, 0x93,
+    0xA7, 0x03, 0x95, 0xAD, 0x03, 0x97, 0xC7, 0x03, 0x4C, 0x85, 0x25, 0x00, 0x86, 0x2A, 0x00, 0x87,
+    0x43, 0x00, 0x8C, 0x61, 0x00, 0x8F, 0x89, 0x00, 0x90, 0xB2, 0x00, 0x91, 0xBA, 0x00, 0x92, 0x14,
+    0x01, 0x95, 0x1D, 0x01, 0x96, 0x57, 0x01, 0x97, 0xC4, 0x01, 0x98, 0x57, 0x02, 0x0C, 0x0F, 0x02,
+    0xE2, 0x01, 0x42, 0x48, 0x05, 0x4C, 0x12, 0x16, 0x16, 0x08, 0x11, 0x86, 0x63, 0x65, 0x73, 0x73,
+    0x61, 0x72, 0x79, 0x00, 0x09, 0x08, 0x11, 0x08, 0x05, 0x01, 0x52, 0x42, 0x4C, 0x05, 0x51, 0x0B,
+    0x16, 0x05, 0x18, 0x16, 0x01, 0x47, 0x42, 0x52, 0x05, 0x58, 0x0E, 0x05, 0x84, 0x75, 0x6E, 0x64,
+    0x61, 0x72, 0x79, 0x00, 0x12, 0x09, 0x02, 0x5C, 0x0B, 0x42, 0x4F, 0x05, 0x56, 0x23, 0x42, 0x4C,
+    0x05, 0x4F, 0x0C, 0x10, 0x82, 0x74, 0x61, 0x72, 0x79, 0x00, 0x0C, 0x42, 0x46, 0x05, 0x5B, 0x09,
+    0x11, 0x04, 0x01, 0xD8, 0x18, 0x04, 0x84, 0x69, 0x61, 0x72, 0x79, 0x00, 0x16, 0x08, 0x13, 0x01,
+    0xCB, 0x43, 0x4C, 0x07, 0x4F, 0x10, 0x58, 0x20, 0x1B, 0x18, 0x04, 0x82, 0x69, 0x61, 0x72, 0x79,
+    0x00, 0x0C, 0x42, 0x57, 0x05, 0x5B, 0x0A, 0x15, 0x04, 0x02, 0x5C, 0x01, 0x18, 0x04, 0x02, 0xC6,
+    0x01, 0x06, 0x0C, 0x17, 0x15, 0x04, 0x13, 0x02, 0x9A, 0x07, 0x18, 0x16, 0x82, 0x6D, 0x61, 0x72,
+    0x79, 0x00, 0x43, 0x48, 0x07, 0x4C, 0x12, 0x52, 0x24, 0x0A, 0x04, 0x10, 0x0C, 0x84, 0x69, 0x6E,
+    0x61, 0x72, 0x79, 0x00, 0x07, 0x15, 0x12, 0x15, 0x17, 0x1B, 0x08, 0x87, 0x61, 0x6F, 0x72, 0x64,
+    0x69, 0x6E, 0x61, 0x72, 0x79, 0x00, 0x44, 0x4C, 0x09, 0x53, 0x1D, 0x56, 0x23, 0x57, 0x28, 0x17,
+    0x18, 0x0F, 0x12, 0x19, 0x11, 0x08, 0x8B, 0x76, 0x6F, 0x6C, 0x75, 0x74, 0x69, 0x6F, 0x6E, 0x61,
+    0x72, 0x79, 0x00, 0x04, 0x08, 0x1A, 0x02, 0xBC, 0x0A, 0x16, 0x0C, 0x10, 0x01, 0x08, 0x0C, 0x07,
+    0x08, 0x13, 0x1B, 0x08, 0x84, 0x69, 0x6F, 0x6E, 0x61, 0x72, 0x79, 0x00, 0x13, 0x10, 0x08, 0x17,
+    0x11, 0x12, 0x06, 0x01, 0xEE, 0x44, 0x52, 0x09, 0x53, 0x1A, 0x57, 0x24, 0x58, 0x32, 0x13, 0x10,
+    0x04, 0x17, 0x11, 0x12, 0x06, 0x87, 0x65, 0x6D, 0x70, 0x6F, 0x72, 0x61, 0x72, 0x79, 0x00, 0x10,
+    0x08, 0x17, 0x83, 0x6F, 0x72, 0x61, 0x72, 0x79, 0x00, 0x0C, 0x15, 0x05, 0x04, 0x87, 0x72, 0x62,
+    0x69, 0x74, 0x72, 0x61, 0x72, 0x79, 0x00, 0x11, 0x04, 0x0D, 0x83, 0x61, 0x72, 0x79, 0x00, 0x45,
+    0x88, 0x10, 0x00, 0x8C, 0x34, 0x00, 0x8F, 0x53, 0x01, 0x95, 0x3F, 0x00, 0x96, 0x4F, 0x00, 0x42,
+    0x46, 0x05, 0x59, 0x1B, 0x42, 0x46, 0x05, 0x48, 0x0F, 0x08, 0x11, 0x85, 0x65, 0x73, 0x73, 0x61,
+    0x72, 0x79, 0x00, 0x11, 0x82, 0x73, 0x61, 0x72, 0x79, 0x00, 0x07, 0x04, 0x83, 0x72, 0x73, 0x61,
+    0x72, 0x79, 0x00, 0x10, 0x10, 0x08, 0x85, 0x69, 0x73, 0x73, 0x61, 0x72, 0x79, 0x00, 0x08, 0x19,
+    0x0C, 0x11, 0x04, 0x87, 0x6E, 0x69, 0x76, 0x65, 0x72, 0x73, 0x61, 0x72, 0x79, 0x00, 0x08, 0x06,
+    0x42, 0x46, 0x05, 0x48, 0x0F, 0x08, 0x11, 0x86, 0x65, 0x73, 0x73, 0x61, 0x72, 0x79, 0x00, 0x11,
+    0x18, 0x87, 0x6E, 0x65, 0x63, 0x65, 0x73, 0x73, 0x61, 0x72, 0x79, 0x00, 0x46, 0x44, 0x0D, 0x48,
+    0x25, 0x4C, 0x3E, 0x4F, 0x55, 0x51, 0x5E, 0x56, 0x87, 0x42, 0x4F, 0x05, 0x55, 0x0E, 0x12, 0x16,
+    0x84, 0x69, 0x74, 0x61, 0x72, 0x79, 0x00, 0x06, 0x08, 0x16, 0x84, 0x65, 0x74, 0x61, 0x72, 0x79,
+    0x00, 0x42, 0x4C, 0x05, 0x50, 0x12, 0x13, 0x12, 0x15, 0x13, 0x85, 0x72, 0x69, 0x65, 0x74, 0x61,
+    0x72, 0x79, 0x00, 0x08, 0x06, 0x82, 0x65, 0x72, 0x79, 0x00, 0x42, 0x45, 0x05, 0x4F, 0x0D, 0x15,
+    0x04, 0x82, 0x72, 0x61, 0x72, 0x79, 0x00, 0x0F, 0x0C, 0x10, 0x85, 0x69, 0x74, 0x61, 0x72, 0x79,
+    0x00, 0x0C, 0x10, 0x83, 0x69, 0x74, 0x61, 0x72, 0x79, 0x00, 0x42, 0x48, 0x05, 0x52, 0x1E, 0x10,
+    0x42, 0x48, 0x05, 0x4C, 0x0C, 0x06, 0x84, 0x74, 0x65, 0x72, 0x79, 0x00, 0x0F, 0x08, 0x87, 0x65,
+    0x6D, 0x65, 0x6E, 0x74, 0x61, 0x72, 0x79, 0x00, 0x0F, 0x12, 0x19, 0x85, 0x75, 0x6E, 0x74, 0x61,
+    0x72, 0x79, 0x00, 0x08, 0x11, 0x12, 0x10, 0x85, 0x61, 0x73, 0x74, 0x65, 0x72, 0x79, 0x00, 0x43,
+    0x45, 0x07, 0x47, 0x10, 0x56, 0x1B, 0x08, 0x09, 0x83, 0x72, 0x75, 0x61, 0x72, 0x79, 0x00, 0x0C,
+    0x16, 0x05, 0x18, 0x16, 0x83, 0x69, 0x61, 0x72, 0x79, 0x00, 0x0C, 0x07, 0x18, 0x0D, 0x84, 0x63,
+    0x69, 0x61, 0x72, 0x79, 0x00, 0x11, 0x18, 0x12, 0x05, 0x81, 0x61, 0x72, 0x79, 0x00, 0x45, 0x4D,
+    0x0B, 0x4F, 0x13, 0x56, 0x23, 0x57, 0x2E, 0x59, 0x4C, 0x15, 0x08, 0x13, 0x82, 0x75, 0x72, 0x79,
+    0x00, 0x42, 0x44, 0x23, 0x4F, 0x05, 0x1A, 0x08, 0x0D, 0x84, 0x65, 0x6C, 0x6C, 0x65, 0x72, 0x79,
+    0x00, 0x0F, 0x18, 0x13, 0x10, 0x12, 0x06, 0x82, 0x6F, 0x72, 0x79, 0x00, 0x42, 0x48, 0x05, 0x56,
+    0x0B, 0x15, 0x06, 0x08, 0x16, 0x01, 0x8F, 0x0C, 0x42, 0x50, 0x05, 0x51, 0x0D, 0x85, 0x79, 0x73,
+    0x74, 0x65, 0x72, 0x79, 0x00, 0x0C, 0x10, 0x02, 0xEB, 0x08, 0x12, 0x15, 0x17, 0x11, 0x12, 0x06,
+    0x80, 0x73, 0x79, 0x00, 0x04, 0x15, 0x13, 0x80, 0x69, 0x65, 0x00, 0x46, 0x4A, 0x0D, 0x4C, 0x18,
+    0x51, 0x22, 0x53, 0x26, 0x57, 0x31, 0x5A, 0x9F, 0x04, 0x17, 0x04, 0x06, 0x84, 0x65, 0x67, 0x6F,
+    0x72, 0x79, 0x00, 0x15, 0x15, 0x08, 0x17, 0x82, 0x74, 0x6F, 0x72, 0x79, 0x00, 0x12, 0x0B, 0x01,
+    0x08, 0x10, 0x08, 0x17, 0x11, 0x12, 0x06, 0x80, 0x61, 0x72, 0x79, 0x00, 0x44, 0x44, 0x09, 0x48,
+    0x32, 0x4C, 0x3D, 0x56, 0x52, 0x43, 0x45, 0x07, 0x53, 0x12, 0x55, 0x1D, 0x04, 0x0F, 0x84, 0x6F,
+    0x72, 0x61, 0x74, 0x6F, 0x72, 0x79, 0x00, 0x08, 0x15, 0x13, 0x83, 0x72, 0x61, 0x74, 0x6F, 0x72,
+    0x79, 0x00, 0x05, 0x04, 0x0F, 0x85, 0x6F, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x79, 0x00, 0x0C, 0x15,
+    0x13, 0x12, 0x15, 0x13, 0x82, 0x61, 0x72, 0x79, 0x00, 0x42, 0x4A, 0x05, 0x51, 0x0B, 0x12, 0x15,
+    0x08, 0x07, 0x01, 0x05, 0x0A, 0x0C, 0x16, 0x84, 0x61, 0x74, 0x6F, 0x72, 0x79, 0x00, 0x42, 0x48,
+    0x05, 0x4B, 0x14, 0x42, 0x46, 0x05, 0x47, 0x0A, 0x11, 0x04, 0x02, 0x48, 0x08, 0x82, 0x72, 0x6F,
+    0x79, 0x00, 0x84, 0x69, 0x73, 0x74, 0x6F, 0x72, 0x79, 0x00, 0x04, 0x16, 0x16, 0x04, 0x06, 0x84,
+    0x6F, 0x77, 0x61, 0x72, 0x79, 0x00, 0x12, 0x17, 0x16, 0x02, 0x29, 0x08, 0x04, 0x42, 0x56, 0x05,
+    0x5A, 0x11, 0x0C, 0x10, 0x10, 0x08, 0x86, 0x69, 0x73, 0x73, 0x61, 0x72, 0x79, 0x00, 0x12, 0x16,
+    0x16, 0x04, 0x06, 0x81, 0x79, 0x00, 0x46, 0x44, 0x0D, 0x48, 0x24, 0x4C, 0x2E, 0x51, 0x34, 0x52,
+    0x40, 0x56, 0x53, 0x42, 0x51, 0x05, 0x57, 0x0D, 0x08, 0x10, 0x18, 0x06, 0x12, 0x07, 0x01, 0xF1,
+    0x11, 0x08, 0x10, 0x0C, 0x07, 0x18, 0x15, 0x02, 0xEB, 0x07, 0x10, 0x1C, 0x16, 0x83, 0x6D, 0x65,
+    0x74, 0x72, 0x79, 0x00, 0x16, 0x11, 0x0C, 0x10, 0x01, 0x37, 0x18, 0x06, 0x12, 0x86, 0x63, 0x6F,
+    0x75, 0x6E, 0x74, 0x72, 0x79, 0x00, 0x42, 0x48, 0x05, 0x56, 0x0D, 0x13, 0x84, 0x6F, 0x65, 0x74,
+    0x72, 0x79, 0x00, 0x83, 0x74, 0x6F, 0x72, 0x79, 0x00, 0x43, 0x47, 0x07, 0x48, 0x12, 0x51, 0x1D,
+    0x18, 0x11, 0x0C, 0x85, 0x64, 0x75, 0x73, 0x74, 0x72, 0x79, 0x00, 0x10, 0x08, 0x0B, 0x06, 0x84,
+    0x69, 0x73, 0x74, 0x72, 0x79, 0x00, 0x0C, 0x10, 0x83, 0x69, 0x73, 0x74, 0x72, 0x79, 0x00, 0x42,
+    0x44, 0x05, 0x55, 0x1A, 0x42, 0x55, 0x05, 0x5A, 0x0F, 0x06, 0x12, 0x13, 0x1C, 0x0B, 0x82, 0x69,
+    0x73, 0x79, 0x00, 0x0F, 0x04, 0x81, 0x79, 0x73, 0x00, 0x08, 0x19, 0x04, 0x15, 0x17, 0x11, 0x12,
+    0x06, 0x85, 0x6F, 0x76, 0x65, 0x72, 0x73, 0x79, 0x00, 0x4D, 0x84, 0x28, 0x00, 0x86, 0x73, 0x00,
+    0x87, 0x7D, 0x00, 0x88, 0x8A, 0x00, 0x89, 0xAF, 0x00, 0x8C, 0xB4, 0x00, 0x8F, 0x54, 0x03, 0x90,
+    0x97, 0x03, 0x91, 0xA1, 0x03, 0x92, 0xB6, 0x03, 0x95, 0xCB, 0x03, 0x96, 0xD3, 0x03, 0x98, 0xE0,
+    0x03, 0x43, 0x4F, 0x07, 0x55, 0x2E, 0x57, 0x44, 0x42, 0x4C, 0x05, 0x58, 0x1E, 0x42, 0x45, 0x05,
+    0x57, 0x0B, 0x04, 0x05, 0x12, 0x15, 0x01, 0x22, 0x0C, 0x16, 0x15, 0x08, 0x19, 0x86, 0x61, 0x74,
+    0x69, 0x6C, 0x69, 0x74, 0x79, 0x00, 0x16, 0x04, 0x06, 0x83, 0x61, 0x6C, 0x74, 0x79, 0x00, 0x42,
+    0x44, 0x05, 0x4C, 0x0D, 0x0F, 0x18, 0x13, 0x12, 0x13, 0x02, 0x5F, 0x03, 0x0F, 0x0C, 0x10, 0x83,
+    0x74, 0x61, 0x72, 0x79, 0x00, 0x11, 0x04, 0x18, 0x14, 0x02, 0x4F, 0x03, 0x0C, 0x15, 0x17, 0x06,
+    0x08, 0x0F, 0x08, 0x02, 0x22, 0x03, 0x0C, 0x0F, 0x0C, 0x04, 0x19, 0x85, 0x6C, 0x69, 0x64, 0x69,
+    0x74, 0x79, 0x00, 0x42, 0x4C, 0x05, 0x52, 0x20, 0x42, 0x47, 0x05, 0x55, 0x0B, 0x83, 0x65, 0x69,
+    0x74, 0x79, 0x00, 0x42, 0x48, 0x05, 0x59, 0x83, 0x17, 0x12, 0x11, 0x85, 0x6F, 0x72, 0x69, 0x65,
+    0x74, 0x79, 0x00, 0x13, 0x80, 0x72, 0x79, 0x00, 0x04, 0x16, 0x02, 0x00, 0x03, 0x4B, 0x84, 0x22,
+    0x00, 0x85, 0x31, 0x00, 0x86, 0x40, 0x00, 0x87, 0x5C, 0x00, 0x88, 0x67, 0x00, 0x8F, 0x71, 0x00,
+    0x90, 0xD4, 0x01, 0x91, 0xE0, 0x01, 0x95, 0x4A, 0x02, 0x96, 0x7A, 0x02, 0x97, 0x99, 0x02, 0x0F,
+    0x13, 0x0C, 0x06, 0x11, 0x0C, 0x15, 0x13, 0x84, 0x61, 0x6C, 0x69, 0x74, 0x79, 0x00, 0x0C, 0x0F,
+    0x04, 0x05, 0x12, 0x15, 0x13, 0x85, 0x62, 0x69, 0x6C, 0x69, 0x74, 0x79, 0x00, 0x0C, 0x15, 0x42,
+    0x44, 0x05, 0x57, 0x0D, 0x06, 0x16, 0x84, 0x63, 0x69, 0x74, 0x79, 0x00, 0x08, 0x0F, 0x08, 0x86,
+    0x63, 0x74, 0x72, 0x69, 0x63, 0x69, 0x74, 0x79, 0x00, 0x0C, 0x15, 0x08, 0x0B, 0x84, 0x65, 0x64,
+    0x69, 0x74, 0x79, 0x00, 0x15, 0x19, 0x84, 0x61, 0x72, 0x69, 0x65, 0x74, 0x79, 0x00, 0x45, 0x84,
+    0x10, 0x00, 0x85, 0x58, 0x00, 0x8C, 0x9C, 0x00, 0x97, 0x4D, 0x01, 0x98, 0x5B, 0x01, 0x43, 0x4C,
+    0x07, 0x51, 0x16, 0x53, 0x25, 0x17, 0x16, 0x04, 0x08, 0x05, 0x88, 0x73, 0x74, 0x69, 0x61, 0x6C,
+    0x69, 0x74, 0x79, 0x00, 0x16, 0x12, 0x15, 0x08, 0x13, 0x87, 0x73, 0x6F, 0x6E, 0x61, 0x6C, 0x69,
+    0x74, 0x79, 0x00, 0x0C, 0x06, 0x42, 0x4C, 0x05, 0x51, 0x14, 0x11, 0x11, 0x18, 0x10, 0x89, 0x69,
+    0x63, 0x69, 0x70, 0x61, 0x6C, 0x69, 0x74, 0x79, 0x00, 0x18, 0x10, 0x87, 0x69, 0x63, 0x69, 0x70,
+    0x61, 0x6C, 0x69, 0x74, 0x79, 0x00, 0x42, 0x44, 0x05, 0x4C, 0x23, 0x43, 0x4C, 0x07, 0x4F, 0x0A,
+    0x57, 0x10, 0x0F, 0x01, 0x23, 0x0C, 0x04, 0x19, 0x04, 0x01, 0x2A, 0x04, 0x13, 0x10, 0x12, 0x06,
+    0x85, 0x69, 0x62, 0x69, 0x6C, 0x69, 0x74, 0x79, 0x00, 0x42, 0x56, 0x05, 0x57, 0x15, 0x42, 0x51,
+    0x05, 0x56, 0x0C, 0x12, 0x13, 0x16, 0x08, 0x15, 0x01, 0x0B, 0x12, 0x13, 0x01, 0x07, 0x04, 0x13,
+    0x10, 0x12, 0x06, 0x83, 0x69, 0x6C, 0x69, 0x74, 0x79, 0x00, 0x42, 0x45, 0x05, 0x4F, 0x91, 0x42,
+    0x44, 0x05, 0x55, 0x7F, 0x45, 0x4F, 0x0B, 0x53, 0x19, 0x55, 0x26, 0x56, 0x3C, 0x57, 0x55, 0x04,
+    0x09, 0x11, 0x0C, 0x86, 0x6C, 0x69, 0x62, 0x69, 0x6C, 0x69, 0x74, 0x79, 0x00, 0x10, 0x12, 0x06,
+    0x85, 0x74, 0x69, 0x62, 0x69, 0x6C, 0x69, 0x74, 0x79, 0x00, 0x08, 0x19, 0x18, 0x08, 0x12, 0x11,
+    0x04, 0x10, 0x8C, 0x65, 0x75, 0x76, 0x65, 0x72, 0x61, 0x62, 0x69, 0x6C, 0x69, 0x74, 0x79, 0x00,
+    0x42, 0x51, 0x05, 0x56, 0x0C, 0x12, 0x13, 0x16, 0x08, 0x15, 0x01, 0x18, 0x42, 0x4C, 0x05, 0x52,
+    0x0A, 0x10, 0x07, 0x04, 0x01, 0x0E, 0x13, 0x01, 0x0B, 0x42, 0x44, 0x05, 0x55, 0x12, 0x13, 0x10,
+    0x12, 0x06, 0x86, 0x69, 0x62, 0x69, 0x6C, 0x69, 0x74, 0x79, 0x00, 0x12, 0x09, 0x11, 0x12, 0x06,
+    0x11, 0x18, 0x8F, 0x64, 0x69, 0x73, 0x63, 0x6F, 0x6D, 0x66, 0x6F, 0x72, 0x74, 0x00, 0x08, 0x13,
+    0x04, 0x06, 0x87, 0x61, 0x62, 0x69, 0x6C, 0x69, 0x74, 0x79, 0x00, 0x05, 0x42, 0x44, 0x05, 0x4C,
+    0x14, 0x42, 0x51, 0x05, 0x55, 0x08, 0x0C, 0x01, 0x0D, 0x08, 0x11, 0x0F, 0x18, 0x19, 0x01, 0x06,
+    0x16, 0x16, 0x12, 0x13, 0x85, 0x69, 0x6C, 0x69, 0x74, 0x79, 0x00, 0x0C, 0x16, 0x15, 0x08, 0x19,
+    0x85, 0x61, 0x74, 0x69, 0x6C, 0x69, 0x74, 0x79, 0x00, 0x06, 0x0C, 0x09, 0x09, 0x0C, 0x07, 0x01,
+    0x2B, 0x0C, 0x11, 0x12, 0x11, 0x04, 0x84, 0x79, 0x6D, 0x69, 0x74, 0x79, 0x00, 0x44, 0x4A, 0x09,
+    0x4C, 0x12, 0x50, 0x40, 0x58, 0x48, 0x0C, 0x08, 0x15, 0x08, 0x19, 0x12, 0x16, 0x01, 0x0D, 0x43,
+    0x44, 0x07, 0x46, 0x0F, 0x57, 0x28, 0x17, 0x15, 0x08, 0x06, 0x82, 0x74, 0x79, 0x00, 0x42, 0x44,
+    0x05, 0x51, 0x0F, 0x19, 0x86, 0x69, 0x63, 0x69, 0x6E, 0x69, 0x74, 0x79, 0x00, 0x0C, 0x19, 0x86,
+    0x63, 0x69, 0x6E, 0x69, 0x74, 0x79, 0x00, 0x18, 0x15, 0x06, 0x16, 0x01, 0x7F, 0x08, 0x84, 0x6E,
+    0x6D, 0x69, 0x74, 0x79, 0x00, 0x17, 0x42, 0x52, 0x05, 0x55, 0x13, 0x15, 0x13, 0x13, 0x12, 0x87,
+    0x6F, 0x72, 0x74, 0x75, 0x6E, 0x69, 0x74, 0x79, 0x00, 0x12, 0x13, 0x12, 0x87, 0x70, 0x6F, 0x72,
+    0x74, 0x75, 0x6E, 0x69, 0x74, 0x79, 0x00, 0x43, 0x44, 0x07, 0x48, 0x0A, 0x52, 0x14, 0x19, 0x01,
+    0xAB, 0x19, 0x0C, 0x11, 0x18, 0x82, 0x73, 0x69, 0x74, 0x79, 0x00, 0x42, 0x4D, 0x05, 0x57, 0x10,
+    0x15, 0x04, 0x10, 0x86, 0x6A, 0x6F, 0x72, 0x69, 0x74, 0x79, 0x00, 0x06, 0x04, 0x09, 0x16, 0x0C,
+    0x17, 0x04, 0x16, 0x81, 0x6C, 0x79, 0x00, 0x42, 0x48, 0x05, 0x55, 0x10, 0x19, 0x0C, 0x11, 0x18,
+    0x83, 0x72, 0x73, 0x69, 0x74, 0x79, 0x00, 0x08, 0x0C, 0x19, 0x11, 0x18, 0x87, 0x69, 0x76, 0x65,
+    0x72, 0x73, 0x69, 0x74, 0x79, 0x00, 0x0C, 0x17, 0x11, 0x08, 0x82, 0x79, 0x00, 0x42, 0x4C, 0x05,
+    0x58, 0x35, 0x42, 0x45, 0x05, 0x4F, 0x23, 0x42, 0x44, 0x3E, 0x4C, 0x05, 0x16, 0x42, 0x51, 0x05,
+    0x56, 0x15, 0x11, 0x12, 0x13, 0x16, 0x08, 0x15, 0x87, 0x73, 0x69, 0x62, 0x69, 0x6C, 0x69, 0x74,
+    0x79, 0x00, 0x12, 0x01, 0x21, 0x05, 0x0C, 0x16, 0x16, 0x12, 0x13, 0x84, 0x69, 0x6C, 0x69, 0x74,
+    0x79, 0x00, 0x06, 0x0C, 0x09, 0x0C, 0x07, 0x85, 0x66, 0x69, 0x63, 0x75, 0x6C, 0x74, 0x79, 0x00,
+    0x0C, 0x1B, 0x12, 0x15, 0x13, 0x81, 0x69, 0x74, 0x79, 0x00, 0x42, 0x48, 0x05, 0x4C, 0x0F, 0x0C,
+    0x06, 0x0C, 0x09, 0x09, 0x08, 0x11, 0x0C, 0x01, 0x4A, 0x11, 0x81, 0x65, 0x74, 0x79, 0x00, 0x42,
+    0x55, 0x05, 0x57, 0x0E, 0x12, 0x0D, 0x04, 0x10, 0x82, 0x69, 0x74, 0x79, 0x00, 0x06, 0x08, 0x15,
+    0x0C, 0x07, 0x01, 0x1B, 0x18, 0x12, 0x09, 0x83, 0x72, 0x74, 0x79, 0x00, 0x0C, 0x15, 0x08, 0x19,
+    0x0C, 0x11, 0x18, 0x83, 0x73, 0x69, 0x74, 0x79, 0x00, 0x17, 0x11, 0x08, 0x06, 0x81, 0x72, 0x79,
+    0x00, 0x14, 0x0C, 0x0F, 0x0C, 0x0F, 0x12, 0x16, 0x83, 0x6F, 0x71, 0x75, 0x79, 0x00, 0x12, 0x0F,
+    0x16, 0x80, 0x6C, 0x79, 0x00, 0x17, 0x0C, 0x11, 0x05, 0x0C, 0x08, 0x0F, 0x81, 0x7A, 0x00, 0x55,
+    0x84, 0x40, 0x00, 0x86, 0x6F, 0x00, 0x87, 0x93, 0x00, 0x88, 0xC5, 0x00, 0x89, 0x61, 0x01, 0x8A,
+    0x74, 0x01, 0x8B, 0x7D, 0x01, 0x8C, 0xC0, 0x01, 0x8E, 0xC8, 0x01, 0x8F, 0xF1, 0x01, 0x90, 0x06,
+    0x02, 0x91, 0x21, 0x02, 0x92, 0xA7, 0x02, 0x93, 0x03, 0x03, 0x95, 0x1F, 0x03, 0x96, 0x67, 0x03,
+    0x97, 0xE0, 0x03, 0x98, 0x69, 0x04, 0x99, 0x88, 0x04, 0x9A, 0xA1, 0x04, 0x9C, 0xCC, 0x04, 0x45,
+    0x48, 0x0B, 0x51, 0x0F, 0x55, 0x16, 0x57, 0x1D, 0x5C, 0x28, 0x15, 0x02, 0xFE, 0x02, 0x0B, 0x17,
+    0x2C, 0x82, 0x61, 0x6E, 0x00, 0x08, 0x1C, 0x2C, 0x82, 0x61, 0x72, 0x00, 0x0B, 0x42, 0x57, 0x05,
+    0x5A, 0x05, 0x2C, 0x82, 0x61, 0x74, 0x00, 0x1A, 0x04, 0x2C, 0x82, 0x61, 0x79, 0x00, 0x44, 0x4B,
+    0x09, 0x4C, 0x10, 0x4E, 0x16, 0x57, 0x1D, 0x04, 0x08, 0x2C, 0x82, 0x63, 0x68, 0x00, 0x0B, 0x1A,
+    0x2C, 0x80, 0x68, 0x00, 0x04, 0x05, 0x2C, 0x82, 0x63, 0x6B, 0x00, 0x04, 0x09, 0x2C, 0x82, 0x63,
+    0x74, 0x00, 0x45, 0x44, 0x0B, 0x45, 0x12, 0x48, 0x18, 0x4C, 0x20, 0x58, 0x2C, 0x05, 0x15, 0x12,
+    0x09, 0x02, 0x8F, 0x03, 0x11, 0x04, 0x2C, 0x82, 0x64, 0x00, 0x04, 0x07, 0x2C, 0x83, 0x65, 0x61,
+    0x64, 0x00, 0x15, 0x04, 0x0B, 0x06, 0x06, 0x04, 0x16, 0x1C, 0x0F, 0x02, 0xF9, 0x02, 0x0F, 0x06,
+    0x11, 0x02, 0x67, 0x03, 0x4B, 0x44, 0x17, 0x4A, 0x3B, 0x4B, 0x41, 0x4D, 0xCA, 0x4E, 0x51, 0x51,
+    0x5A, 0x52, 0x61, 0x55, 0x79, 0x56, 0x88, 0x57, 0x8F, 0x59, 0x98, 0x43, 0x4E, 0x07, 0x50, 0x12,
+    0x59, 0x1D, 0x42, 0x50, 0x05, 0x57, 0x05, 0x2C, 0x83, 0x61, 0x6B, 0x65, 0x00, 0x42, 0x51, 0x05,
+    0x56, 0x05, 0x2C, 0x83, 0x61, 0x6D, 0x65, 0x00, 0x0B, 0x2C, 0x83, 0x61, 0x76, 0x65, 0x00, 0x0B,
+    0x17, 0x2C, 0x82, 0x65, 0x00, 0x43, 0x8A, 0x0A, 0x00, 0x8D, 0x0A, 0x00, 0x9C, 0xE4, 0x03, 0x17,
+    0x2C, 0x83, 0x68, 0x65, 0x00, 0x10, 0x04, 0x2C, 0x84, 0x6D, 0x61, 0x6B, 0x65, 0x00, 0x0B, 0x17,
+    0x2C, 0x82, 0x65, 0x6E, 0x00, 0x43, 0x90, 0x0A, 0x00, 0x95, 0x11, 0x00, 0x99, 0x93, 0x01, 0x16,
+    0x2C, 0x83, 0x6F, 0x6D, 0x65, 0x00, 0x10, 0x2C, 0x83, 0x6F, 0x72, 0x65, 0x00, 0x42, 0x90, 0x07,
+    0x00, 0x9C, 0x9C, 0x03, 0x12, 0x2C, 0x84, 0x6D, 0x6F, 0x72, 0x65, 0x00, 0x0C, 0x18, 0x2C, 0x83,
+    0x73, 0x65, 0x00, 0x17, 0x0C, 0x10, 0x10, 0x12, 0x06, 0x02, 0xD7, 0x02, 0x0B, 0x02, 0x35, 0x03,
+    0x42, 0x48, 0x05, 0x4C, 0x0C, 0x0C, 0x1A, 0x2C, 0x82, 0x66, 0x65, 0x00, 0x15, 0x08, 0x0B, 0x16,
+    0x80, 0x66, 0x00, 0x11, 0x08, 0x05, 0x2C, 0x82, 0x69, 0x6E, 0x67, 0x00, 0x44, 0x46, 0x09, 0x48,
+    0x12, 0x4C, 0x18, 0x57, 0x29, 0x0C, 0x1A, 0x2C, 0x83, 0x68, 0x69, 0x63, 0x68, 0x00, 0x17, 0x2C,
+    0x82, 0x68, 0x65, 0x00, 0x42, 0x57, 0x05, 0x5A, 0x0C, 0x1A, 0x2C, 0x83, 0x69, 0x74, 0x68, 0x00,
+    0x2C, 0x81, 0x74, 0x68, 0x00, 0x43, 0x44, 0x07, 0x52, 0x0B, 0x5A, 0x12, 0x17, 0x02, 0x60, 0x02,
+    0x11, 0x2C, 0x82, 0x72, 0x74, 0x68, 0x00, 0x0C, 0x2C, 0x84, 0x77, 0x69, 0x74, 0x68, 0x00, 0x16,
+    0x0B, 0x17, 0x2C, 0x82, 0x69, 0x73, 0x00, 0x44, 0x44, 0x09, 0x48, 0x11, 0x52, 0x18, 0x55, 0x20,
+    0x06, 0x05, 0x2C, 0x83, 0x61, 0x63, 0x6B, 0x00, 0x0C, 0x0F, 0x2C, 0x82, 0x6B, 0x65, 0x00, 0x15,
+    0x1A, 0x2C, 0x83, 0x6F, 0x72, 0x6B, 0x00, 0x1A, 0x12, 0x2C, 0x84, 0x77, 0x6F, 0x72, 0x6B, 0x00,
+    0x42, 0x4F, 0x05, 0x5C, 0x0E, 0x1A, 0x0C, 0x2C, 0x84, 0x77, 0x69, 0x6C, 0x6C, 0x00, 0x11, 0x12,
+    0x2C, 0x82, 0x6C, 0x79, 0x00, 0x42, 0x48, 0x05, 0x52, 0x13, 0x42, 0x4C, 0x05, 0x52, 0x08, 0x17,
+    0x01, 0x03, 0x16, 0x2C, 0x82, 0x6D, 0x65, 0x00, 0x08, 0x13, 0x2C, 0x83, 0x6F, 0x65, 0x6D, 0x00,
+    0x47, 0x44, 0x0F, 0x47, 0x16, 0x48, 0x21, 0x4B, 0x2A, 0x4C, 0x46, 0x52, 0x54, 0x57, 0x76, 0x05,
+    0x16, 0x18, 0x0B, 0x80, 0x64, 0x00, 0x42, 0x44, 0x06, 0x4C, 0x05, 0x09, 0x2C, 0x82, 0x6E, 0x64,
+    0x00, 0x17, 0x0B, 0x2C, 0x84, 0x74, 0x68, 0x65, 0x6E, 0x00, 0x44, 0x44, 0x09, 0x48, 0x10, 0x57,
+    0x17, 0x5A, 0x17, 0x17, 0x2C, 0x83, 0x68, 0x61, 0x6E, 0x00, 0x1A, 0x2C, 0x83, 0x68, 0x65, 0x6E,
+    0x00, 0x2C, 0x81, 0x65, 0x6E, 0x00, 0x0A, 0x04, 0x42, 0x90, 0xC0, 0x01, 0xAC, 0x07, 0x00, 0x82,
+    0x61, 0x69, 0x6E, 0x00, 0x43, 0x4C, 0x07, 0x53, 0x13, 0x5A, 0x1B, 0x17, 0x04, 0x11, 0x15, 0x08,
+    0x17, 0x11, 0x0C, 0x80, 0x61, 0x6C, 0x00, 0x04, 0x2C, 0x84, 0x75, 0x70, 0x6F, 0x6E, 0x00, 0x17,
+    0x2C, 0x83, 0x6F, 0x77, 0x6E, 0x00, 0x42, 0x44, 0x05, 0x4C, 0x0B, 0x1A, 0x2C, 0x82, 0x6E, 0x74,
+    0x00, 0x1A, 0x2C, 0x81, 0x68, 0x00, 0x48, 0x48, 0x11, 0x4B, 0x19, 0x4F, 0x21, 0x51, 0x29, 0x53,
+    0x2D, 0x57, 0x3D, 0x58, 0x43, 0x5A, 0x49, 0x19, 0x0F, 0x2C, 0x83, 0x6F, 0x76, 0x65, 0x00, 0x17,
+    0x0F, 0x04, 0x80, 0x75, 0x67, 0x68, 0x00, 0x16, 0x04, 0x2C, 0x83, 0x6C, 0x73, 0x6F, 0x00, 0x1A,
+    0x02, 0xEB, 0x01, 0x42, 0x57, 0x05, 0x5A, 0x0B, 0x16, 0x2C, 0x82, 0x6F, 0x70, 0x00, 0x17, 0x2C,
+    0x82, 0x6F, 0x00, 0x11, 0x2C, 0x82, 0x6F, 0x74, 0x00, 0x1C, 0x2C, 0x82, 0x6F, 0x75, 0x00, 0x43,
+    0x8E, 0xD4, 0x01, 0x91, 0x0A, 0x00, 0x95, 0x0D, 0x00, 0x0E, 0x01, 0x03, 0x0A, 0x2C, 0x82, 0x6F,
+    0x77, 0x00, 0x43, 0x4F, 0x07, 0x50, 0x0F, 0x52, 0x14, 0x04, 0x0B, 0x2C, 0x83, 0x65, 0x6C, 0x70,
+    0x00, 0x08, 0x17, 0x17, 0x01, 0xC2, 0x18, 0x16, 0x2C, 0x83, 0x6F, 0x75, 0x70, 0x00, 0x45, 0x44,
+    0x0B, 0x48, 0x24, 0x4E, 0x32, 0x50, 0x39, 0x5C, 0x41, 0x42, 0x51, 0x05, 0x5C, 0x11, 0x12, 0x0C,
+    0x17, 0x18, 0x0F, 0x12, 0x19, 0x08, 0x15, 0x80, 0x79, 0x00, 0x08, 0x2C, 0x84, 0x79, 0x65, 0x61,
+    0x72, 0x00, 0x42, 0x84, 0x07, 0x00, 0x9C, 0x97, 0x01, 0x1C, 0x2C, 0x83, 0x65, 0x61, 0x72, 0x00,
+    0x12, 0x1A, 0x2C, 0x82, 0x72, 0x6B, 0x00, 0x12, 0x09, 0x2C, 0x83, 0x72, 0x6F, 0x6D, 0x00, 0x08,
+    0x19, 0x2C, 0x82, 0x72, 0x79, 0x00, 0x46, 0x44, 0x0D, 0x48, 0x2F, 0x4B, 0x52, 0x4C, 0x5A, 0x51,
+    0x6D, 0x56, 0x74, 0x44, 0x46, 0x09, 0x48, 0x0E, 0x55, 0x14, 0x5C, 0x1B, 0x15, 0x04, 0x06, 0x01,
+    0x2E, 0x1A, 0x2C, 0x83, 0x61, 0x73, 0x00, 0x15, 0x04, 0x05, 0x10, 0x08, 0x01, 0x21, 0x16, 0x2C,
+    0x83, 0x61, 0x79, 0x73, 0x00, 0x44, 0x46, 0x09, 0x4C, 0x0E, 0x51, 0x14, 0x58, 0x1B, 0x12, 0x15,
+    0x13, 0x01, 0x0C, 0x0F, 0x15, 0x04, 0x08, 0x01, 0x30, 0x0C, 0x16, 0x18, 0x05, 0x80, 0x73, 0x00,
+    0x0A, 0x18, 0x17, 0x15, 0x12, 0x13, 0x01, 0x7A, 0x0C, 0x17, 0x2C, 0x83, 0x68, 0x69, 0x73, 0x00,
+    0x17, 0x42, 0x4B, 0x05, 0x51, 0x0C, 0x2C, 0x84, 0x74, 0x68, 0x69, 0x73, 0x00, 0x08, 0x0C, 0x06,
+    0x16, 0x01, 0x06, 0x0C, 0x04, 0x0A, 0x04, 0x80, 0x74, 0x00, 0x04, 0x1A, 0x2C, 0x81, 0x00, 0x48,
+    0x44, 0x11, 0x4B, 0x24, 0x4C, 0x3A, 0x51, 0x54, 0x52, 0x59, 0x56, 0x77, 0x58, 0xA0, 0x5B, 0x80,
+    0x42, 0x51, 0x05, 0x56, 0x0C, 0x1A, 0x2C, 0x83, 0x61, 0x6E, 0x74, 0x00, 0x0F, 0x2C, 0x83, 0x61,
+    0x73, 0x74, 0x00, 0x42, 0x44, 0x05, 0x4C, 0x10, 0x42, 0x57, 0x05, 0x5A, 0x05, 0x2C, 0x83, 0x68,
+    0x61, 0x74, 0x00, 0x1A, 0x2C, 0x82, 0x74, 0x68, 0x00, 0x42, 0x51, 0x05, 0x55, 0x12, 0x0C, 0x09,
+    0x42, 0x48, 0x05, 0x51, 0x08, 0x07, 0x01, 0x0A, 0x0C, 0x01, 0x07, 0x06, 0x12, 0x13, 0x1C, 0x0B,
+    0x80, 0x65, 0x00, 0x16, 0x0C, 0x2C, 0x01, 0xCD, 0x42, 0x4F, 0x05, 0x51, 0x0D, 0x04, 0x2C, 0x83,
+    0x20, 0x6C, 0x6F, 0x74, 0x00, 0x42, 0x4C, 0x05, 0x52, 0x0A, 0x2C, 0x82, 0x74, 0x6F, 0x00, 0x2C,
+    0x84, 0x6E, 0x6F, 0x74, 0x65, 0x00, 0x18, 0x17, 0x2C, 0x83, 0x72, 0x75, 0x73, 0x74, 0x00, 0x11,
+    0x08, 0x2C, 0x84, 0x6E, 0x65, 0x78, 0x74, 0x00, 0x43, 0x52, 0x07, 0x55, 0x0E, 0x57, 0x17, 0x17,
+    0x1C, 0x2C, 0x83, 0x6F, 0x75, 0x00, 0x0B, 0x17, 0x2C, 0x81, 0x6F, 0x75, 0x67, 0x68, 0x00, 0x16,
+    0x0D, 0x2C, 0x83, 0x75, 0x73, 0x74, 0x00, 0x08, 0x43, 0x44, 0x07, 0x4B, 0x0A, 0x52, 0x12, 0x0B,
+    0x01, 0x0B, 0x04, 0x2C, 0x84, 0x68, 0x61, 0x76, 0x65, 0x00, 0x0F, 0x2C, 0x82, 0x76, 0x65, 0x00,
+    0x44, 0x48, 0x09, 0x4B, 0x12, 0x51, 0x1A, 0x52, 0x22, 0x0C, 0x1A, 0x2C, 0x84, 0x76, 0x69, 0x65,
+    0x77, 0x00, 0x12, 0x16, 0x2C, 0x83, 0x68, 0x6F, 0x77, 0x00, 0x12, 0x0E, 0x2C, 0x83, 0x6E, 0x6F,
+    0x77, 0x00, 0x0E, 0x11, 0x2C, 0x84, 0x6B, 0x6E, 0x6F, 0x77, 0x00, 0x44, 0x48, 0x09, 0x4B, 0x1D,
+    0x52, 0x25, 0x55, 0x2D, 0x42, 0x55, 0x05, 0x57, 0x0C, 0x19, 0x2C, 0x83, 0x65, 0x72, 0x79, 0x00,
+    0x0B, 0x2C, 0x84, 0x74, 0x68, 0x65, 0x79, 0x00, 0x08, 0x17, 0x2C, 0x83, 0x68, 0x65, 0x79, 0x00,
+    0x13, 0x06, 0x2C, 0x83, 0x6F, 0x70, 0x79, 0x00, 0x04, 0x13, 0x2C, 0x81, 0x74, 0x79, 0x00, 0x17,
+    0x11, 0x04, 0x06, 0x81, 0x27, 0x74, 0x00
+};
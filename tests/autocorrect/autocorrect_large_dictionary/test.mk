@@ -0,0 +1,7 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+AUTOCORRECT_ENABLE = yes
+
+# autocorrect_data.h is generated from dictionary.txt with
+#   qmk generate-autocorrect-data tests/autocorrect/autocorrect_large_dictionary/dictionary.txt -o tests/autocorrect/autocorrect_large_dictionary/autocorrect_data.h
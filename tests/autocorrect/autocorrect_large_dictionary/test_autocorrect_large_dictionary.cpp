@@ -0,0 +1,133 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_replay.hpp"
+
+/* The text typed so far, corrections are applied to it instead of being sent. */
+static std::string text;
+
+extern "C" bool apply_autocorrect(uint8_t backspaces, const char *str, char *typo, char *correct) {
+    text.erase(text.size() - std::min<size_t>(backspaces, text.size()));
+    text += str;
+    return false;
+}
+
+static std::string trim(const std::string &s) {
+    size_t first = s.find_first_not_of(" \t\r\n");
+    size_t last  = s.find_last_not_of(" \t\r\n");
+    return first == std::string::npos ? "" : s.substr(first, last - first + 1);
+}
+
+/* The entries of dictionary.txt, which autocorrect_data.h was generated from. */
+static std::vector<std::pair<std::string, std::string>> read_dictionary(void) {
+    std::vector<std::pair<std::string, std::string>> entries;
+    std::ifstream                                    file(test_data_path(__FILE__, "dictionary.txt"));
+    std::string                                      line;
+
+    while (std::getline(file, line)) {
+        size_t arrow = line.find("->");
+        if (line.empty() || line[0] == '#' || arrow == std::string::npos) {
+            continue;
+        }
+        std::string typo = trim(line.substr(0, arrow));
+        size_t      first = typo.find_first_not_of(':');
+        size_t      last  = typo.find_last_not_of(':');
+        entries.emplace_back(typo.substr(first, last - first + 1), trim(line.substr(arrow + 2)));
+    }
+    return entries;
+}
+
+static uint16_t char_to_keycode(char c) {
+    switch (c) {
+        case 'a' ... 'z':
+            return KC_A + (c - 'a');
+        case '\'':
+            return KC_QUOTE;
+        default:
+            return KC_SPACE;
+    }
+}
+
+class AutocorrectLargeDictionary : public TestFixture {
+   public:
+    void SetUp() override {
+        autocorrect_enable();
+        text.clear();
+    }
+
+    /* Types `word` between spaces, and returns what ends up in the text for it. */
+    std::string type_word(const std::string &word) {
+        keyrecord_t record     = {};
+        record.event.type      = KEY_EVENT;
+        record.event.pressed   = true;
+        std::string const line = " " + word + " ";
+
+        text.clear();
+        for (char c : line) {
+            if (process_autocorrect(char_to_keycode(c), &record)) {
+                text += c;
+            }
+        }
+        return text;
+    }
+};
+
+TEST_F(AutocorrectLargeDictionary, EveryTypoIsCorrected) {
+    TestDriver driver;
+    auto       entries = read_dictionary();
+
+    ASSERT_GT(entries.size(), 3000);
+    for (auto &entry : entries) {
+        EXPECT_EQ(type_word(entry.first), " " + entry.second + " ") << "typo: " << entry.first;
+    }
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(AutocorrectLargeDictionary, CorrectionsAreKept) {
+    TestDriver driver;
+
+    for (auto &entry : read_dictionary()) {
+        if (entry.second.find_first_not_of("abcdefghijklmnopqrstuvwxyz") == std::string::npos) {
+            EXPECT_EQ(type_word(entry.second), " " + entry.second + " ");
+        }
+    }
+    VERIFY_AND_CLEAR(driver);
+}
+
+/* Types every typo and every correction, most of the keystrokes walk a few nodes
+ * of the dictionary before finding no typo. */
+TEST_F(AutocorrectLargeDictionary, Benchmark) {
+    TestDriver  driver;
+    auto        entries    = read_dictionary();
+    const int   rounds     = 20;
+    size_t      keystrokes = 0;
+    keyrecord_t record     = {};
+    record.event.type      = KEY_EVENT;
+    record.event.pressed   = true;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; round++) {
+        for (auto &entry : entries) {
+            for (auto &word : {entry.first, entry.second}) {
+                for (char c : " " + word) {
+                    process_autocorrect(char_to_keycode(c), &record);
+                    keystrokes++;
+                }
+            }
+        }
+    }
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+    RecordProperty("entries", std::to_string(entries.size()));
+    RecordProperty("ns_per_keystroke", std::to_string(elapsed.count() / keystrokes));
+    printf("%zu entries: %.2f ns per keystroke\n", entries.size(), elapsed.count() / keystrokes);
+    VERIFY_AND_CLEAR(driver);
+}
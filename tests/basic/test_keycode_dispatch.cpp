@@ -0,0 +1,73 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include "keycodes.h"
+#include "test_common.hpp"
+
+class KeycodeDispatch : public TestFixture {};
+
+TEST_F(KeycodeDispatch, DecodesEveryRange) {
+    EXPECT_EQ(action_for_keycode(KC_NO).code, ACTION_NO);
+    EXPECT_EQ(action_for_keycode(KC_TRANSPARENT).code, ACTION_TRANSPARENT);
+    EXPECT_EQ(action_for_keycode(KC_A).code, ACTION_KEY(KC_A));
+    EXPECT_EQ(action_for_keycode(KC_EXSEL).code, ACTION_KEY(KC_EXSEL));
+    EXPECT_EQ(action_for_keycode(KC_LEFT_CTRL).code, ACTION_KEY(KC_LEFT_CTRL));
+    EXPECT_EQ(action_for_keycode(KC_RIGHT_GUI).code, ACTION_KEY(KC_RIGHT_GUI));
+    EXPECT_EQ(action_for_keycode(MS_UP).code, ACTION_MOUSEKEY(MS_UP));
+    EXPECT_EQ(action_for_keycode(MS_ACL2).code, ACTION_MOUSEKEY(MS_ACL2));
+#ifdef EXTRAKEY_ENABLE
+    EXPECT_EQ(action_for_keycode(KC_SYSTEM_POWER).code, ACTION_USAGE_SYSTEM(KEYCODE2SYSTEM(KC_SYSTEM_POWER)));
+    EXPECT_EQ(action_for_keycode(KC_AUDIO_MUTE).code, ACTION_USAGE_CONSUMER(KEYCODE2CONSUMER(KC_AUDIO_MUTE)));
+#endif
+    EXPECT_EQ(action_for_keycode(LCTL(KC_A)).code, ACTION_MODS_KEY(MOD_LCTL, KC_A));
+    EXPECT_EQ(action_for_keycode(RSFT_T(KC_B)).code, ACTION_MODS_TAP_KEY(MOD_RSFT, KC_B));
+    EXPECT_EQ(action_for_keycode(LT(3, KC_C)).code, ACTION_LAYER_TAP_KEY(3, KC_C));
+    EXPECT_EQ(action_for_keycode(LM(2, MOD_LALT)).code, ACTION_LAYER_MODS(2, MOD_LALT));
+    EXPECT_EQ(action_for_keycode(TO(4)).code, ACTION_LAYER_GOTO(4));
+    EXPECT_EQ(action_for_keycode(MO(5)).code, ACTION_LAYER_MOMENTARY(5));
+    EXPECT_EQ(action_for_keycode(DF(6)).code, ACTION_DEFAULT_LAYER_SET(6));
+    EXPECT_EQ(action_for_keycode(TG(7)).code, ACTION_LAYER_TOGGLE(7));
+    EXPECT_EQ(action_for_keycode(OSL(8)).code, ACTION_LAYER_ONESHOT(8));
+    EXPECT_EQ(action_for_keycode(OSM(MOD_LGUI)).code, ACTION_MODS_ONESHOT(MOD_LGUI));
+    EXPECT_EQ(action_for_keycode(TT(9)).code, ACTION_LAYER_TAP_TOGGLE(9));
+}
+
+TEST_F(KeycodeDispatch, UnhandledKeycodesDecodeToNothing) {
+    for (uint16_t keycode : {(uint16_t)(KC_RIGHT_GUI + 1), (uint16_t)(KC_LAUNCHPAD + 1), (uint16_t)PDF(1), (uint16_t)(QK_LAYER_TAP_TOGGLE_MAX + 0x100), (uint16_t)QK_TAP_DANCE, (uint16_t)QK_BOOTLOADER, (uint16_t)QK_USER, (uint16_t)QK_UNICODEMAP, (uint16_t)0xFFFF}) {
+        EXPECT_EQ(action_for_keycode(keycode).code, ACTION_NO) << "keycode 0x" << std::hex << keycode;
+    }
+}
+
+/* Decodes every keycode of each range, and prints the time spent per keycode. */
+TEST_F(KeycodeDispatch, Benchmark) {
+    const struct {
+        const char *name;
+        uint16_t    first;
+        uint16_t    last;
+    } ranges[] = {
+        {"basic", QK_BASIC, QK_BASIC_MAX},
+        {"mods", QK_MODS, QK_MODS_MAX},
+        {"mod_tap", QK_MOD_TAP, QK_MOD_TAP_MAX},
+        {"layer_tap", QK_LAYER_TAP, QK_LAYER_TAP_MAX},
+        {"layer", QK_LAYER_MOD, QK_PERSISTENT_DEF_LAYER_MAX},
+        {"quantum", QK_SWAP_HANDS, QK_USER_MAX},
+    };
+    const unsigned rounds = 200;
+    uint32_t       sum    = 0;
+
+    for (auto &range : ranges) {
+        auto start = std::chrono::steady_clock::now();
+        for (unsigned round = 0; round < rounds; round++) {
+            for (uint32_t keycode = range.first; keycode <= range.last; keycode++) {
+                sum += action_for_keycode(keycode).code;
+            }
+        }
+        std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+        double ns_per_keycode = elapsed.count() / ((double)rounds * (range.last - range.first + 1));
+        RecordProperty(range.name, std::to_string(ns_per_keycode));
+        printf("%-10s %.2f ns per keycode\n", range.name, ns_per_keycode);
+    }
+    printf("checksum %u\n", (unsigned)sum);
+}
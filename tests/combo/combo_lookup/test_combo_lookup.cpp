@@ -0,0 +1,236 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <set>
+#include <vector>
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "keymap_introspection.h"
+}
+
+using testing::_;
+using testing::InSequence;
+
+#define SYNTHETIC_PAIRS 300
+#define SYNTHETIC_TRIPLES 220
+#define SYNTHETIC_COMBOS (SYNTHETIC_PAIRS + SYNTHETIC_TRIPLES)
+#define SYNTHETIC_KEYCODE KC_F24
+
+/* The keys of the synthetic combos, every letter and number. */
+static const uint16_t pool_first = KC_A;
+static const uint16_t pool_last  = KC_0;
+
+static std::array<std::array<uint16_t, 4>, SYNTHETIC_COMBOS> synthetic_keys;
+static std::array<combo_t, SYNTHETIC_COMBOS>                 synthetic_combos;
+
+/* Distinct pairs and then distinct triples of the pool, in a fixed pseudo-random order. */
+static void build_synthetic_combos(void) {
+    std::set<std::vector<uint16_t>> seen;
+    uint32_t                        rng   = 0x2545F491;
+    size_t                          count = 0;
+
+    while (count < SYNTHETIC_COMBOS) {
+        size_t                length = count < SYNTHETIC_PAIRS ? 2 : 3;
+        std::vector<uint16_t> keys;
+        while (keys.size() < length) {
+            rng ^= rng << 13;
+            rng ^= rng >> 17;
+            rng ^= rng << 5;
+            uint16_t keycode = pool_first + rng % (pool_last - pool_first + 1);
+            if (std::find(keys.begin(), keys.end(), keycode) == keys.end()) {
+                keys.push_back(keycode);
+            }
+        }
+        std::vector<uint16_t> sorted = keys;
+        std::sort(sorted.begin(), sorted.end());
+        if (!seen.insert(sorted).second) {
+            continue;
+        }
+
+        synthetic_keys[count].fill(COMBO_END);
+        std::copy(keys.begin(), keys.end(), synthetic_keys[count].begin());
+        synthetic_combos[count]         = {};
+        synthetic_combos[count].keys    = synthetic_keys[count].data();
+        synthetic_combos[count].keycode = SYNTHETIC_KEYCODE;
+        count++;
+    }
+}
+
+extern "C" uint16_t combo_count(void) {
+    return combo_count_raw() + SYNTHETIC_COMBOS;
+}
+
+extern "C" combo_t *combo_get(uint16_t combo_idx) {
+    if (combo_idx < combo_count_raw()) {
+        return combo_get_raw(combo_idx);
+    }
+    return &synthetic_combos[combo_idx - combo_count_raw()];
+}
+
+class ComboLookup : public TestFixture {
+   public:
+    static void SetUpTestCase() {
+        build_synthetic_combos();
+        TestFixture::SetUpTestCase();
+    }
+};
+
+TEST_F(ComboLookup, ComboAmongManyFires) {
+    TestDriver driver;
+    KeymapKey  key_f13(0, 0, 0, KC_F13);
+    KeymapKey  key_f14(0, 1, 0, KC_F14);
+    set_keymap({key_f13, key_f14});
+
+    EXPECT_REPORT(driver, (KC_ESCAPE));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_f13, key_f14});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboLookup, LongerOverlappingComboWins) {
+    TestDriver driver;
+    KeymapKey  key_f13(0, 0, 0, KC_F13);
+    KeymapKey  key_f14(0, 1, 0, KC_F14);
+    KeymapKey  key_f15(0, 2, 0, KC_F15);
+    set_keymap({key_f13, key_f14, key_f15});
+
+    EXPECT_REPORT(driver, (KC_TAB));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_f13, key_f14, key_f15});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboLookup, CombosWithoutCommonKeysBothFire) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_f13(0, 0, 0, KC_F13);
+    KeymapKey  key_f14(0, 1, 0, KC_F14);
+    KeymapKey  key_f16(0, 2, 0, KC_F16);
+    KeymapKey  key_f17(0, 3, 0, KC_F17);
+    set_keymap({key_f13, key_f14, key_f16, key_f17});
+
+    EXPECT_REPORT(driver, (KC_ESCAPE));
+    EXPECT_REPORT(driver, (KC_ESCAPE, KC_ENTER));
+    EXPECT_REPORT(driver, (KC_ENTER));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_f13, key_f14, key_f16, key_f17});
+    VERIFY_AND_CLEAR(driver);
+}
+
+/* Of two combos of the same length, the one completed last is kept. */
+TEST_F(ComboLookup, LaterOverlappingComboWins) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_f15(0, 0, 0, KC_F15);
+    KeymapKey  key_f16(0, 1, 0, KC_F16);
+    KeymapKey  key_f17(0, 2, 0, KC_F17);
+    set_keymap({key_f15, key_f16, key_f17});
+
+    EXPECT_REPORT(driver, (KC_F15));
+    EXPECT_REPORT(driver, (KC_F15, KC_ENTER));
+    EXPECT_REPORT(driver, (KC_ENTER));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_f15, key_f16, key_f17});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboLookup, SyntheticCombosFire) {
+    TestDriver driver;
+
+    for (uint16_t index : {0, SYNTHETIC_PAIRS / 2, SYNTHETIC_PAIRS - 1}) {
+        KeymapKey key_first(0, 0, 0, synthetic_keys[index][0]);
+        KeymapKey key_second(0, 1, 0, synthetic_keys[index][1]);
+        set_keymap({key_first, key_second});
+
+        EXPECT_REPORT(driver, (SYNTHETIC_KEYCODE));
+        EXPECT_EMPTY_REPORT(driver);
+        tap_combo({key_first, key_second});
+        VERIFY_AND_CLEAR(driver);
+    }
+}
+
+/* The first key of a combo, tapped alone, doesn't count towards the combo later. */
+TEST_F(ComboLookup, PartialCombosAreCleared) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_first(0, 0, 0, synthetic_keys[0][0]);
+    KeymapKey  key_second(0, 1, 0, synthetic_keys[0][1]);
+    set_keymap({key_first, key_second});
+
+    EXPECT_REPORT(driver, (synthetic_keys[0][0]));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_first);
+    EXPECT_REPORT(driver, (synthetic_keys[0][1]));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_second);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboLookup, KeysOfNoComboAreNotDelayed) {
+    TestDriver driver;
+    KeymapKey  key_f20(0, 0, 0, KC_F20);
+    set_keymap({key_f20});
+
+    EXPECT_REPORT(driver, (KC_F20));
+    key_f20.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_f20.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+static double ns_per_event(const std::vector<KeymapKey> &keys, int rounds) {
+    keyevent_t event = {};
+    event.type       = KEY_EVENT;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; round++) {
+        for (auto &key : keys) {
+            event.key     = key.position;
+            event.time    = timer_read();
+            event.pressed = true;
+            action_exec(event);
+            event.pressed = false;
+            action_exec(event);
+        }
+    }
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / (2.0 * rounds * keys.size());
+}
+
+/* Taps every key of the pool, each of them is in about 40 combos, and then keys
+ * of no combo. The difference is the time spent on the combos. */
+TEST_F(ComboLookup, Benchmark) {
+    TestDriver             driver;
+    const int              rounds = 2000;
+    std::vector<KeymapKey> combo_keys;
+    std::vector<KeymapKey> other_keys;
+
+    for (uint16_t keycode = pool_first; keycode <= pool_last; keycode++) {
+        uint16_t position = keycode - pool_first;
+        combo_keys.emplace_back(0, position % MATRIX_COLS, position / MATRIX_COLS, keycode);
+        add_key(combo_keys.back());
+    }
+    for (uint16_t position = combo_keys.size(); position < MATRIX_ROWS * MATRIX_COLS; position++) {
+        other_keys.emplace_back(0, position % MATRIX_COLS, position / MATRIX_COLS, KC_F1 + other_keys.size());
+        add_key(other_keys.back());
+    }
+    EXPECT_ANY_REPORT(driver).Times(testing::AnyNumber());
+
+    double combo_ns = ns_per_event(combo_keys, rounds);
+    double other_ns = ns_per_event(other_keys, rounds * combo_keys.size() / other_keys.size());
+
+    RecordProperty("combos", std::to_string(combo_count()));
+    RecordProperty("ns_per_combo_key_event", std::to_string(combo_ns));
+    RecordProperty("ns_per_other_key_event", std::to_string(other_ns));
+    printf("%u combos: %.2f ns per event of a combo key, %.2f ns per event of another key\n", combo_count(), combo_ns, other_ns);
+}
@@ -0,0 +1,20 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+enum combos { esc, tab, bspc, ent };
+
+uint16_t const esc_combo[]  = {KC_F13, KC_F14, COMBO_END};
+uint16_t const tab_combo[]  = {KC_F13, KC_F14, KC_F15, COMBO_END};
+uint16_t const bspc_combo[] = {KC_F15, KC_F16, COMBO_END};
+uint16_t const ent_combo[]  = {KC_F16, KC_F17, COMBO_END};
+
+// clang-format off
+combo_t key_combos[] = {
+    [esc]  = COMBO(esc_combo, KC_ESC),
+    [tab]  = COMBO(tab_combo, KC_TAB),
+    [bspc] = COMBO(bspc_combo, KC_BSPC),
+    [ent]  = COMBO(ent_combo, KC_ENT)
+};
+// clang-format on
@@ -0,0 +1,152 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+#include "keycodes.h"
+#include "test_common.hpp"
+
+extern "C" void advance_time(uint32_t ms);
+
+using testing::_;
+using testing::InSequence;
+
+struct processed_t {
+    uint16_t keycode;
+    uint16_t time;
+    bool     pressed;
+
+    bool operator==(const processed_t &other) const {
+        return keycode == other.keycode && time == other.time && pressed == other.pressed;
+    }
+};
+
+static std::vector<processed_t> processed;
+static uint16_t                 slow_keycode;
+
+extern "C" bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+    processed.push_back({keycode, record->event.time, record->event.pressed});
+    if (keycode == slow_keycode && record->event.pressed) {
+        // stands in for a long send_string()
+        advance_time(50);
+    }
+    return true;
+}
+
+static keyevent_t key_event(uint8_t row, uint8_t col, bool pressed, uint16_t time) {
+    keyevent_t event = {};
+    event.key.row    = row;
+    event.key.col    = col;
+    event.time       = time;
+    event.type       = KEY_EVENT;
+    event.pressed    = pressed;
+    return event;
+}
+
+class KeyEventQueue : public TestFixture {
+   protected:
+    void SetUp() override {
+        processed.clear();
+        slow_keycode = KC_NO;
+    }
+};
+
+TEST_F(KeyEventQueue, EventsArePoppedInOrder) {
+    keyevent_t event;
+
+    for (uint8_t i = 0; i < KEY_EVENT_QUEUE_SIZE; i++) {
+        EXPECT_TRUE(key_event_queue_push(key_event(1, i, true, i)));
+    }
+    EXPECT_FALSE(key_event_queue_push(key_event(2, 0, true, 0)));
+    EXPECT_EQ(key_event_queue_count(), KEY_EVENT_QUEUE_SIZE);
+
+    for (uint8_t i = 0; i < KEY_EVENT_QUEUE_SIZE; i++) {
+        ASSERT_TRUE(key_event_queue_pop(&event));
+        EXPECT_EQ(event.key.row, 1);
+        EXPECT_EQ(event.key.col, i);
+    }
+    EXPECT_FALSE(key_event_queue_pop(&event));
+    EXPECT_EQ(key_event_queue_count(), 0);
+}
+
+TEST_F(KeyEventQueue, IndicesWrapAround) {
+    keyevent_t event;
+
+    for (uint16_t i = 0; i < 600; i++) {
+        ASSERT_TRUE(key_event_queue_push(key_event(i % 7, i % 5, i & 1, i)));
+        if (i % 3 == 0) {
+            continue;
+        }
+        ASSERT_TRUE(key_event_queue_pop(&event));
+        EXPECT_EQ(event.time, i - key_event_queue_count());
+        key_event_queue_clear();
+    }
+    EXPECT_EQ(key_event_queue_count(), 0);
+}
+
+TEST_F(KeyEventQueue, EventsOfOneScanKeepTheScanTime) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b = KeymapKey(0, 1, 0, KC_B);
+    auto       key_c = KeymapKey(0, 2, 0, KC_C);
+
+    set_keymap({key_a, key_b, key_c});
+    slow_keycode = KC_A;
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_REPORT(driver, (KC_A, KC_B));
+    EXPECT_REPORT(driver, (KC_A, KC_B, KC_C));
+    uint16_t scan_time = timer_read();
+    key_a.press();
+    key_b.press();
+    key_c.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(processed, std::vector<processed_t>({{KC_A, scan_time, true}, {KC_B, scan_time, true}, {KC_C, scan_time, true}}));
+
+    EXPECT_REPORT(driver, (KC_B, KC_C));
+    EXPECT_REPORT(driver, (KC_C));
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    key_b.release();
+    key_c.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyEventQueue, ChangesThatDoNotFitWaitForTheNextScan) {
+    TestDriver                   driver;
+    std::vector<KeymapKey>       keys;
+    std::vector<processed_t>     expected;
+    const std::vector<uint16_t> keycodes = {KC_A, KC_B, KC_C, KC_D, KC_E, KC_F};
+
+    for (uint8_t i = 0; i < keycodes.size(); i++) {
+        keys.push_back(KeymapKey(0, i, 0, keycodes[i]));
+    }
+    set_keymap({keys[0], keys[1], keys[2], keys[3], keys[4], keys[5]});
+
+    EXPECT_ANY_REPORT(driver).Times(keycodes.size());
+    for (auto &key : keys) {
+        key.press();
+    }
+    uint16_t first_scan = timer_read();
+    run_one_scan_loop();
+    EXPECT_EQ(processed.size(), KEY_EVENT_QUEUE_SIZE);
+    uint16_t second_scan = timer_read();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    for (uint8_t i = 0; i < keycodes.size(); i++) {
+        expected.push_back({keycodes[i], i < KEY_EVENT_QUEUE_SIZE ? first_scan : second_scan, true});
+    }
+    EXPECT_EQ(processed, expected);
+
+    EXPECT_ANY_REPORT(driver).Times(keycodes.size());
+    for (auto &key : keys) {
+        key.release();
+    }
+    run_one_scan_loop();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
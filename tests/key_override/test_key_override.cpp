@@ -0,0 +1,274 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include "keycodes.h"
+#include "test_common.hpp"
+#include "test_replay.hpp"
+
+extern "C" {
+#include "keymap_introspection.h"
+}
+
+using testing::_;
+using testing::AnyNumber;
+using testing::InSequence;
+
+#define SYNTHETIC_OVERRIDES 240
+
+static const uint16_t replacements[] = {
+    KC_F1, KC_F2, KC_F3, KC_F4, KC_F5, KC_F6, KC_F7, KC_F8, KC_F9, KC_F10, KC_F11, KC_F12, KC_F13, KC_F14, KC_F15, KC_F16, KC_F17, KC_F18, KC_F19, KC_F20, KC_F21, KC_F22, KC_F23, KC_F24,
+};
+static const uint8_t trigger_mods[] = {
+    MOD_MASK_CTRL, MOD_MASK_SHIFT, MOD_MASK_ALT, MOD_MASK_GUI, MOD_MASK_CS, MOD_MASK_CA, MOD_MASK_SA, MOD_BIT(KC_LEFT_CTRL), MOD_MASK_CSA, MOD_BIT(KC_LEFT_SHIFT),
+};
+
+static std::array<key_override_t, SYNTHETIC_OVERRIDES + 1> synthetic_overrides;
+
+/* Overrides of every letter with various mods, some of them only on layer 1, some
+ * with negative mods or any one of their mods, and a last one without a trigger. */
+static void build_synthetic_overrides(void) {
+    for (uint16_t i = 0; i < SYNTHETIC_OVERRIDES; i++) {
+        key_override_t &override = synthetic_overrides[i];
+
+        override                   = {};
+        override.trigger           = KC_A + i % 26;
+        override.trigger_mods      = trigger_mods[(i / 26) % (sizeof(trigger_mods) / sizeof(trigger_mods[0]))];
+        override.layers            = i % 5 == 0 ? (layer_state_t)1 << 1 : ~(layer_state_t)0;
+        override.negative_mod_mask = i % 7 == 3 ? MOD_MASK_GUI : 0;
+        override.suppressed_mods   = override.trigger_mods;
+        override.replacement       = replacements[i % (sizeof(replacements) / sizeof(replacements[0]))];
+        override.options           = (ko_option_t)(ko_options_default | (i % 11 == 0 ? ko_option_one_mod : 0));
+    }
+
+    key_override_t &override = synthetic_overrides[SYNTHETIC_OVERRIDES];
+    override                 = {};
+    override.trigger         = KC_NO;
+    override.trigger_mods    = MOD_BIT(KC_LEFT_CTRL) | MOD_BIT(KC_LEFT_GUI);
+    override.layers          = ~(layer_state_t)0;
+    override.suppressed_mods = override.trigger_mods;
+    override.replacement     = KC_ESCAPE;
+    override.options         = ko_options_default;
+}
+
+extern "C" uint16_t key_override_count(void) {
+    return key_override_count_raw() + synthetic_overrides.size();
+}
+
+extern "C" const key_override_t *key_override_get(uint16_t key_override_idx) {
+    if (key_override_idx < key_override_count_raw()) {
+        return key_override_get_raw(key_override_idx);
+    }
+    if (key_override_idx < key_override_count()) {
+        return &synthetic_overrides[key_override_idx - key_override_count_raw()];
+    }
+    return NULL;
+}
+
+/* Every test runs with and without KEY_OVERRIDE_LOOKUP_SIZE, see key_override_lookup/test.mk. */
+class KeyOverride : public TestFixture {
+   public:
+    static void SetUpTestCase() {
+        build_synthetic_overrides();
+        TestFixture::SetUpTestCase();
+    }
+
+   protected:
+    KeymapKey key_bspc  = KeymapKey(0, 6, 2, KC_BSPC);
+    KeymapKey key_lctl  = KeymapKey(0, 7, 2, KC_LEFT_CTRL);
+    KeymapKey key_lsft  = KeymapKey(0, 8, 2, KC_LEFT_SHIFT);
+    KeymapKey key_lalt  = KeymapKey(0, 9, 2, KC_LEFT_ALT);
+    KeymapKey key_lgui  = KeymapKey(0, 0, 3, KC_LEFT_GUI);
+    KeymapKey key_layer = KeymapKey(0, 1, 3, MO(1));
+
+    void SetUp() override {
+        for (uint16_t i = 0; i < 26; i++) {
+            add_key(KeymapKey(0, i % MATRIX_COLS, i / MATRIX_COLS, KC_A + i));
+            add_key(KeymapKey(1, i % MATRIX_COLS, i / MATRIX_COLS, KC_A + i));
+        }
+        for (auto &key : {key_bspc, key_lctl, key_lsft, key_lalt, key_lgui, key_layer}) {
+            add_key(key);
+            add_key(KeymapKey(1, key.position.col, key.position.row, KC_TRNS));
+        }
+    }
+
+    KeymapKey letter(uint16_t keycode) {
+        uint16_t i = keycode - KC_A;
+        return KeymapKey(0, i % MATRIX_COLS, i / MATRIX_COLS, keycode);
+    }
+
+    std::vector<keypos_t> keys() const {
+        std::vector<keypos_t> positions;
+        for (auto &key : keymap) {
+            if (key.layer == 0) {
+                positions.push_back(key.position);
+            }
+        }
+        // the mods come up as often as five letters
+        for (int i = 0; i < 4; i++) {
+            for (auto &key : {key_lctl, key_lsft, key_lalt, key_lgui}) {
+                positions.push_back(key.position);
+            }
+        }
+        return positions;
+    }
+};
+
+TEST_F(KeyOverride, ShiftBackspaceSendsDelete) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    key_lsft.press();
+    run_one_scan_loop();
+    EXPECT_REPORT(driver, (KC_DELETE));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    tap_key(key_bspc);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_lsft.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, FirstMatchingOverrideActivates) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_b = letter(KC_B);
+
+    // synthetic override 1: ctrl + b
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL));
+    key_lctl.press();
+    run_one_scan_loop();
+    EXPECT_REPORT(driver, (KC_F2));
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL));
+    tap_key(key_b);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_lctl.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, OverridesOfOtherLayersAreSkipped) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a = letter(KC_A);
+
+    // synthetic override 0 is on layer 1 only, 182 is the next one of ctrl + a
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL));
+    key_lctl.press();
+    run_one_scan_loop();
+    EXPECT_REPORT(driver, (replacements[182 % (sizeof(replacements) / sizeof(replacements[0]))]));
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL));
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    key_layer.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_F1));
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL));
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    key_layer.release();
+    key_lctl.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, NegativeModsSkipTheOverride) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_d = letter(KC_D);
+
+    // synthetic override 3 (ctrl + d) has gui as negative mod, 81 (gui + d) is the next one
+    EXPECT_ANY_REPORT(driver).Times(2);
+    key_lgui.press();
+    run_one_scan_loop();
+    key_lctl.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // the last synthetic override, ctrl + gui without a trigger, is active until d goes down
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL, KC_LEFT_GUI));
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL, replacements[81 % (sizeof(replacements) / sizeof(replacements[0]))]));
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL, KC_LEFT_GUI));
+    tap_key(key_d);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    key_lctl.release();
+    key_lgui.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+/* Replays ten minutes of typing with mods, the reports must be the same with and without the lookup. */
+TEST_F(KeyOverride, SessionMatchesGolden) {
+    TestDriver driver;
+    Replay     replay(driver);
+    auto       events = generate_trace(keys(), 10 * 60 * 1000, 0x4B4F);
+
+    replay.run(events);
+    VERIFY_AND_CLEAR(driver);
+
+    uint32_t digest = 2166136261u;
+    for (auto &report : replay.reports()) {
+        for (char c : report) {
+            digest = (digest ^ (uint8_t)c) * 16777619u;
+        }
+    }
+    char digest_line[32];
+    snprintf(digest_line, sizeof(digest_line), "digest %08x", digest);
+    expect_golden({"events " + std::to_string(events.size()), "reports " + std::to_string(replay.reports().size()), digest_line}, test_data_path(__FILE__, "session.golden"));
+}
+
+static double ns_per_event(const std::vector<KeymapKey> &keys, int rounds) {
+    keyrecord_t record = {};
+    record.event.type  = KEY_EVENT;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; round++) {
+        for (auto &key : keys) {
+            record.event.key     = key.position;
+            record.event.pressed = true;
+            process_key_override(key.code, &record);
+            record.event.pressed = false;
+            process_key_override(key.code, &record);
+        }
+    }
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / (2.0 * rounds * keys.size());
+}
+
+/* Taps every letter without mods, and then with a shift, which activates some overrides. */
+TEST_F(KeyOverride, Benchmark) {
+    TestDriver             driver;
+    const int              rounds = 2000;
+    std::vector<KeymapKey> letters;
+
+    for (uint16_t keycode = KC_A; keycode <= KC_Z; keycode++) {
+        letters.push_back(letter(keycode));
+    }
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+
+    double plain_ns = ns_per_event(letters, rounds);
+    add_mods(MOD_BIT(KC_LEFT_SHIFT));
+    double shift_ns = ns_per_event(letters, rounds);
+    clear_mods();
+
+    RecordProperty("overrides", std::to_string(key_override_count()));
+    RecordProperty("ns_per_event", std::to_string(plain_ns));
+    RecordProperty("ns_per_shifted_event", std::to_string(shift_ns));
+    printf("%u overrides: %.2f ns per event, %.2f ns per shifted event\n", key_override_count(), plain_ns, shift_ns);
+}
@@ -0,0 +1,160 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "latency_trace.h"
+}
+
+using testing::_;
+using testing::InSequence;
+
+// latencies are in tens of microseconds
+#define MS(ms) ((ms) * 100)
+
+class LatencyTrace : public TestFixture {
+   protected:
+    void SetUp() override {
+        latency_trace_reset();
+    }
+
+    latency_trace_summary_t get(latency_trace_stage_t stage) {
+        latency_trace_summary_t summary;
+        latency_trace_get(stage, &summary);
+        return summary;
+    }
+};
+
+TEST_F(LatencyTrace, PlainKeyIsReportedInTheSameScan) {
+    TestDriver driver;
+    InSequence s;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    key.press();
+    run_one_scan_loop();
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    auto total = get(LATENCY_TRACE_TOTAL);
+    EXPECT_EQ(total.count, 2);
+    EXPECT_EQ(total.max, 0);
+}
+
+TEST_F(LatencyTrace, ModTapIsBufferedUntilRelease) {
+    TestDriver driver;
+    InSequence s;
+    auto       key = KeymapKey(0, 0, 0, SFT_T(KC_P));
+
+    set_keymap({key});
+
+    EXPECT_NO_REPORT(driver);
+    key.press();
+    idle_for(TAPPING_TERM / 2);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_P));
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // the press waits for the release, which is reported right away
+    auto buffering = get(LATENCY_TRACE_BUFFERING);
+    EXPECT_EQ(buffering.count, 2);
+    EXPECT_EQ(buffering.min, 0);
+    EXPECT_EQ(buffering.max, MS(TAPPING_TERM / 2));
+    EXPECT_EQ(get(LATENCY_TRACE_TOTAL).max, MS(TAPPING_TERM / 2));
+    EXPECT_EQ(get(LATENCY_TRACE_PROCESSING).max, 0);
+}
+
+TEST_F(LatencyTrace, ModTapHoldIsBufferedForTheTappingTerm) {
+    TestDriver driver;
+    InSequence s;
+    auto       key = KeymapKey(0, 0, 0, SFT_T(KC_P));
+
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    key.press();
+    idle_for(TAPPING_TERM + 1);
+    VERIFY_AND_CLEAR(driver);
+
+    auto buffering = get(LATENCY_TRACE_BUFFERING);
+    EXPECT_EQ(buffering.count, 1);
+    EXPECT_EQ(buffering.max, MS(TAPPING_TERM));
+
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LatencyTrace, EventsWithoutReportAreNotCounted) {
+    TestDriver driver;
+    InSequence s;
+    auto       layer_key = KeymapKey(0, 0, 0, MO(1));
+    auto       key       = KeymapKey(1, 1, 0, KC_A);
+
+    set_keymap({layer_key, key});
+
+    EXPECT_NO_REPORT(driver);
+    layer_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(get(LATENCY_TRACE_TOTAL).count, 0);
+
+    // the layer key press doesn't get attributed to the next report
+    idle_for(10);
+    EXPECT_REPORT(driver, (KC_A));
+    key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    auto total = get(LATENCY_TRACE_TOTAL);
+    EXPECT_EQ(total.count, 1);
+    EXPECT_EQ(total.max, 0);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    layer_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LatencyTrace, MatrixEdgeStartsTheDebounceStage) {
+    TestDriver driver;
+    InSequence s;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+
+    // the test matrix isn't debounced, so the raw change is simulated
+    latency_trace_matrix_scan(true, false);
+    idle_for(5);
+
+    EXPECT_REPORT(driver, (KC_A));
+    key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(get(LATENCY_TRACE_DEBOUNCE).max, MS(5));
+    EXPECT_EQ(get(LATENCY_TRACE_TOTAL).max, MS(5));
+
+    // the edge is used up by the event
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    auto debounce = get(LATENCY_TRACE_DEBOUNCE);
+    EXPECT_EQ(debounce.count, 2);
+    EXPECT_EQ(debounce.min, 0);
+}
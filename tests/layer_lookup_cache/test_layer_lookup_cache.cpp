@@ -0,0 +1,186 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <random>
+#include <vector>
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class LayerLookupCache : public TestFixture {};
+
+TEST_F(LayerLookupCache, TransparentLayersFallThrough) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key, KeymapKey(1, 0, 0, KC_TRNS), KeymapKey(2, 0, 0, KC_TRNS), KeymapKey(3, 0, 0, KC_B)});
+
+    EXPECT_EQ(layer_switch_get_layer(key.position), 0);
+    layer_on(1);
+    layer_on(2);
+    EXPECT_EQ(layer_switch_get_layer(key.position), 0);
+    layer_on(3);
+    EXPECT_EQ(layer_switch_get_layer(key.position), 3);
+    layer_off(3);
+    EXPECT_EQ(layer_switch_get_layer(key.position), 0);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerLookupCache, DirectStateChangesAreSeen) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key, KeymapKey(1, 0, 0, KC_B)});
+
+    EXPECT_EQ(layer_switch_get_layer(key.position), 0);
+    // like the split transport does on the secondary half
+    layer_state = (layer_state_t)1 << 1;
+    EXPECT_EQ(layer_switch_get_layer(key.position), 1);
+    layer_state         = 0;
+    default_layer_state = (layer_state_t)1 << 1;
+    EXPECT_EQ(layer_switch_get_layer(key.position), 1);
+    default_layer_state = (layer_state_t)1 << 0;
+    EXPECT_EQ(layer_switch_get_layer(key.position), 0);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerLookupCache, KeymapChangesAreSeen) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key, KeymapKey(1, 0, 0, KC_TRNS)});
+
+    layer_on(1);
+    EXPECT_EQ(layer_switch_get_layer(key.position), 0);
+
+    set_keymap({key, KeymapKey(1, 0, 0, KC_B)});
+    EXPECT_EQ(layer_switch_get_layer(key.position), 1);
+
+    layer_off(1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerLookupCache, KeysAreCachedSeparately) {
+    TestDriver driver;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b = KeymapKey(0, 1, 0, KC_B);
+
+    set_keymap({key_a, key_b, KeymapKey(1, 0, 0, KC_TRNS), KeymapKey(1, 1, 0, KC_C)});
+
+    layer_on(1);
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 0);
+    EXPECT_EQ(layer_switch_get_layer(key_b.position), 1);
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 0);
+
+    layer_off(1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerLookupCache, MomentaryLayerOverTransparentKey) {
+    TestDriver driver;
+    InSequence s;
+    auto       layer_key = KeymapKey(0, 0, 0, MO(1));
+    auto       key_a     = KeymapKey(0, 1, 0, KC_A);
+    auto       key_b     = KeymapKey(0, 2, 0, KC_B);
+
+    set_keymap({layer_key, key_a, key_b, KeymapKey(1, 0, 0, KC_TRNS), KeymapKey(1, 1, 0, KC_TRNS), KeymapKey(1, 2, 0, KC_C)});
+
+    EXPECT_NO_REPORT(driver);
+    layer_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A, KC_C));
+    key_b.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // the layer key goes first, the others are released from the layer they were pressed on
+    EXPECT_NO_REPORT(driver);
+    layer_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_C));
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    key_b.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerLookupCache, LayerChangesKeepUnaffectedKeys) {
+    TestDriver driver;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b = KeymapKey(0, 1, 0, KC_B);
+
+    set_keymap({key_a, key_b, KeymapKey(1, 0, 0, KC_TRNS), KeymapKey(1, 1, 0, KC_C), KeymapKey(2, 0, 0, KC_D), KeymapKey(2, 1, 0, KC_TRNS)});
+
+    layer_on(1);
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 0);
+    EXPECT_EQ(layer_switch_get_layer(key_b.position), 1);
+    // covers key_a, which was on a lower layer, but not key_b, transparent there
+    layer_on(2);
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 2);
+    EXPECT_EQ(layer_switch_get_layer(key_b.position), 1);
+    // uncovers key_a, key_b is still on layer 1
+    layer_off(2);
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 0);
+    EXPECT_EQ(layer_switch_get_layer(key_b.position), 1);
+    // key_b falls back to the base layer
+    layer_off(1);
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 0);
+    EXPECT_EQ(layer_switch_get_layer(key_b.position), 0);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+/* Random layer changes, checked against a lookup that walks the active layers. */
+TEST_F(LayerLookupCache, RandomLayerChangesMatchAFullLookup) {
+    TestDriver        driver;
+    const uint8_t     layers = 5, keys = 4;
+    std::mt19937      random(2026);
+    std::vector<bool> transparent(layers * keys);
+
+    set_keymap({});
+    for (uint8_t layer = 0; layer < layers; layer++) {
+        for (uint8_t col = 0; col < keys; col++) {
+            transparent[layer * keys + col] = layer > 0 && random() % 2;
+            add_key(KeymapKey(layer, col, 0, transparent[layer * keys + col] ? KC_TRNS : KC_A + col));
+        }
+    }
+
+    for (int step = 0; step < 500; step++) {
+        if (random() % 8 == 0) {
+            default_layer_state = (layer_state_t)1 << (random() % 2);
+        } else {
+            layer_invert(1 + random() % (layers - 1));
+        }
+
+        layer_state_t active = layer_state | default_layer_state;
+        for (uint8_t col = 0; col < keys; col++) {
+            uint8_t expected = 0;
+            for (int8_t layer = layers - 1; layer >= 0; layer--) {
+                if ((active & ((layer_state_t)1 << layer)) && !transparent[layer * keys + col]) {
+                    expected = layer;
+                    break;
+                }
+            }
+            ASSERT_EQ(layer_switch_get_layer({.col = col, .row = 0}), expected) << "step " << step << ", key " << +col;
+        }
+    }
+
+    layer_clear();
+    default_layer_state = (layer_state_t)1 << 0;
+    VERIFY_AND_CLEAR(driver);
+}
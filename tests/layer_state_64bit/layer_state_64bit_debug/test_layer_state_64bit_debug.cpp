@@ -0,0 +1,25 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+class LayerState64BitDebug : public TestFixture {};
+
+TEST_F(LayerState64BitDebug, LayerDebugPrintsBothHalves) {
+    layer_on(1);
+    layer_on(40);
+
+    testing::internal::CaptureStdout();
+    layer_debug();
+    EXPECT_EQ(testing::internal::GetCapturedStdout(), "0000010000000002(40)");
+}
+
+TEST_F(LayerState64BitDebug, DefaultLayerDebugPrintsBothHalves) {
+    default_layer_set(((layer_state_t)1 << 63) | 1);
+
+    testing::internal::CaptureStdout();
+    default_layer_debug();
+    EXPECT_EQ(testing::internal::GetCapturedStdout(), "8000000000000001(63)");
+
+    default_layer_set(1);
+}
@@ -0,0 +1,67 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycodes.h"
+#include "test_common.hpp"
+
+using testing::_;
+
+class LayerState64Bit : public TestFixture {};
+
+TEST_F(LayerState64Bit, HighestLayerIsFound) {
+    EXPECT_EQ(MAX_LAYER, 64);
+    EXPECT_EQ(get_highest_layer((layer_state_t)0), 0);
+    EXPECT_EQ(get_highest_layer((layer_state_t)1), 0);
+    EXPECT_EQ(get_highest_layer((layer_state_t)1 << 31), 31);
+    EXPECT_EQ(get_highest_layer((layer_state_t)1 << 32), 32);
+    EXPECT_EQ(get_highest_layer(((layer_state_t)1 << 40) | 0xff), 40);
+    EXPECT_EQ(get_highest_layer(~(layer_state_t)0), 63);
+}
+
+TEST_F(LayerState64Bit, LayersAbove32CanBeTurnedOn) {
+    layer_on(47);
+    EXPECT_TRUE(layer_state_is(47));
+    EXPECT_EQ(layer_state, (layer_state_t)1 << 47);
+
+    layer_on(63);
+    EXPECT_EQ(get_highest_layer(layer_state), 63);
+
+    layer_off(47);
+    layer_off(63);
+    EXPECT_EQ(layer_state, 0);
+}
+
+TEST_F(LayerState64Bit, KeysOfLayersAbove32AreResolved) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key, KeymapKey(40, 0, 0, KC_B), KeymapKey(63, 0, 0, KC_TRNS)});
+    layer_on(40);
+    layer_on(63);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+
+    layer_clear();
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerState64Bit, LayerKeycodesClearHighLayers) {
+    TestDriver driver;
+    auto       key_to = KeymapKey(0, 0, 0, TO(2));
+
+    set_keymap({key_to, KeymapKey(2, 0, 0, KC_TRNS), KeymapKey(50, 0, 0, KC_TRNS)});
+    layer_on(50);
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_to);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(layer_state, (layer_state_t)1 << 2);
+}
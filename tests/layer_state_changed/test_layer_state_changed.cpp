@@ -0,0 +1,124 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <utility>
+#include <vector>
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+
+typedef std::vector<std::pair<layer_state_t, layer_state_t>> changes_t;
+
+static changes_t layer_changes;
+static changes_t default_layer_changes;
+static int       layer_sets;
+
+extern "C" {
+layer_state_t layer_state_set_user(layer_state_t state) {
+    layer_sets++;
+    return state;
+}
+
+void layer_state_changed_user(layer_state_t old_state, layer_state_t new_state) {
+    layer_changes.push_back({old_state, new_state});
+}
+
+void default_layer_state_changed_user(layer_state_t old_state, layer_state_t new_state) {
+    default_layer_changes.push_back({old_state, new_state});
+}
+}
+
+class LayerStateChanged : public TestFixture {
+   protected:
+    void SetUp() override {
+        TestDriver driver;
+
+        // deliver whatever the previous test left behind
+        EXPECT_NO_REPORT(driver);
+        run_one_scan_loop();
+        layer_changes.clear();
+        default_layer_changes.clear();
+        layer_sets = 0;
+    }
+};
+
+TEST_F(LayerStateChanged, MomentaryLayerIsNotifiedOnPressAndRelease) {
+    TestDriver driver;
+    auto       key_mo = KeymapKey(0, 0, 0, MO(1));
+
+    set_keymap({key_mo, KeymapKey(1, 0, 0, KC_TRNS)});
+
+    EXPECT_NO_REPORT(driver);
+    key_mo.press();
+    run_one_scan_loop();
+    EXPECT_EQ(layer_changes, changes_t({{0, 1 << 1}}));
+    key_mo.release();
+    run_one_scan_loop();
+    EXPECT_EQ(layer_changes, changes_t({{0, 1 << 1}, {1 << 1, 0}}));
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerStateChanged, ChangesOfOneLoopAreCoalesced) {
+    TestDriver driver;
+
+    layer_on(1);
+    layer_on(2);
+    layer_off(1);
+    layer_on(3);
+    EXPECT_EQ(layer_sets, 4);
+    EXPECT_TRUE(layer_changes.empty());
+
+    run_one_scan_loop();
+    EXPECT_EQ(layer_changes, changes_t({{0, (1 << 2) | (1 << 3)}}));
+
+    run_one_scan_loop();
+    EXPECT_EQ(layer_changes.size(), 1);
+}
+
+TEST_F(LayerStateChanged, ChangesThatCancelOutAreNotNotified) {
+    TestDriver driver;
+
+    layer_on(1);
+    layer_off(1);
+    run_one_scan_loop();
+    EXPECT_TRUE(layer_changes.empty());
+}
+
+/* The layer tap is resolved when the other key is released, both in one scan. */
+TEST_F(LayerStateChanged, LayerTapHoldIsNotifiedOnce) {
+    TestDriver driver;
+    auto       key_lt = KeymapKey(0, 0, 0, LT(1, KC_P));
+    auto       key_a  = KeymapKey(0, 1, 0, KC_A);
+
+    set_keymap({key_lt, key_a, KeymapKey(1, 1, 0, KC_B)});
+
+    EXPECT_NO_REPORT(driver);
+    key_lt.press();
+    idle_for(TAPPING_TERM + 1);
+    EXPECT_EQ(layer_changes, changes_t({{0, 1 << 1}}));
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    key_lt.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(layer_changes, changes_t({{0, 1 << 1}, {1 << 1, 0}}));
+}
+
+TEST_F(LayerStateChanged, DefaultLayerChangesAreNotified) {
+    TestDriver    driver;
+    layer_state_t initial = default_layer_state;
+
+    default_layer_set(1 << 2);
+    default_layer_set(1 << 3);
+    run_one_scan_loop();
+    EXPECT_EQ(default_layer_changes, changes_t({{initial, 1 << 3}}));
+    EXPECT_TRUE(layer_changes.empty());
+
+    default_layer_set(initial);
+}
@@ -0,0 +1,20 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+// clang-format off
+const leader_sequence_t PROGMEM leader_sequences[] = {
+    LEADER_SEQUENCE(KC_1, KC_A),
+    LEADER_SEQUENCE(KC_2, KC_A, KC_B),
+    LEADER_SEQUENCE(KC_3, KC_C, KC_D),
+    LEADER_SEQUENCE(KC_4, KC_E, KC_F, KC_G, KC_H, KC_I, KC_J, KC_K),
+    LEADER_SEQUENCE_ACTION(KC_X, KC_Y),
+};
+// clang-format on
+
+uint16_t leader_sequence_matched_index = UINT16_MAX;
+
+void leader_sequence_matched_user(uint16_t index) {
+    leader_sequence_matched_index = index;
+}
@@ -0,0 +1,150 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+
+extern "C" uint16_t leader_sequence_matched_index;
+
+class LeaderSequenceTable : public TestFixture {
+   protected:
+    void SetUp() override {
+        leader_sequence_matched_index = UINT16_MAX;
+    }
+
+    void tap_keys(std::initializer_list<KeymapKey> keys) {
+        for (auto &key : keys) {
+            tap_key(key);
+        }
+    }
+};
+
+TEST_F(LeaderSequenceTable, FiresOnceUnambiguous) {
+    TestDriver driver;
+    auto       key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto       key_c      = KeymapKey(0, 1, 0, KC_C);
+    auto       key_d      = KeymapKey(0, 2, 0, KC_D);
+
+    set_keymap({key_leader, key_c, key_d});
+
+    EXPECT_NO_REPORT(driver);
+    tap_keys({key_leader, key_c});
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_3));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_d);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_FALSE(leader_sequence_active());
+    EXPECT_EQ(leader_sequence_matched_index, 2);
+}
+
+TEST_F(LeaderSequenceTable, PrefixOfAnotherSequenceFiresOnTimeout) {
+    TestDriver driver;
+    auto       key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto       key_a      = KeymapKey(0, 1, 0, KC_A);
+
+    set_keymap({key_leader, key_a});
+
+    EXPECT_NO_REPORT(driver);
+    tap_keys({key_leader, key_a});
+    idle_for(290);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_TRUE(leader_sequence_active());
+
+    EXPECT_REPORT(driver, (KC_1));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(20);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_FALSE(leader_sequence_active());
+}
+
+TEST_F(LeaderSequenceTable, LongerSequenceFiresOnceUnambiguous) {
+    TestDriver driver;
+    auto       key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto       key_a      = KeymapKey(0, 1, 0, KC_A);
+    auto       key_b      = KeymapKey(0, 2, 0, KC_B);
+
+    set_keymap({key_leader, key_a, key_b});
+
+    EXPECT_NO_REPORT(driver);
+    tap_keys({key_leader, key_a});
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_2));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_b);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_FALSE(leader_sequence_active());
+}
+
+TEST_F(LeaderSequenceTable, SequencesCanBeLongerThanFiveKeys) {
+    TestDriver driver;
+    auto       key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto       key_e      = KeymapKey(0, 1, 0, KC_E);
+    auto       key_f      = KeymapKey(0, 2, 0, KC_F);
+    auto       key_g      = KeymapKey(0, 3, 0, KC_G);
+    auto       key_h      = KeymapKey(0, 4, 0, KC_H);
+    auto       key_i      = KeymapKey(0, 5, 0, KC_I);
+    auto       key_j      = KeymapKey(0, 6, 0, KC_J);
+    auto       key_k      = KeymapKey(0, 7, 0, KC_K);
+
+    set_keymap({key_leader, key_e, key_f, key_g, key_h, key_i, key_j, key_k});
+
+    EXPECT_NO_REPORT(driver);
+    tap_keys({key_leader, key_e, key_f, key_g, key_h, key_i, key_j});
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_4));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_k);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_FALSE(leader_sequence_active());
+}
+
+TEST_F(LeaderSequenceTable, ActionsOnlyCallTheUser) {
+    TestDriver driver;
+    auto       key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto       key_x      = KeymapKey(0, 1, 0, KC_X);
+    auto       key_y      = KeymapKey(0, 2, 0, KC_Y);
+
+    set_keymap({key_leader, key_x, key_y});
+
+    EXPECT_NO_REPORT(driver);
+    tap_keys({key_leader, key_x, key_y});
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_FALSE(leader_sequence_active());
+    EXPECT_EQ(leader_sequence_matched_index, 4);
+}
+
+TEST_F(LeaderSequenceTable, UnknownSequencesFireNothing) {
+    TestDriver driver;
+    auto       key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto       key_a      = KeymapKey(0, 1, 0, KC_A);
+    auto       key_c      = KeymapKey(0, 2, 0, KC_C);
+
+    set_keymap({key_leader, key_a, key_c});
+
+    EXPECT_NO_REPORT(driver);
+    tap_keys({key_leader, key_c, key_a});
+    idle_for(301);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_FALSE(leader_sequence_active());
+    EXPECT_EQ(leader_sequence_matched_index, UINT16_MAX);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+}
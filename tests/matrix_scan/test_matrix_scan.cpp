@@ -0,0 +1,135 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include "keycodes.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class MatrixScan : public TestFixture {
+   protected:
+    void TearDown() override {
+        set_changed_rows_tracking(true);
+    }
+
+    /* Runs keyboard_task in a tight loop and returns the achieved scans per second. */
+    double measure_scan_rate(unsigned iterations) {
+        auto start = std::chrono::steady_clock::now();
+        for (unsigned i = 0; i < iterations; i++) {
+            keyboard_task();
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return iterations / elapsed.count();
+    }
+};
+
+TEST_F(MatrixScan, KeysInHighRowsAreReported) {
+    TestDriver driver;
+    auto       key_low  = KeymapKey(0, 0, 0, KC_A);
+    auto       key_mid  = KeymapKey(0, 31, 31, KC_B);
+    auto       key_high = KeymapKey(0, 5, 39, KC_C);
+
+    set_keymap({key_low, key_mid, key_high});
+
+    EXPECT_REPORT(driver, (KC_C));
+    key_high.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_C, KC_B));
+    key_mid.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    key_high.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_mid.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_low);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MatrixScan, ChangesInOneScanAreProcessedInMatrixOrder) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a = KeymapKey(0, 3, 0, KC_A);
+    auto       key_b = KeymapKey(0, 7, 0, KC_B);
+    auto       key_c = KeymapKey(0, 1, 33, KC_C);
+    auto       key_d = KeymapKey(0, 2, 33, KC_D);
+
+    set_keymap({key_a, key_b, key_c, key_d});
+
+    /* Pressed in reverse order, but processed row by row and column by column. */
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_REPORT(driver, (KC_A, KC_B));
+    EXPECT_REPORT(driver, (KC_A, KC_B, KC_C));
+    EXPECT_REPORT(driver, (KC_A, KC_B, KC_C, KC_D));
+    key_d.press();
+    key_c.press();
+    key_b.press();
+    key_a.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B, KC_C, KC_D));
+    EXPECT_REPORT(driver, (KC_C, KC_D));
+    EXPECT_REPORT(driver, (KC_D));
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    key_b.release();
+    key_c.release();
+    key_d.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MatrixScan, UntrackedRowsFallBackToFullComparison) {
+    TestDriver driver;
+    auto       key_a = KeymapKey(0, 4, 20, KC_A);
+
+    set_keymap({key_a});
+    set_changed_rows_tracking(false);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MatrixScan, ScanRateBenchmark) {
+    TestDriver driver;
+    auto       key_a = KeymapKey(0, 0, 10, KC_A);
+
+    set_keymap({key_a});
+
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* A held key and an otherwise idle matrix, compared with every row being flagged as changed. */
+    const unsigned iterations = 200000;
+    set_changed_rows_tracking(false);
+    double all_rows = measure_scan_rate(iterations);
+    set_changed_rows_tracking(true);
+    double changed_rows = measure_scan_rate(iterations);
+
+    RecordProperty("scans_per_second_all_rows", std::to_string(all_rows));
+    RecordProperty("scans_per_second_changed_rows", std::to_string(changed_rows));
+    printf("matrix scan rate: %.0f/s comparing all rows, %.0f/s with changed rows\n", all_rows, changed_rows);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,13 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define MATRIX_WAKEUP_IDLE_TIME 50
+
+#define DEBOUNCE 5
+
+// the test matrix runs the keys through the debounce algorithm
+#define TEST_MATRIX_DEBOUNCE
@@ -0,0 +1,74 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycodes.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "gpio_wakeup.h"
+}
+
+using testing::_;
+
+class MatrixWakeupDebounce : public TestFixture {};
+
+TEST_F(MatrixWakeupDebounce, PressBeingDebouncedIsNotLost) {
+    TestDriver driver;
+    auto       key_a = KeymapKey(0, 2, 1, KC_A);
+
+    set_keymap({key_a});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.press();
+    idle_for(DEBOUNCE * 2);
+    key_a.release();
+    idle_for(DEBOUNCE * 2);
+    VERIFY_AND_CLEAR(driver);
+
+    /* The release was reported DEBOUNCE ms after it was scanned, the matrix gets armed on the second loop from here. */
+    EXPECT_NO_REPORT(driver);
+    idle_for(MATRIX_WAKEUP_IDLE_TIME - DEBOUNCE - 1);
+    EXPECT_FALSE(gpio_wakeup_is_pin_enabled(2));
+    key_a.press();
+    run_one_scan_loop();
+    run_one_scan_loop();
+    EXPECT_FALSE(gpio_wakeup_is_pin_enabled(2));
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    idle_for(DEBOUNCE);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    idle_for(DEBOUNCE * 2);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MatrixWakeupDebounce, BounceBeingDebouncedDelaysArming) {
+    TestDriver driver;
+    auto       key_a = KeymapKey(0, 2, 1, KC_A);
+
+    set_keymap({key_a});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.press();
+    idle_for(DEBOUNCE * 2);
+    key_a.release();
+    idle_for(DEBOUNCE * 2);
+    VERIFY_AND_CLEAR(driver);
+
+    /* The key is up again when the matrix would be armed, but its bounce is still being debounced. */
+    EXPECT_NO_REPORT(driver);
+    idle_for(MATRIX_WAKEUP_IDLE_TIME - DEBOUNCE - 1);
+    key_a.press();
+    run_one_scan_loop();
+    key_a.release();
+    run_one_scan_loop();
+    EXPECT_FALSE(gpio_wakeup_is_pin_enabled(2));
+    idle_for(MATRIX_WAKEUP_IDLE_TIME);
+    EXPECT_TRUE(gpio_wakeup_is_pin_enabled(2));
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,187 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycodes.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "gpio_wakeup.h"
+}
+
+using testing::_;
+
+class MatrixWakeup : public TestFixture {};
+
+TEST_F(MatrixWakeup, ArmsAfterIdleTime) {
+    TestDriver driver;
+    auto       key_a = KeymapKey(0, 2, 1, KC_A);
+
+    set_keymap({key_a});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(MATRIX_WAKEUP_IDLE_TIME - 2);
+    EXPECT_FALSE(gpio_wakeup_is_pin_enabled(2));
+    idle_for(2);
+    EXPECT_TRUE(gpio_wakeup_is_pin_enabled(2));
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MatrixWakeup, FirstKeyIsReportedOnNextScan) {
+    TestDriver driver;
+    auto       key_a = KeymapKey(0, 2, 1, KC_A);
+
+    set_keymap({key_a});
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(MATRIX_WAKEUP_IDLE_TIME * 2);
+    EXPECT_TRUE(gpio_wakeup_is_pin_enabled(2));
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    run_one_scan_loop();
+    EXPECT_FALSE(gpio_wakeup_is_pin_enabled(2));
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MatrixWakeup, PressJustBeforeArmingIsScanned) {
+    TestDriver driver;
+    auto       key_a = KeymapKey(0, 2, 1, KC_A);
+
+    set_keymap({key_a});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(MATRIX_WAKEUP_IDLE_TIME - 1);
+    EXPECT_FALSE(gpio_wakeup_is_pin_enabled(2));
+    VERIFY_AND_CLEAR(driver);
+
+    /* The edge comes before the matrix is armed on this loop, so it is only seen on the input line. */
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    run_one_scan_loop();
+    EXPECT_FALSE(gpio_wakeup_is_pin_enabled(2));
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MatrixWakeup, NoScanWithoutEdge) {
+    TestDriver driver;
+    auto       key_a = KeymapKey(0, 2, 1, KC_A);
+    auto       key_b = KeymapKey(0, 3, 1, KC_B);
+
+    set_keymap({key_a, key_b});
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(MATRIX_WAKEUP_IDLE_TIME * 2);
+    VERIFY_AND_CLEAR(driver);
+
+    /* A wakeup source that stays silent keeps the matrix from being scanned. */
+    gpio_wakeup_disable_pin(3);
+
+    EXPECT_NO_REPORT(driver);
+    key_b.press();
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_REPORT(driver, (KC_A, KC_B));
+    key_a.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    run_one_scan_loop();
+    key_b.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MatrixWakeup, HeldKeyKeepsPolling) {
+    TestDriver driver;
+    auto       key_a = KeymapKey(0, 2, 1, KC_A);
+
+    set_keymap({key_a});
+
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    idle_for(MATRIX_WAKEUP_IDLE_TIME * 2);
+    EXPECT_FALSE(gpio_wakeup_is_pin_enabled(2));
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MatrixWakeup, KeepsPollingWhenAPinCantWakeUp) {
+    TestDriver driver;
+    auto       key_a = KeymapKey(0, 2, 1, KC_A);
+
+    set_keymap({key_a});
+
+    /* Like a pin sharing its edge interrupt with another pin already armed. */
+    gpio_wakeup_set_pin_unsupported(3, true);
+
+    EXPECT_NO_REPORT(driver);
+    gpio_wakeup_simulate_edge(2);
+    run_one_scan_loop();
+    idle_for(MATRIX_WAKEUP_IDLE_TIME * 2);
+    EXPECT_FALSE(gpio_wakeup_is_pin_enabled(2));
+    VERIFY_AND_CLEAR(driver);
+
+    /* No edge is simulated, the key is only seen by polling. */
+    gpio_wakeup_disable_pin(2);
+
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    gpio_wakeup_set_pin_unsupported(3, false);
+}
+
+static uint32_t scan_user_calls = 0;
+
+extern "C" void matrix_scan_user(void) {
+    scan_user_calls++;
+}
+
+TEST_F(MatrixWakeup, ScanHooksRunWhileArmed) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(MATRIX_WAKEUP_IDLE_TIME * 2);
+    EXPECT_TRUE(gpio_wakeup_is_pin_enabled(2));
+
+    scan_user_calls = 0;
+    idle_for(10);
+    EXPECT_EQ(scan_user_calls, 10);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,148 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <vector>
+#include "keycodes.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+using testing::InSequence;
+
+static std::vector<uint16_t> user_keycodes;
+static uint16_t              blocked_keycode;
+static bool                  track_user_keycodes;
+
+extern "C" bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+    if (track_user_keycodes && record->event.pressed) {
+        user_keycodes.push_back(keycode);
+    }
+    return keycode != blocked_keycode;
+}
+
+class ProcessRecordDispatch : public TestFixture {
+   protected:
+    void SetUp() override {
+        user_keycodes.clear();
+        blocked_keycode     = KC_NO;
+        track_user_keycodes = true;
+    }
+};
+
+TEST_F(ProcessRecordDispatch, KeysOutsideOfTheFeatureRangesAreSent) {
+    TestDriver driver;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key_a});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(user_keycodes, std::vector<uint16_t>({KC_A}));
+}
+
+TEST_F(ProcessRecordDispatch, UserRunsBeforeFeatureKeycodes) {
+    TestDriver driver;
+    auto       key_lower = KeymapKey(0, 0, 0, TL_LOWR);
+    auto       key_esc   = KeymapKey(0, 1, 0, QK_GRAVE_ESCAPE);
+
+    set_keymap({key_lower, key_esc});
+    blocked_keycode = TL_LOWR;
+
+    EXPECT_NO_REPORT(driver);
+    key_lower.press();
+    run_one_scan_loop();
+    EXPECT_FALSE(layer_state_is(1));
+    key_lower.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    blocked_keycode = QK_GRAVE_ESCAPE;
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_esc);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(user_keycodes, std::vector<uint16_t>({TL_LOWR, QK_GRAVE_ESCAPE}));
+}
+
+TEST_F(ProcessRecordDispatch, FeatureKeycodesStopTheChain) {
+    TestDriver driver;
+    auto       key_lower = KeymapKey(0, 0, 0, TL_LOWR);
+
+    set_keymap({key_lower, KeymapKey(1, 0, 0, KC_TRNS)});
+
+    EXPECT_NO_REPORT(driver);
+    key_lower.press();
+    run_one_scan_loop();
+    EXPECT_TRUE(layer_state_is(1));
+    key_lower.release();
+    run_one_scan_loop();
+    EXPECT_FALSE(layer_state_is(1));
+    VERIFY_AND_CLEAR(driver);
+}
+
+/* Caps Word sees every key before Grave Escape consumes its keycode. */
+TEST_F(ProcessRecordDispatch, HandlersOfAllKeysRunBeforeLaterFeatures) {
+    TestDriver driver;
+    auto       key_esc = KeymapKey(0, 0, 0, QK_GRAVE_ESCAPE);
+
+    set_keymap({key_esc});
+
+    caps_word_on();
+    EXPECT_REPORT(driver, (KC_ESCAPE));
+    EXPECT_EMPTY_REPORT(driver).Times(AnyNumber());
+    tap_key(key_esc);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_FALSE(is_caps_word_on());
+}
+
+/* The last key is remembered before the user and the features see it. */
+TEST_F(ProcessRecordDispatch, RepeatKeyRemembersFeatureKeycodes) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_esc    = KeymapKey(0, 0, 0, QK_GRAVE_ESCAPE);
+    auto       key_repeat = KeymapKey(0, 1, 0, QK_REPEAT_KEY);
+
+    set_keymap({key_esc, key_repeat});
+
+    EXPECT_REPORT(driver, (KC_ESCAPE));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_esc);
+    EXPECT_REPORT(driver, (KC_ESCAPE));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_repeat);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(get_last_keycode(), QK_GRAVE_ESCAPE);
+}
+
+/* Runs a press and a release of a basic key through every handler. */
+TEST_F(ProcessRecordDispatch, Benchmark) {
+    TestDriver  driver;
+    const int   rounds = 100000;
+    keyrecord_t press  = {};
+    keyrecord_t release;
+
+    set_keymap({KeymapKey(0, 0, 0, KC_A)});
+    press.event.type      = KEY_EVENT;
+    press.event.pressed   = true;
+    release               = press;
+    release.event.pressed = false;
+    track_user_keycodes   = false;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; i++) {
+        process_record_quantum(&press);
+        process_record_quantum(&release);
+    }
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+    double ns_per_record = elapsed.count() / (2.0 * rounds);
+    RecordProperty("ns_per_record", std::to_string(ns_per_record));
+    printf("%.2f ns per record\n", ns_per_record);
+}
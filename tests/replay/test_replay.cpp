@@ -0,0 +1,75 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstdio>
+#include <string>
+#include "keycodes.h"
+#include "test_common.hpp"
+#include "test_replay.hpp"
+
+class KeyEventReplay : public TestFixture {
+   protected:
+    void SetUp() override {
+        // clang-format off
+        set_keymap({
+            KeymapKey(0, 0, 0, KC_A),           KeymapKey(1, 0, 0, KC_1),
+            KeymapKey(0, 1, 0, KC_S),           KeymapKey(1, 1, 0, KC_2),
+            KeymapKey(0, 2, 0, LCTL_T(KC_D)),   KeymapKey(1, 2, 0, KC_3),
+            KeymapKey(0, 3, 0, LSFT_T(KC_F)),   KeymapKey(1, 3, 0, KC_4),
+            KeymapKey(0, 4, 0, KC_J),           KeymapKey(1, 4, 0, KC_LEFT),
+            KeymapKey(0, 5, 0, KC_K),           KeymapKey(1, 5, 0, KC_DOWN),
+            KeymapKey(0, 6, 0, KC_L),           KeymapKey(1, 6, 0, KC_UP),
+            KeymapKey(0, 7, 0, LT(1, KC_SPC)),  KeymapKey(1, 7, 0, KC_TRNS),
+            KeymapKey(0, 8, 0, KC_BSPC),        KeymapKey(1, 8, 0, KC_DEL),
+            KeymapKey(0, 9, 0, KC_LEFT_SHIFT),  KeymapKey(1, 9, 0, KC_TRNS),
+        });
+        // clang-format on
+    }
+
+    std::vector<keypos_t> keys() const {
+        std::vector<keypos_t> positions;
+        for (auto &key : keymap) {
+            if (key.layer == 0) {
+                positions.push_back(key.position);
+            }
+        }
+        return positions;
+    }
+};
+
+TEST_F(KeyEventReplay, TraceMatchesGolden) {
+    TestDriver driver;
+    Replay     replay(driver);
+
+    replay.run(load_trace(test_data_path(__FILE__, "typing.trace")));
+    VERIFY_AND_CLEAR(driver);
+
+    expect_golden(replay.reports(), test_data_path(__FILE__, "typing.golden"));
+}
+
+/* Replays an hour of generated typing, and prints the time spent per loop and per key event. */
+TEST_F(KeyEventReplay, Benchmark) {
+    TestDriver driver;
+    Replay     replay(driver);
+    auto       events = generate_trace(keys(), 60 * 60 * 1000, 0x2026);
+
+    replay.run(events);
+    VERIFY_AND_CLEAR(driver);
+
+    // an hour of reports is too long for a golden file, a digest of them is compared instead
+    uint32_t digest = 2166136261u;
+    for (auto &report : replay.reports()) {
+        for (char c : report) {
+            digest = (digest ^ (uint8_t)c) * 16777619u;
+        }
+    }
+    char digest_line[32];
+    snprintf(digest_line, sizeof(digest_line), "digest %08x", digest);
+    expect_golden({"events " + std::to_string(events.size()), "reports " + std::to_string(replay.reports().size()), digest_line}, test_data_path(__FILE__, "session.golden"));
+
+    double ns_per_loop  = replay.elapsed_ns() / replay.loops();
+    double ns_per_event = replay.elapsed_ns() / events.size();
+    RecordProperty("ns_per_loop", std::to_string(ns_per_loop));
+    RecordProperty("ns_per_event", std::to_string(ns_per_event));
+    printf("%zu events in %llu loops: %.2f ns per loop, %.2f ns per event\n", events.size(), (unsigned long long)replay.loops(), ns_per_loop, ns_per_event);
+}
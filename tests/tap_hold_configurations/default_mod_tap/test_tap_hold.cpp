@@ -66,6 +66,52 @@ TEST_F(DefaultTapHold, tap_regular_key_while_mod_tap_key_is_held) {
     VERIFY_AND_CLEAR(driver);
 }
 
+TEST_F(DefaultTapHold, roll_regular_keys_while_mod_tap_key_is_held) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_hold_key = KeymapKey(0, 1, 0, SFT_T(KC_P));
+    auto       key_a            = KeymapKey(0, 2, 0, KC_A);
+    auto       key_b            = KeymapKey(0, 3, 0, KC_B);
+    auto       key_c            = KeymapKey(0, 4, 0, KC_C);
+
+    set_keymap({mod_tap_hold_key, key_a, key_b, key_c});
+
+    /* Press mod-tap-hold key. */
+    EXPECT_NO_REPORT(driver);
+    mod_tap_hold_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Roll the regular keys, which fills most of the waiting buffer. */
+    EXPECT_NO_REPORT(driver);
+    key_a.press();
+    run_one_scan_loop();
+    key_b.press();
+    run_one_scan_loop();
+    key_a.release();
+    run_one_scan_loop();
+    key_c.press();
+    run_one_scan_loop();
+    key_b.release();
+    run_one_scan_loop();
+    key_c.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Release mod-tap-hold key. */
+    EXPECT_REPORT(driver, (KC_P));
+    EXPECT_REPORT(driver, (KC_P, KC_A));
+    EXPECT_REPORT(driver, (KC_P, KC_A, KC_B));
+    EXPECT_REPORT(driver, (KC_P, KC_B));
+    EXPECT_REPORT(driver, (KC_P, KC_B, KC_C));
+    EXPECT_REPORT(driver, (KC_P, KC_C));
+    EXPECT_REPORT(driver, (KC_P));
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_hold_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
 TEST_F(DefaultTapHold, tap_a_mod_tap_key_while_another_mod_tap_key_is_held) {
     TestDriver driver;
     InSequence s;
@@ -0,0 +1,9 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define TAPPING_STATS_AUTO_TUNE
+#define TAPPING_STATS_TUNE_SAMPLES 4
@@ -0,0 +1,160 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "tapping_stats.h"
+}
+
+using testing::_;
+using testing::InSequence;
+
+class TappingStats : public TestFixture {
+   protected:
+    void SetUp() override {
+        tapping_stats_clear();
+    }
+
+    int8_t find(KeymapKey &key) {
+        keypos_t position;
+        position.row = key.position.row;
+        position.col = key.position.col;
+        return tapping_stats_find(position, key.code);
+    }
+
+    // count in the bucket of a time
+    uint8_t count(KeymapKey &key, tapping_stats_interval_t interval, uint16_t time) {
+        return tapping_stats_get_histogram(find(key), interval)[time / TAPPING_STATS_BUCKET_WIDTH];
+    }
+
+    uint8_t total(KeymapKey &key, tapping_stats_interval_t interval) {
+        const uint8_t *buckets = tapping_stats_get_histogram(find(key), interval);
+        uint8_t        sum     = 0;
+        for (uint8_t i = 0; i < TAPPING_STATS_BUCKETS; i++) {
+            sum += buckets[i];
+        }
+        return sum;
+    }
+};
+
+TEST_F(TappingStats, LonePressIsARelease) {
+    TestDriver driver;
+    InSequence s;
+    auto       key = KeymapKey(0, 0, 0, SFT_T(KC_P));
+
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_P));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key, 60);
+    VERIFY_AND_CLEAR(driver);
+
+    ASSERT_GE(find(key), 0);
+    EXPECT_EQ(count(key, TAPPING_STATS_RELEASE, 60), 1);
+    EXPECT_EQ(total(key, TAPPING_STATS_RELEASE), 1);
+    EXPECT_EQ(total(key, TAPPING_STATS_NEXT_KEY), 0);
+}
+
+TEST_F(TappingStats, PressOfAnotherKeyIsANextKey) {
+    TestDriver driver;
+    auto       mod_tap = KeymapKey(0, 0, 0, SFT_T(KC_P));
+    auto       key_a   = KeymapKey(0, 1, 0, KC_A);
+
+    set_keymap({mod_tap, key_a});
+
+    EXPECT_REPORT(driver, (KC_LSFT)).Times(testing::AnyNumber());
+    EXPECT_REPORT(driver, (KC_LSFT, KC_A)).Times(testing::AnyNumber());
+    EXPECT_REPORT(driver, (KC_P)).Times(testing::AnyNumber());
+    EXPECT_REPORT(driver, (KC_P, KC_A)).Times(testing::AnyNumber());
+    EXPECT_REPORT(driver, (KC_A)).Times(testing::AnyNumber());
+    EXPECT_EMPTY_REPORT(driver).Times(testing::AnyNumber());
+    mod_tap.press();
+    idle_for(30);
+    tap_key(key_a, 20);
+    idle_for(TAPPING_TERM);
+    mod_tap.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // only the first key after the press counts
+    EXPECT_EQ(count(mod_tap, TAPPING_STATS_NEXT_KEY, 30), 1);
+    EXPECT_EQ(total(mod_tap, TAPPING_STATS_NEXT_KEY), 1);
+    EXPECT_EQ(total(mod_tap, TAPPING_STATS_RELEASE), 0);
+}
+
+TEST_F(TappingStats, RegularKeysAreNotTracked) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key, 60);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(find(key), -1);
+}
+
+TEST_F(TappingStats, TermIsDerivedFromTaps) {
+    TestDriver  driver;
+    InSequence  s;
+    auto        key    = KeymapKey(0, 0, 0, SFT_T(KC_P));
+    keyrecord_t record = {};
+
+    set_keymap({key});
+    record.event.key.row = key.position.row;
+    record.event.key.col = key.position.col;
+    record.event.type    = KEY_EVENT;
+
+    for (int i = 0; i < TAPPING_STATS_TUNE_SAMPLES; i++) {
+        EXPECT_EQ(get_tapping_term(key.code, &record), TAPPING_TERM);
+        EXPECT_REPORT(driver, (KC_P));
+        EXPECT_EMPTY_REPORT(driver);
+        tap_key(key, 110);
+        idle_for(TAPPING_TERM);
+        VERIFY_AND_CLEAR(driver);
+    }
+
+    // end of the 100-125ms bucket, plus the margin
+    EXPECT_EQ(get_tapping_term(key.code, &record), 125 + TAPPING_STATS_TUNE_MARGIN);
+
+    // a press that used to be a tap is now a hold
+    EXPECT_REPORT(driver, (KC_LSFT));
+    key.press();
+    idle_for(125 + TAPPING_STATS_TUNE_MARGIN + 1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TappingStats, OtherKeycodesKeepTheirTerm) {
+    TestDriver  driver;
+    auto        key    = KeymapKey(0, 0, 0, SFT_T(KC_P));
+    keyrecord_t record = {};
+
+    set_keymap({key});
+    record.event.key.row = key.position.row;
+    record.event.key.col = key.position.col;
+    record.event.type    = KEY_EVENT;
+
+    EXPECT_REPORT(driver, (KC_P)).Times(TAPPING_STATS_TUNE_SAMPLES);
+    EXPECT_EMPTY_REPORT(driver).Times(TAPPING_STATS_TUNE_SAMPLES);
+    for (int i = 0; i < TAPPING_STATS_TUNE_SAMPLES; i++) {
+        tap_key(key, 10);
+    }
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(get_tapping_term(key.code, &record), TAPPING_STATS_TUNE_MIN);
+    EXPECT_EQ(get_tapping_term(CTL_T(KC_P), &record), TAPPING_TERM);
+
+    // records without a key event, like the ones of tap dance
+    keyrecord_t tick = {};
+    EXPECT_EQ(get_tapping_term(key.code, &tick), TAPPING_TERM);
+}
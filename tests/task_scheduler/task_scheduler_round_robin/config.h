@@ -0,0 +1,11 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+// due on every iteration, and checked before the LED task
+#define MOUSEKEY_TASK_PERIOD 1
+
+#define LED_TASK_PERIOD 10
@@ -0,0 +1,20 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+using testing::_;
+
+class TaskSchedulerRoundRobin : public TestFixture {};
+
+TEST_F(TaskSchedulerRoundRobin, FastTaskDoesNotStarveTheNextOnes) {
+    TestDriver driver;
+
+    for (uint8_t leds = 1; leds <= 10; leds++) {
+        uint32_t last_change = last_led_activity_time();
+
+        driver.set_leds(leds);
+        idle_for(LED_TASK_PERIOD + 1);
+        EXPECT_NE(last_led_activity_time(), last_change) << "LED state " << (int)leds;
+    }
+}
@@ -0,0 +1,71 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+#define CAPS_LOCK_LED 0x02
+
+class TaskScheduler : public TestFixture {
+   protected:
+    uint32_t last_led_change;
+
+    // Changes the host LED state, and returns whether the LED task saw it in the given time.
+    bool led_task_sees(TestDriver &driver, uint8_t leds, unsigned time) {
+        driver.set_leds(leds);
+        idle_for(time);
+        if (last_led_activity_time() == last_led_change) {
+            return false;
+        }
+        last_led_change = last_led_activity_time();
+        return true;
+    }
+
+    // Waits for the LED task to run, so its period starts now.
+    void start_period(TestDriver &driver) {
+        for (unsigned i = 0; i <= LED_TASK_PERIOD; i++) {
+            // a new state every time, so the task sees a change whenever it runs
+            driver.set_leds(0x80 | i);
+            run_one_scan_loop();
+            if (last_led_activity_time() == timer_read32() - 1) {
+                last_led_change = last_led_activity_time();
+                return;
+            }
+        }
+        FAIL() << "the LED task didn't run";
+    }
+};
+
+TEST_F(TaskScheduler, TaskRunsOncePerPeriod) {
+    TestDriver driver;
+
+    start_period(driver);
+    EXPECT_FALSE(led_task_sees(driver, CAPS_LOCK_LED, LED_TASK_PERIOD - 1));
+    EXPECT_TRUE(led_task_sees(driver, CAPS_LOCK_LED, 1));
+    EXPECT_TRUE(led_task_sees(driver, 0, LED_TASK_PERIOD));
+}
+
+TEST_F(TaskScheduler, MatrixChangesComeFirst) {
+    TestDriver driver;
+    InSequence s;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+    start_period(driver);
+    EXPECT_FALSE(led_task_sees(driver, CAPS_LOCK_LED, LED_TASK_PERIOD - 1));
+
+    // the LED task is due, but waits for the iteration after the key press
+    EXPECT_REPORT(driver, (KC_A));
+    key.press();
+    EXPECT_FALSE(led_task_sees(driver, CAPS_LOCK_LED, 1));
+    EXPECT_TRUE(led_task_sees(driver, CAPS_LOCK_LED, 1));
+
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
@@ -17,35 +17,143 @@
 #include "matrix.h"
 #include "test_matrix.h"
 #include <string.h>
+#ifdef TEST_MATRIX_DEBOUNCE
+#    include "debounce.h"
+#endif
+#ifdef MATRIX_WAKEUP_ENABLE
+#    include "gpio_wakeup.h"
+#endif
 
 static matrix_row_t matrix[MATRIX_ROWS] = {};
+#ifdef TEST_MATRIX_DEBOUNCE
+// the keys down at the last scan, and their debounced state returned by matrix_get_row()
+static matrix_row_t raw_matrix[MATRIX_ROWS]       = {};
+static matrix_row_t debounced_matrix[MATRIX_ROWS] = {};
+#endif
+static uint32_t     changed_rows[MATRIX_ROW_BITMAP_WORDS];
+static bool         changed_rows_tracked = true;
 
 void matrix_init(void) {
     clear_all_keys();
+#ifdef TEST_MATRIX_DEBOUNCE
+    memset(raw_matrix, 0, sizeof(raw_matrix));
+    memset(debounced_matrix, 0, sizeof(debounced_matrix));
+    debounce_init(MATRIX_ROWS);
+#endif
     matrix_init_kb();
 }
 
 uint8_t matrix_scan(void) {
+#ifdef TEST_MATRIX_DEBOUNCE
+    matrix_row_t previous[MATRIX_ROWS];
+    bool         changed = memcmp(raw_matrix, matrix, sizeof(matrix)) != 0;
+
+    memcpy(raw_matrix, matrix, sizeof(matrix));
+    memcpy(previous, debounced_matrix, sizeof(debounced_matrix));
+    debounce(raw_matrix, debounced_matrix, MATRIX_ROWS, changed);
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        if (debounced_matrix[row] != previous[row]) {
+            matrix_set_rows_changed(row, 1);
+        }
+    }
+#endif
     matrix_scan_kb();
     return 1;
 }
 
 matrix_row_t matrix_get_row(uint8_t row) {
+#ifdef TEST_MATRIX_DEBOUNCE
+    return debounced_matrix[row];
+#else
     return matrix[row];
+#endif
+}
+
+void matrix_set_rows_changed(uint8_t first_row, uint8_t num_rows) {
+    for (uint8_t row = first_row; row < first_row + num_rows; row++) {
+        changed_rows[row / 32] |= (uint32_t)1 << (row % 32);
+    }
+}
+
+void matrix_get_changed_rows(uint32_t rows[MATRIX_ROW_BITMAP_WORDS]) {
+    if (!changed_rows_tracked) {
+        matrix_set_rows_changed(0, MATRIX_ROWS);
+    }
+    memcpy(rows, changed_rows, sizeof(changed_rows));
+    memset(changed_rows, 0, sizeof(changed_rows));
 }
 
+void set_changed_rows_tracking(bool enabled) {
+    changed_rows_tracked = enabled;
+}
+
+#ifdef MATRIX_WAKEUP_ENABLE
+// Every row is driven while armed, so each column line acts as the wakeup pin with the same number
+static void matrix_wakeup_disarm(void) {
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        gpio_wakeup_disable_pin(col);
+    }
+}
+
+bool matrix_wakeup_arm(void) {
+    bool armed = true;
+
+#ifdef TEST_MATRIX_DEBOUNCE
+    // a change still being debounced raises no more edges
+    if (memcmp(raw_matrix, debounced_matrix, sizeof(raw_matrix)) != 0) {
+        return false;
+    }
+#endif
+
+    // an edge between the last scan and enabling its interrupt is missed, so each column is read again once enabled
+    gpio_wakeup_clear();
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        armed &= gpio_wakeup_enable_pin(col);
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            armed &= !(matrix[row] & ((matrix_row_t)1 << col));
+        }
+    }
+
+    if (!armed) {
+        matrix_wakeup_disarm();
+    }
+    return armed;
+}
+
+bool matrix_wakeup_triggered(void) {
+    if (!gpio_wakeup_pending()) {
+        return false;
+    }
+
+    matrix_wakeup_disarm();
+    return true;
+}
+#endif
+
 void matrix_print(void) {}
 
 void matrix_init_kb(void) {}
 
-void matrix_scan_kb(void) {}
+__attribute__((weak)) void matrix_scan_user(void) {}
+
+void matrix_scan_kb(void) {
+    matrix_scan_user();
+}
 
 void press_key(uint8_t col, uint8_t row) {
     matrix[row] |= (matrix_row_t)1 << col;
+    matrix_set_rows_changed(row, 1);
+#ifdef MATRIX_WAKEUP_ENABLE
+    gpio_wakeup_simulate_edge(col);
+#endif
 }
 
 void release_key(uint8_t col, uint8_t row) {
     matrix[row] &= ~((matrix_row_t)1 << col);
+    matrix_set_rows_changed(row, 1);
+#ifdef MATRIX_WAKEUP_ENABLE
+    gpio_wakeup_simulate_edge(col);
+#endif
 }
 
 bool matrix_is_on(uint8_t row, uint8_t col) {
@@ -54,6 +162,7 @@ bool matrix_is_on(uint8_t row, uint8_t col) {
 
 void clear_all_keys(void) {
     memset(matrix, 0, sizeof(matrix));
+    matrix_set_rows_changed(0, MATRIX_ROWS);
 }
 
 void led_set(uint8_t usb_led) {}
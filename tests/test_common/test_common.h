@@ -1,4 +1,8 @@
 #pragma once
 
-#define MATRIX_ROWS 4
-#define MATRIX_COLS 10
+#ifndef MATRIX_ROWS
+#    define MATRIX_ROWS 4
+#endif
+#ifndef MATRIX_COLS
+#    define MATRIX_COLS 10
+#endif
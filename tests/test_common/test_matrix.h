@@ -23,6 +23,8 @@ extern "C" {
 void press_key(uint8_t col, uint8_t row);
 void release_key(uint8_t col, uint8_t row);
 void clear_all_keys(void);
+/* when disabled every row is reported as changed, like a matrix without row tracking */
+void set_changed_rows_tracking(bool enabled);
 
 #ifdef __cplusplus
 }
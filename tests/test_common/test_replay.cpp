@@ -0,0 +1,177 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_replay.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include "gtest/gtest.h"
+#include "keyboard_report_util.hpp"
+
+extern "C" {
+#include "quantum.h"
+#include "test_matrix.h"
+#include "timer.h"
+
+void advance_time(uint32_t ms);
+}
+
+using testing::_;
+
+std::vector<ReplayEvent> parse_trace(std::istream& input) {
+    std::vector<ReplayEvent> events;
+    std::string              line;
+    unsigned                 line_number = 0;
+
+    while (std::getline(input, line)) {
+        line_number++;
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        std::istringstream fields(line);
+        uint32_t           time;
+        unsigned           row, col;
+        std::string        state;
+        if (!(fields >> time >> row >> col >> state) || (state != "press" && state != "release")) {
+            ADD_FAILURE() << "trace line " << line_number << " is not <time> <row> <col> <press|release>: " << line;
+            continue;
+        }
+        if (!events.empty() && time < events.back().time) {
+            ADD_FAILURE() << "trace line " << line_number << " goes back in time: " << line;
+            continue;
+        }
+        events.push_back({time, (uint8_t)row, (uint8_t)col, state == "press"});
+    }
+    return events;
+}
+
+std::vector<ReplayEvent> load_trace(const std::string& path) {
+    std::ifstream input(path);
+    if (!input) {
+        ADD_FAILURE() << "cannot read trace " << path;
+        return {};
+    }
+    return parse_trace(input);
+}
+
+std::string test_data_path(const std::string& source_file, const std::string& name) {
+    return source_file.substr(0, source_file.find_last_of('/') + 1) + name;
+}
+
+std::vector<ReplayEvent> generate_trace(const std::vector<keypos_t>& keys, uint32_t duration_ms, uint32_t seed) {
+    std::vector<ReplayEvent> events;
+    std::vector<uint32_t>    free_at(keys.size(), 0);
+    uint32_t                 rng  = seed ? seed : 1;
+    uint32_t                 time = 0;
+
+    // xorshift, so that traces do not depend on the standard library
+    auto random = [&rng](uint32_t low, uint32_t high) {
+        rng ^= rng << 13;
+        rng ^= rng >> 17;
+        rng ^= rng << 5;
+        return low + rng % (high - low + 1);
+    };
+
+    while (time < duration_ms) {
+        uint32_t word_length = random(1, 9);
+        for (uint32_t i = 0; i < word_length && time < duration_ms; i++) {
+            size_t key = random(0, keys.size() - 1);
+            // a key can only be pressed again after the scan that saw it released
+            for (size_t tries = 1; free_at[key] > time && tries < keys.size(); tries++) {
+                key = (key + 1) % keys.size();
+            }
+            time = std::max(time, free_at[key]);
+
+            uint32_t hold = random(30, 160);
+            free_at[key]  = time + hold + 1;
+            events.push_back({time, keys[key].row, keys[key].col, true});
+            events.push_back({time + hold, keys[key].row, keys[key].col, false});
+            // fast typists press the next key before releasing the last one
+            time += random(40, 260);
+        }
+        time += random(100, 700);
+        if (random(0, 49) == 0) {
+            time += random(2000, 30000);
+        }
+    }
+
+    std::stable_sort(events.begin(), events.end(), [](const ReplayEvent& a, const ReplayEvent& b) { return a.time < b.time; });
+    return events;
+}
+
+Replay::Replay(TestDriver& driver) : m_start(timer_read32()) {
+    EXPECT_ANY_REPORT(driver).WillRepeatedly([this](report_keyboard_t& report) {
+        std::ostringstream line;
+        line << timer_elapsed32(m_start) << " " << report;
+        std::string text = line.str();
+        text.erase(text.find_last_not_of('\n') + 1);
+        m_reports.push_back(text);
+    });
+}
+
+void Replay::run_loop() {
+    auto start = std::chrono::steady_clock::now();
+    keyboard_task();
+    housekeeping_task();
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    m_elapsed_ns += elapsed.count();
+    m_loops++;
+    advance_time(1);
+}
+
+void Replay::run(const std::vector<ReplayEvent>& events, unsigned settle_ms) {
+    uint32_t start = timer_read32();
+
+    for (size_t i = 0; i < events.size();) {
+        while (timer_elapsed32(start) < events[i].time) {
+            run_loop();
+        }
+        // the events of the same millisecond are seen by the same scan
+        for (; i < events.size() && events[i].time <= timer_elapsed32(start); i++) {
+            if (events[i].pressed) {
+                press_key(events[i].col, events[i].row);
+            } else {
+                release_key(events[i].col, events[i].row);
+            }
+        }
+        run_loop();
+    }
+    for (unsigned i = 0; i < settle_ms; i++) {
+        run_loop();
+    }
+}
+
+void expect_golden(const std::vector<std::string>& lines, const std::string& path) {
+    if (std::getenv("QMK_UPDATE_GOLDEN")) {
+        std::ofstream output(path);
+        for (auto& line : lines) {
+            output << line << '\n';
+        }
+        EXPECT_TRUE(output.good()) << "cannot write golden file " << path;
+        return;
+    }
+
+    std::ifstream input(path);
+    if (!input) {
+        ADD_FAILURE() << "cannot read golden file " << path << ", run with QMK_UPDATE_GOLDEN=1 to create it";
+        return;
+    }
+    std::vector<std::string> golden;
+    std::string              line;
+    while (std::getline(input, line)) {
+        golden.push_back(line);
+    }
+
+    size_t common = std::min(lines.size(), golden.size());
+    for (size_t i = 0; i < common; i++) {
+        if (lines[i] != golden[i]) {
+            ADD_FAILURE() << path << ":" << i + 1 << " differs\n  expected: " << golden[i] << "\n    actual: " << lines[i];
+            return;
+        }
+    }
+    EXPECT_EQ(lines.size(), golden.size()) << path << " has " << golden.size() << " lines, the replay produced " << lines.size();
+}
@@ -0,0 +1,103 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <vector>
+extern "C" {
+#include "keyboard.h"
+}
+#include "test_driver.hpp"
+
+/**
+ * @brief A key event of a recorded trace.
+ */
+struct ReplayEvent {
+    uint32_t time; // milliseconds since the start of the trace
+    uint8_t  row;
+    uint8_t  col;
+    bool     pressed;
+};
+
+/**
+ * @brief Reads a key event trace, one event per line:
+ *
+ *     <time> <row> <col> <press|release>
+ *
+ * Times are in milliseconds since the start of the trace and must not decrease.
+ * Empty lines and lines starting with `#` are skipped.
+ */
+std::vector<ReplayEvent> parse_trace(std::istream& input);
+
+/**
+ * @brief Reads a key event trace from a file, see `parse_trace`.
+ */
+std::vector<ReplayEvent> load_trace(const std::string& path);
+
+/**
+ * @brief The path of the data file `name` next to the test source `source_file`,
+ * called with `__FILE__`.
+ */
+std::string test_data_path(const std::string& source_file, const std::string& name);
+
+/**
+ * @brief Generates `duration_ms` of typing on `keys`: words of overlapping
+ * keystrokes with pauses in between. The same `seed` gives the same trace.
+ */
+std::vector<ReplayEvent> generate_trace(const std::vector<keypos_t>& keys, uint32_t duration_ms, uint32_t seed);
+
+/**
+ * @brief Feeds key event traces through the test matrix, one keyboard task loop
+ * per millisecond of the test timer, and records the keyboard reports.
+ *
+ * Every key of the trace has to be in the keymap of the test fixture.
+ */
+class Replay {
+   public:
+    explicit Replay(TestDriver& driver);
+
+    /**
+     * @brief Replays `events`, then runs `settle_ms` more loops for the pending timeouts.
+     */
+    void run(const std::vector<ReplayEvent>& events, unsigned settle_ms = 1000);
+
+    /**
+     * @brief The reports sent so far, each prefixed by its time in milliseconds since the start of the replay.
+     */
+    const std::vector<std::string>& reports() const {
+        return m_reports;
+    }
+
+    /**
+     * @brief The number of keyboard task loops run so far.
+     */
+    uint64_t loops() const {
+        return m_loops;
+    }
+
+    /**
+     * @brief The time spent in the keyboard task loops so far, in nanoseconds.
+     */
+    double elapsed_ns() const {
+        return m_elapsed_ns;
+    }
+
+   private:
+    void run_loop();
+
+    std::vector<std::string> m_reports;
+    uint32_t                 m_start;
+    uint64_t                 m_loops      = 0;
+    double                   m_elapsed_ns = 0;
+};
+
+/**
+ * @brief Compares `lines` with the lines of a golden file.
+ *
+ * When the QMK_UPDATE_GOLDEN environment variable is set, the golden file is
+ * written with `lines` instead.
+ */
+void expect_golden(const std::vector<std::string>& lines, const std::string& path);
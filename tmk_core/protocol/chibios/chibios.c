@@ -45,6 +45,9 @@
 #endif
 #include "suspend.h"
 #include "wait.h"
+#ifdef KEY_EVENT_QUEUE_SCAN_THREAD
+#    include "key_event_queue.h"
+#endif
 
 #define USB_GETSTATUS_REMOTE_WAKEUP_ENABLED (2U)
 
@@ -177,6 +180,10 @@ void protocol_pre_task(void) {
 #if !defined(NO_USB_STARTUP_CHECK)
     if (USB_DRIVER.state == USB_SUSPENDED) {
         dprintln("suspending keyboard");
+#    ifdef KEY_EVENT_QUEUE_SCAN_THREAD
+        // suspend_wakeup_condition() scans the matrix from here instead
+        key_event_queue_scan_thread_pause();
+#    endif
         while (USB_DRIVER.state == USB_SUSPENDED) {
             /* Do this in the suspended state */
             suspend_power_down(); // on AVR this deep sleeps for 15ms
@@ -195,6 +202,9 @@ void protocol_pre_task(void) {
             }
         }
         /* Woken up */
+#    ifdef KEY_EVENT_QUEUE_SCAN_THREAD
+        key_event_queue_scan_thread_resume();
+#    endif
     }
 #endif
 }
@@ -35,6 +35,12 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    include "connection.h"
 #endif
 
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#else
+#    define latency_trace_report()
+#endif
+
 #ifdef BLUETOOTH_ENABLE
 #    include "bluetooth.h"
 
@@ -142,6 +148,7 @@ void host_keyboard_send(report_keyboard_t *report) {
     report->report_id = REPORT_ID_KEYBOARD;
 #endif
     (*driver->send_keyboard)(report);
+    latency_trace_report();
 
     if (debug_keyboard) {
         dprintf("keyboard_report: %02X | ", report->mods);
@@ -158,6 +165,7 @@ void host_nkro_send(report_nkro_t *report) {
 
     report->report_id = REPORT_ID_NKRO;
     (*driver->send_nkro)(report);
+    latency_trace_report();
 
     if (debug_keyboard) {
         dprintf("nkro_report: %02X | ", report->mods);
@@ -195,6 +203,7 @@ void host_system_send(uint16_t usage) {
         .usage     = usage,
     };
     (*driver->send_extra)(&report);
+    latency_trace_report();
 }
 
 void host_consumer_send(uint16_t usage) {
@@ -209,6 +218,7 @@ void host_consumer_send(uint16_t usage) {
         .usage     = usage,
     };
     (*driver->send_extra)(&report);
+    latency_trace_report();
 }
 
 #ifdef JOYSTICK_ENABLE
@@ -0,0 +1,156 @@
+#!/usr/bin/env python3
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+"""Pulls profiler events from a keyboard over raw HID and writes them out for a flamegraph.
+
+The keyboard needs PROFILER_ENABLE and VIA_ENABLE. The output is either folded
+stacks, for flamegraph.pl or speedscope, or a Chrome trace for Perfetto.
+
+    util/profiler.py --duration 10 --output scan.folded
+    util/profiler.py --format trace --output scan.json
+"""
+import argparse
+import json
+import struct
+import sys
+import time
+from collections import Counter
+
+import hid
+
+RAW_USAGE_PAGE = 0xFF60
+RAW_USAGE_ID = 0x61
+RAW_EPSIZE = 32
+
+ID_CUSTOM_SET_VALUE = 0x07
+ID_CUSTOM_GET_VALUE = 0x08
+ID_UNHANDLED = 0xFF
+ID_QMK_PROFILER_CHANNEL = 8
+ID_QMK_PROFILER_INFO = 1
+ID_QMK_PROFILER_ZONE_NAME = 2
+ID_QMK_PROFILER_EVENTS = 3
+ID_QMK_PROFILER_CLEAR = 4
+
+
+class Profiler:
+    def __init__(self, device):
+        self.device = device
+        self.names = {}
+
+    def command(self, command_id, value_id, data=b''):
+        request = bytes([command_id, ID_QMK_PROFILER_CHANNEL, value_id]) + data
+        self.device.write(b'\x00' + request.ljust(RAW_EPSIZE, b'\x00'))
+        reply = self.device.read(RAW_EPSIZE, 1000)
+        if len(reply) < RAW_EPSIZE or reply[0] == ID_UNHANDLED:
+            raise RuntimeError('The keyboard did not answer the profiler command, is PROFILER_ENABLE set?')
+        return reply[3:]
+
+    def info(self):
+        frequency, zones, dropped = struct.unpack('>IBH', self.command(ID_CUSTOM_GET_VALUE, ID_QMK_PROFILER_INFO)[:7])
+        return frequency, zones, dropped
+
+    def zone_name(self, zone):
+        if zone not in self.names:
+            data = self.command(ID_CUSTOM_GET_VALUE, ID_QMK_PROFILER_ZONE_NAME, bytes([zone]))
+            self.names[zone] = data[1:].split(b'\x00')[0].decode(errors='replace') or f'zone {zone}'
+        return self.names[zone]
+
+    def clear(self):
+        self.command(ID_CUSTOM_SET_VALUE, ID_QMK_PROFILER_CLEAR)
+
+    def events(self):
+        data = self.command(ID_CUSTOM_GET_VALUE, ID_QMK_PROFILER_EVENTS)
+        for i in range(data[0]):
+            timestamp, zone, flags = struct.unpack('>IBB', data[1 + i * 6:7 + i * 6])
+            yield timestamp, zone, flags & 0x7F, bool(flags & 0x80)
+
+
+def open_device(vid, pid):
+    for info in hid.enumerate(vid or 0, pid or 0):
+        if info['usage_page'] == RAW_USAGE_PAGE and info['usage'] == RAW_USAGE_ID:
+            return hid.Device(path=info['path'])
+    raise RuntimeError('No keyboard with a raw HID interface found')
+
+
+def collect(profiler, duration):
+    """Pulls events for a number of seconds, and unwraps the 32-bit timestamps.
+    """
+    events = []
+    last = None
+    offset = 0
+    end = time.monotonic() + duration
+    while time.monotonic() < end:
+        batch = list(profiler.events())
+        if not batch:
+            time.sleep(0.001)
+        for timestamp, zone, depth, is_end in batch:
+            if last is not None and timestamp < last:
+                offset += 1 << 32
+            last = timestamp
+            events.append((timestamp + offset, zone, depth, is_end))
+    return events
+
+
+def build_stacks(profiler, events, frequency):
+    """Matches the begin and end events, and yields (stack, start, self time) in microseconds.
+    """
+    stack = []  # [zone, start, time spent in children]
+    for timestamp, zone, depth, is_end in events:
+        us = timestamp * 1000000 / frequency
+        if not is_end:
+            # events lost to a full buffer leave zones open, drop them
+            del stack[depth:]
+            stack.append([zone, us, 0])
+        elif len(stack) > depth and stack[depth][0] == zone:
+            del stack[depth + 1:]
+            _, start, children = stack.pop()
+            if stack:
+                stack[-1][2] += us - start
+            names = [profiler.zone_name(frame[0]) for frame in stack] + [profiler.zone_name(zone)]
+            yield names, start, us - start - children
+
+
+def write_folded(profiler, events, frequency, output):
+    totals = Counter()
+    for names, _, self_time in build_stacks(profiler, events, frequency):
+        totals[';'.join(names)] += self_time
+    for stack, self_time in sorted(totals.items()):
+        output.write(f'{stack} {round(self_time)}\n')
+
+
+def write_trace(profiler, events, frequency, output):
+    trace = []
+    for timestamp, zone, _, is_end in events:
+        trace.append({
+            'name': profiler.zone_name(zone),
+            'ph': 'E' if is_end else 'B',
+            'ts': timestamp * 1000000 / frequency,
+            'pid': 0,
+            'tid': 0,
+        })
+    json.dump({'traceEvents': trace, 'displayTimeUnit': 'ns'}, output)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--vid', type=lambda x: int(x, 16), help='USB vendor ID of the keyboard, in hex')
+    parser.add_argument('--pid', type=lambda x: int(x, 16), help='USB product ID of the keyboard, in hex')
+    parser.add_argument('--duration', type=float, default=5, help='Seconds to record for (default: 5)')
+    parser.add_argument('--format', choices=['folded', 'trace'], default='folded', help='Output format (default: folded)')
+    parser.add_argument('--output', type=argparse.FileType('w'), default=sys.stdout, help='Output file (default: stdout)')
+    args = parser.parse_args()
+
+    profiler = Profiler(open_device(args.vid, args.pid))
+    profiler.clear()
+    events = collect(profiler, args.duration)
+    frequency, zones, dropped = profiler.info()
+
+    print(f'{len(events)} events from {zones} zones, {dropped} dropped, {frequency} Hz timestamps', file=sys.stderr)
+    if args.format == 'folded':
+        write_folded(profiler, events, frequency, args.output)
+    else:
+        write_trace(profiler, events, frequency, args.output)
+
+
+if __name__ == '__main__':
+    main()